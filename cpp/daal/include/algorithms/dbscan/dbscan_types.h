@@ -54,7 +54,9 @@ const int undefined = -2;
  */
 enum Method
 {
-    defaultDense = 0 /*!< Default: performance-oriented method */
+    defaultDense      = 0, /*!< Default: performance-oriented method */
+    spatialIndexDense = 1  /*!< Method that answers the neighborhood queries through a grid or a k-d tree, its memory usage is linear
+                                in the number of observations. Supported in the batch processing mode only, computed on CPU */
 };
 
 /**
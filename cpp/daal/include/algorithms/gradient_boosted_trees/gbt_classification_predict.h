@@ -162,12 +162,7 @@ public:
 protected:
     virtual Batch<algorithmFPType, method> * cloneImpl() const DAAL_C11_OVERRIDE { return new Batch<algorithmFPType, method>(*this); }
 
-    services::Status allocateResult() DAAL_C11_OVERRIDE
-    {
-        services::Status s = _result->allocate<algorithmFPType>(&input, _par, 0);
-        _res               = _result.get();
-        return s;
-    }
+    services::Status allocateResult() DAAL_C11_OVERRIDE;
 
     void initialize()
     {
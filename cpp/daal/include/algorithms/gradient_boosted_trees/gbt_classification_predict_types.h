@@ -56,6 +56,22 @@ enum Method
     defaultDense = 0 /*!< Default method */
 };
 
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__GBT__CLASSIFICATION__PREDICTION__RESULTTOCOMPUTEID"></a>
+ * \brief Available identifiers to specify the contributions of the features to compute in addition to
+ *        the results of classifier::ResultToComputeId. The contributions are computed for the raw scores of the classes
+ *        and are stored in the prediction table, so they cannot be computed together with the class labels.
+ *        The table has a block of columns per class, or a single block for two classes.
+ */
+enum ResultToComputeId
+{
+    predictionContributions = 0x00000002ULL, /*!< Blocks of p + 1 columns with the contributions of the features (SHAP values)
+                                                  to the raw scores, the last column of a block is the bias */
+    predictionInteractions  = 0x00000004ULL  /*!< Blocks of (p + 1)^2 columns with the (p + 1) x (p + 1) matrices of the contributions
+                                                  of the pairs of the features (SHAP interaction values) to the raw scores,
+                                                  the last row and column of a matrix stand for the bias */
+};
+
 /**
  * \brief Contains version 2.0 of the Intel(R) oneAPI Data Analytics Library interface.
  */
@@ -70,9 +86,10 @@ namespace interface2
 /* [Parameter source code] */
 struct DAAL_EXPORT Parameter : public daal::algorithms::classifier::Parameter
 {
-    Parameter(size_t nClasses = 2) : daal::algorithms::classifier::Parameter(nClasses), nIterations(0) {}
-    Parameter(const Parameter & o) : daal::algorithms::classifier::Parameter(o), nIterations(o.nIterations) {}
-    size_t nIterations; /*!< Number of iterations of the trained model to be used for prediction */
+    Parameter(size_t nClasses = 2) : daal::algorithms::classifier::Parameter(nClasses), nIterations(0), resultsToCompute(0) {}
+    Parameter(const Parameter & o) : daal::algorithms::classifier::Parameter(o), nIterations(o.nIterations), resultsToCompute(o.resultsToCompute) {}
+    size_t nIterations;           /*!< Number of iterations of the trained model to be used for prediction */
+    DAAL_UINT64 resultsToCompute; /*!< 64 bit integer flag that indicates the contributions to compute, \ref ResultToComputeId */
 };
 /* [Parameter source code] */
 } // namespace interface2
@@ -90,6 +90,21 @@ enum ResultId
     lastResultId = prediction
 };
 
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__GBT__REGRESSSION__PREDICTION__RESULTTOCOMPUTEID"></a>
+ * \brief Available identifiers to specify the result of model-based prediction to compute,
+ *        the result is stored in the prediction table, only one of them can be computed at once
+ */
+enum ResultToComputeId
+{
+    predictionResult        = 0x00000001ULL, /*!< Numeric table of size n x 1 with the predicted responses */
+    predictionContributions = 0x00000002ULL, /*!< Numeric table of size n x (p + 1) with the contributions of the features (SHAP values)
+                                                  to the predicted responses, the last column is the bias */
+    predictionInteractions  = 0x00000004ULL  /*!< Numeric table of size n x (p + 1)^2 with the (p + 1) x (p + 1) matrices of the contributions
+                                                  of the pairs of the features (SHAP interaction values), the last row and column
+                                                  stand for the bias */
+};
+
 /**
  * \brief Contains version 1.0 of the Intel(R) oneAPI Data Analytics Library interface
  */
@@ -104,9 +119,10 @@ namespace interface1
 /* [Parameter source code] */
 struct DAAL_EXPORT Parameter : public daal::algorithms::Parameter
 {
-    Parameter() : daal::algorithms::Parameter(), nIterations(0) {}
-    Parameter(const Parameter & o) : daal::algorithms::Parameter(o), nIterations(o.nIterations) {}
-    size_t nIterations; /*!< Number of iterations of the trained model to be uses for prediction*/
+    Parameter() : daal::algorithms::Parameter(), nIterations(0), resultsToCompute(predictionResult) {}
+    Parameter(const Parameter & o) : daal::algorithms::Parameter(o), nIterations(o.nIterations), resultsToCompute(o.resultsToCompute) {}
+    size_t nIterations;           /*!< Number of iterations of the trained model to be uses for prediction*/
+    DAAL_UINT64 resultsToCompute; /*!< 64 bit integer flag that indicates the result to compute, \ref ResultToComputeId */
 };
 /* [Parameter source code] */
 
@@ -50,7 +50,8 @@ enum Method
 {
     lloydDense   = 0, /*!< Default: performance-oriented method, synonym of defaultDense */
     defaultDense = 0, /*!< Default: performance-oriented method, synonym of lloydDense */
-    lloydCSR     = 1  /*!< Implementation of the Lloyd algorithm for CSR numeric tables */
+    lloydCSR     = 1, /*!< Implementation of the Lloyd algorithm for CSR numeric tables */
+    hamerlyDense = 2  /*!< Lloyd algorithm for dense data accelerated with Hamerly distance bounds */
 };
 
 /**
@@ -178,6 +179,25 @@ public:
     services::Status check(const daal::algorithms::Parameter * par, int method) const DAAL_C11_OVERRIDE;
 };
 
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__KMEANS__ONLINEINPUT"></a>
+ * \brief %Input objects for K-Means algorithm in the online processing mode.
+ *        Initial centroids are required only for the first block of data
+ */
+class DAAL_EXPORT OnlineInput : public Input
+{
+public:
+    OnlineInput() {}
+    virtual ~OnlineInput() {}
+
+    /**
+     * Checks input objects for K-Means algorithm in the online processing mode
+     * \param[in] par     Algorithm parameter
+     * \param[in] method  Computation method of the algorithm
+     */
+    services::Status check(const daal::algorithms::Parameter * par, int method) const DAAL_C11_OVERRIDE;
+};
+
 /**
  * <a name="DAAL-CLASS-ALGORITHMS__KMEANS__PARTIALRESULT"></a>
  * \brief Partial results obtained with the compute() method of K-Means algorithm in the batch processing mode
@@ -199,6 +219,16 @@ public:
     template <typename algorithmFPType>
     DAAL_EXPORT services::Status allocate(const daal::algorithms::Input * input, const daal::algorithms::Parameter * parameter, const int method);
 
+    /**
+     * Initializes partial results of K-Means algorithm in the online processing mode:
+     * sets the current centroids to the initial centroids and the number of observations to zero
+     * \param[in] input        Pointer to the structure of the input objects
+     * \param[in] parameter    Pointer to the structure of the algorithm parameters
+     * \param[in] method       Computation method of the algorithm
+     */
+    template <typename algorithmFPType>
+    DAAL_EXPORT services::Status initialize(const daal::algorithms::Input * input, const daal::algorithms::Parameter * parameter, const int method);
+
     /**
      * Returns a partial result of K-Means algorithm
      * \param[in] id   Identifier of the partial result
@@ -412,6 +442,7 @@ struct DAAL_EXPORT Parameter : public daal::algorithms::Parameter
 using interface2::Parameter;
 using interface1::InputIface;
 using interface1::Input;
+using interface1::OnlineInput;
 using interface1::PartialResult;
 using interface1::PartialResultPtr;
 using interface1::Result;
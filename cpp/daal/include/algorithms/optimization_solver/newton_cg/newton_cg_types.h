@@ -0,0 +1,194 @@
+/* file: newton_cg_types.h */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the Newton conjugate gradient algorithm types.
+//--
+*/
+
+#ifndef __NEWTON_CG_TYPES_H__
+#define __NEWTON_CG_TYPES_H__
+
+#include "data_management/data/numeric_table.h"
+#include "data_management/data/homogen_numeric_table.h"
+#include "services/daal_defines.h"
+#include "algorithms/optimization_solver/iterative_solver/iterative_solver_types.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace optimization_solver
+{
+/**
+ * @defgroup newton_cg Newton Conjugate Gradient Algorithm
+ * \copydoc daal::algorithms::optimization_solver::newton_cg
+ * @ingroup optimization_solver
+ * @{
+ */
+/**
+ * \brief Contains classes for computing the Newton conjugate gradient (truncated Newton) algorithm
+ */
+namespace newton_cg
+{
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__OPTIMIZATION_SOLVER__NEWTON_CG__METHOD"></a>
+ * Available methods for computing the Newton conjugate gradient algorithm
+ */
+enum Method
+{
+    defaultDense = 0 /*!< Default: performance-oriented method */
+};
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__OPTIMIZATION_SOLVER__NEWTON_CG__GLOBALIZATION"></a>
+ * Available strategies that make the Newton conjugate gradient algorithm converge from any starting point
+ */
+enum Globalization
+{
+    trustRegion = 0, /*!< Default: the step is restricted by the trust region, the radius of the region is updated on every iteration */
+    lineSearch  = 1  /*!< The step length is chosen by the backtracking line search with the sufficient decrease condition */
+};
+
+/**
+ * \brief Contains version 1.0 of the Intel(R) oneAPI Data Analytics Library interface.
+ */
+namespace interface1
+{
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__OPTIMIZATION_SOLVER__NEWTON_CG__PARAMETER"></a>
+ * \brief %Parameter base class for the Newton conjugate gradient algorithm
+ *
+ * \snippet optimization_solver/newton_cg/newton_cg_types.h Parameter source code
+ */
+/* [Parameter source code] */
+struct DAAL_EXPORT Parameter : public optimization_solver::iterative_solver::Parameter
+{
+    /**
+     * Constructs the parameter base class of the Newton conjugate gradient algorithm
+     * \param[in] function             Objective function represented as sum of functions.
+     *                                 The L1 penalty of the function must be zero, the objective function must be twice differentiable
+     * \param[in] nIterations          Maximal number of iterations of the algorithm
+     * \param[in] accuracyThreshold    Accuracy of the algorithm. The algorithm terminates when the norm of the gradient
+     *                                 is not greater than accuracyThreshold * max(1, norm of the argument)
+     * \param[in] nInnerIterations     Maximal number of conjugate gradient iterations that compute one Newton step
+     * \param[in] globalization        Strategy that makes the algorithm converge from any starting point
+     */
+    Parameter(const sum_of_functions::BatchPtr & function, size_t nIterations = 100, double accuracyThreshold = 1.0e-05,
+              size_t nInnerIterations = 200, Globalization globalization = trustRegion);
+
+    virtual ~Parameter() {}
+
+    /**
+     * Checks the correctness of the parameter.
+     * Objective functions with the non-zero L1 penalty are rejected with ErrorIncorrectParameter
+     *
+     * \return Status of computations
+     */
+    virtual services::Status check() const DAAL_C11_OVERRIDE;
+
+    size_t nInnerIterations;     /*!< Maximal number of conjugate gradient iterations that compute one Newton step */
+    Globalization globalization; /*!< Strategy that makes the algorithm converge from any starting point */
+    double trustRegionRadius;    /*!< Initial radius of the trust region */
+};
+/* [Parameter source code] */
+
+/**
+* <a name="DAAL-CLASS-ALGORITHMS__OPTIMIZATION_SOLVER__NEWTON_CG__INPUT"></a>
+* \brief %Input class for the Newton conjugate gradient algorithm
+*
+* \snippet optimization_solver/newton_cg/newton_cg_types.h Input source code
+*/
+/* [Input source code] */
+class DAAL_EXPORT Input : public optimization_solver::iterative_solver::Input
+{
+private:
+    typedef optimization_solver::iterative_solver::Input super;
+
+public:
+    Input();
+    Input(const Input & other);
+
+    using super::set;
+    using super::get;
+
+    /**
+    * Checks the correctness of the input
+    * \param[in] par       Pointer to the structure of the algorithm parameters
+    * \param[in] method    Computation method
+    *
+    * \return Status of computations
+    */
+    virtual services::Status check(const daal::algorithms::Parameter * par, int method) const DAAL_C11_OVERRIDE;
+};
+/* [Input source code] */
+
+/**
+* <a name="DAAL-CLASS-ALGORITHMS__OPTIMIZATION_SOLVER__NEWTON_CG__RESULT"></a>
+* \brief Results obtained with the compute() method of the Newton conjugate gradient algorithm in the batch processing mode
+*/
+class DAAL_EXPORT Result : public optimization_solver::iterative_solver::Result
+{
+public:
+    DECLARE_SERIALIZABLE_CAST(Result)
+    typedef optimization_solver::iterative_solver::Result super;
+
+    Result() {}
+    using super::set;
+    using super::get;
+
+    /**
+    * Allocates memory to store the results of the iterative solver algorithm
+    * \param[in] input  Pointer to the input structure
+    * \param[in] par    Pointer to the parameter structure
+    * \param[in] method Computation method of the algorithm
+    *
+    * \return Status of computations
+    */
+    template <typename algorithmFPType>
+    DAAL_EXPORT services::Status allocate(const daal::algorithms::Input * input, const daal::algorithms::Parameter * par, const int method);
+
+    /**
+    * Checks the result of the iterative solver algorithm
+    * \param[in] input   %Input of algorithm
+    * \param[in] par     %Parameter of algorithm
+    * \param[in] method  Computation method of the algorithm
+    *
+    * \return Status of computations
+    */
+    virtual services::Status check(const daal::algorithms::Input * input, const daal::algorithms::Parameter * par,
+                                   int method) const DAAL_C11_OVERRIDE;
+
+protected:
+    using daal::algorithms::interface1::Result::check;
+};
+typedef services::SharedPtr<Result> ResultPtr;
+/* [Result source code] */
+
+/** @} */
+} // namespace interface1
+using interface1::Parameter;
+using interface1::Input;
+using interface1::Result;
+using interface1::ResultPtr;
+
+} // namespace newton_cg
+} // namespace optimization_solver
+} // namespace algorithms
+} // namespace daal
+#endif
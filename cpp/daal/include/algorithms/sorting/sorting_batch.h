@@ -160,8 +160,119 @@ private:
 };
 /** @} */
 } // namespace interface1
+
+/**
+ * \brief Contains version 2.0 of Intel(R) oneAPI Data Analytics Library interface.
+ */
+namespace interface2
+{
+/**
+ * @ingroup sorting_batch
+ * @{
+ */
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__SORTING__BATCH"></a>
+ * \brief Sorts the datasets by components of the random vector in the batch processing mode.
+ * <!-- \n<a href="DAAL-REF-SORTING-ALGORITHM">Sorting algorithm description and usage models</a> -->
+ *
+ * \tparam algorithmFPType  Data type to use in intermediate computations for the sorting, double or float
+ * \tparam method           Sorting computation method, \ref daal::algorithms::sorting::Method
+ *
+ * \par Enumerations
+ *      - \ref Method      Sorting computation methods
+ *      - \ref SortingMode Sorting modes
+ *      - \ref SortOrder   Orders of the sorted values
+ *      - \ref InputId     Identifiers of sorting input objects
+ *      - \ref ResultId    Identifiers of sorting results
+ */
+template <typename algorithmFPType = DAAL_ALGORITHM_FP_TYPE, Method method = defaultDense>
+class DAAL_EXPORT Batch : public daal::algorithms::Analysis<batch>
+{
+public:
+    typedef algorithms::sorting::Input InputType;
+    typedef algorithms::sorting::Parameter ParameterType;
+    typedef algorithms::sorting::Result ResultType;
+
+    InputType input;         /*!< %input data structure */
+    ParameterType parameter; /*!< Sorting parameters structure */
+
+    /** Default constructor     */
+    Batch() { initialize(); }
+
+    /**
+     * Constructs sorting algorithm with the specified parameters
+     * \param[in] parameter Parameters of the sorting algorithm
+     */
+    Batch(const ParameterType & parameter) : parameter(parameter) { initialize(); }
+
+    /**
+     * Constructs sorting algorithm by copying input objects and parameters
+     * of another sorting algorithm
+     * \param[in] other An algorithm to be used as the source to initialize the input objects
+     *                  and parameters of the algorithm
+     */
+    Batch(const Batch<algorithmFPType, method> & other) : input(other.input), parameter(other.parameter) { initialize(); }
+
+    ~Batch() DAAL_C11_OVERRIDE {}
+
+    /**
+    * Returns method of the algorithm
+    * \return Method of the algorithm
+    */
+    virtual int getMethod() const DAAL_C11_OVERRIDE { return (int)method; }
+
+    /**
+     * Returns the structure that contains computed results of the sorting
+     * \return Structure that contains computed results of the sorting
+     */
+    ResultPtr getResult() { return _result; }
+
+    /**
+     * Registers user-allocated memory to store results of the sorting algorithms
+     * \param[in] result Structure to store results of the sorting algorithms
+     */
+    services::Status setResult(const ResultPtr & result)
+    {
+        DAAL_CHECK(result, services::ErrorNullResult)
+        _result = result;
+        _res    = _result.get();
+        return services::Status();
+    }
+
+    /**
+     * Returns a pointer to the newly allocated sorting algorithm
+     * with a copy of input objects and parameters of this sorting algorithm
+     * \return Pointer to the newly allocated algorithm
+     */
+    services::SharedPtr<Batch<algorithmFPType, method> > clone() const { return services::SharedPtr<Batch<algorithmFPType, method> >(cloneImpl()); }
+
+protected:
+    virtual Batch<algorithmFPType, method> * cloneImpl() const DAAL_C11_OVERRIDE { return new Batch<algorithmFPType, method>(*this); }
+
+    virtual services::Status allocateResult() DAAL_C11_OVERRIDE
+    {
+        services::Status s = _result->allocate<algorithmFPType>(&input, &parameter, method);
+        _res               = _result.get();
+        return s;
+    }
+
+    void initialize()
+    {
+        Analysis<batch>::_ac = new __DAAL_ALGORITHM_CONTAINER(batch, interface1::BatchContainer, algorithmFPType, method)(&_env);
+        _in                  = &input;
+        _par                 = &parameter;
+        _result.reset(new ResultType());
+    }
+
+    ResultPtr _result;
+
+private:
+    Batch & operator=(const Batch &);
+};
+/** @} */
+} // namespace interface2
 using interface1::BatchContainer;
-using interface1::Batch;
+using interface2::Batch;
 
 } // namespace sorting
 } // namespace algorithms
@@ -50,6 +50,37 @@ enum Method
     defaultDense = 0 /*!< Default: radix method for sorting a data set */
 };
 
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__SORTING__SORTINGMODE"></a>
+ * Available modes of the sorting algorithm
+ */
+enum SortingMode
+{
+    sortColumns = 0, /*!< Default: every column of the data set is sorted independently */
+    sortRows    = 1, /*!< Observations of the data set are sorted by the values of the key columns */
+    selectTopK  = 2  /*!< The first k values of every column in the sort order are selected */
+};
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__SORTING__SORTORDER"></a>
+ * Available orders of the sorting algorithm
+ */
+enum SortOrder
+{
+    ascending  = 0, /*!< Default: values are sorted in the ascending order */
+    descending = 1  /*!< Values are sorted in the descending order */
+};
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__SORTING__RESULTTOCOMPUTEID"></a>
+ * Available identifiers to specify the result to compute
+ */
+enum ResultToComputeId
+{
+    computeSortedData    = 0x00000001ULL, /*!< Compute table containing sorted values */
+    computeSortedIndices = 0x00000002ULL  /*!< Compute table containing indices of the sorted values in the input data set */
+};
+
 /**
  * <a name="DAAL-ENUM-ALGORITHMS__SORTING__INPUTID"></a>
  * Available identifiers of input objects for the sorting algorithm
@@ -66,8 +97,9 @@ enum InputId
  */
 enum ResultId
 {
-    sortedData, /*!< observation sorting results */
-    lastResultId = sortedData
+    sortedData,    /*!< observation sorting results */
+    sortedIndices, /*!< indices of the sorted observations in the input data set */
+    lastResultId = sortedIndices
 };
 
 /**
@@ -106,7 +138,7 @@ public:
      * \param[in] method    Algorithm computation method
      * \param[in] par       Pointer to the parameters of the algorithm
      */
-    virtual services::Status check(const Parameter * par, int method) const DAAL_C11_OVERRIDE;
+    virtual services::Status check(const daal::algorithms::Parameter * par, int method) const DAAL_C11_OVERRIDE;
 };
 
 /**
@@ -130,6 +162,15 @@ public:
     template <typename algorithmFPType>
     DAAL_EXPORT services::Status allocate(const daal::algorithms::Input * input, const int method);
 
+    /**
+     * Allocates memory to store final results of the sorting algorithms
+     * \param[in] input     Input objects for the sorting algorithm
+     * \param[in] par       %Parameter of the sorting algorithm
+     * \param[in] method    Algorithm computation method
+     */
+    template <typename algorithmFPType>
+    DAAL_EXPORT services::Status allocate(const daal::algorithms::Input * input, const daal::algorithms::Parameter * par, const int method);
+
     /**
      * Returns the final result of the sorting algorithm
      * \param[in] id   Identifier of the final result, \ref ResultId
@@ -150,7 +191,7 @@ public:
      * \param[in] par     %Parameter of algorithm
      * \param[in] method Algorithm computation method
      */
-    virtual services::Status check(const daal::algorithms::Input * in, const Parameter * par, int method) const DAAL_C11_OVERRIDE;
+    virtual services::Status check(const daal::algorithms::Input * in, const daal::algorithms::Parameter * par, int method) const DAAL_C11_OVERRIDE;
 
 protected:
     using daal::algorithms::interface1::Result::check;
@@ -166,6 +207,35 @@ typedef services::SharedPtr<Result> ResultPtr;
 
 /** @} */
 } // namespace interface1
+
+/**
+ * \brief Contains version 2.0 of Intel(R) oneAPI Data Analytics Library interface.
+ */
+namespace interface2
+{
+/**
+ * <a name="DAAL-STRUCT-ALGORITHMS__SORTING__PARAMETER"></a>
+ * \brief Parameters of the sorting algorithm
+ */
+struct DAAL_EXPORT Parameter : public daal::algorithms::Parameter
+{
+    Parameter(SortingMode mode = sortColumns, SortOrder order = ascending, size_t k = 1, DAAL_UINT64 resultsToCompute = computeSortedData);
+
+    SortingMode mode;                        /*!< Mode of the sorting algorithm */
+    SortOrder order;                         /*!< Order of the sorted values */
+    size_t k;                                /*!< Number of values selected from every column in the selectTopK mode */
+    services::Collection<size_t> keyColumns; /*!< Indices of the key columns in the sortRows mode, the first key is the most significant one.
+                                                  Rows with equal keys keep their order in the input data set */
+    DAAL_UINT64 resultsToCompute;            /*!< 64 bit integer flag that indicates the results to compute */
+
+    /**
+     * Checks the correctness of the parameter
+     */
+    services::Status check() const DAAL_C11_OVERRIDE;
+};
+
+} // namespace interface2
+using interface2::Parameter;
 using interface1::Input;
 using interface1::Result;
 using interface1::ResultPtr;
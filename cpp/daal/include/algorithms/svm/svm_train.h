@@ -189,8 +189,137 @@ private:
 };
 /** @} */
 } // namespace interface2
+
+/**
+ * \brief Contains version 3.0 of Intel(R) oneAPI Data Analytics Library interface.
+ */
+namespace interface3
+{
+/**
+ * @ingroup svm_training_batch
+ * @{
+ */
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__SVM__TRAINING__BATCH"></a>
+ *  \brief %Algorithm class to train the SVM model
+ *  <!-- \n<a href="DAAL-REF-SVM-ALGORITHM">SVM algorithm description and usage models</a> -->
+ *
+ *  \tparam algorithmFPType  Data type to use in intermediate computations for the SVM training algorithm, double or float
+ *  \tparam method           SVM training method, \ref Method
+ *
+ *  \par Enumerations
+ *      - \ref classifier::training::InputId Identifiers of SVM training input objects
+ *      - \ref classifier::training::ResultId Identifiers of SVM training results
+ *      - \ref ResultNumericTableId Identifiers of the optional SVM training results
+ *      - \ref ResultToComputeId Identifiers of the optional SVM training results to compute
+ *      - \ref Method   SVM training methods
+ *
+ * \par References
+ *      - \ref interface1::Input "Input" class
+ *      - \ref interface1::Model "Model" class
+ */
+template <typename algorithmFPType = DAAL_ALGORITHM_FP_TYPE, Method method = boser>
+class DAAL_EXPORT Batch : public classifier::training::Batch
+{
+public:
+    typedef classifier::training::Batch super;
+
+    typedef typename super::InputType InputType;
+    typedef algorithms::svm::training::Parameter ParameterType;
+    typedef algorithms::svm::training::Result ResultType;
+
+    ParameterType parameter; /*!< \ref interface3::Parameter "Parameters" of the algorithm */
+    InputType input;         /*!< %Input objects of the algorithm */
+
+    /** Default constructor */
+    Batch() { initialize(); };
+
+    /**
+     * Constructs an SVM training algorithm with nClasses parameter
+     * \param[in] nClasses   number of classes
+    */
+    Batch(size_t nClasses)
+    {
+        parameter.nClasses = nClasses;
+        initialize();
+    }
+
+    /**
+     * Constructs an SVM training algorithm by copying input objects and parameters
+     * of another SVM training algorithm
+     * \param[in] other An algorithm to be used as the source to initialize the input objects
+     *                  and parameters of the algorithm
+     */
+    Batch(const Batch<algorithmFPType, method> & other) : classifier::training::Batch(other), parameter(other.parameter), input(other.input)
+    {
+        initialize();
+    }
+
+    virtual ~Batch() {}
+
+    /**
+     * Get input objects for the SVM training algorithm
+     * \return %Input objects for the SVM training algorithm
+     */
+    InputType * getInput() DAAL_C11_OVERRIDE { return &input; }
+
+    /**
+     * Returns method of the algorithm
+     * \return Method of the algorithm
+     */
+    virtual int getMethod() const DAAL_C11_OVERRIDE { return (int)method; }
+
+    /**
+     * Returns structure that contains computed results of the SVM training algorithm
+     * \return Structure that contains computed results of the SVM training algorithm
+     */
+    ResultPtr getResult() { return ResultType::cast(_result); }
+
+    /**
+     * Resets the training results of the classification algorithm
+     */
+    services::Status resetResult() DAAL_C11_OVERRIDE
+    {
+        _result.reset(new ResultType());
+        DAAL_CHECK(_result, services::ErrorNullResult);
+        _res = NULL;
+        return services::Status();
+    }
+
+    /**
+     * Returns a pointer to the newly allocated SVM training algorithm with a copy of input objects
+     * and parameters of this SVM training algorithm
+     * \return Pointer to the newly allocated algorithm
+     */
+    services::SharedPtr<Batch<algorithmFPType, method> > clone() const { return services::SharedPtr<Batch<algorithmFPType, method> >(cloneImpl()); }
+
+protected:
+    virtual Batch<algorithmFPType, method> * cloneImpl() const DAAL_C11_OVERRIDE { return new Batch<algorithmFPType, method>(*this); }
+
+    services::Status allocateResult() DAAL_C11_OVERRIDE
+    {
+        ResultPtr res = getResult();
+        DAAL_CHECK(res, services::ErrorNullResult);
+        services::Status s = res->template allocate<algorithmFPType>(&input, _par, (int)method);
+        _res               = _result.get();
+        return s;
+    }
+
+    void initialize()
+    {
+        _ac  = new __DAAL_ALGORITHM_CONTAINER(batch, interface2::BatchContainer, algorithmFPType, method)(&_env);
+        _in  = &input;
+        _par = &parameter;
+        _result.reset(new ResultType());
+    }
+
+private:
+    Batch & operator=(const Batch &);
+};
+/** @} */
+} // namespace interface3
 using interface2::BatchContainer;
-using interface2::Batch;
+using interface3::Batch;
 
 } // namespace training
 } // namespace svm
@@ -57,6 +57,60 @@ enum Method
     thunder      = 1  /*!< Method proposed by ThunderSVM. */
 };
 
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__SVM__TRAINING__RESULT_TO_COMPUTE_ID"></a>
+ * Available identifiers of the optional results of the SVM training algorithm
+ */
+enum ResultToComputeId
+{
+    computeCacheStatistics = 0x00000001ULL /*!< Compute the statistics of the kernel matrix cache */
+};
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__SVM__TRAINING__RESULT_NUMERIC_TABLE_ID"></a>
+ * Available identifiers of the optional results of the SVM training algorithm
+ */
+enum ResultNumericTableId
+{
+    cacheStatistics = classifier::training::lastResultId + 1, /*!< Table of size 1 x 3 with the numbers of the kernel matrix rows found in the cache,
+                                                                   computed on request and excluded from the cache by the thunder method */
+    lastResultNumericTableId = cacheStatistics
+};
+
+/**
+ * \brief Contains version 3.0 of Intel(R) oneAPI Data Analytics Library interface.
+ */
+namespace interface3
+{
+/**
+ * <a name="DAAL-STRUCT-ALGORITHMS__SVM__TRAINING__PARAMETER"></a>
+ * \brief Parameters of the SVM training algorithm
+ *
+ * \snippet svm/svm_train_types.h Parameter source code
+ */
+/* [Parameter source code] */
+struct DAAL_EXPORT Parameter : public svm::interface2::Parameter
+{
+    Parameter(const services::SharedPtr<kernel_function::KernelIface> & kernelForParameter =
+                  services::SharedPtr<kernel_function::KernelIface>(new kernel_function::linear::Batch<>()),
+              double C = 1.0, double accuracyThreshold = 0.001, double tau = 1.0e-6, size_t maxIterations = 1000000, size_t cacheSize = 8000000,
+              bool doShrinking = true, size_t shrinkingStep = 1000, DAAL_UINT64 resultsToCompute = 0, bool doThunderShrinking = false,
+              size_t thunderShrinkingStep = 1000)
+        : svm::interface2::Parameter(kernelForParameter, C, accuracyThreshold, tau, maxIterations, cacheSize, doShrinking, shrinkingStep),
+          resultsToCompute(resultsToCompute),
+          doThunderShrinking(doThunderShrinking),
+          thunderShrinkingStep(thunderShrinkingStep) {};
+
+    DAAL_UINT64 resultsToCompute; /*!< 64 bit integer flag that indicates the optional results to compute, \ref ResultToComputeId */
+    bool doThunderShrinking;      /*!< Flag that enables use of the shrinking optimization technique in the thunder method.
+                                       doShrinking applies to the boser method only */
+    size_t thunderShrinkingStep;  /*!< Number of iterations of the thunder method between the steps of shrinking optimization technique */
+
+    services::Status check() const DAAL_C11_OVERRIDE;
+};
+/* [Parameter source code] */
+} // namespace interface3
+
 /**
  * \brief Contains version 1.0 of Intel(R) oneAPI Data Analytics Library interface.
  */
@@ -75,6 +129,8 @@ public:
 
     virtual ~Result() {}
 
+    using classifier::training::Result::set;
+
     /**
      * Returns the model trained with the SVM algorithm
      * \param[in] id    Identifier of the result, \ref classifier::training::ResultId
@@ -82,6 +138,20 @@ public:
      */
     daal::algorithms::svm::ModelPtr get(classifier::training::ResultId id) const;
 
+    /**
+     * Returns the optional result of the SVM training algorithm
+     * \param[in] id    Identifier of the result, \ref ResultNumericTableId
+     * \return          Result that corresponds to the given identifier
+     */
+    data_management::NumericTablePtr get(ResultNumericTableId id) const;
+
+    /**
+     * Sets the optional result of the SVM training algorithm
+     * \param[in] id      Identifier of the result, \ref ResultNumericTableId
+     * \param[in] value   Result
+     */
+    void set(ResultNumericTableId id, const data_management::NumericTablePtr & value);
+
     /**
      * Allocates memory for storing SVM training results
      * \param[in] input     Pointer to input structure
@@ -108,6 +178,7 @@ protected:
 typedef services::SharedPtr<Result> ResultPtr;
 
 } // namespace interface1
+using interface3::Parameter;
 using interface1::Result;
 using interface1::ResultPtr;
 
@@ -987,6 +987,24 @@ public:
      */
     const DataArchive & getDataArchive() { return *static_cast<DataArchive *>(_arch); }
 
+    /**
+     *  Returns the major version of the library the object is serialized for
+     *  \return Version of the library
+     */
+    int getMajorVersion() const { return _arch->getMajorVersion(); }
+
+    /**
+     *  Returns the minor version of the library the object is serialized for
+     *  \return Version of the library
+     */
+    int getMinorVersion() const { return _arch->getMinorVersion(); }
+
+    /**
+     *  Returns the update version of the library the object is serialized for
+     *  \return Version of the library
+     */
+    int getUpdateVersion() const { return _arch->getUpdateVersion(); }
+
     /**
     * Returns errors during the computation
     * \return Errors during the computation
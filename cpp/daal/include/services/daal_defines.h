@@ -327,7 +327,8 @@ const int SERIALIZATION_QR_ONLINE_PARTIAL_RESULT_ID            = 102410;
 const int SERIALIZATION_QR_DISTRIBUTED_PARTIAL_RESULT_ID       = 102420;
 const int SERIALIZATION_QR_DISTRIBUTED_PARTIAL_RESULT_STEP3_ID = 102430;
 
-const int SERIALIZATION_QUANTILES_RESULT_ID = 102500;
+const int SERIALIZATION_QUANTILES_RESULT_ID         = 102500;
+const int SERIALIZATION_QUANTILES_PARTIAL_RESULT_ID = 102510;
 
 const int SERIALIZATION_WEAK_LEARNER_RESULT_ID = 102600;
 
@@ -354,6 +355,7 @@ const int SERIALIZATION_LBFGS_RESULT_ID              = 103830;
 const int SERIALIZATION_SGD_RESULT_ID                = 103840;
 const int SERIALIZATION_SAGA_RESULT_ID               = 103850;
 const int SERIALIZATION_COORDINATE_DESCENT_RESULT_ID = 103860;
+const int SERIALIZATION_NEWTON_CG_RESULT_ID          = 103870;
 
 const int SERIALIZATION_NORMALIZATION_ZSCORE_RESULT_ID = 103900;
 const int SERIALIZATION_NORMALIZATION_MINMAX_RESULT_ID = 103910;
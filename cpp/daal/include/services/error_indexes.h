@@ -375,6 +375,8 @@ enum ErrorID
     // GBT error: -30000..-30099
     ErrorGbtIncorrectNumberOfTrees             = -30000, /*!< Number of trees in the model is not consistent with the number of classes */
     ErrorGbtPredictIncorrectNumberOfIterations = -30001, /*!< Number of iterations value in GBT parameter is not consistent with the model */
+    ErrorGbtPredictShapOptionsNotSupported     = -30002, /*!< Requested combination of the GBT prediction results is not supported */
+    ErrorGbtPredictShapNoNodeCover             = -30003, /*!< Feature contributions require the node sample counts the model does not have */
 
     // Data management errors:  -80001..
     ErrorUserAllocatedMemory = -80001, /*!< Couldn't free memory allocated by user */
@@ -125,81 +125,6 @@ Status DBSCANBatchKernel<algorithmFPType, method, cpu>::processNeighborhoodParal
     return safeStat.detach();
 }
 
-template <typename algorithmFPType, Method method, CpuType cpu>
-Status DBSCANBatchKernel<algorithmFPType, method, cpu>::processResultsToCompute(DAAL_UINT64 resultsToCompute, int * const isCore,
-                                                                                const NumericTable * ntData, NumericTable * ntCoreIndices,
-                                                                                NumericTable * ntCoreObservations)
-{
-    const size_t nRows     = ntData->getNumberOfRows();
-    const size_t nFeatures = ntData->getNumberOfColumns();
-
-    size_t nCoreObservations = 0;
-
-    for (size_t i = 0; i < nRows; i++)
-    {
-        if (!isCore[i])
-        {
-            continue;
-        }
-        nCoreObservations++;
-    }
-
-    if (nCoreObservations == 0)
-    {
-        return Status();
-    }
-
-    if (resultsToCompute & computeCoreIndices)
-    {
-        DAAL_CHECK_STATUS_VAR(ntCoreIndices->resize(nCoreObservations));
-        WriteRows<int, cpu> coreIndicesRows(ntCoreIndices, 0, nCoreObservations);
-        DAAL_CHECK_BLOCK_STATUS(coreIndicesRows);
-        int * const coreIndices = coreIndicesRows.get();
-
-        size_t pos = 0;
-        for (size_t i = 0; i < nRows; i++)
-        {
-            if (!isCore[i])
-            {
-                continue;
-            }
-            coreIndices[pos] = i;
-            pos++;
-        }
-    }
-
-    if (resultsToCompute & computeCoreObservations)
-    {
-        DAAL_CHECK_STATUS_VAR(ntCoreObservations->resize(nCoreObservations));
-        WriteRows<algorithmFPType, cpu> coreObservationsRows(ntCoreObservations, 0, nCoreObservations);
-        DAAL_CHECK_BLOCK_STATUS(coreObservationsRows);
-        algorithmFPType * const coreObservations = coreObservationsRows.get();
-
-        size_t pos = 0;
-        int result = 0;
-        for (size_t i = 0; i < nRows; i++)
-        {
-            if (!isCore[i])
-            {
-                continue;
-            }
-            ReadRows<algorithmFPType, cpu> dataRows(const_cast<NumericTable *>(ntData), i, 1);
-            DAAL_CHECK_BLOCK_STATUS(dataRows);
-            const algorithmFPType * const data = dataRows.get();
-
-            result |= daal::services::internal::daal_memcpy_s(&(coreObservations[pos * nFeatures]), sizeof(algorithmFPType) * nFeatures, data,
-                                                              sizeof(algorithmFPType) * nFeatures);
-            pos++;
-        }
-        if (result)
-        {
-            return Status(services::ErrorMemoryCopyFailedInternal);
-        }
-    }
-
-    return Status();
-}
-
 template <typename algorithmFPType, Method method, CpuType cpu>
 Status DBSCANBatchKernel<algorithmFPType, method, cpu>::computeNoMemSave(const NumericTable * ntData, const NumericTable * ntWeights,
                                                                          NumericTable * ntAssignments, NumericTable * ntNClusters,
@@ -263,7 +188,8 @@ Status DBSCANBatchKernel<algorithmFPType, method, cpu>::computeNoMemSave(const N
 
     if (par->resultsToCompute & (computeCoreIndices | computeCoreObservations))
     {
-        DAAL_CHECK_STATUS_VAR(processResultsToCompute(par->resultsToCompute, isCore, ntData, ntCoreIndices, ntCoreObservations));
+        DAAL_CHECK_STATUS_VAR(
+            (processResultsToCompute<algorithmFPType, cpu>(par->resultsToCompute, isCore, ntData, ntCoreIndices, ntCoreObservations)));
     }
 
     const size_t nBlocks   = neighs.size();
@@ -378,7 +304,8 @@ Status DBSCANBatchKernel<algorithmFPType, method, cpu>::computeMemSave(const Num
 
     if (par->resultsToCompute & (computeCoreIndices | computeCoreObservations))
     {
-        DAAL_CHECK_STATUS_VAR(processResultsToCompute(par->resultsToCompute, isCore, ntData, ntCoreIndices, ntCoreObservations));
+        DAAL_CHECK_STATUS_VAR(
+            (processResultsToCompute<algorithmFPType, cpu>(par->resultsToCompute, isCore, ntData, ntCoreIndices, ntCoreObservations)));
     }
 
     return s;
@@ -0,0 +1,275 @@
+/* file: dbscan_dense_spatial_index_batch_impl.i */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of spatial index method for DBSCAN algorithm.
+//
+//  The clusters are built in the following steps:
+//  1. Core observations are detected by counting the weights of their neighbors
+//     until minObservations is reached, the neighborhoods are not stored.
+//  2. Core observations are merged by the union-find structure. The observations
+//     are split into blocks in the order of the index, every thread merges the
+//     core observations of its block, the pairs of core observations from the
+//     different blocks are merged after that in log2(nBlocks) parallel rounds.
+//  3. Clusters are numbered in the order of their first core observations,
+//     a non-core observation is assigned to the cluster with the smallest
+//     number among its core neighbors, as the default method does.
+//--
+*/
+
+#include "algorithms/algorithm.h"
+#include "data_management/data/numeric_table.h"
+
+#include "algorithms/dbscan/dbscan_types.h"
+#include "src/algorithms/dbscan/dbscan_utils.h"
+#include "src/algorithms/dbscan/dbscan_spatial_index.h"
+
+using namespace daal::internal;
+using namespace daal::services;
+using namespace daal::services::internal;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace dbscan
+{
+namespace internal
+{
+/* the root of a set is its observation with the smallest position, so the parent never follows its child */
+DAAL_FORCEINLINE int findRoot(int * const parent, int x)
+{
+    while (parent[x] != x)
+    {
+        parent[x] = parent[parent[x]];
+        x         = parent[x];
+    }
+    return x;
+}
+
+DAAL_FORCEINLINE void uniteSets(int * const parent, int x, int y)
+{
+    const int rx = findRoot(parent, x);
+    const int ry = findRoot(parent, y);
+    if (rx < ry)
+        parent[ry] = rx;
+    else if (ry < rx)
+        parent[rx] = ry;
+}
+
+template <typename algorithmFPType, CpuType cpu>
+Status DBSCANBatchKernel<algorithmFPType, spatialIndexDense, cpu>::compute(const NumericTable * ntData, const NumericTable * ntWeights,
+                                                                          NumericTable * ntAssignments, NumericTable * ntNClusters,
+                                                                          NumericTable * ntCoreIndices, NumericTable * ntCoreObservations,
+                                                                          const Parameter * par)
+{
+    const size_t nRows     = ntData->getNumberOfRows();
+    const size_t nFeatures = ntData->getNumberOfColumns();
+
+    const algorithmFPType epsilon         = par->epsilon;
+    const algorithmFPType minObservations = par->minObservations;
+
+    WriteRows<int, cpu> assignRows(ntAssignments, 0, nRows);
+    DAAL_CHECK_BLOCK_STATUS(assignRows);
+    int * const assignments = assignRows.get();
+
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nRows, sizeof(int));
+
+    TArray<int, cpu> isCoreArray(nRows);
+    DAAL_CHECK_MALLOC(isCoreArray.get());
+    int * const isCore = isCoreArray.get();
+
+    size_t nClusters = 0;
+    {
+        ReadRows<algorithmFPType, cpu> dataRows(const_cast<NumericTable *>(ntData), 0, nRows);
+        DAAL_CHECK_BLOCK_STATUS(dataRows);
+        const algorithmFPType * const data = dataRows.get();
+
+        ReadRows<algorithmFPType, cpu> weightsRows;
+        const algorithmFPType * weights = nullptr;
+        if (ntWeights)
+        {
+            weightsRows.set(const_cast<NumericTable *>(ntWeights), 0, nRows);
+            DAAL_CHECK_BLOCK_STATUS(weightsRows);
+            weights = weightsRows.get();
+        }
+
+        bool isGridBuilt = false;
+        if (GridIndex<algorithmFPType, cpu>::isApplicable(nFeatures, epsilon))
+        {
+            GridIndex<algorithmFPType, cpu> grid;
+            DAAL_CHECK_STATUS_VAR(grid.build(data, weights, nRows, nFeatures, epsilon, isGridBuilt));
+            if (isGridBuilt)
+            {
+                DAAL_CHECK_STATUS_VAR(computeClusters(grid, minObservations, assignments, isCore, nClusters));
+            }
+        }
+        if (!isGridBuilt)
+        {
+            KDTreeIndex<algorithmFPType, cpu> tree;
+            DAAL_CHECK_STATUS_VAR(tree.build(data, weights, nRows, nFeatures, epsilon));
+            DAAL_CHECK_STATUS_VAR(computeClusters(tree, minObservations, assignments, isCore, nClusters));
+        }
+    }
+
+    WriteRows<int, cpu> nClustersRows(ntNClusters, 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(nClustersRows);
+    nClustersRows.get()[0] = nClusters;
+
+    if (par->resultsToCompute & (computeCoreIndices | computeCoreObservations))
+    {
+        DAAL_CHECK_STATUS_VAR(
+            (processResultsToCompute<algorithmFPType, cpu>(par->resultsToCompute, isCore, ntData, ntCoreIndices, ntCoreObservations)));
+    }
+
+    return Status();
+}
+
+template <typename algorithmFPType, CpuType cpu>
+template <typename IndexType>
+Status DBSCANBatchKernel<algorithmFPType, spatialIndexDense, cpu>::computeClusters(const IndexType & index, algorithmFPType minObservations,
+                                                                                  int * const assignments, int * const isCore, size_t & nClusters)
+{
+    const size_t nRows = index.size();
+
+    /* all the arrays below are in the order of the index */
+    TArray<int, cpu> coreArray(nRows);
+    TArray<int, cpu> parentArray(nRows);
+    TArray<int, cpu> clusterArray(nRows);
+    DAAL_CHECK_MALLOC(coreArray.get() && parentArray.get() && clusterArray.get());
+    int * const core    = coreArray.get();
+    int * const parent  = parentArray.get();
+    int * const cluster = clusterArray.get();
+
+    const size_t blockSize = __DBSCAN_SPATIAL_INDEX_BLOCK_SIZE;
+    const size_t nBlocks   = nRows / blockSize + !!(nRows % blockSize);
+
+    /* core observations */
+    daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock) {
+        const size_t begin = iBlock * blockSize;
+        const size_t end   = services::internal::min<cpu, size_t>(begin + blockSize, nRows);
+        for (size_t pos = begin; pos < end; ++pos)
+        {
+            algorithmFPType weight = 0;
+            auto countWeight       = [&](size_t j) -> bool {
+                weight += index.weight(j);
+                return weight < minObservations;
+            };
+            index.forEachNeighbor(pos, countWeight);
+            core[pos]   = (weight >= minObservations);
+            parent[pos] = int(pos);
+        }
+    });
+
+    /* every thread merges the core observations of its block only, the parents of the observations never leave the block then */
+    const size_t nMergeBlocks    = threader_get_max_threads_number();
+    const size_t mergeBlockSize  = nRows / nMergeBlocks + !!(nRows % nMergeBlocks);
+    int * const hasForeignNeighs = cluster;
+    daal::threader_for(nMergeBlocks, nMergeBlocks, [&](size_t iBlock) {
+        const size_t begin = iBlock * mergeBlockSize;
+        const size_t end   = services::internal::min<cpu, size_t>(begin + mergeBlockSize, nRows);
+        for (size_t pos = begin; pos < end; ++pos)
+        {
+            hasForeignNeighs[pos] = 0;
+            if (!core[pos]) continue;
+            auto unite = [&](size_t j) -> bool {
+                if (!core[j]) return true;
+                if (j < begin || j >= end)
+                    hasForeignNeighs[pos] = 1;
+                else if (j < pos)
+                    uniteSets(parent, int(pos), int(j));
+                return true;
+            };
+            index.forEachNeighbor(pos, unite);
+        }
+    });
+
+    /* the pairs of core observations from the different blocks are merged in rounds: in the round with the given stride
+       the groups of 2 * stride consecutive blocks are formed, the first half of each group is merged with its second half.
+       The parents of the observations never leave their group, so the groups are merged in parallel */
+    for (size_t stride = 1; stride < nMergeBlocks; stride *= 2)
+    {
+        const size_t groupSize = 2 * stride * mergeBlockSize;
+        const size_t nGroups   = nRows / groupSize + !!(nRows % groupSize);
+        daal::threader_for(nGroups, nGroups, [&](size_t iGroup) {
+            const size_t begin  = iGroup * groupSize;
+            const size_t middle = services::internal::min<cpu, size_t>(begin + stride * mergeBlockSize, nRows);
+            const size_t end    = services::internal::min<cpu, size_t>(begin + groupSize, nRows);
+            for (size_t pos = begin; pos < middle; ++pos)
+            {
+                if (!hasForeignNeighs[pos]) continue;
+                auto unite = [&](size_t j) -> bool {
+                    if (core[j] && j >= middle && j < end) uniteSets(parent, int(pos), int(j));
+                    return true;
+                };
+                index.forEachNeighbor(pos, unite);
+            }
+        });
+    }
+
+    /* the parent of an observation precedes it, so a single pass makes each observation refer to its root */
+    for (size_t pos = 0; pos < nRows; ++pos) parent[pos] = parent[parent[pos]];
+
+    daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock) {
+        const size_t begin = iBlock * blockSize;
+        const size_t end   = services::internal::min<cpu, size_t>(begin + blockSize, nRows);
+        for (size_t pos = begin; pos < end; ++pos)
+        {
+            const int i    = index.index(pos);
+            isCore[i]      = core[pos];
+            assignments[i] = core[pos] ? parent[pos] : noise;
+            cluster[pos]   = undefined;
+        }
+    });
+
+    /* the clusters are numbered in the order of their first core observations in the input data set */
+    for (size_t i = 0; i < nRows; ++i)
+    {
+        const int root = assignments[i];
+        if (root < 0) continue;
+        if (cluster[root] == undefined) cluster[root] = int(nClusters++);
+        assignments[i] = cluster[root];
+    }
+
+    daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock) {
+        const size_t begin = iBlock * blockSize;
+        const size_t end   = services::internal::min<cpu, size_t>(begin + blockSize, nRows);
+        for (size_t pos = begin; pos < end; ++pos)
+        {
+            if (core[pos]) continue;
+            int clusterId      = noise;
+            auto findClusterId = [&](size_t j) -> bool {
+                if (core[j])
+                {
+                    const int c = cluster[parent[j]];
+                    clusterId   = (clusterId == noise || c < clusterId) ? c : clusterId;
+                }
+                return true;
+            };
+            index.forEachNeighbor(pos, findClusterId);
+            assignments[index.index(pos)] = clusterId;
+        }
+    });
+
+    return Status();
+}
+
+} // namespace internal
+} // namespace dbscan
+} // namespace algorithms
+} // namespace daal
@@ -59,8 +59,35 @@ private:
                                                  daal::tls<Queue<size_t, cpu> *> & tls, TArray<Neighborhood<algorithmFPType, cpu>, cpu> & neighs,
                                                  algorithmFPType minObservations, int * const isCore, size_t nestedLevel);
 
-    services::Status processResultsToCompute(DAAL_UINT64 resultsToCompute, int * const isCore, const NumericTable * ntData,
-                                             NumericTable * ntCoreIndices, NumericTable * ntCoreObservations);
+};
+
+/* Answers the neighborhood queries through a spatial index instead of the pairwise distances, so the memory usage does not depend
+ * on the size of the neighborhoods. The memorySavingMode flag is not applicable for this method. */
+template <typename algorithmFPType, CpuType cpu>
+class DBSCANBatchKernel<algorithmFPType, spatialIndexDense, cpu> : public Kernel
+{
+public:
+    services::Status computeNoMemSave(const NumericTable * ntData, const NumericTable * ntWeights, NumericTable * ntAssignments,
+                                      NumericTable * ntNClusters, NumericTable * ntCoreIndices, NumericTable * ntCoreObservations,
+                                      const Parameter * par)
+    {
+        return compute(ntData, ntWeights, ntAssignments, ntNClusters, ntCoreIndices, ntCoreObservations, par);
+    }
+
+    services::Status computeMemSave(const NumericTable * ntData, const NumericTable * ntWeights, NumericTable * ntAssignments,
+                                    NumericTable * ntNClusters, NumericTable * ntCoreIndices, NumericTable * ntCoreObservations,
+                                    const Parameter * par)
+    {
+        return compute(ntData, ntWeights, ntAssignments, ntNClusters, ntCoreIndices, ntCoreObservations, par);
+    }
+
+private:
+    services::Status compute(const NumericTable * ntData, const NumericTable * ntWeights, NumericTable * ntAssignments, NumericTable * ntNClusters,
+                             NumericTable * ntCoreIndices, NumericTable * ntCoreObservations, const Parameter * par);
+
+    template <typename IndexType>
+    services::Status computeClusters(const IndexType & index, algorithmFPType minObservations, int * const assignments, int * const isCore,
+                                     size_t & nClusters);
 };
 
 template <typename algorithmFPType, Method method, CpuType cpu>
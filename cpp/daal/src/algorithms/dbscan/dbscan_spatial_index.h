@@ -0,0 +1,432 @@
+/* file: dbscan_spatial_index.h */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Spatial indices answering the epsilon-neighborhood queries of the DBSCAN
+//  algorithm. Both of them keep the observations reordered so that the close
+//  observations are stored close to each other, the queries are made by the
+//  positions of observations in this order.
+//--
+*/
+
+#ifndef __DBSCAN_SPATIAL_INDEX_H__
+#define __DBSCAN_SPATIAL_INDEX_H__
+
+#include "src/threading/threading.h"
+#include "src/services/service_arrays.h"
+#include "src/externals/service_memory.h"
+#include "src/algorithms/service_error_handling.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace dbscan
+{
+namespace internal
+{
+#define __DBSCAN_SPATIAL_INDEX_BLOCK_SIZE   1024
+#define __DBSCAN_GRID_MAX_DIMENSION         3
+#define __DBSCAN_KD_TREE_LEAF_SIZE          32
+#define __DBSCAN_KD_TREE_MAX_STACK_SIZE     128
+
+using daal::services::internal::TArray;
+
+/* Observations and weights of the data set in the order defined by the index */
+template <typename FPType, CpuType cpu>
+class SpatialIndexBase
+{
+public:
+    SpatialIndexBase() : _nRows(0), _dim(0), _eps2(0) {}
+
+    size_t size() const { return _nRows; }
+
+    /* index of the observation in the input data set */
+    int index(size_t pos) const { return _order[pos]; }
+
+    FPType weight(size_t pos) const { return _weights.get() ? _weights[pos] : FPType(1); }
+
+    const FPType * point(size_t pos) const { return _data.get() + pos * _dim; }
+
+protected:
+    services::Status init(size_t nRows, size_t dim, FPType eps)
+    {
+        _nRows = nRows;
+        _dim   = dim;
+        _eps2  = eps * eps;
+        DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nRows, dim);
+        _order.reset(nRows);
+        DAAL_CHECK_MALLOC(_order.get());
+        return services::Status();
+    }
+
+    /* copies the observations and their weights in the order of the index */
+    services::Status permute(const FPType * data, const FPType * weights)
+    {
+        _data.reset(_nRows * _dim);
+        DAAL_CHECK_MALLOC(_data.get());
+        if (weights)
+        {
+            _weights.reset(_nRows);
+            DAAL_CHECK_MALLOC(_weights.get());
+        }
+
+        const size_t blockSize = __DBSCAN_SPATIAL_INDEX_BLOCK_SIZE;
+        const size_t nBlocks   = _nRows / blockSize + !!(_nRows % blockSize);
+        daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock) {
+            const size_t begin = iBlock * blockSize;
+            const size_t end   = services::internal::min<cpu, size_t>(begin + blockSize, _nRows);
+            for (size_t pos = begin; pos < end; ++pos)
+            {
+                const FPType * const src = data + size_t(_order[pos]) * _dim;
+                FPType * const dst       = _data.get() + pos * _dim;
+                for (size_t k = 0; k < _dim; ++k) dst[k] = src[k];
+                if (weights) _weights[pos] = weights[_order[pos]];
+            }
+        });
+        return services::Status();
+    }
+
+    bool isNeighbor(const FPType * a, size_t pos) const
+    {
+        const FPType * const b = point(pos);
+        FPType sum             = 0;
+        for (size_t k = 0; k < _dim; ++k) sum += (b[k] - a[k]) * (b[k] - a[k]);
+        return sum <= _eps2;
+    }
+
+    size_t _nRows;
+    size_t _dim;
+    FPType _eps2;
+    TArray<int, cpu> _order;
+    TArray<FPType, cpu> _data;
+    TArray<FPType, cpu> _weights;
+};
+
+/* Uniform grid with the cell side equal to epsilon, the neighbors of an observation lie in its cell and in the adjacent ones.
+ * Suits the data sets of a low dimension only, since the number of the adjacent cells is 3^dim */
+template <typename FPType, CpuType cpu>
+class GridIndex : public SpatialIndexBase<FPType, cpu>
+{
+    using super = SpatialIndexBase<FPType, cpu>;
+
+public:
+    static bool isApplicable(size_t dim, FPType eps) { return (dim <= __DBSCAN_GRID_MAX_DIMENSION) && (eps > 0); }
+
+    /* sets built to false if the grid has too many cells to address them, the k-d tree is used then */
+    services::Status build(const FPType * data, const FPType * weights, size_t nRows, size_t dim, FPType eps, bool & built)
+    {
+        built = false;
+        DAAL_CHECK_STATUS_VAR(super::init(nRows, dim, eps));
+        _eps = eps;
+
+        /* bounding box of the data set and the number of cells in each dimension,
+         * the keys of the cells are sorted as double values, so they have to be exactly representable */
+        const double maxKey = double(1ULL << 53);
+        double nCellsTotal  = 1;
+        for (size_t k = 0; k < dim; ++k)
+        {
+            _min[k]       = data[k];
+            FPType maxVal = data[k];
+            for (size_t i = 1; i < nRows; ++i)
+            {
+                const FPType val = data[i * dim + k];
+                _min[k]          = (val < _min[k]) ? val : _min[k];
+                maxVal           = (val > maxVal) ? val : maxVal;
+            }
+            const double nCells = double((maxVal - _min[k]) / eps) + 1;
+            nCellsTotal *= nCells;
+            if (!(nCellsTotal <= maxKey)) return services::Status();
+            _nCells[k] = size_t(nCells);
+        }
+
+        TArray<IdxValType<double>, cpu> keysArray(nRows);
+        DAAL_CHECK_MALLOC(keysArray.get());
+        IdxValType<double> * const keys = keysArray.get();
+
+        const size_t blockSize = __DBSCAN_SPATIAL_INDEX_BLOCK_SIZE;
+        const size_t nBlocks   = nRows / blockSize + !!(nRows % blockSize);
+        daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock) {
+            const size_t begin = iBlock * blockSize;
+            const size_t end   = services::internal::min<cpu, size_t>(begin + blockSize, nRows);
+            size_t coords[__DBSCAN_GRID_MAX_DIMENSION];
+            for (size_t i = begin; i < end; ++i)
+            {
+                cellCoords(data + i * dim, coords);
+                keys[i].value = double(cellKey(coords));
+                keys[i].index = i;
+            }
+        });
+        daal::parallel_sort<double>(keys, keys + nRows);
+
+        size_t nNonEmpty = 0;
+        for (size_t i = 0; i < nRows; ++i)
+        {
+            this->_order[i] = int(keys[i].index);
+            nNonEmpty += (i == 0) || (keys[i].value != keys[i - 1].value);
+        }
+
+        _cellKeys.reset(nNonEmpty);
+        _cellStart.reset(nNonEmpty + 1);
+        DAAL_CHECK_MALLOC(_cellKeys.get() && _cellStart.get());
+        size_t iCell = 0;
+        for (size_t i = 0; i < nRows; ++i)
+        {
+            if ((i == 0) || (keys[i].value != keys[i - 1].value))
+            {
+                _cellKeys[iCell]  = size_t(keys[i].value);
+                _cellStart[iCell] = i;
+                ++iCell;
+            }
+        }
+        _cellStart[nNonEmpty] = nRows;
+        keysArray.reset();
+
+        DAAL_CHECK_STATUS_VAR(super::permute(data, weights));
+        built = true;
+        return services::Status();
+    }
+
+    /* calls visitor(neighborPos) for each observation in the epsilon-neighborhood of the one at pos including itself,
+     * stops when the visitor returns false */
+    template <typename Visitor>
+    void forEachNeighbor(size_t pos, Visitor & visitor) const
+    {
+        const FPType * const x = this->point(pos);
+        size_t coords[__DBSCAN_GRID_MAX_DIMENSION];
+        size_t adjacent[__DBSCAN_GRID_MAX_DIMENSION];
+        cellCoords(x, coords);
+
+        size_t nAdjacent = 1;
+        for (size_t k = 0; k < this->_dim; ++k) nAdjacent *= 3;
+
+        for (size_t iAdjacent = 0; iAdjacent < nAdjacent; ++iAdjacent)
+        {
+            /* decode the offsets in {-1, 0, 1} of the adjacent cell */
+            bool isValid = true;
+            for (size_t k = 0, code = iAdjacent; k < this->_dim; ++k, code /= 3)
+            {
+                const size_t offset = code % 3;
+                isValid &= !(offset == 0 && coords[k] == 0) && !(offset == 2 && coords[k] + 1 >= _nCells[k]);
+                adjacent[k] = coords[k] + offset - 1;
+            }
+            if (!isValid) continue;
+
+            const size_t iCell = findCell(cellKey(adjacent));
+            if (iCell == _cellKeys.size()) continue;
+
+            for (size_t j = _cellStart[iCell]; j < _cellStart[iCell + 1]; ++j)
+            {
+                if (this->isNeighbor(x, j) && !visitor(j)) return;
+            }
+        }
+    }
+
+private:
+    void cellCoords(const FPType * x, size_t * coords) const
+    {
+        for (size_t k = 0; k < this->_dim; ++k)
+        {
+            const size_t c = size_t((x[k] - _min[k]) / _eps);
+            coords[k]      = (c < _nCells[k]) ? c : _nCells[k] - 1;
+        }
+    }
+
+    size_t cellKey(const size_t * coords) const
+    {
+        size_t key = 0;
+        for (size_t k = this->_dim; k > 0; --k) key = key * _nCells[k - 1] + coords[k - 1];
+        return key;
+    }
+
+    /* binary search of the non-empty cell, returns the number of non-empty cells if it is not found */
+    size_t findCell(size_t key) const
+    {
+        size_t left  = 0;
+        size_t right = _cellKeys.size();
+        while (left < right)
+        {
+            const size_t mid = (left + right) / 2;
+            if (_cellKeys[mid] < key)
+                left = mid + 1;
+            else
+                right = mid;
+        }
+        return (left < _cellKeys.size() && _cellKeys[left] == key) ? left : _cellKeys.size();
+    }
+
+    FPType _eps;
+    FPType _min[__DBSCAN_GRID_MAX_DIMENSION];
+    size_t _nCells[__DBSCAN_GRID_MAX_DIMENSION];
+    TArray<size_t, cpu> _cellKeys;
+    TArray<size_t, cpu> _cellStart;
+};
+
+/* k-d tree with the leaves of at most __DBSCAN_KD_TREE_LEAF_SIZE observations split by the median of the widest dimension */
+template <typename FPType, CpuType cpu>
+class KDTreeIndex : public SpatialIndexBase<FPType, cpu>
+{
+    using super = SpatialIndexBase<FPType, cpu>;
+
+    struct Node
+    {
+        size_t dimension;
+        FPType cutPoint;
+        size_t left; /* 0 for a leaf, since the root is never a child */
+        size_t start;
+        size_t end;
+    };
+
+public:
+    services::Status build(const FPType * data, const FPType * weights, size_t nRows, size_t dim, FPType eps)
+    {
+        DAAL_CHECK_STATUS_VAR(super::init(nRows, dim, eps));
+        _eps        = eps;
+        int * order = this->_order.get();
+        for (size_t i = 0; i < nRows; ++i) order[i] = int(i);
+
+        /* every leaf has at least a half of the leaf size observations */
+        const size_t maxNodes = 2 * (nRows / (__DBSCAN_KD_TREE_LEAF_SIZE / 2) + 1);
+        _nodes.reset(maxNodes);
+        DAAL_CHECK_MALLOC(_nodes.get());
+
+        TArray<FPType, cpu> lowerArray(dim);
+        TArray<FPType, cpu> upperArray(dim);
+        DAAL_CHECK_MALLOC(lowerArray.get() && upperArray.get());
+        FPType * const lower = lowerArray.get();
+        FPType * const upper = upperArray.get();
+
+        _nNodes         = 1;
+        _nodes[0].start = 0;
+        _nodes[0].end   = nRows;
+        _nodes[0].left  = 0;
+        size_t stack[__DBSCAN_KD_TREE_MAX_STACK_SIZE];
+        size_t stackSize   = 0;
+        stack[stackSize++] = 0;
+        while (stackSize)
+        {
+            Node & node        = _nodes[stack[--stackSize]];
+            const size_t count = node.end - node.start;
+            if (count <= __DBSCAN_KD_TREE_LEAF_SIZE) continue;
+
+            for (size_t k = 0; k < dim; ++k) lower[k] = upper[k] = data[size_t(order[node.start]) * dim + k];
+            for (size_t i = node.start + 1; i < node.end; ++i)
+            {
+                const FPType * const x = data + size_t(order[i]) * dim;
+                for (size_t k = 0; k < dim; ++k)
+                {
+                    lower[k] = (x[k] < lower[k]) ? x[k] : lower[k];
+                    upper[k] = (x[k] > upper[k]) ? x[k] : upper[k];
+                }
+            }
+            size_t widest = 0;
+            for (size_t k = 1; k < dim; ++k) widest = (upper[k] - lower[k] > upper[widest] - lower[widest]) ? k : widest;
+            if (!(upper[widest] > lower[widest])) continue; /* all the observations coincide */
+
+            const size_t mid = node.start + count / 2;
+            selectKth(data, dim, order + node.start, count, mid - node.start, widest);
+
+            node.dimension = widest;
+            node.cutPoint  = data[size_t(order[mid]) * dim + widest];
+            node.left      = _nNodes;
+
+            Node & left = _nodes[_nNodes++];
+            left.start  = node.start;
+            left.end    = mid;
+            left.left   = 0;
+
+            Node & right = _nodes[_nNodes++];
+            right.start  = mid;
+            right.end    = node.end;
+            right.left   = 0;
+
+            stack[stackSize++] = node.left;
+            stack[stackSize++] = node.left + 1;
+        }
+
+        return super::permute(data, weights);
+    }
+
+    /* calls visitor(neighborPos) for each observation in the epsilon-neighborhood of the one at pos including itself,
+     * stops when the visitor returns false */
+    template <typename Visitor>
+    void forEachNeighbor(size_t pos, Visitor & visitor) const
+    {
+        const FPType * const x = this->point(pos);
+        size_t stack[__DBSCAN_KD_TREE_MAX_STACK_SIZE];
+        size_t stackSize   = 0;
+        stack[stackSize++] = 0;
+        while (stackSize)
+        {
+            const Node & node = _nodes[stack[--stackSize]];
+            if (!node.left)
+            {
+                for (size_t j = node.start; j < node.end; ++j)
+                {
+                    if (this->isNeighbor(x, j) && !visitor(j)) return;
+                }
+                continue;
+            }
+            /* the observations equal to the cut point may be in both children */
+            const FPType diff = x[node.dimension] - node.cutPoint;
+            if (diff <= _eps) stack[stackSize++] = node.left;
+            if (diff >= -_eps) stack[stackSize++] = node.left + 1;
+        }
+    }
+
+private:
+    /* rearranges the indices so that the k-th one refers to the k-th smallest value of the dimension,
+     * the preceding ones refer to the values not greater than it and the following ones to the values not less than it */
+    static void selectKth(const FPType * data, size_t dim, int * idx, size_t n, size_t k, size_t dimension)
+    {
+        DAAL_INT l = 0;
+        DAAL_INT r = static_cast<DAAL_INT>(n) - 1;
+        while (l < r)
+        {
+            const FPType med = data[size_t(idx[k]) * dim + dimension];
+            DAAL_INT i       = l;
+            DAAL_INT j       = r;
+            while (i <= j)
+            {
+                while (data[size_t(idx[i]) * dim + dimension] < med) i++;
+                while (med < data[size_t(idx[j]) * dim + dimension]) j--;
+                if (i <= j)
+                {
+                    const int tmp = idx[i];
+                    idx[i]        = idx[j];
+                    idx[j]        = tmp;
+                    i++;
+                    j--;
+                }
+            }
+            if (j < static_cast<DAAL_INT>(k)) l = i;
+            if (static_cast<DAAL_INT>(k) < i) r = j;
+        }
+    }
+
+    FPType _eps;
+    size_t _nNodes;
+    TArray<Node, cpu> _nodes;
+};
+
+} // namespace internal
+} // namespace dbscan
+} // namespace algorithms
+} // namespace daal
+
+#endif
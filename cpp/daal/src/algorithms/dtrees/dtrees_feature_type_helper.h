@@ -81,7 +81,9 @@ struct BinParams
 //////////////////////////////////////////////////////////////////////////////////////////
 // IndexedFeatures. Creates and stores index of every feature
 // Sorts every feature and creates the mapping: features value -> index of the value
-// in the sorted array of unique values of the feature in increasing order
+// in the sorted array of unique values of the feature in increasing order.
+// If the missing values are requested, NaN values of the feature are mapped to the dedicated
+// index following all the others, otherwise they are sorted with the other values
 //////////////////////////////////////////////////////////////////////////////////////////
 class IndexedFeatures
 {
@@ -91,8 +93,9 @@ public:
     struct FeatureEntry
     {
         DAAL_NEW_DELETE();
-        IndexType numIndices     = 0;       //number of indices or bins
+        IndexType numIndices     = 0;       //number of indices or bins, including the index of the missing values
         ModelFPType * binBorders = nullptr; //right bin borders
+        bool hasMissingValues    = false;   //the last index stands for the missing (NaN) values
 
         services::Status allocBorders();
         ~FeatureEntry();
@@ -103,11 +106,15 @@ public:
     ~IndexedFeatures();
 
     template <typename algorithmFPType, CpuType cpu>
-    services::Status init(const NumericTable & nt, const FeatureTypes * featureTypes = nullptr, const BinParams * pBimPrm = nullptr);
+    services::Status init(const NumericTable & nt, const FeatureTypes * featureTypes = nullptr, const BinParams * pBimPrm = nullptr,
+                          bool bMissingValues = false);
 
     //get max number of indices for that feature
     IndexType numIndices(size_t iCol) const { return _entries[iCol].numIndices; }
 
+    //get index of the missing values of the feature, -1 if the feature has no missing values
+    IndexType missingIndex(size_t iCol) const { return _entries[iCol].hasMissingValues ? _entries[iCol].numIndices - 1 : -1; }
+
     //get max number of indices among all features
     IndexType maxNumIndices() const { return _maxNumIndices; }
 
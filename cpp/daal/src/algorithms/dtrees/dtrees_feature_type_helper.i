@@ -39,7 +39,7 @@ template <typename IndexType, typename algorithmFPType, CpuType cpu>
 struct ColIndexTask
 {
     DAAL_NEW_DELETE();
-    ColIndexTask(size_t nRows) : _index(nRows), maxNumDiffValues(1) {}
+    ColIndexTask(size_t nRows, bool bMissingValues) : _index(nRows), _bMissingValues(bMissingValues), maxNumDiffValues(1) {}
     virtual ~ColIndexTask() {}
     bool isValid() const { return _index.get(); }
 
@@ -64,68 +64,90 @@ struct ColIndexTask
     services::Status makeIndexDefault(NumericTable & nt, IndexedFeatures::FeatureEntry & entry, IndexType * aRes, size_t iCol, size_t nRows,
                                       bool bUnorderedFeature)
     {
-        Status s = this->getSorted(nt, iCol, nRows);
+        size_t nPresent = 0;
+        Status s       = this->getSorted(nt, iCol, nRows, nPresent);
         if (!s) return s;
+        makeIndexSorted(entry, aRes, nRows, nPresent);
+        return s;
+    }
+
+public:
+    size_t maxNumDiffValues;
+
+protected:
+    //makes the index of the feature, which values are sorted already
+    void makeIndexSorted(IndexedFeatures::FeatureEntry & entry, IndexType * aRes, size_t nRows, size_t nPresent)
+    {
         const FeatureIdx * index = _index.get();
-        if (index[0].key == index[nRows - 1].key)
+        IndexType iUnique        = 0;
+        if (nPresent)
         {
-            entry.numIndices = 1;
-            for (size_t i = 0; i < nRows; ++i) aRes[i] = 0;
-            return s;
-        }
-        IndexType iUnique    = 0;
-        aRes[index[0].val]   = iUnique;
-        algorithmFPType prev = index[0].key;
-        for (size_t i = 1; i < nRows; ++i)
-        {
-            const IndexType idx = index[i].val;
-            if (index[i].key == prev)
-                aRes[idx] = iUnique;
-            else
+            aRes[index[0].val]   = iUnique;
+            algorithmFPType prev = index[0].key;
+            for (size_t i = 1; i < nPresent; ++i)
             {
-                aRes[idx] = ++iUnique;
-                prev      = index[i].key;
+                const IndexType idx = index[i].val;
+                if (index[i].key == prev)
+                    aRes[idx] = iUnique;
+                else
+                {
+                    aRes[idx] = ++iUnique;
+                    prev      = index[i].key;
+                }
             }
+            ++iUnique;
         }
-        ++iUnique;
         entry.numIndices = iUnique;
-        if (maxNumDiffValues < iUnique) maxNumDiffValues = iUnique;
-        return services::Status();
+        assignMissingIndex(entry, aRes, nRows, nPresent);
+        if (maxNumDiffValues < entry.numIndices) maxNumDiffValues = entry.numIndices;
     }
 
-public:
-    size_t maxNumDiffValues;
+    //maps the missing values to the index following the indices of the other values
+    void assignMissingIndex(IndexedFeatures::FeatureEntry & entry, IndexType * aRes, size_t nRows, size_t nPresent)
+    {
+        entry.hasMissingValues = (nPresent < nRows);
+        if (!entry.hasMissingValues) return;
+        const FeatureIdx * index = _index.get();
+        for (size_t i = nPresent; i < nRows; ++i) aRes[index[i].val] = entry.numIndices;
+        ++entry.numIndices;
+    }
 
-protected:
-    Status getSorted(NumericTable & nt, size_t iCol, size_t nRows)
+    //sorts the present values of the feature, the missing ones are placed after them if they are requested
+    Status getSorted(NumericTable & nt, size_t iCol, size_t nRows, size_t & nPresent)
     {
         const algorithmFPType * pBlock = _block.set(&nt, iCol, 0, nRows);
         DAAL_CHECK_BLOCK_STATUS(_block);
         FeatureIdx * index = _index.get();
+        size_t iMissing    = nRows;
+        nPresent            = 0;
         for (size_t i = 0; i < nRows; ++i)
         {
-            index[i].key = pBlock[i];
-            index[i].val = i;
+            const bool bMissing = _bMissingValues && services::internal::IsNaN<algorithmFPType, cpu>::get(pBlock[i]);
+            FeatureIdx & dst    = bMissing ? index[--iMissing] : index[nPresent++];
+            dst.key          = pBlock[i];
+            dst.val          = i;
         }
-        daal::algorithms::internal::qSortByKey<FeatureIdx, cpu>(nRows, index);
+        daal::algorithms::internal::qSortByKey<FeatureIdx, cpu>(nPresent, index);
         return Status();
     }
 
 protected:
     daal::internal::ReadColumns<algorithmFPType, cpu> _block;
     TVector<FeatureIdx, cpu, DefaultAllocator<cpu> > _index;
+    const bool _bMissingValues;
 };
 
 template <typename IndexType, typename algorithmFPType, CpuType cpu>
 struct ColIndexTaskBins : public ColIndexTask<IndexType, algorithmFPType, cpu>
 {
     typedef ColIndexTask<IndexType, algorithmFPType, cpu> super;
-    ColIndexTaskBins(size_t nRows, const BinParams & prm) : super(nRows), _prm(prm), _bins(_prm.maxBins) {}
+    ColIndexTaskBins(size_t nRows, bool bMissingValues, const BinParams & prm) : super(nRows, bMissingValues), _prm(prm), _bins(_prm.maxBins) {}
     virtual services::Status makeIndex(NumericTable & nt, IndexedFeatures::FeatureEntry & entry, IndexType * aRes, size_t iCol, size_t nRows,
                                        bool bUnorderedFeature) DAAL_C11_OVERRIDE;
 
 private:
-    services::Status assignIndexAccordingToBins(IndexedFeatures::FeatureEntry & entry, IndexType * aRes, size_t nBins, size_t nRows);
+    services::Status assignIndexAccordingToBins(IndexedFeatures::FeatureEntry & entry, IndexType * aRes, size_t nBins, size_t nRows,
+                                                size_t nPresent);
 
 private:
     const BinParams _prm;
@@ -161,23 +183,14 @@ const T * upper_bound(const T * first, const T * last, const T & value)
 
 template <typename IndexType, typename algorithmFPType, CpuType cpu>
 services::Status ColIndexTaskBins<IndexType, algorithmFPType, cpu>::assignIndexAccordingToBins(IndexedFeatures::FeatureEntry & entry,
-                                                                                               IndexType * aRes, size_t nBins, size_t nRows)
+                                                                                               IndexType * aRes, size_t nBins, size_t nRows,
+                                                                                               size_t nPresent)
 {
     const typename super::FeatureIdx * index = this->_index.get();
 
-    if (nBins == 1)
-    {
-        entry.numIndices   = 1;
-        services::Status s = entry.allocBorders();
-        DAAL_CHECK(s, s);
-        services::internal::service_memset_seq<IndexType, cpu>(aRes, 0, nRows);
-
-        entry.binBorders[0] = index[nRows - 1].key;
-        _bins[0]            = nRows;
-        return Status();
-    }
-    entry.numIndices   = nBins;
-    services::Status s = entry.allocBorders();
+    const bool hasMissingValues = (nPresent < nRows);
+    entry.numIndices            = nBins + hasMissingValues;
+    services::Status s          = entry.allocBorders();
     if (!s) return s;
 
     size_t i = 0;
@@ -186,6 +199,10 @@ services::Status ColIndexTaskBins<IndexType, algorithmFPType, cpu>::assignIndexA
         for (size_t n = i + _bins[iBin]; i < n; ++i) aRes[index[i].val] = iBin;
         entry.binBorders[iBin] = index[i - 1].key;
     }
+    //the border of the missing values bin is never used as a split value
+    if (hasMissingValues) entry.binBorders[nBins] = entry.binBorders[nBins - 1];
+    entry.numIndices = nBins;
+    this->assignMissingIndex(entry, aRes, nRows, nPresent);
     if (this->maxNumDiffValues < entry.numIndices) this->maxNumDiffValues = entry.numIndices;
     return s;
 }
@@ -194,28 +211,27 @@ template <typename IndexType, typename algorithmFPType, CpuType cpu>
 services::Status ColIndexTaskBins<IndexType, algorithmFPType, cpu>::makeIndex(NumericTable & nt, IndexedFeatures::FeatureEntry & entry,
                                                                               IndexType * aRes, size_t iCol, size_t nRows, bool bUnorderedFeature)
 {
-    if (bUnorderedFeature || nRows <= _prm.maxBins) return this->makeIndexDefault(nt, entry, aRes, iCol, nRows, bUnorderedFeature);
-
-    Status s = this->getSorted(nt, iCol, nRows);
+    size_t nPresent = 0;
+    Status s       = this->getSorted(nt, iCol, nRows, nPresent);
     if (!s) return s;
 
-    const typename super::FeatureIdx * index = this->_index.get();
-    if (index[0].key == index[nRows - 1].key)
+    if (bUnorderedFeature || nPresent <= _prm.maxBins)
     {
-        _bins[0] = nRows;
-        services::internal::service_memset_seq<IndexType, cpu>(aRes, 0, nRows);
-
-        entry.numIndices = 1;
-        s |= entry.allocBorders();
-        DAAL_CHECK(s, s);
-        entry.binBorders[0] = index[nRows - 1].key;
+        this->makeIndexSorted(entry, aRes, nRows, nPresent);
         return s;
     }
 
+    const typename super::FeatureIdx * index = this->_index.get();
+    if (index[0].key == index[nPresent - 1].key)
+    {
+        _bins[0] = nPresent;
+        return assignIndexAccordingToBins(entry, aRes, 1, nRows, nPresent);
+    }
+
     size_t nBins         = 0;
-    const size_t binSize = nRows / _prm.maxBins;
+    const size_t binSize = nPresent / _prm.maxBins;
     size_t i             = 0;
-    for (; (i + binSize < nRows) && (nBins < _prm.maxBins);)
+    for (; (i + binSize < nPresent) && (nBins < _prm.maxBins);)
     {
         //trying to make a bin of size binSize
         size_t newBinSize                     = binSize;
@@ -228,10 +244,10 @@ services::Status ColIndexTaskBins<IndexType, algorithmFPType, cpu>::makeIndex(Nu
             ++iRight;
             size_t r = iRight + binSize;
             //at first, roughly locate the value bigger than iRight, jumping by binSize to the right
-            for (; (r < nRows) && (index[r].key == ri.key); r += binSize)
+            for (; (r < nPresent) && (index[r].key == ri.key); r += binSize)
             {
             }
-            if (r > nRows) r = nRows;
+            if (r > nPresent) r = nPresent;
             //then locate a new border as the upper_bound between this rough value and iRight
             iRight = upper_bound<typename super::FeatureIdx>(index + iRight + 1, index + r, ri) - index;
             //this is the size of the bin
@@ -265,9 +281,9 @@ services::Status ColIndexTaskBins<IndexType, algorithmFPType, cpu>::makeIndex(Nu
         append(_bins, nBins, newBinSize);
         i += newBinSize;
     }
-    if (i < nRows)
+    if (i < nPresent)
     {
-        size_t newBinSize = nRows - i;
+        size_t newBinSize = nPresent - i;
         if (((nBins < _prm.maxBins) && (newBinSize >= _prm.minBinSize)) || nBins == 0)
         {
             append(_bins, nBins, newBinSize);
@@ -282,7 +298,7 @@ services::Status ColIndexTaskBins<IndexType, algorithmFPType, cpu>::makeIndex(Nu
     //run-time check for bins correctness
     size_t nTotal = 0;
     for(size_t i = 0; i < nBins; nTotal += _bins[i], ++i);
-    DAAL_ASSERT(nTotal == nRows);
+    DAAL_ASSERT(nTotal == nPresent);
     size_t iBorder = 0;
     for(size_t i = 1; i < nBins; ++i)
     {
@@ -291,11 +307,11 @@ services::Status ColIndexTaskBins<IndexType, algorithmFPType, cpu>::makeIndex(Nu
     }
     #endif
 #endif
-    return assignIndexAccordingToBins(entry, aRes, nBins, nRows);
+    return assignIndexAccordingToBins(entry, aRes, nBins, nRows, nPresent);
 }
 
 template <typename algorithmFPType, CpuType cpu>
-services::Status IndexedFeatures::init(const NumericTable & nt, const FeatureTypes * featureTypes, const BinParams * pBimPrm)
+services::Status IndexedFeatures::init(const NumericTable & nt, const FeatureTypes * featureTypes, const BinParams * pBimPrm, bool bMissingValues)
 {
     dtrees::internal::FeatureTypes autoFT;
     if (!featureTypes)
@@ -315,7 +331,7 @@ services::Status IndexedFeatures::init(const NumericTable & nt, const FeatureTyp
 
     daal::tls<TlsTask *> tlsData([=, &nt]() -> TlsTask * {
         const size_t nRows = nt.getNumberOfRows();
-        TlsTask * res      = (pBimPrm ? new BinningTask(nRows, *pBimPrm) : new DefaultTask(nRows));
+        TlsTask * res      = (pBimPrm ? new BinningTask(nRows, bMissingValues, *pBimPrm) : new DefaultTask(nRows, bMissingValues));
         if (res && !res->isValid())
         {
             delete res;
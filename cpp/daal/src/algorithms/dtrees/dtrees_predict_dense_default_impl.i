@@ -54,10 +54,12 @@ const typename TreeType::NodeType::Base * findNode(const dtrees::internal::Tree
         for (; pNode && pNode->isSplit();)
         {
             auto pSplit  = TreeType::NodeType::castSplit(pNode);
-            const int sn = (pSplit->featureUnordered ?
-                                (int(x[pSplit->featureIdx]) != int(pSplit->featureValue)) :
-                                daal::services::internal::SignBit<algorithmFPType, cpu>::get(pSplit->featureValue - x[pSplit->featureIdx]));
-            pNode        = pSplit->kid[sn];
+            const int sn = daal::services::internal::IsNaN<algorithmFPType, cpu>::get(x[pSplit->featureIdx]) ?
+                               !pSplit->defaultLeft :
+                               (pSplit->featureUnordered ?
+                                    (int(x[pSplit->featureIdx]) != int(pSplit->featureValue)) :
+                                    daal::services::internal::SignBit<algorithmFPType, cpu>::get(pSplit->featureValue - x[pSplit->featureIdx]));
+            pNode = pSplit->kid[sn];
         }
     }
     else
@@ -65,8 +67,10 @@ const typename TreeType::NodeType::Base * findNode(const dtrees::internal::Tree
         for (; pNode && pNode->isSplit();)
         {
             auto pSplit  = TreeType::NodeType::castSplit(pNode);
-            const int sn = daal::services::internal::SignBit<algorithmFPType, cpu>::get(pSplit->featureValue - x[pSplit->featureIdx]);
-            pNode        = pSplit->kid[sn];
+            const int sn = daal::services::internal::IsNaN<algorithmFPType, cpu>::get(x[pSplit->featureIdx]) ?
+                               !pSplit->defaultLeft :
+                               daal::services::internal::SignBit<algorithmFPType, cpu>::get(pSplit->featureValue - x[pSplit->featureIdx]);
+            pNode = pSplit->kid[sn];
         }
     }
     return pNode;
@@ -110,6 +110,7 @@ struct SplitData
     size_t nLeft;
     size_t iStart;
     bool featureUnordered;
+    bool defaultLeft; //the child the missing values of the feature go to
     algorithmFPType totalWeights;
     algorithmFPType leftWeights;
 
@@ -118,11 +119,19 @@ struct SplitData
           featureValue(0.0),
           nLeft(0),
           iStart(0),
+          defaultLeft(true),
           totalWeights(0.0),
           leftWeights(0.0)
     {}
     SplitData(algorithmFPType impDecr, bool bFeatureUnordered)
-        : impurityDecrease(impDecr), featureUnordered(bFeatureUnordered), featureValue(0.0), nLeft(0), iStart(0), totalWeights(0.0), leftWeights(0.0)
+        : impurityDecrease(impDecr),
+          featureUnordered(bFeatureUnordered),
+          defaultLeft(true),
+          featureValue(0.0),
+          nLeft(0),
+          iStart(0),
+          totalWeights(0.0),
+          leftWeights(0.0)
     {}
     SplitData(const SplitData & o) = delete;
     void copyTo(SplitData & o) const
@@ -132,6 +141,7 @@ struct SplitData
         o.iStart           = iStart;
         o.left             = left;
         o.featureUnordered = featureUnordered;
+        o.defaultLeft      = defaultLeft;
         o.impurityDecrease = impurityDecrease;
         o.totalWeights     = totalWeights;
         o.leftWeights      = leftWeights;
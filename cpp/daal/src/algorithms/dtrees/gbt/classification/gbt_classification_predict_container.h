@@ -69,9 +69,13 @@ services::Status BatchContainer<algorithmFPType, method, cpu>::compute()
     NumericTable * prob = ((par->resultsToEvaluate & classifier::ResultToComputeId::computeClassProbabilities) ?
                                result->get(classifier::prediction::probabilities).get() :
                                nullptr);
+    NumericTable * contributions = ((par->resultsToCompute & (predictionContributions | predictionInteractions)) ?
+                                        result->get(classifier::prediction::prediction).get() :
+                                        nullptr);
 
     __DAAL_CALL_KERNEL(env, internal::PredictKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), compute,
-                       daal::services::internal::hostApp(*input), a, m, r, prob, par->nClasses, par->nIterations);
+                       daal::services::internal::hostApp(*input), a, m, r, prob, par->nClasses, par->nIterations, contributions,
+                       par->resultsToCompute);
 }
 
 } // namespace interface2
@@ -24,6 +24,7 @@
 */
 
 #include "src/algorithms/dtrees/gbt/classification/gbt_classification_predict_container.h"
+#include "data_management/data/homogen_numeric_table.h"
 
 namespace daal
 {
@@ -55,6 +56,30 @@ Batch<DAAL_FPTYPE, gbt::classification::prediction::defaultDense>::Batch(const B
     _par = new ParameterType(other.parameter());
     initialize();
 }
+
+template <>
+services::Status BatchType::allocateResult()
+{
+    services::Status s = _result->allocate<DAAL_FPTYPE>(&input, _par, 0);
+    _res               = _result.get();
+    DAAL_CHECK_STATUS_VAR(s);
+
+    /* The contributions are stored in the prediction table */
+    const ParameterType & par = parameter();
+    if (par.resultsToCompute & (predictionContributions | predictionInteractions))
+    {
+        NumericTablePtr dataTable = input.get(classifier::prediction::data);
+        DAAL_CHECK(dataTable, services::ErrorNullInputNumericTable);
+        const size_t nContributions = dataTable->getNumberOfColumns() + 1;
+        const size_t nGroups        = (par.nClasses == 2) ? 1 : par.nClasses;
+        DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nContributions, nContributions);
+        const size_t groupWidth = (par.resultsToCompute & predictionInteractions) ? nContributions * nContributions : nContributions;
+        DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nGroups, groupWidth);
+        _result->set(classifier::prediction::prediction,
+                     HomogenNumericTable<DAAL_FPTYPE>::create(nGroups * groupWidth, dataTable->getNumberOfRows(), NumericTable::doAllocate, &s));
+    }
+    return s;
+}
 } // namespace interface2
 } // namespace prediction
 } // namespace classification
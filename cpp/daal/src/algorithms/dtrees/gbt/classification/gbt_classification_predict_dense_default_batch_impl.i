@@ -36,6 +36,7 @@
 #include "src/algorithms/dtrees/regression/dtrees_regression_predict_dense_default_impl.i"
 #include "src/algorithms/dtrees/gbt/regression/gbt_regression_predict_dense_default_batch_impl.i"
 #include "src/algorithms/dtrees/gbt/gbt_predict_dense_default_impl.i"
+#include "src/algorithms/dtrees/gbt/gbt_predict_tree_shap_impl.i"
 #include "src/algorithms/objective_function/cross_entropy_loss/cross_entropy_loss_dense_default_batch_kernel.h"
 #include "src/services/service_algo_utils.h"
 
@@ -201,10 +202,21 @@ protected:
 template <typename algorithmFPType, prediction::Method method, CpuType cpu>
 services::Status PredictKernel<algorithmFPType, method, cpu>::compute(services::HostAppIface * pHostApp, const NumericTable * x,
                                                                       const classification::Model * m, NumericTable * r, NumericTable * prob,
-                                                                      size_t nClasses, size_t nIterations)
+                                                                      size_t nClasses, size_t nIterations, NumericTable * contributions,
+                                                                      DAAL_UINT64 resultsToCompute)
 {
     const daal::algorithms::gbt::classification::internal::ModelImpl * pModel =
         static_cast<const daal::algorithms::gbt::classification::internal::ModelImpl *>(m);
+    if (contributions)
+    {
+        /* a binary model has a single tree per iteration, a multiclass one has a tree per class */
+        const size_t nGroups = (nClasses == 2) ? 1 : nClasses;
+        DAAL_ASSERT(!nIterations || nGroups * nIterations <= pModel->size());
+        gbt::prediction::internal::PredictTreeShapTask<algorithmFPType, cpu> task(x, contributions);
+        services::Status s = task.run(pModel, (nIterations ? nIterations * nGroups : pModel->size()), nGroups,
+                                      (resultsToCompute & predictionInteractions) != 0, pHostApp);
+        if (!s || !prob) return s;
+    }
     if (nClasses == 2)
     {
         PredictBinaryClassificationTask<algorithmFPType, cpu> task(x, r, prob);
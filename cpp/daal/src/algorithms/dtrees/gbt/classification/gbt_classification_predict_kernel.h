@@ -56,9 +56,11 @@ public:
      *  \param r[out]   Prediction results
      *  \param nClasses[in]     Number of classes in gradient boosted trees algorithm parameter
      *  \param nIterations[in]  Number of iterations to predict in gradient boosted trees algorithm parameter
+     *  \param contributions[out]    Contributions of the features to the raw scores of the classes
+     *  \param resultsToCompute[in]  Contributions to compute: of the features or of the pairs of the features
      */
     services::Status compute(services::HostAppIface * pHostApp, const NumericTable * a, const classification::Model * m, NumericTable * r,
-                             NumericTable * prob, size_t nClasses, size_t nIterations);
+                             NumericTable * prob, size_t nClasses, size_t nIterations, NumericTable * contributions, DAAL_UINT64 resultsToCompute);
 };
 
 } // namespace internal
@@ -95,13 +95,16 @@ services::Status Input::check(const daal::algorithms::Parameter * parameter, int
     DAAL_CHECK(pModel->getNumberOfTrees(), services::ErrorNullModel);
 
     size_t nClasses = 0, nIterations = 0;
+    DAAL_UINT64 resultsToEvaluate = 0, resultsToCompute = 0;
 
     const gbt::classification::prediction::interface2::Parameter * pPrm2 =
         dynamic_cast<const gbt::classification::prediction::interface2::Parameter *>(parameter);
     if (pPrm2)
     {
-        nClasses    = pPrm2->nClasses;
-        nIterations = pPrm2->nIterations;
+        nClasses          = pPrm2->nClasses;
+        nIterations       = pPrm2->nIterations;
+        resultsToEvaluate = pPrm2->resultsToEvaluate;
+        resultsToCompute  = pPrm2->resultsToCompute;
     }
     else
         return services::ErrorNullParameterNotSupported;
@@ -110,6 +113,12 @@ services::Status Input::check(const daal::algorithms::Parameter * parameter, int
     if (nClasses > 2) maxNIterations /= nClasses;
     DAAL_CHECK((nClasses < 3) || (pModel->getNumberOfTrees() % nClasses == 0), services::ErrorGbtIncorrectNumberOfTrees);
     DAAL_CHECK((nIterations == 0) || (nIterations <= maxNIterations), services::ErrorGbtPredictIncorrectNumberOfIterations);
+
+    /* The contributions take the place of the class labels in the prediction table */
+    DAAL_CHECK_EX(resultsToCompute == 0 || resultsToCompute == predictionContributions || resultsToCompute == predictionInteractions,
+                  services::ErrorGbtPredictShapOptionsNotSupported, ParameterName, resultsToComputeStr());
+    DAAL_CHECK_EX(resultsToCompute == 0 || !(resultsToEvaluate & classifier::computeClassLabels), services::ErrorGbtPredictShapOptionsNotSupported,
+                  ParameterName, resultsToEvaluateStr());
     return s;
 }
 
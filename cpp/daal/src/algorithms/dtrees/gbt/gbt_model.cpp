@@ -351,6 +351,12 @@ const GbtDecisionTree * ModelImpl::at(const size_t idx) const
     return (const GbtDecisionTree *)(*super::_serializationData)[idx].get();
 }
 
+const int * ModelImpl::getNodeSampleCount(const size_t idx) const
+{
+    if (!super::_nNodeSampleTables || idx >= super::_nNodeSampleTables->size() || !(*super::_nNodeSampleTables)[idx]) return nullptr;
+    return super::getNodeSampleCount(idx);
+}
+
 } // namespace internal
 } // namespace gbt
 } // namespace algorithms
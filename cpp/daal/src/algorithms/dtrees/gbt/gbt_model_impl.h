@@ -63,17 +63,20 @@ public:
     DECLARE_SERIALIZABLE();
     using SplitPointType             = HomogenNumericTable<gbt::prediction::internal::ModelFPType>;
     using FeatureIndexesForSplitType = HomogenNumericTable<gbt::prediction::internal::FeatureIndexType>;
+    using DefaultLeftForSplitType    = HomogenNumericTable<int>;
 
     GbtDecisionTree(const size_t nNodes, const size_t maxLvl, const size_t sourceNumOfNodes)
         : _nNodes(nNodes),
           _maxLvl(maxLvl),
           _sourceNumOfNodes(sourceNumOfNodes),
+          _hasDefaultRightSplits(false),
           _splitPoints(SplitPointType::create(1, nNodes, NumericTableIface::doAllocate)),
-          _featureIndexes(FeatureIndexesForSplitType::create(1, nNodes, NumericTableIface::doAllocate))
+          _featureIndexes(FeatureIndexesForSplitType::create(1, nNodes, NumericTableIface::doAllocate)),
+          _defaultLeft(DefaultLeftForSplitType::create(1, nNodes, NumericTableIface::doAllocate, 1))
     {}
 
     // for serailization only
-    GbtDecisionTree() : _nNodes(0), _maxLvl(0), _sourceNumOfNodes(0) {}
+    GbtDecisionTree() : _nNodes(0), _maxLvl(0), _sourceNumOfNodes(0), _hasDefaultRightSplits(false) {}
 
     gbt::prediction::internal::ModelFPType * getSplitPoints() { return _splitPoints->getArray(); }
 
@@ -83,6 +86,21 @@ public:
 
     const gbt::prediction::internal::FeatureIndexType * getFeatureIndexesForSplit() const { return _featureIndexes->getArray(); }
 
+    // the child the missing values go to: 1 for the left one, 0 for the right one
+    int * getDefaultLeftForSplit() { return _defaultLeft->getArray(); }
+
+    const int * getDefaultLeftForSplit() const { return _defaultLeft->getArray(); }
+
+    // true if the missing values go to the right child at least in one split of the tree
+    bool hasDefaultRightSplits() const { return _hasDefaultRightSplits; }
+
+    void updateHasDefaultRightSplits()
+    {
+        const int * const defaultLeft = getDefaultLeftForSplit();
+        _hasDefaultRightSplits        = false;
+        for (size_t i = 0; i < _nNodes && !_hasDefaultRightSplits; ++i) _hasDefaultRightSplits = !defaultLeft[i];
+    }
+
     size_t getNumberOfNodes() const { return _nNodes; }
 
     size_t * getArrayNumSplitFeature() { return nNodeSplitFeature.data(); }
@@ -109,6 +127,7 @@ public:
 
         gbt::prediction::internal::ModelFPType * const spitPoints          = tree->getSplitPoints();
         gbt::prediction::internal::FeatureIndexType * const featureIndexes = tree->getFeatureIndexesForSplit();
+        int * const defaultLeft                                            = tree->getDefaultLeftForSplit();
 
         for (size_t i = 0; i < nNodes; ++i)
         {
@@ -147,12 +166,14 @@ public:
                     sons[nSons++]              = NodeType::castSplit(p->left());
                     sons[nSons++]              = NodeType::castSplit(p->right());
                     featureIndexes[idxInTable] = p->featureIdx;
+                    defaultLeft[idxInTable]    = p->defaultLeft;
                 }
                 else
                 {
                     sons[nSons++]              = p;
                     sons[nSons++]              = p;
                     featureIndexes[idxInTable] = 0;
+                    defaultLeft[idxInTable]    = 1;
                 }
                 DAAL_ASSERT(featureIndexes[idxInTable] >= 0);
                 nNodeSamplesVals[idxInTable] = (int)p->count;
@@ -167,6 +188,7 @@ public:
 
             nParents = nSons;
         }
+        tree->updateHasDefaultRightSplits();
 
         return (!result) ? services::Status() : services::Status(services::ErrorMemoryCopyFailedInternal);
     }
@@ -182,15 +204,39 @@ protected:
         arch->setSharedPtrObj(_splitPoints);
         arch->setSharedPtrObj(_featureIndexes);
 
+        if (getArchiveVersion(arch) >= COMPUTE_DAAL_VERSION(2021, 4, 0))
+        {
+            arch->setSharedPtrObj(_defaultLeft);
+        }
+        else if (onDeserialize)
+        {
+            // the trees of the older versions send the missing values to the left child
+            _defaultLeft = DefaultLeftForSplitType::create(1, _nNodes, NumericTableIface::doAllocate, 1);
+        }
+        if (onDeserialize)
+        {
+            DAAL_CHECK_MALLOC(_defaultLeft.get() && _defaultLeft->getArray());
+            updateHasDefaultRightSplits();
+        }
+
         return services::Status();
     }
 
+    // the trees are written in the format of the version the archive is created for
+    template <typename Archive>
+    static int getArchiveVersion(const Archive * arch)
+    {
+        return COMPUTE_DAAL_VERSION(arch->getMajorVersion(), arch->getMinorVersion(), arch->getUpdateVersion());
+    }
+
 protected:
     size_t _nNodes;
     gbt::prediction::internal::FeatureIndexType _maxLvl;
     size_t _sourceNumOfNodes;
+    bool _hasDefaultRightSplits;
     services::SharedPtr<SplitPointType> _splitPoints;
     services::SharedPtr<FeatureIndexesForSplitType> _featureIndexes;
+    services::SharedPtr<DefaultLeftForSplitType> _defaultLeft;
     services::Collection<size_t> nNodeSplitFeature;
     services::Collection<size_t> CoverFeature;
     services::Collection<double> GainFeature;
@@ -271,6 +317,9 @@ public:
 
     const GbtDecisionTree * at(const size_t idx) const;
 
+    // Numbers of the training observations in the nodes of the tree, nullptr if the model does not have them
+    const int * getNodeSampleCount(const size_t idx) const;
+
     static void decisionTreeToGbtTree(const DecisionTreeTable & tree, GbtDecisionTree & gbtTree);
     static services::Status convertDecisionTreesToGbtTrees(data_management::DataCollectionPtr & serializationData);
 
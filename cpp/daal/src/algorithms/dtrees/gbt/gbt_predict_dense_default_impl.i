@@ -30,6 +30,7 @@
 #include "src/algorithms/dtrees/dtrees_predict_dense_default_impl.i"
 #include "src/algorithms/dtrees/dtrees_feature_type_helper.h"
 #include "src/algorithms/dtrees/gbt/gbt_internal.h"
+#include "src/services/service_data_utils.h"
 
 namespace daal
 {
@@ -45,11 +46,14 @@ typedef float ModelFPType;
 typedef uint32_t FeatureIndexType;
 const FeatureIndexType VECTOR_BLOCK_SIZE = 64;
 
+// The missing (NaN) values of an ordered feature follow the default direction of the split, the comparison with the split point
+// sends them to the left child. The missing values of a categorical feature always go to the right child.
 template <typename algorithmFPType, typename DecisionTreeType, CpuType cpu>
 inline void predictForTreeVector(const DecisionTreeType & t, const FeatureTypes & featTypes, const algorithmFPType * x, algorithmFPType v[])
 {
     const ModelFPType * const values        = t.getSplitPoints() - 1;
     const FeatureIndexType * const fIndexes = t.getFeatureIndexesForSplit() - 1;
+    const int * const defaultLeft           = t.getDefaultLeftForSplit() - 1;
     const FeatureIndexType nFeat            = featTypes.getNumberOfFeatures();
 
     FeatureIndexType i[VECTOR_BLOCK_SIZE];
@@ -69,8 +73,26 @@ inline void predictForTreeVector(const DecisionTreeType & t, const FeatureTypes
                 const FeatureIndexType splitFeature = fIndexes[idx];
                 const ModelFPType valueFromDataSet  = x[splitFeature + k * nFeat];
                 const ModelFPType splitPoint        = values[idx];
+                const int isMissing                 = services::internal::IsNaN<ModelFPType, cpu>::get(valueFromDataSet);
 
-                i[k] = idx * 2 + (featTypes.isUnordered(splitFeature) ? valueFromDataSet != splitPoint : valueFromDataSet > splitPoint);
+                i[k] = idx * 2
+                       + (featTypes.isUnordered(splitFeature) ? valueFromDataSet != splitPoint :
+                                                                (valueFromDataSet > splitPoint) | (isMissing & !defaultLeft[idx]));
+            }
+        }
+    }
+    else if (t.hasDefaultRightSplits())
+    {
+        for (FeatureIndexType itr = 0; itr < maxLvl; itr++)
+        {
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (FeatureIndexType k = 0; k < VECTOR_BLOCK_SIZE; k++)
+            {
+                const FeatureIndexType idx = i[k];
+                const algorithmFPType xVal = x[fIndexes[idx] + k * nFeat];
+                const int isMissing        = services::internal::IsNaN<algorithmFPType, cpu>::get(xVal);
+                i[k]                       = idx * 2 + ((xVal > values[idx]) | (isMissing & !defaultLeft[idx]));
             }
         }
     }
@@ -101,6 +123,7 @@ inline algorithmFPType predictForTree(const DecisionTreeType & t, const FeatureT
 {
     const ModelFPType * const values        = (const ModelFPType *)t.getSplitPoints() - 1;
     const FeatureIndexType * const fIndexes = t.getFeatureIndexesForSplit() - 1;
+    const int * const defaultLeft           = t.getDefaultLeftForSplit() - 1;
 
     const FeatureIndexType maxLvl = t.getMaxLvl();
 
@@ -110,7 +133,21 @@ inline algorithmFPType predictForTree(const DecisionTreeType & t, const FeatureT
     {
         for (FeatureIndexType itr = 0; itr < maxLvl; itr++)
         {
-            i = i * 2 + (featTypes.isUnordered(fIndexes[i]) ? int(x[fIndexes[i]]) != int(values[i]) : x[fIndexes[i]] > values[i]);
+            const algorithmFPType xVal = x[fIndexes[i]];
+            const bool isMissing       = services::internal::IsNaN<algorithmFPType, cpu>::get(xVal);
+            if (featTypes.isUnordered(fIndexes[i]))
+                i = i * 2 + (isMissing || int(xVal) != int(values[i]));
+            else
+                i = i * 2 + ((xVal > values[i]) || (isMissing && !defaultLeft[i]));
+        }
+    }
+    else if (t.hasDefaultRightSplits())
+    {
+        for (FeatureIndexType itr = 0; itr < maxLvl; itr++)
+        {
+            const algorithmFPType xVal = x[fIndexes[i]];
+            const int isMissing        = services::internal::IsNaN<algorithmFPType, cpu>::get(xVal);
+            i                          = i * 2 + ((xVal > values[i]) | (isMissing & !defaultLeft[i]));
         }
     }
     else
@@ -0,0 +1,645 @@
+/* file: gbt_predict_tree_shap_impl.i */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the feature contributions (SHAP values) and the feature
+//  interactions (SHAP interaction values) computation for gradient boosted trees
+//  by the polynomial TreeSHAP algorithm:
+//  S.M. Lundberg, G.G. Erion, S.-I. Lee. Consistent Individualized Feature
+//  Attribution for Tree Ensembles. arXiv:1802.03888, 2018.
+//--
+*/
+
+#ifndef __GBT_PREDICT_TREE_SHAP_IMPL_I__
+#define __GBT_PREDICT_TREE_SHAP_IMPL_I__
+
+#include "src/algorithms/dtrees/gbt/gbt_model_impl.h"
+#include "src/algorithms/dtrees/gbt/gbt_predict_dense_default_impl.i"
+#include "src/algorithms/service_threading.h"
+#include "src/data_management/service_numeric_table.h"
+#include "src/externals/service_memory.h"
+#include "src/services/service_algo_utils.h"
+#include "src/services/service_arrays.h"
+#include "src/services/service_utils.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace gbt
+{
+namespace prediction
+{
+namespace internal
+{
+/* Number of rows processed by one traversal of a tree */
+const size_t SHAP_BLOCK_SIZE = 32;
+
+/* Maximal number of the result values of the rows processed by all threads at once */
+const size_t SHAP_CHUNK_SIZE = 1 << 18;
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// TreeShap computes the contributions of a tree for a block of SHAP_BLOCK_SIZE rows.
+//
+// The TreeSHAP recursion visits every node of the tree whatever the row is: a row only
+// defines which child of a split is "hot", i.e. the one the row follows. The features and
+// the zero fractions of the unique path are the same for all rows, only the one fractions,
+// the permutation weights and the condition fractions depend on the row. So the tree is
+// traversed once for the whole block and all the path updates are vectorized across rows.
+//////////////////////////////////////////////////////////////////////////////////////////
+template <typename algorithmFPType, typename DecisionTreeType, CpuType cpu>
+class TreeShap
+{
+public:
+    static const size_t blockSize = SHAP_BLOCK_SIZE;
+
+    /* Number of elements in all the unique paths of the recursion over a tree of the depth maxLvl */
+    static size_t getNumberOfPathElements(size_t maxLvl) { return (maxLvl + 3) * (maxLvl + 4) / 2; }
+
+    static size_t getFPWorkspaceSize(size_t maxLvl, size_t nFeatures, bool interactions)
+    {
+        const size_t nElements = getNumberOfPathElements(maxLvl);
+        return nElements * (2 * blockSize + 1) + (maxLvl + 1) * nLevelBuffers * blockSize + 3 * blockSize
+               + (interactions ? 3 * blockSize * (nFeatures + 1) : 0);
+    }
+
+    static size_t getIntWorkspaceSize(size_t maxLvl, size_t nFeatures) { return getNumberOfPathElements(maxLvl) + 2 * nFeatures; }
+
+    /*
+     * \param fpWorkspace   Buffer of getFPWorkspaceSize() elements
+     * \param intWorkspace  Buffer of getIntWorkspaceSize() elements filled with zeros
+     */
+    TreeShap(algorithmFPType * fpWorkspace, int * intWorkspace, size_t maxLvl, size_t nFeatures, const FeatureTypes & featHelper)
+        : _nFeatures(nFeatures), _featHelper(featHelper)
+    {
+        const size_t nElements = getNumberOfPathElements(maxLvl);
+
+        _zero     = fpWorkspace;
+        _one      = _zero + nElements;
+        _pweight  = _one + nElements * blockSize;
+        _levels   = _pweight + nElements * blockSize;
+        _next     = _levels + (maxLvl + 1) * nLevelBuffers * blockSize;
+        _total    = _next + blockSize;
+        _ones     = _total + blockSize;
+        _phiDiag  = _ones + blockSize;
+        _phiOn    = _phiDiag + blockSize * (nFeatures + 1);
+        _phiOff   = _phiOn + blockSize * (nFeatures + 1);
+        _features = intWorkspace;
+        _isUsed   = _features + nElements;
+        _used     = _isUsed + nFeatures;
+
+        for (size_t r = 0; r < blockSize; ++r) _ones[r] = algorithmFPType(1);
+    }
+
+    /*
+     * Adds the SHAP values of the tree to phi: the value of the feature j for the row r goes to
+     * phi[r * ldPhi + j], the expected value of the tree goes to phi[r * ldPhi + nFeatures]
+     */
+    void computeContributions(const DecisionTreeType & t, const int * nodeCover, const algorithmFPType * x, size_t nRows, algorithmFPType * phi,
+                              size_t ldPhi)
+    {
+        setTree(t, nodeCover, x, nRows);
+        traverse(0, 0, phi, ldPhi);
+
+        const algorithmFPType bias = getNodeMean(0, 0);
+        for (size_t r = 0; r < _nRows; ++r) phi[r * ldPhi + _nFeatures] += bias;
+    }
+
+    /*
+     * Adds the SHAP interaction values of the tree to phi: the (nFeatures + 1) x (nFeatures + 1) matrix
+     * of the row r starts from phi[r * ldPhi], the last row and column of the matrix stand for the bias
+     */
+    void computeInteractions(const DecisionTreeType & t, const int * nodeCover, const algorithmFPType * x, size_t nRows, algorithmFPType * phi,
+                             size_t ldPhi)
+    {
+        setTree(t, nodeCover, x, nRows);
+        const size_t nContributions = _nFeatures + 1;
+
+        /* Only the features the tree splits on get non-zero values */
+        size_t nUsed = 0;
+        collectSplitFeatures(0, 0, nUsed);
+
+        resetUsedFeatures(_phiDiag, nUsed);
+        traverse(0, 0, _phiDiag, nContributions);
+
+        /* Interaction of the features i and k is the half of the difference between the contributions
+           of k conditioned on i being present and on i being missing */
+        for (size_t iUsed = 0; iUsed < nUsed; ++iUsed)
+        {
+            const int i = _used[iUsed];
+            resetUsedFeatures(_phiOn, nUsed);
+            resetUsedFeatures(_phiOff, nUsed);
+            traverse(1, i, _phiOn, nContributions);
+            traverse(-1, i, _phiOff, nContributions);
+
+            for (size_t r = 0; r < _nRows; ++r)
+            {
+                algorithmFPType * const phiRow  = phi + r * ldPhi + i * nContributions;
+                const algorithmFPType * const on  = _phiOn + r * nContributions;
+                const algorithmFPType * const off = _phiOff + r * nContributions;
+                algorithmFPType diag              = _phiDiag[r * nContributions + i];
+                for (size_t kUsed = 0; kUsed < nUsed; ++kUsed)
+                {
+                    const int k = _used[kUsed];
+                    if (k == i) continue;
+                    const algorithmFPType value = (on[k] - off[k]) * algorithmFPType(0.5);
+                    phiRow[k] += value;
+                    diag -= value;
+                }
+                phiRow[i] += diag;
+            }
+        }
+
+        for (size_t iUsed = 0; iUsed < nUsed; ++iUsed) _isUsed[_used[iUsed]] = 0;
+
+        const algorithmFPType bias = getNodeMean(0, 0);
+        for (size_t r = 0; r < _nRows; ++r) phi[r * ldPhi + _nFeatures * nContributions + _nFeatures] += bias;
+    }
+
+private:
+    /* Per-level buffers: incoming one fractions, one fractions and condition fractions of the children */
+    static const size_t nLevelBuffers = 5;
+
+    void setTree(const DecisionTreeType & t, const int * nodeCover, const algorithmFPType * x, size_t nRows)
+    {
+        _values      = t.getSplitPoints();
+        _fIndexes    = t.getFeatureIndexesForSplit();
+        _defaultLeft = t.getDefaultLeftForSplit();
+        _maxLvl      = t.getMaxLvl();
+        _cover       = nodeCover;
+        _x           = x;
+        _nRows       = nRows;
+    }
+
+    bool isLeaf(size_t idx, size_t lvl) const
+    {
+        if (lvl == _maxLvl) return true;
+        /* leaves above the last level are duplicated down to it */
+        const size_t left = 2 * idx + 1;
+        return _values[left] == _values[idx] && _fIndexes[left] == _fIndexes[idx];
+    }
+
+    algorithmFPType getNodeMean(size_t idx, size_t lvl) const
+    {
+        if (isLeaf(idx, lvl)) return _values[idx];
+        const size_t left  = 2 * idx + 1;
+        const size_t right = 2 * idx + 2;
+        return (algorithmFPType(_cover[left]) * getNodeMean(left, lvl + 1) + algorithmFPType(_cover[right]) * getNodeMean(right, lvl + 1))
+               / algorithmFPType(_cover[idx]);
+    }
+
+    void collectSplitFeatures(size_t idx, size_t lvl, size_t & nUsed)
+    {
+        if (isLeaf(idx, lvl)) return;
+        const FeatureIndexType iFeature = _fIndexes[idx];
+        if (!_isUsed[iFeature])
+        {
+            _isUsed[iFeature] = 1;
+            _used[nUsed++]    = int(iFeature);
+        }
+        collectSplitFeatures(2 * idx + 1, lvl + 1, nUsed);
+        collectSplitFeatures(2 * idx + 2, lvl + 1, nUsed);
+    }
+
+    void resetUsedFeatures(algorithmFPType * phi, size_t nUsed)
+    {
+        const size_t nContributions = _nFeatures + 1;
+        for (size_t r = 0; r < blockSize; ++r)
+        {
+            for (size_t iUsed = 0; iUsed < nUsed; ++iUsed) phi[r * nContributions + _used[iUsed]] = 0;
+        }
+    }
+
+    void traverse(int condition, int conditionFeature, algorithmFPType * phi, size_t ldPhi)
+    {
+        _condition        = condition;
+        _conditionFeature = conditionFeature;
+        _phi              = phi;
+        _ldPhi            = ldPhi;
+        /* The path starts from the dummy element of the feature -1 with the weight 1 */
+        computeNode(0, 0, 0, 0, algorithmFPType(1), _ones, -1, _ones);
+    }
+
+    /* Adds an element to the end of the unique path and updates the permutation weights */
+    void extendPath(size_t base, size_t uniqueDepth, algorithmFPType zeroFraction, const algorithmFPType * oneFraction, int iFeature)
+    {
+        const size_t iElement  = base + uniqueDepth;
+        _features[iElement]    = iFeature;
+        _zero[iElement]        = zeroFraction;
+        algorithmFPType * one  = _one + iElement * blockSize;
+        algorithmFPType * pw   = _pweight + iElement * blockSize;
+        const algorithmFPType w = (uniqueDepth == 0) ? algorithmFPType(1) : algorithmFPType(0);
+
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t r = 0; r < blockSize; ++r)
+        {
+            one[r] = oneFraction[r];
+            pw[r]  = w;
+        }
+
+        const algorithmFPType invDepth = algorithmFPType(1) / algorithmFPType(uniqueDepth + 1);
+        for (size_t i = uniqueDepth; i-- > 0;)
+        {
+            algorithmFPType * pwCur        = _pweight + (base + i) * blockSize;
+            algorithmFPType * pwNext       = pwCur + blockSize;
+            const algorithmFPType oneCoeff  = algorithmFPType(i + 1) * invDepth;
+            const algorithmFPType zeroCoeff = zeroFraction * algorithmFPType(uniqueDepth - i) * invDepth;
+
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t r = 0; r < blockSize; ++r)
+            {
+                pwNext[r] += one[r] * pwCur[r] * oneCoeff;
+                pwCur[r] *= zeroCoeff;
+            }
+        }
+    }
+
+    /* Removes the element pathIndex from the unique path and restores the permutation weights */
+    void unwindPath(size_t base, size_t uniqueDepth, size_t pathIndex)
+    {
+        const algorithmFPType zeroFraction = _zero[base + pathIndex];
+        const algorithmFPType * one        = _one + (base + pathIndex) * blockSize;
+        const algorithmFPType * pwLast     = _pweight + (base + uniqueDepth) * blockSize;
+        algorithmFPType * next             = _next;
+
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t r = 0; r < blockSize; ++r) next[r] = pwLast[r];
+
+        for (size_t i = uniqueDepth; i-- > 0;)
+        {
+            algorithmFPType * pw = _pweight + (base + i) * blockSize;
+            algorithmFPType oneCoeff, zeroCoeff, zeroInvCoeff;
+            getUnwindCoefficients(uniqueDepth, i, zeroFraction, oneCoeff, zeroCoeff, zeroInvCoeff);
+
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t r = 0; r < blockSize; ++r)
+            {
+                const bool isHot              = one[r] != 0;
+                const algorithmFPType w       = pw[r];
+                const algorithmFPType wHot    = next[r] * oneCoeff / (isHot ? one[r] : algorithmFPType(1));
+                pw[r]                         = isHot ? wHot : w * zeroInvCoeff;
+                next[r]                       = isHot ? w - wHot * zeroCoeff : next[r];
+            }
+        }
+
+        for (size_t i = pathIndex; i < uniqueDepth; ++i)
+        {
+            const size_t iElement = base + i;
+            _features[iElement]   = _features[iElement + 1];
+            _zero[iElement]       = _zero[iElement + 1];
+            algorithmFPType * dst       = _one + iElement * blockSize;
+            const algorithmFPType * src = dst + blockSize;
+
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t r = 0; r < blockSize; ++r) dst[r] = src[r];
+        }
+    }
+
+    /* Computes the total permutation weight the path would have without the element pathIndex */
+    void unwoundPathSum(size_t base, size_t uniqueDepth, size_t pathIndex, algorithmFPType * total)
+    {
+        const algorithmFPType zeroFraction = _zero[base + pathIndex];
+        const algorithmFPType * one        = _one + (base + pathIndex) * blockSize;
+        const algorithmFPType * pwLast     = _pweight + (base + uniqueDepth) * blockSize;
+        algorithmFPType * next             = _next;
+
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t r = 0; r < blockSize; ++r)
+        {
+            next[r]  = pwLast[r];
+            total[r] = 0;
+        }
+
+        for (size_t i = uniqueDepth; i-- > 0;)
+        {
+            const algorithmFPType * pw = _pweight + (base + i) * blockSize;
+            algorithmFPType oneCoeff, zeroCoeff, zeroInvCoeff;
+            getUnwindCoefficients(uniqueDepth, i, zeroFraction, oneCoeff, zeroCoeff, zeroInvCoeff);
+
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t r = 0; r < blockSize; ++r)
+            {
+                const bool isHot           = one[r] != 0;
+                const algorithmFPType w    = pw[r];
+                const algorithmFPType wHot = next[r] * oneCoeff / (isHot ? one[r] : algorithmFPType(1));
+                total[r] += isHot ? wHot : w * zeroInvCoeff;
+                next[r] = isHot ? w - wHot * zeroCoeff : next[r];
+            }
+        }
+    }
+
+    static void getUnwindCoefficients(size_t uniqueDepth, size_t i, algorithmFPType zeroFraction, algorithmFPType & oneCoeff,
+                                      algorithmFPType & zeroCoeff, algorithmFPType & zeroInvCoeff)
+    {
+        const algorithmFPType depth     = algorithmFPType(uniqueDepth + 1);
+        const algorithmFPType remaining = algorithmFPType(uniqueDepth - i);
+        oneCoeff                        = depth / algorithmFPType(i + 1);
+        zeroCoeff                       = zeroFraction * remaining / depth;
+        zeroInvCoeff                    = (zeroFraction != 0) ? depth / (zeroFraction * remaining) : algorithmFPType(0);
+    }
+
+    void computeNode(size_t idx, size_t lvl, size_t uniqueDepth, size_t parentBase, algorithmFPType parentZero, const algorithmFPType * parentOne,
+                     int parentFeature, const algorithmFPType * conditionFraction)
+    {
+        /* stop if no row brings weight to the node */
+        if (_condition)
+        {
+            bool hasWeight = false;
+            for (size_t r = 0; r < blockSize; ++r) hasWeight |= (conditionFraction[r] != 0);
+            if (!hasWeight) return;
+        }
+
+        /* extend the copy of the parent's unique path */
+        const size_t base = parentBase + uniqueDepth + 1;
+        for (size_t i = 0; i <= uniqueDepth; ++i)
+        {
+            _features[base + i] = _features[parentBase + i];
+            _zero[base + i]     = _zero[parentBase + i];
+        }
+        const size_t nCopied = (uniqueDepth + 1) * blockSize;
+        services::internal::tmemcpy<algorithmFPType, cpu>(_one + base * blockSize, _one + parentBase * blockSize, nCopied);
+        services::internal::tmemcpy<algorithmFPType, cpu>(_pweight + base * blockSize, _pweight + parentBase * blockSize, nCopied);
+
+        if (!_condition || _conditionFeature != parentFeature) extendPath(base, uniqueDepth, parentZero, parentOne, parentFeature);
+
+        if (isLeaf(idx, lvl))
+        {
+            const algorithmFPType leafValue = _values[idx];
+            for (size_t i = 1; i <= uniqueDepth; ++i)
+            {
+                unwoundPathSum(base, uniqueDepth, i, _total);
+                const size_t iElement              = base + i;
+                const algorithmFPType zeroFraction = _zero[iElement];
+                const algorithmFPType * one        = _one + iElement * blockSize;
+                algorithmFPType * phi              = _phi + _features[iElement];
+                for (size_t r = 0; r < _nRows; ++r)
+                {
+                    phi[r * _ldPhi] += _total[r] * (one[r] - zeroFraction) * leafValue * conditionFraction[r];
+                }
+            }
+            return;
+        }
+
+        algorithmFPType * const incomingOne = _levels + lvl * nLevelBuffers * blockSize;
+        algorithmFPType * const leftOne     = incomingOne + blockSize;
+        algorithmFPType * const rightOne    = leftOne + blockSize;
+        algorithmFPType * const leftCond    = rightOne + blockSize;
+        algorithmFPType * const rightCond   = leftCond + blockSize;
+
+        const FeatureIndexType iFeature = _fIndexes[idx];
+        const size_t left               = 2 * idx + 1;
+        const size_t right              = 2 * idx + 2;
+        const algorithmFPType cover     = algorithmFPType(_cover[idx]);
+        const algorithmFPType leftZero  = algorithmFPType(_cover[left]) / cover;
+        const algorithmFPType rightZero = algorithmFPType(_cover[right]) / cover;
+
+        /* the direction each row goes, in the same way as the prediction does */
+        const ModelFPType splitPoint = _values[idx];
+        if (_featHelper.isUnordered(iFeature))
+        {
+            for (size_t r = 0; r < _nRows; ++r)
+            {
+                const algorithmFPType xVal = _x[r * _nFeatures + iFeature];
+                leftOne[r]                 = (services::internal::IsNaN<algorithmFPType, cpu>::get(xVal) || int(xVal) != int(splitPoint)) ? 0 : 1;
+            }
+        }
+        else
+        {
+            const int defaultLeft = _defaultLeft[idx];
+            for (size_t r = 0; r < _nRows; ++r)
+            {
+                const algorithmFPType xVal = _x[r * _nFeatures + iFeature];
+                if (services::internal::IsNaN<algorithmFPType, cpu>::get(xVal))
+                    leftOne[r] = defaultLeft;
+                else
+                    leftOne[r] = (xVal > splitPoint) ? 0 : 1;
+            }
+        }
+        for (size_t r = _nRows; r < blockSize; ++r) leftOne[r] = 1;
+
+        /* undo the previous split on the same feature to redo it for this node */
+        algorithmFPType incomingZero = 1;
+        size_t pathIndex             = 0;
+        for (; pathIndex <= uniqueDepth; ++pathIndex)
+        {
+            if (_features[base + pathIndex] == int(iFeature)) break;
+        }
+        size_t childDepth = uniqueDepth + 1;
+        if (pathIndex <= uniqueDepth)
+        {
+            incomingZero = _zero[base + pathIndex];
+            services::internal::tmemcpy<algorithmFPType, cpu>(incomingOne, _one + (base + pathIndex) * blockSize, blockSize);
+            unwindPath(base, uniqueDepth, pathIndex);
+            --childDepth;
+        }
+        else
+        {
+            services::internal::tmemcpy<algorithmFPType, cpu>(incomingOne, _ones, blockSize);
+        }
+
+        /* divide the condition fraction between the children */
+        const bool isConditionSplit = _condition && (int(iFeature) == _conditionFeature);
+        if (isConditionSplit) --childDepth;
+
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t r = 0; r < blockSize; ++r)
+        {
+            const algorithmFPType isLeft = leftOne[r];
+            leftOne[r]                   = incomingOne[r] * isLeft;
+            rightOne[r]                  = incomingOne[r] * (algorithmFPType(1) - isLeft);
+            leftCond[r]                  = conditionFraction[r];
+            rightCond[r]                 = conditionFraction[r];
+            if (isConditionSplit)
+            {
+                /* the feature is present: the rows follow their own way only,
+                   the feature is missing: the rows go both ways weighted by the covers */
+                leftCond[r] *= (_condition > 0) ? isLeft : leftZero;
+                rightCond[r] *= (_condition > 0) ? (algorithmFPType(1) - isLeft) : rightZero;
+            }
+        }
+
+        computeNode(left, lvl + 1, childDepth, base, leftZero * incomingZero, leftOne, int(iFeature), leftCond);
+        computeNode(right, lvl + 1, childDepth, base, rightZero * incomingZero, rightOne, int(iFeature), rightCond);
+    }
+
+private:
+    const size_t _nFeatures;
+    const FeatureTypes & _featHelper;
+
+    /* current tree and rows */
+    const ModelFPType * _values        = nullptr;
+    const FeatureIndexType * _fIndexes = nullptr;
+    const int * _defaultLeft           = nullptr;
+    const int * _cover                 = nullptr;
+    size_t _maxLvl                     = 0;
+    const algorithmFPType * _x         = nullptr;
+    size_t _nRows                      = 0;
+
+    /* current traversal */
+    int _condition         = 0;
+    int _conditionFeature  = -1;
+    algorithmFPType * _phi = nullptr;
+    size_t _ldPhi          = 0;
+
+    /* unique paths of the recursion, the row-dependent values of an element are stored contiguously */
+    int * _features           = nullptr;
+    algorithmFPType * _zero    = nullptr;
+    algorithmFPType * _one     = nullptr;
+    algorithmFPType * _pweight = nullptr;
+
+    algorithmFPType * _levels  = nullptr;
+    algorithmFPType * _next    = nullptr;
+    algorithmFPType * _total   = nullptr;
+    algorithmFPType * _ones    = nullptr;
+    algorithmFPType * _phiDiag = nullptr;
+    algorithmFPType * _phiOn   = nullptr;
+    algorithmFPType * _phiOff  = nullptr;
+    int * _isUsed              = nullptr;
+    int * _used                = nullptr;
+};
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// PredictTreeShapTask computes the feature contributions or the feature interactions of
+// the trees of the model for all rows of the data.
+//
+// The trees are split into nGroups groups by the tree index modulo nGroups, as the trees of
+// the classes of a multiclass model are, each group gets its own columns of the result.
+// The rows are processed by chunks, the pairs (tree, block of rows) of a chunk are
+// distributed between the threads, each thread accumulates the values in its own copy of
+// the results of the chunk.
+//////////////////////////////////////////////////////////////////////////////////////////
+template <typename algorithmFPType, CpuType cpu>
+class PredictTreeShapTask
+{
+public:
+    typedef gbt::internal::GbtDecisionTree TreeType;
+    typedef TreeShap<algorithmFPType, TreeType, cpu> ShapType;
+
+    PredictTreeShapTask(const NumericTable * x, NumericTable * y) : _data(x), _res(y) {}
+
+    services::Status run(const gbt::internal::ModelImpl * m, size_t nTrees, size_t nGroups, bool interactions, services::HostAppIface * pHostApp)
+    {
+        DAAL_CHECK_MALLOC(_featHelper.init(*_data));
+
+        const size_t nRowsTotal     = _data->getNumberOfRows();
+        const size_t nFeatures      = _data->getNumberOfColumns();
+        const size_t nContributions = nFeatures + 1;
+        DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nContributions, nContributions);
+        const size_t groupWidth = interactions ? nContributions * nContributions : nContributions;
+        DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nGroups, groupWidth);
+        const size_t rowWidth = nGroups * groupWidth;
+        DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, ShapType::blockSize, rowWidth);
+        const size_t blockWidth = ShapType::blockSize * rowWidth;
+        DAAL_CHECK(_res->getNumberOfColumns() == rowWidth, services::ErrorIncorrectNumberOfColumns);
+
+        TArray<const TreeType *, cpu> aTree(nTrees);
+        TArray<const int *, cpu> aCover(nTrees);
+        DAAL_CHECK_MALLOC(aTree.get() && aCover.get());
+        size_t maxLvl = 0;
+        for (size_t i = 0; i < nTrees; ++i)
+        {
+            aTree[i]  = m->at(i);
+            aCover[i] = m->getNodeSampleCount(i);
+            DAAL_CHECK(aCover[i] && aCover[i][0] > 0, services::ErrorGbtPredictShapNoNodeCover);
+            if (aTree[i]->getMaxLvl() > maxLvl) maxLvl = aTree[i]->getMaxLvl();
+        }
+
+        const size_t nBlocksTotal = nRowsTotal / ShapType::blockSize + !!(nRowsTotal % ShapType::blockSize);
+        size_t nBlocksInChunk     = SHAP_CHUNK_SIZE / blockWidth;
+        if (nBlocksInChunk < 1) nBlocksInChunk = 1;
+        if (nBlocksInChunk > nBlocksTotal) nBlocksInChunk = nBlocksTotal;
+
+        StaticTlsMem<algorithmFPType, cpu, services::internal::ScalableCalloc<algorithmFPType, cpu> > tlsResult(nBlocksInChunk * blockWidth);
+        StaticTlsMem<algorithmFPType, cpu> tlsFPWorkspace(ShapType::getFPWorkspaceSize(maxLvl, nFeatures, interactions));
+        StaticTlsMem<int, cpu, services::internal::ScalableCalloc<int, cpu> > tlsIntWorkspace(ShapType::getIntWorkspaceSize(maxLvl, nFeatures));
+
+        services::Status s;
+        HostAppHelper host(pHostApp, 100);
+        for (size_t iFirstBlock = 0; iFirstBlock < nBlocksTotal; iFirstBlock += nBlocksInChunk)
+        {
+            if (host.isCancelled(s, 1)) return s;
+
+            const size_t nBlocks   = (iFirstBlock + nBlocksInChunk < nBlocksTotal) ? nBlocksInChunk : nBlocksTotal - iFirstBlock;
+            const size_t iStartRow = iFirstBlock * ShapType::blockSize;
+            const size_t nRowsLeft = nRowsTotal - iStartRow;
+            const size_t nRows     = (nBlocks * ShapType::blockSize < nRowsLeft) ? nBlocks * ShapType::blockSize : nRowsLeft;
+
+            ReadRows<algorithmFPType, cpu> xBD(const_cast<NumericTable *>(_data), iStartRow, nRows);
+            DAAL_CHECK_BLOCK_STATUS(xBD);
+            WriteOnlyRows<algorithmFPType, cpu> resBD(_res, iStartRow, nRows);
+            DAAL_CHECK_BLOCK_STATUS(resBD);
+            const algorithmFPType * const x = xBD.get();
+            algorithmFPType * const res     = resBD.get();
+
+            SafeStatus safeStat;
+            daal::static_threader_for(nTrees * nBlocks, [&](size_t iTask, size_t tid) {
+                const size_t iTree = iTask / nBlocks;
+                const size_t iRow  = (iTask % nBlocks) * ShapType::blockSize;
+
+                algorithmFPType * const localRes = tlsResult.local(tid);
+                algorithmFPType * const fpBuf    = tlsFPWorkspace.local(tid);
+                int * const intBuf               = tlsIntWorkspace.local(tid);
+                DAAL_CHECK_THR(localRes && fpBuf && intBuf, services::ErrorMemoryAllocationFailed);
+
+                const size_t nBlockRows = (iRow + ShapType::blockSize < nRows) ? ShapType::blockSize : nRows - iRow;
+                algorithmFPType * const phi = localRes + iRow * rowWidth + (iTree % nGroups) * groupWidth;
+
+                ShapType shap(fpBuf, intBuf, maxLvl, nFeatures, _featHelper);
+                if (interactions)
+                    shap.computeInteractions(*aTree[iTree], aCover[iTree], x + iRow * nFeatures, nBlockRows, phi, rowWidth);
+                else
+                    shap.computeContributions(*aTree[iTree], aCover[iTree], x + iRow * nFeatures, nBlockRows, phi, rowWidth);
+            });
+            DAAL_CHECK_SAFE_STATUS();
+
+            const size_t nValues = nRows * rowWidth;
+            services::internal::service_memset<algorithmFPType, cpu>(res, algorithmFPType(0), nValues);
+            tlsResult.reduce([&](algorithmFPType * localRes) -> void {
+                PRAGMA_IVDEP
+                PRAGMA_VECTOR_ALWAYS
+                for (size_t i = 0; i < nValues; ++i)
+                {
+                    res[i] += localRes[i];
+                    localRes[i] = 0;
+                }
+            });
+        }
+        return s;
+    }
+
+protected:
+    dtrees::internal::FeatureTypes _featHelper;
+    const NumericTable * _data;
+    NumericTable * _res;
+};
+
+} /* namespace internal */
+} /* namespace prediction */
+} /* namespace gbt */
+} /* namespace algorithms */
+} /* namespace daal */
+
+#endif
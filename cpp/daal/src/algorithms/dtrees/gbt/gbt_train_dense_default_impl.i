@@ -101,10 +101,23 @@ public:
         return ((nSamples < 2 * _par.minObservationsInLeafNode) || ((_par.maxTreeDepth > 0) && (level >= _par.maxTreeDepth)));
     }
 
-    void featureValuesToBuf(size_t iFeature, algorithmFPType * featureVal, int * aIdx, size_t n)
+    //returns the number of missing (NaN) values, they are moved to the beginning of the buffer, the rest are sorted
+    size_t featureValuesToBuf(size_t iFeature, algorithmFPType * featureVal, int * aIdx, size_t n)
     {
         _dataHelper.getColumnValues(iFeature, aIdx, n, featureVal);
-        daal::algorithms::internal::qSort<algorithmFPType, int, cpu>(n, featureVal, aIdx);
+        size_t nMissing = 0;
+        for (size_t i = 0; i < n; ++i)
+        {
+            if (!services::internal::IsNaN<algorithmFPType, cpu>::get(featureVal[i])) continue;
+            featureVal[i]        = featureVal[nMissing];
+            featureVal[nMissing] = algorithmFPType(0); //the value of a missing observation is never used
+            const int idx        = aIdx[i];
+            aIdx[i]              = aIdx[nMissing];
+            aIdx[nMissing]       = idx;
+            ++nMissing;
+        }
+        daal::algorithms::internal::qSort<algorithmFPType, int, cpu>(n - nMissing, featureVal + nMissing, aIdx + nMissing);
+        return nMissing;
     }
 
     void chooseFeatures(RowIndexType * featureSample)
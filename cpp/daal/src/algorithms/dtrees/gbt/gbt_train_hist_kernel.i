@@ -73,21 +73,30 @@ public:
                      DAAL_INT & idxFeatureBestSplit, bool featureUnordered,
                      SharedDataForTree<algorithmFPType, RowIndexType, BinIndexType, cpu> & data, size_t iFeature)
     {
+        const DAAL_INT idxMissing = data.ctx.dataHelper().indexedFeatures().missingIndex(iFeature);
         if (featureUnordered)
-            findCategorical(n, minObservationsInLeafNode, lambda, split, res, idxFeatureBestSplit);
+            findCategorical(n, minObservationsInLeafNode, lambda, split, res, idxFeatureBestSplit, idxMissing);
         else
-            findOrdered(n, minObservationsInLeafNode, lambda, split, res, idxFeatureBestSplit, data, iFeature);
+            findOrdered(n, minObservationsInLeafNode, lambda, split, res, idxFeatureBestSplit, idxMissing);
     }
 
+    // The missing values, if any, are in the last bin. Every split point is examined twice:
+    // with the missing values sent to the right child and to the left one
     static void findOrdered(size_t n, size_t minObservationsInLeafNode, algorithmFPType lambda, SplitType & split, const ResultType & res,
-                            DAAL_INT & idxFeatureBestSplit, SharedDataForTree<algorithmFPType, RowIndexType, BinIndexType, cpu> & data,
-                            size_t iFeature)
+                            DAAL_INT & idxFeatureBestSplit, DAAL_INT idxMissing)
     {
-        const size_t nUnique = res.nUnique;
+        const size_t nUnique = (idxMissing < 0) ? res.nUnique : size_t(idxMissing);
         auto * aGHSum        = res.ghSums;
         size_t nLeft         = 0;
 
         ImpurityType imp(res.gTotal, res.hTotal);
+        ImpurityType missing;
+        size_t nMissing = 0;
+        if (idxMissing >= 0)
+        {
+            missing  = aGHSum[idxMissing];
+            nMissing = aGHSum[idxMissing].n;
+        }
 
         ImpurityType left;
         algorithmFPType bestImpDecrease = -services::internal::MaxVal<algorithmFPType>::get();
@@ -98,26 +107,48 @@ public:
             nLeft += aGHSum[i].n;
             if ((n - nLeft) < minObservationsInLeafNode) break;
             left.add(aGHSum[i]);
-            if (nLeft < minObservationsInLeafNode) continue;
 
-            ImpurityType right(imp, left);
-            //the part of the impurity decrease dependent on split itself
-            const algorithmFPType impDecrease = left.value(lambda) + right.value(lambda);
-            if ((impDecrease > bestImpDecrease))
+            //the missing values go to the right
+            if (nLeft >= minObservationsInLeafNode)
             {
-                split.left          = left;
-                split.nLeft         = nLeft;
-                idxFeatureBestSplit = i;
-                bestImpDecrease     = impDecrease;
+                ImpurityType right(imp, left);
+                //the part of the impurity decrease dependent on split itself
+                const algorithmFPType impDecrease = left.value(lambda) + right.value(lambda);
+                if ((impDecrease > bestImpDecrease))
+                {
+                    split.left          = left;
+                    split.nLeft         = nLeft;
+                    split.defaultLeft   = !nMissing;
+                    idxFeatureBestSplit = i;
+                    bestImpDecrease     = impDecrease;
+                }
+            }
+
+            //the missing values go to the left
+            if (nMissing && (nLeft + nMissing >= minObservationsInLeafNode) && (n - nLeft - nMissing >= minObservationsInLeafNode))
+            {
+                ImpurityType leftWithMissing(left);
+                leftWithMissing.add(missing);
+                ImpurityType right(imp, leftWithMissing);
+                const algorithmFPType impDecrease = leftWithMissing.value(lambda) + right.value(lambda);
+                if ((impDecrease > bestImpDecrease))
+                {
+                    split.left          = leftWithMissing;
+                    split.nLeft         = nLeft + nMissing;
+                    split.defaultLeft   = true;
+                    idxFeatureBestSplit = i;
+                    bestImpDecrease     = impDecrease;
+                }
             }
         }
         split.impurityDecrease = bestImpDecrease;
     }
 
+    // The missing values are never the category of the split, they always go to the right child
     static void findCategorical(size_t n, size_t minObservationsInLeafNode, algorithmFPType lambda, SplitType & split, const ResultType & res,
-                                DAAL_INT & idxFeatureBestSplit)
+                                DAAL_INT & idxFeatureBestSplit, DAAL_INT idxMissing)
     {
-        const size_t nUnique = res.nUnique;
+        const size_t nUnique = (idxMissing < 0) ? res.nUnique : size_t(idxMissing);
         auto * aGHSum        = res.ghSums;
 
         ImpurityType imp(res.gTotal, res.hTotal);
@@ -139,8 +170,9 @@ public:
         }
         if (idxFeatureBestSplit >= 0)
         {
-            split.left  = (const GHSumType &)aGHSum[idxFeatureBestSplit];
-            split.nLeft = aGHSum[idxFeatureBestSplit].n;
+            split.left        = (const GHSumType &)aGHSum[idxFeatureBestSplit];
+            split.nLeft       = aGHSum[idxFeatureBestSplit].n;
+            split.defaultLeft = false;
         }
 
         split.impurityDecrease = bestImpDecrease;
@@ -69,20 +69,18 @@ public:
         {
             finalizeBestSplit(_nodeInfo.n, _nodeInfo.iStart);
         }
-        else if (_bestSplit.featureUnordered)
+        else if (_bestSplit.iStart)
         {
-            if (_bestSplit.iStart)
-            {
-                DAAL_ASSERT(_bestSplit.iStart + _bestSplit.nLeft <= _nodeInfo.n);
-                services::internal::tmemcpy<int, cpu>(aIdx, bestSplitIdx + _bestSplit.iStart, _bestSplit.nLeft);
-                aIdx += _bestSplit.nLeft;
-                services::internal::tmemcpy<int, cpu>(aIdx, bestSplitIdx, _bestSplit.iStart);
-                aIdx += _bestSplit.iStart;
-                bestSplitIdx += _bestSplit.iStart + _bestSplit.nLeft;
-                if (_nodeInfo.n > (_bestSplit.iStart + _bestSplit.nLeft))
-                    services::internal::tmemcpy<int, cpu>(aIdx, bestSplitIdx, _nodeInfo.n - _bestSplit.iStart - _bestSplit.nLeft);
-                bCopy = false;
-            }
+            //the left rows do not start at the beginning: a category or an ordered split with the missing values sent to the right
+            DAAL_ASSERT(_bestSplit.iStart + _bestSplit.nLeft <= _nodeInfo.n);
+            services::internal::tmemcpy<int, cpu>(aIdx, bestSplitIdx + _bestSplit.iStart, _bestSplit.nLeft);
+            aIdx += _bestSplit.nLeft;
+            services::internal::tmemcpy<int, cpu>(aIdx, bestSplitIdx, _bestSplit.iStart);
+            aIdx += _bestSplit.iStart;
+            bestSplitIdx += _bestSplit.iStart + _bestSplit.nLeft;
+            if (_nodeInfo.n > (_bestSplit.iStart + _bestSplit.nLeft))
+                services::internal::tmemcpy<int, cpu>(aIdx, bestSplitIdx, _nodeInfo.n - _bestSplit.iStart - _bestSplit.nLeft);
+            bCopy = false;
         }
         if (bCopy && _sharedData.ctx.par().memorySavingMode) services::internal::tmemcpy<int, cpu>(aIdx, bestSplitIdx, _nodeInfo.n);
 
@@ -151,12 +149,15 @@ protected:
 
     DAAL_INT doPartition(size_t n, size_t iStart, SplitDataType & split, DAAL_INT iFeature, size_t idxFeatureValueBestSplit)
     {
-        return doPartitionIdx(n, _sharedData.aIdx + iStart, _sharedData.ctx.dataHelper().indexedFeatures().data(iFeature), split.featureUnordered,
-                              idxFeatureValueBestSplit, _sharedData.bestSplitIdxBuf + (2 * iStart), split.nLeft);
+        const auto & indexedFeatures = _sharedData.ctx.dataHelper().indexedFeatures();
+        //index of the missing values if they go to the left child, -1 otherwise
+        const RowIndexType idxMissingLeft = (split.defaultLeft && !split.featureUnordered) ? indexedFeatures.missingIndex(iFeature) : -1;
+        return doPartitionIdx(n, _sharedData.aIdx + iStart, indexedFeatures.data(iFeature), split.featureUnordered, idxFeatureValueBestSplit,
+                              idxMissingLeft, _sharedData.bestSplitIdxBuf + (2 * iStart), split.nLeft);
     }
 
     DAAL_INT doPartitionIdx(IndexType n, RowIndexType * aIdx, const RowIndexType * indexedFeature, bool featureUnordered,
-                            RowIndexType idxFeatureValueBestSplit, RowIndexType * buffer, RowIndexType nLeft)
+                            RowIndexType idxFeatureValueBestSplit, RowIndexType idxMissingLeft, RowIndexType * buffer, RowIndexType nLeft)
     {
         DAAL_INT iRowSplitVal = -1;
 
@@ -201,7 +202,8 @@ protected:
                 PRAGMA_VECTOR_ALWAYS
                 for (IndexType i = iStart; i < iEnd; ++i)
                 {
-                    if (indexedFeature[aIdx[i]] > idxFeatureValueBestSplit)
+                    const RowIndexType idx = indexedFeature[aIdx[i]];
+                    if ((idx > idxFeatureValueBestSplit) && (idx != idxMissingLeft))
                         bestSplitIdxRight[iRight++] = aIdx[i];
                     else
                         bestSplitIdx[iLeft++] = aIdx[i];
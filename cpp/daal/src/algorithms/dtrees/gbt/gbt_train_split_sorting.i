@@ -78,8 +78,9 @@ public:
             aIdx = aFeatIdxBuf->get();
         }
         algorithmFPType * featBuf = aFeatBuf->get();
-        _sharedData.ctx.featureValuesToBuf(_iFeature, featBuf, aIdx, _nodeInfo.n);
-        if (featBuf[_nodeInfo.n - 1] - featBuf[0] <= _sharedData.ctx.accuracy()) //all values of the feature are the same
+        const size_t nMissing = _sharedData.ctx.featureValuesToBuf(_iFeature, featBuf, aIdx, _nodeInfo.n);
+        if ((nMissing == _nodeInfo.n)
+            || (!nMissing && (featBuf[_nodeInfo.n - 1] - featBuf[0] <= _sharedData.ctx.accuracy()))) //all values of the feature are the same
         {
             _sharedData.memHelper->releaseFeatureValueBuf(aFeatBuf);
             if (aFeatIdxBuf) _sharedData.memHelper->releaseSortedFeatureIdxBuf(aFeatIdxBuf);
@@ -90,7 +91,7 @@ public:
         int iBestFeat;
         _bestSplit.safeGetData(bestImpDec, iBestFeat);
         SplitDataType split(bestImpDec, _sharedData.ctx.featTypes().isUnordered(_iFeature));
-        bool bFound = findBestSplitFeatSorted(featBuf, aIdx, split, iBestFeat < 0 || iBestFeat > _iFeature);
+        bool bFound = findBestSplitFeatSorted(featBuf, aIdx, nMissing, split, iBestFeat < 0 || iBestFeat > _iFeature);
         _sharedData.memHelper->releaseFeatureValueBuf(aFeatBuf);
         if (bFound)
         {
@@ -105,49 +106,84 @@ public:
     }
 
 protected:
-    bool findBestSplitFeatSorted(const algorithmFPType * featureVal, const RowIndexType * aIdx, SplitDataType & split, bool bUpdateWhenTie) const
+    //the first nMissing values are missing ones, the rest are sorted
+    bool findBestSplitFeatSorted(const algorithmFPType * featureVal, const RowIndexType * aIdx, size_t nMissing, SplitDataType & split,
+                                 bool bUpdateWhenTie) const
     {
-        return split.featureUnordered ? findBestSplitCategorical(featureVal, aIdx, split, bUpdateWhenTie) :
-                                        findBestSplitOrdered(featureVal, aIdx, split, bUpdateWhenTie);
+        return split.featureUnordered ? findBestSplitCategorical(featureVal, aIdx, nMissing, split, bUpdateWhenTie) :
+                                        findBestSplitOrdered(featureVal, aIdx, nMissing, split, bUpdateWhenTie);
     }
 
-    bool findBestSplitOrdered(const algorithmFPType * featureVal, const RowIndexType * aIdx, SplitDataType & split, bool bUpdateWhenTie) const
+    //every split point is examined twice: with the missing values sent to the right child and to the left one
+    bool findBestSplitOrdered(const algorithmFPType * featureVal, const RowIndexType * aIdx, size_t nMissing, SplitDataType & split,
+                              bool bUpdateWhenTie) const
     {
-        ImpurityType left(_sharedData.ctx.grad(_sharedData.iTree)[*aIdx]);
+        const size_t n                  = _nodeInfo.n;
+        const size_t nPresent           = n - nMissing;
+        const algorithmFPType * presVal = featureVal + nMissing;
+        const RowIndexType * presIdx    = aIdx + nMissing;
+        const auto nMinSplitPart        = _sharedData.ctx.par().minObservationsInLeafNode;
+        const algorithmFPType lambda    = _sharedData.ctx.par().lambda;
+
+        ImpurityType missing;
+        if (nMissing) calcImpurityIndirect(aIdx, nMissing, missing);
+
+        ImpurityType left(_sharedData.ctx.grad(_sharedData.iTree)[*presIdx]);
         algorithmFPType bestImpurityDecrease = split.impurityDecrease;
         DAAL_INT iBest                       = -1;
-        const size_t n                       = _nodeInfo.n;
-        const auto nMinSplitPart             = _sharedData.ctx.par().minObservationsInLeafNode;
-        for (size_t i = 1; i < (n - nMinSplitPart + 1); ++i)
+        bool bMissingLeft                    = false;
+        for (size_t i = 1; (i <= nPresent) && (i + nMinSplitPart <= n); ++i)
         {
-            const bool bSameFeaturePrev(featureVal[i] <= featureVal[i - 1] + _sharedData.ctx.accuracy());
-            if (!(bSameFeaturePrev || i < nMinSplitPart))
+            const bool bSameFeaturePrev((i < nPresent) && (presVal[i] <= presVal[i - 1] + _sharedData.ctx.accuracy()));
+            if (!bSameFeaturePrev)
             {
                 //can make a split
-                //nLeft == i, nRight == n - i
-                ImpurityType right(_nodeInfo.imp, left);
-                const algorithmFPType v = left.value(_sharedData.ctx.par().lambda) + right.value(_sharedData.ctx.par().lambda);
-                if ((v > bestImpurityDecrease) || (bUpdateWhenTie && (v == bestImpurityDecrease)))
+                //the missing values go to the right: nLeft == i, nRight == n - i
+                if (i >= nMinSplitPart)
+                {
+                    ImpurityType right(_nodeInfo.imp, left);
+                    const algorithmFPType v = left.value(lambda) + right.value(lambda);
+                    if ((v > bestImpurityDecrease) || (bUpdateWhenTie && (v == bestImpurityDecrease)))
+                    {
+                        bestImpurityDecrease = v;
+                        split.left           = left;
+                        iBest                = i;
+                        bMissingLeft         = false;
+                    }
+                }
+                //the missing values go to the left: nLeft == i + nMissing, nRight == nPresent - i
+                if (nMissing && (i < nPresent) && (i + nMissing >= nMinSplitPart) && (nPresent - i >= nMinSplitPart))
                 {
-                    bestImpurityDecrease = v;
-                    split.left           = left;
-                    iBest                = i;
+                    ImpurityType leftWithMissing(left);
+                    leftWithMissing.add(missing);
+                    ImpurityType right(_nodeInfo.imp, leftWithMissing);
+                    const algorithmFPType v = leftWithMissing.value(lambda) + right.value(lambda);
+                    if ((v > bestImpurityDecrease) || (bUpdateWhenTie && (v == bestImpurityDecrease)))
+                    {
+                        bestImpurityDecrease = v;
+                        split.left           = leftWithMissing;
+                        iBest                = i;
+                        bMissingLeft         = true;
+                    }
                 }
             }
 
             //update impurity and continue
-            left.add(_sharedData.ctx.grad(_sharedData.iTree)[aIdx[i]]);
+            if (i < nPresent) left.add(_sharedData.ctx.grad(_sharedData.iTree)[presIdx[i]]);
         }
         if (iBest < 0) return false;
 
         split.impurityDecrease = bestImpurityDecrease;
-        split.nLeft            = iBest;
-        split.iStart           = 0;
-        split.featureValue     = featureVal[iBest - 1];
+        split.nLeft            = bMissingLeft ? iBest + nMissing : iBest;
+        split.iStart           = bMissingLeft ? 0 : nMissing;
+        split.featureValue     = presVal[iBest - 1];
+        split.defaultLeft      = bMissingLeft || !nMissing;
         return true;
     }
 
-    bool findBestSplitCategorical(const algorithmFPType * featureVal, const RowIndexType * aIdx, SplitDataType & split, bool bUpdateWhenTie) const
+    //the missing values are never the category of the split, they always go to the right child
+    bool findBestSplitCategorical(const algorithmFPType * featureVal, const RowIndexType * aIdx, size_t nMissing, SplitDataType & split,
+                                  bool bUpdateWhenTie) const
     {
         const size_t n           = _nodeInfo.n;
         const auto nMinSplitPart = _sharedData.ctx.par().minObservationsInLeafNode;
@@ -156,7 +192,7 @@ protected:
         ImpurityType left;
         bool bFound               = false;
         size_t nDiffFeatureValues = 0;
-        for (size_t i = 0; i < n - nMinSplitPart;)
+        for (size_t i = nMissing; i < n - nMinSplitPart;)
         {
             ++nDiffFeatureValues;
             size_t count                = 1;
@@ -166,7 +202,8 @@ protected:
                 ;
             if ((count < nMinSplitPart) || ((n - count) < nMinSplitPart)) continue;
 
-            if ((i == n) && (nDiffFeatureValues == 2) && bFound) break; //only 2 feature values, one possible split, already found
+            //only 2 feature values, one possible split, already found
+            if ((i == n) && !nMissing && (nDiffFeatureValues == 2) && bFound) break;
 
             calcImpurityIndirect(aIdx + iStart, count, left);
             ImpurityType right(_nodeInfo.imp, left);
@@ -178,6 +215,7 @@ protected:
                 split.nLeft          = count;
                 split.iStart         = iStart;
                 split.featureValue   = first;
+                split.defaultLeft    = false;
                 bFound               = true;
             }
         }
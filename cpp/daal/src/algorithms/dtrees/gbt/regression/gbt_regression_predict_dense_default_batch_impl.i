@@ -35,6 +35,7 @@
 #include "src/externals/service_memory.h"
 #include "src/algorithms/dtrees/regression/dtrees_regression_predict_dense_default_impl.i"
 #include "src/algorithms/dtrees/gbt/gbt_predict_dense_default_impl.i"
+#include "src/algorithms/dtrees/gbt/gbt_predict_tree_shap_impl.i"
 
 using namespace daal::internal;
 using namespace daal::services::internal;
@@ -81,10 +82,17 @@ protected:
 //////////////////////////////////////////////////////////////////////////////////////////
 template <typename algorithmFPType, prediction::Method method, CpuType cpu>
 services::Status PredictKernel<algorithmFPType, method, cpu>::compute(services::HostAppIface * pHostApp, const NumericTable * x,
-                                                                      const regression::Model * m, NumericTable * r, size_t nIterations)
+                                                                      const regression::Model * m, NumericTable * r, size_t nIterations,
+                                                                      DAAL_UINT64 resultsToCompute)
 {
     const daal::algorithms::gbt::regression::internal::ModelImpl * pModel =
         static_cast<const daal::algorithms::gbt::regression::internal::ModelImpl *>(m);
+    if (resultsToCompute & (predictionContributions | predictionInteractions))
+    {
+        DAAL_ASSERT(!nIterations || nIterations <= pModel->size());
+        gbt::prediction::internal::PredictTreeShapTask<algorithmFPType, cpu> task(x, r);
+        return task.run(pModel, (nIterations ? nIterations : pModel->size()), 1, (resultsToCompute & predictionInteractions) != 0, pHostApp);
+    }
     PredictRegressionTask<algorithmFPType, cpu> task(x, r);
     return task.run(pModel, nIterations, pHostApp);
 }
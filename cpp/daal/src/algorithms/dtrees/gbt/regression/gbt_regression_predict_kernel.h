@@ -55,9 +55,10 @@ public:
      *  \param m[in]    gradient boosted trees model obtained on training stage
      *  \param r[out]   Prediction results
      *  \param nIterations[in]  Number of iterations to predict in gradient boosted trees algorithm parameter
+     *  \param resultsToCompute[in]  Result to compute: the responses, the feature contributions or the feature interactions
      */
     services::Status compute(services::HostAppIface * pHostApp, const NumericTable * a, const regression::Model * m, NumericTable * r,
-                             size_t nIterations);
+                             size_t nIterations, DAAL_UINT64 resultsToCompute);
 };
 
 } // namespace internal
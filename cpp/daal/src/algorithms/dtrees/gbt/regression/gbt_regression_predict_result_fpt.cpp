@@ -44,9 +44,21 @@ DAAL_EXPORT services::Status Result::allocate(const daal::algorithms::Input * in
     data_management::NumericTablePtr dataPtr = algInput->get(data);
     DAAL_CHECK_EX(dataPtr.get(), ErrorNullInputNumericTable, ArgumentName, dataStr());
     services::Status s;
-    const size_t nVectors = dataPtr->getNumberOfRows();
-    Argument::set(prediction,
-                  data_management::HomogenNumericTable<algorithmFPType>::create(1, nVectors, data_management::NumericTableIface::doAllocate, &s));
+    const size_t nVectors      = dataPtr->getNumberOfRows();
+    const size_t nFeatures     = dataPtr->getNumberOfColumns();
+    const Parameter * algParam = static_cast<const Parameter *>(par);
+    size_t nColumns            = 1;
+    if (algParam && (algParam->resultsToCompute & predictionContributions))
+    {
+        nColumns = nFeatures + 1;
+    }
+    else if (algParam && (algParam->resultsToCompute & predictionInteractions))
+    {
+        DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nFeatures + 1, nFeatures + 1);
+        nColumns = (nFeatures + 1) * (nFeatures + 1);
+    }
+    Argument::set(prediction, data_management::HomogenNumericTable<algorithmFPType>::create(nColumns, nVectors,
+                                                                                            data_management::NumericTableIface::doAllocate, &s));
     return s;
 }
 
@@ -107,6 +107,10 @@ services::Status Input::check(const daal::algorithms::Parameter * parameter, int
     size_t nIterations = pPrm->nIterations;
 
     DAAL_CHECK((nIterations == 0) || (nIterations <= maxNIterations), services::ErrorGbtPredictIncorrectNumberOfIterations);
+
+    const DAAL_UINT64 resultsToCompute = pPrm->resultsToCompute;
+    DAAL_CHECK_EX(resultsToCompute == predictionResult || resultsToCompute == predictionContributions || resultsToCompute == predictionInteractions,
+                  services::ErrorGbtPredictShapOptionsNotSupported, ParameterName, resultsToComputeStr());
     return s;
 }
 
@@ -142,7 +146,15 @@ services::Status Result::check(const daal::algorithms::Input * input, const daal
 {
     Status s;
     DAAL_CHECK_STATUS(s, algorithms::regression::prediction::Result::check(input, par, method));
-    DAAL_CHECK_EX(get(prediction)->getNumberOfColumns() == 1, ErrorIncorrectNumberOfColumns, ArgumentName, predictionStr());
+
+    const size_t nFeatures     = static_cast<const Input *>(input)->get(data)->getNumberOfColumns();
+    const Parameter * algParam = static_cast<const Parameter *>(par);
+    size_t nColumns            = 1;
+    if (algParam->resultsToCompute & predictionContributions)
+        nColumns = nFeatures + 1;
+    else if (algParam->resultsToCompute & predictionInteractions)
+        nColumns = (nFeatures + 1) * (nFeatures + 1);
+    DAAL_CHECK_EX(get(prediction)->getNumberOfColumns() == nColumns, ErrorIncorrectNumberOfColumns, ArgumentName, predictionStr());
     return s;
 }
 
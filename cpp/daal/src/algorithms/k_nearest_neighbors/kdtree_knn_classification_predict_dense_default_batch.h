@@ -32,6 +32,7 @@
 #include "src/externals/service_blas.h"
 #include "src/services/service_arrays.h"
 #include "src/algorithms/k_nearest_neighbors/knn_heap.h"
+#include "src/algorithms/service_kernel_math.h"
 
 namespace daal
 {
@@ -52,9 +53,40 @@ namespace internal
 using namespace daal::data_management;
 using namespace daal::internal;
 
+using daal::algorithms::internal::PairwiseDistanceType;
+
 template <typename algorithmFpType>
 struct SearchNode;
 
+template <typename algorithmFpType>
+struct OffsetChange;
+
+template <typename algorithmFpType, CpuType cpu>
+class SearchMetric;
+
+struct KernelParameter : kdtree_knn_classification::Parameter
+{
+    using kdtree_knn_classification::Parameter::Parameter;
+
+    PairwiseDistanceType pairwiseDistance = PairwiseDistanceType::minkowski;
+    double minkowskiDegree                = 2.0;
+    double radius                         = 0.0; /* Radius of the search used by computeRadius() */
+};
+
+/* Receives the neighbors found by the radius search in the CSR layout */
+template <typename algorithmFpType>
+class RadiusSearchResultIface
+{
+public:
+    virtual ~RadiusSearchResultIface() {}
+
+    /* Allocates the neighbor lists of nQueries queries with nNeighbors neighbors in total.
+     * The neighbors of the i-th query occupy the positions from rowOffsets[i] to rowOffsets[i + 1] - 1
+     * of indices and distances, rowOffsets has nQueries + 1 elements and is zero-based */
+    virtual services::Status allocate(size_t nQueries, size_t nNeighbors, DAAL_INT64 *& rowOffsets, DAAL_INT64 *& indices,
+                                      algorithmFpType *& distances) = 0;
+};
+
 template <typename algorithmFpType, prediction::Method method, CpuType cpu>
 class KNNClassificationPredictKernel : public daal::algorithms::Kernel
 {};
@@ -63,19 +95,34 @@ template <typename algorithmFpType, CpuType cpu>
 class KNNClassificationPredictKernel<algorithmFpType, defaultDense, cpu> : public daal::algorithms::Kernel
 {
 public:
+    /* Searches for k nearest neighbors. If par is a KernelParameter, its distance is used, otherwise the Euclidean one */
     services::Status compute(const NumericTable * x, const classifier::Model * m, NumericTable * y, NumericTable * indices, NumericTable * distances,
                              const daal::algorithms::Parameter * par);
 
+    /* Searches for all the neighbors within par->radius from each query */
+    services::Status computeRadius(const NumericTable * x, const classifier::Model * m, const KernelParameter * par,
+                                   RadiusSearchResultIface<algorithmFpType> & result);
+
 protected:
-    void findNearestNeighbors(const algorithmFpType * query, Heap<GlobalNeighbors<algorithmFpType, cpu>, cpu> & heap,
-                              kdtree_knn_classification::internal::Stack<SearchNode<algorithmFpType>, cpu> & stack, size_t k, algorithmFpType radius,
-                              const KDTreeTable & kdTreeTable, size_t rootTreeNodeIndex, const NumericTable & data, const bool isHomogenSOA,
+    typedef kdtree_knn_classification::internal::Stack<SearchNode<algorithmFpType>, cpu> SearchStack;
+    typedef kdtree_knn_classification::internal::Stack<OffsetChange<algorithmFpType>, cpu> OffsetStack;
+
+    void findNearestNeighbors(const algorithmFpType * query, Heap<GlobalNeighbors<algorithmFpType, cpu>, cpu> & heap, SearchStack & stack,
+                              OffsetStack & offsetStack, algorithmFpType * offsets, size_t k, algorithmFpType radius,
+                              const SearchMetric<algorithmFpType, cpu> & metric, const KDTreeTable & kdTreeTable, size_t rootTreeNodeIndex,
+                              const NumericTable & data, const bool isHomogenSOA,
                               services::internal::TArrayScalable<algorithmFpType *, cpu> & soa_arrays);
 
+    template <typename Visitor>
+    void searchTree(const algorithmFpType * query, Visitor & visitor, SearchStack & stack, OffsetStack & offsetStack, algorithmFpType * offsets,
+                    algorithmFpType radius, const SearchMetric<algorithmFpType, cpu> & metric, const KDTreeTable & kdTreeTable,
+                    size_t rootTreeNodeIndex, const NumericTable & data, const bool isHomogenSOA,
+                    services::internal::TArrayScalable<algorithmFpType *, cpu> & soa_arrays);
+
     services::Status predict(algorithmFpType * predictedClass, const Heap<GlobalNeighbors<algorithmFpType, cpu>, cpu> & heap,
                              const NumericTable * labels, size_t k, VoteWeights voteWeights, const NumericTable * modelIndices,
                              data_management::BlockDescriptor<int> & indices, data_management::BlockDescriptor<algorithmFpType> & distances,
-                             size_t index, const size_t nClasses);
+                             size_t index, const size_t nClasses, const SearchMetric<algorithmFpType, cpu> & metric);
 };
 
 } // namespace internal
@@ -59,7 +59,237 @@ template <typename algorithmFpType>
 struct SearchNode
 {
     size_t nodeIndex;
-    algorithmFpType minDistance;
+    algorithmFpType minDistance; /* Lower bound of the reduced distance from the query to the node */
+    size_t dimension;            /* Splitting dimension of the parent node */
+    algorithmFpType offset;      /* Distance from the query to the node along the splitting dimension */
+    size_t offsetStackSize;      /* Size of the stack of offset changes at the moment the node was pushed */
+};
+
+template <typename algorithmFpType>
+struct OffsetChange
+{
+    size_t dimension;
+    algorithmFpType offset;
+};
+
+/* Distance between the query and a point kept in the reduced form that preserves the order of the points:
+ * sum(|d|^p) for Minkowski distance of degree p and max(|d|) for Chebyshev distance */
+template <typename algorithmFpType, CpuType cpu>
+class SearchMetric
+{
+public:
+    typedef daal::internal::Math<algorithmFpType, cpu> Math;
+
+    enum Kind
+    {
+        euclidean,
+        manhattan,
+        minkowski,
+        chebyshev
+    };
+
+    SearchMetric() : _kind(euclidean), _degree(2.0) {}
+
+    services::Status init(PairwiseDistanceType type, double degree)
+    {
+        _degree = algorithmFpType(degree);
+        switch (type)
+        {
+        case PairwiseDistanceType::euclidean: _kind = euclidean; break;
+        case PairwiseDistanceType::chebyshev: _kind = chebyshev; break;
+        case PairwiseDistanceType::minkowski:
+            DAAL_CHECK(degree > 0.0, services::ErrorIncorrectParameter);
+            _kind = (degree == 2.0) ? euclidean : ((degree == 1.0) ? manhattan : minkowski);
+            break;
+        default: return services::Status(services::ErrorIncorrectParameter);
+        }
+        return services::Status();
+    }
+
+    /* Adds the difference along one more dimension to the reduced distances of n points */
+    DAAL_FORCEINLINE void accumulate(algorithmFpType query, const algorithmFpType * x, size_t n, algorithmFpType * distance) const
+    {
+        switch (_kind)
+        {
+        case euclidean:
+            for (size_t i = 0; i < n; ++i)
+            {
+                distance[i] += (query - x[i]) * (query - x[i]);
+            }
+            break;
+        case manhattan:
+            for (size_t i = 0; i < n; ++i)
+            {
+                distance[i] += Math::sFabs(query - x[i]);
+            }
+            break;
+        case minkowski:
+            for (size_t i = 0; i < n; ++i)
+            {
+                distance[i] += Math::sPowx(Math::sFabs(query - x[i]), _degree);
+            }
+            break;
+        case chebyshev:
+            for (size_t i = 0; i < n; ++i)
+            {
+                distance[i] = Math::sMax(distance[i], Math::sFabs(query - x[i]));
+            }
+            break;
+        }
+    }
+
+    /* Lower bound of the reduced distance to a child node whose offset along the splitting dimension
+     * grows from oldOffset to newOffset. The bound is exact for a node box */
+    DAAL_FORCEINLINE algorithmFpType childBound(algorithmFpType parentBound, algorithmFpType oldOffset, algorithmFpType newOffset) const
+    {
+        switch (_kind)
+        {
+        case euclidean: return parentBound - oldOffset * oldOffset + newOffset * newOffset;
+        case manhattan: return parentBound - oldOffset + newOffset;
+        case minkowski: return parentBound - Math::sPowx(oldOffset, _degree) + Math::sPowx(newOffset, _degree);
+        default: return Math::sMax(parentBound, newOffset);
+        }
+    }
+
+    /* Converts the distance to the reduced form */
+    algorithmFpType reduce(algorithmFpType distance) const
+    {
+        switch (_kind)
+        {
+        case euclidean: return distance * distance;
+        case minkowski: return Math::sPowx(distance, _degree);
+        default: return distance;
+        }
+    }
+
+    /* Converts the reduced distance back to the distance */
+    DAAL_FORCEINLINE algorithmFpType finalize(algorithmFpType distance) const
+    {
+        switch (_kind)
+        {
+        case euclidean: return Math::sSqrt(distance);
+        case minkowski: return Math::sPowx(distance, algorithmFpType(1.0) / _degree);
+        default: return distance;
+        }
+    }
+
+    void finalize(size_t n, algorithmFpType * distance) const
+    {
+        switch (_kind)
+        {
+        case euclidean: Math::vSqrt(n, distance, distance); break;
+        case minkowski: Math::vPowx(n, distance, algorithmFpType(1.0) / _degree, distance); break;
+        default: break;
+        }
+    }
+
+private:
+    Kind _kind;
+    algorithmFpType _degree;
+};
+
+template <typename algorithmFpType, CpuType cpu>
+services::Status initSearchMetric(SearchMetric<algorithmFpType, cpu> & metric, const daal::algorithms::Parameter * par)
+{
+    const KernelParameter * const kernelPar = dynamic_cast<const KernelParameter *>(par);
+    if (kernelPar)
+    {
+        return metric.init(kernelPar->pairwiseDistance, kernelPar->minkowskiDegree);
+    }
+    return metric.init(PairwiseDistanceType::euclidean, 2.0);
+}
+
+/* Collects k nearest neighbors shrinking the search radius to the k-th distance found */
+template <typename algorithmFpType, CpuType cpu>
+struct HeapVisitor
+{
+    HeapVisitor(Heap<GlobalNeighbors<algorithmFpType, cpu>, cpu> & heap, size_t k) : _heap(heap), _k(k) {}
+
+    DAAL_FORCEINLINE void visit(size_t index, algorithmFpType distance, algorithmFpType & radius)
+    {
+        GlobalNeighbors<algorithmFpType, cpu> curNeighbor;
+        curNeighbor.distance = distance;
+        curNeighbor.index    = index;
+        if (_heap.size() < _k)
+        {
+            _heap.push(curNeighbor, _k);
+
+            if (_heap.size() == _k)
+            {
+                radius = _heap.getMax()->distance;
+            }
+        }
+        else
+        {
+            if (_heap.getMax()->distance > curNeighbor.distance)
+            {
+                _heap.replaceMax(curNeighbor);
+                radius = _heap.getMax()->distance;
+            }
+        }
+    }
+
+    Heap<GlobalNeighbors<algorithmFpType, cpu>, cpu> & _heap;
+    const size_t _k;
+};
+
+/* Growing list of the neighbors found by the radius search in a block of queries */
+template <typename algorithmFpType, CpuType cpu>
+class NeighborList
+{
+public:
+    typedef GlobalNeighbors<algorithmFpType, cpu> Neighbor;
+
+    NeighborList() : _data(nullptr), _size(0), _capacity(0), _failed(false) {}
+
+    ~NeighborList() { clear(); }
+
+    void clear()
+    {
+        service_scalable_free<Neighbor, cpu>(_data);
+        _data     = nullptr;
+        _size     = 0;
+        _capacity = 0;
+    }
+
+    DAAL_FORCEINLINE void visit(size_t index, algorithmFpType distance, algorithmFpType &)
+    {
+        if (_size == _capacity && !grow()) return;
+        _data[_size].index    = index;
+        _data[_size].distance = distance;
+        ++_size;
+    }
+
+    size_t size() const { return _size; }
+    Neighbor * data() const { return _data; }
+    bool failed() const { return _failed; }
+
+private:
+    bool grow()
+    {
+        const size_t capacity = _capacity ? _capacity * 2 : 256;
+        Neighbor * const data = service_scalable_malloc<Neighbor, cpu>(capacity);
+        if (!data)
+        {
+            _failed = true;
+            return false;
+        }
+        if (_size && services::internal::daal_memcpy_s(data, capacity * sizeof(Neighbor), _data, _size * sizeof(Neighbor)))
+        {
+            service_scalable_free<Neighbor, cpu>(data);
+            _failed = true;
+            return false;
+        }
+        service_scalable_free<Neighbor, cpu>(_data);
+        _data     = data;
+        _capacity = capacity;
+        return true;
+    }
+
+    Neighbor * _data;
+    size_t _size;
+    size_t _capacity;
+    bool _failed;
 };
 
 template <typename algorithmFpType, CpuType cpu>
@@ -125,7 +355,6 @@ Status KNNClassificationPredictKernel<algorithmFpType, defaultDense, cpu>::compu
 
     typedef GlobalNeighbors<algorithmFpType, cpu> Neighbors;
     typedef Heap<Neighbors, cpu> MaxHeap;
-    typedef kdtree_knn_classification::internal::Stack<SearchNode<algorithmFpType>, cpu> SearchStack;
     typedef daal::services::internal::MaxVal<algorithmFpType> MaxVal;
     typedef daal::internal::Math<algorithmFpType, cpu> Math;
 
@@ -145,6 +374,9 @@ Status KNNClassificationPredictKernel<algorithmFpType, defaultDense, cpu>::compu
 
     if (par3 == NULL) return Status(ErrorNullParameterNotSupported);
 
+    SearchMetric<algorithmFpType, cpu> metric;
+    DAAL_CHECK_STATUS(status, initSearchMetric(metric, par));
+
     const Model * const model    = static_cast<const Model *>(m);
     const auto & kdTreeTable     = *(model->impl()->getKDTreeTable());
     const auto rootTreeNodeIndex = model->impl()->getRootNodeIndex();
@@ -168,10 +400,13 @@ Status KNNClassificationPredictKernel<algorithmFpType, defaultDense, cpu>::compu
     const algorithmFpType base    = 2.0;
     const size_t expectedMaxDepth = (Math::sLog(xRowCount) / Math::sLog(base) + 1) * __KDTREE_DEPTH_MULTIPLICATION_FACTOR;
     const size_t stackSize        = Math::sPowx(base, Math::sCeil(Math::sLog(expectedMaxDepth) / Math::sLog(base)));
+    const size_t xColumnCount     = x->getNumberOfColumns();
     struct Local
     {
         MaxHeap heap;
         SearchStack stack;
+        OffsetStack offsetStack;
+        algorithmFpType * offsets;
     };
     daal::tls<Local *> localTLS([&]() -> Local * {
         Local * const ptr = service_scalable_calloc<Local, cpu>(1);
@@ -190,6 +425,17 @@ Status KNNClassificationPredictKernel<algorithmFpType, defaultDense, cpu>::compu
                 service_scalable_free<Local, cpu>(ptr);
                 return nullptr;
             }
+            ptr->offsets = service_scalable_calloc<algorithmFpType, cpu>(xColumnCount);
+            if (!ptr->offsetStack.init(stackSize) || !ptr->offsets)
+            {
+                status.add(services::ErrorMemoryAllocationFailed);
+                service_scalable_free<algorithmFpType, cpu>(ptr->offsets);
+                ptr->offsetStack.clear();
+                ptr->stack.clear();
+                ptr->heap.clear();
+                service_scalable_free<Local, cpu>(ptr);
+                return nullptr;
+            }
         }
         else
         {
@@ -200,9 +446,8 @@ Status KNNClassificationPredictKernel<algorithmFpType, defaultDense, cpu>::compu
 
     DAAL_CHECK_STATUS_OK((status.ok()), status);
 
-    const auto maxThreads     = threader_get_threads_number();
-    const size_t xColumnCount = x->getNumberOfColumns();
-    const auto rowsPerBlock   = (xRowCount + maxThreads - 1) / maxThreads;
+    const auto maxThreads   = threader_get_threads_number();
+    const auto rowsPerBlock = (xRowCount + maxThreads - 1) / maxThreads;
     const auto blockCount     = (xRowCount + rowsPerBlock - 1) / rowsPerBlock;
     SafeStatus safeStat;
 
@@ -245,9 +490,10 @@ Status KNNClassificationPredictKernel<algorithmFpType, defaultDense, cpu>::compu
 
                 for (size_t i = 0; i < last - first; ++i)
                 {
-                    findNearestNeighbors(&dx[i * xColumnCount], local->heap, local->stack, k, radius, kdTreeTable, rootTreeNodeIndex, data,
-                                         isHomogenSOA, soa_arrays);
-                    s = predict(&(dy[i * yColumnCount]), local->heap, labels, k, voteWeights, modelIndices, indicesBD, distancesBD, i, nClasses);
+                    findNearestNeighbors(&dx[i * xColumnCount], local->heap, local->stack, local->offsetStack, local->offsets, k, radius, metric,
+                                         kdTreeTable, rootTreeNodeIndex, data, isHomogenSOA, soa_arrays);
+                    s = predict(&(dy[i * yColumnCount]), local->heap, labels, k, voteWeights, modelIndices, indicesBD, distancesBD, i, nClasses,
+                                metric);
                     DAAL_CHECK_STATUS_THR(s)
                 }
 
@@ -258,9 +504,9 @@ Status KNNClassificationPredictKernel<algorithmFpType, defaultDense, cpu>::compu
             {
                 for (size_t i = 0; i < last - first; ++i)
                 {
-                    findNearestNeighbors(&dx[i * xColumnCount], local->heap, local->stack, k, radius, kdTreeTable, rootTreeNodeIndex, data,
-                                         isHomogenSOA, soa_arrays);
-                    s = predict(nullptr, local->heap, labels, k, voteWeights, modelIndices, indicesBD, distancesBD, i, nClasses);
+                    findNearestNeighbors(&dx[i * xColumnCount], local->heap, local->stack, local->offsetStack, local->offsets, k, radius, metric,
+                                         kdTreeTable, rootTreeNodeIndex, data, isHomogenSOA, soa_arrays);
+                    s = predict(nullptr, local->heap, labels, k, voteWeights, modelIndices, indicesBD, distancesBD, i, nClasses, metric);
                     DAAL_CHECK_STATUS_THR(s)
                 }
             }
@@ -285,6 +531,8 @@ Status KNNClassificationPredictKernel<algorithmFpType, defaultDense, cpu>::compu
     localTLS.reduce([&](Local * ptr) -> void {
         if (ptr)
         {
+            service_scalable_free<algorithmFpType, cpu>(ptr->offsets);
+            ptr->offsetStack.clear();
             ptr->stack.clear();
             ptr->heap.clear();
             service_scalable_free<Local, cpu>(ptr);
@@ -293,10 +541,176 @@ Status KNNClassificationPredictKernel<algorithmFpType, defaultDense, cpu>::compu
     return status;
 }
 
+template <typename algorithmFpType, CpuType cpu>
+Status KNNClassificationPredictKernel<algorithmFpType, defaultDense, cpu>::computeRadius(const NumericTable * x, const classifier::Model * m,
+                                                                                         const KernelParameter * par,
+                                                                                         RadiusSearchResultIface<algorithmFpType> & result)
+{
+    Status status;
+    DAAL_CHECK(par, ErrorNullParameterNotSupported);
+    DAAL_CHECK(par->radius >= 0.0, ErrorIncorrectParameter);
+
+    typedef NeighborList<algorithmFpType, cpu> Neighbors;
+    typedef daal::internal::Math<algorithmFpType, cpu> Math;
+
+    SearchMetric<algorithmFpType, cpu> metric;
+    DAAL_CHECK_STATUS(status, metric.init(par->pairwiseDistance, par->minkowskiDegree));
+    const algorithmFpType radius = metric.reduce(algorithmFpType(par->radius));
+
+    const Model * const model         = static_cast<const Model *>(m);
+    const auto & kdTreeTable          = *(model->impl()->getKDTreeTable());
+    const auto rootTreeNodeIndex      = model->impl()->getRootNodeIndex();
+    const NumericTable & data         = *(model->impl()->getData());
+    NumericTable * const modelIndices = model->impl()->getIndices().get();
+    DAAL_CHECK(modelIndices, ErrorNullModel);
+
+    const size_t xRowCount = x->getNumberOfRows();
+    if (xRowCount == 0)
+    {
+        DAAL_INT64 * rowOffsets     = nullptr;
+        DAAL_INT64 * indices        = nullptr;
+        algorithmFpType * distances = nullptr;
+        DAAL_CHECK_STATUS(status, result.allocate(0, 0, rowOffsets, indices, distances));
+        rowOffsets[0] = 0;
+        return status;
+    }
+
+    const size_t xColumnCount     = x->getNumberOfColumns();
+    const algorithmFpType base    = 2.0;
+    const size_t expectedMaxDepth = (Math::sLog(xRowCount) / Math::sLog(base) + 1) * __KDTREE_DEPTH_MULTIPLICATION_FACTOR;
+    const size_t stackSize        = Math::sPowx(base, Math::sCeil(Math::sLog(expectedMaxDepth) / Math::sLog(base)));
+    struct Local
+    {
+        SearchStack stack;
+        OffsetStack offsetStack;
+        algorithmFpType * offsets;
+    };
+    daal::tls<Local *> localTLS([&]() -> Local * {
+        Local * const ptr = service_scalable_calloc<Local, cpu>(1);
+        if (ptr)
+        {
+            ptr->offsets = service_scalable_calloc<algorithmFpType, cpu>(xColumnCount);
+            if (!ptr->stack.init(stackSize) || !ptr->offsetStack.init(stackSize) || !ptr->offsets)
+            {
+                status.add(services::ErrorMemoryAllocationFailed);
+                service_scalable_free<algorithmFpType, cpu>(ptr->offsets);
+                ptr->offsetStack.clear();
+                ptr->stack.clear();
+                service_scalable_free<Local, cpu>(ptr);
+                return nullptr;
+            }
+        }
+        else
+        {
+            status.add(services::ErrorMemoryAllocationFailed);
+        }
+        return ptr;
+    });
+
+    DAAL_CHECK_STATUS_OK((status.ok()), status);
+
+    const auto maxThreads   = threader_get_threads_number();
+    const auto rowsPerBlock = (xRowCount + maxThreads - 1) / maxThreads;
+    const auto blockCount   = (xRowCount + rowsPerBlock - 1) / rowsPerBlock;
+
+    /* The neighbors of each block of queries are collected first, the offsets of the lists are known only after that */
+    TArray<Neighbors, cpu> blockNeighbors(blockCount);
+    TArray<size_t, cpu> neighborCounts(xRowCount + 1);
+    DAAL_CHECK_MALLOC(blockNeighbors.get() && neighborCounts.get());
+
+    services::internal::TArrayScalable<algorithmFpType *, cpu> soa_arrays;
+    bool isHomogenSOA = checkHomogenSOA<algorithmFpType, cpu>(data, soa_arrays);
+
+    SafeStatus safeStat;
+    daal::threader_for(blockCount, blockCount, [&](int iBlock) {
+        Local * const local = localTLS.local();
+        DAAL_CHECK_MALLOC_THR(local);
+
+        const size_t first = iBlock * rowsPerBlock;
+        const size_t last  = min<cpu>(static_cast<decltype(xRowCount)>(first + rowsPerBlock), xRowCount);
+
+        ReadRows<algorithmFpType, cpu> xBlock(*const_cast<NumericTable *>(x), first, last - first);
+        DAAL_CHECK_BLOCK_STATUS_THR(xBlock);
+        const algorithmFpType * const dx = xBlock.get();
+
+        Neighbors & neighbors = blockNeighbors[iBlock];
+        for (size_t i = 0; i < last - first; ++i)
+        {
+            const size_t startSize = neighbors.size();
+            searchTree(&dx[i * xColumnCount], neighbors, local->stack, local->offsetStack, local->offsets, radius, metric, kdTreeTable,
+                       rootTreeNodeIndex, data, isHomogenSOA, soa_arrays);
+            DAAL_CHECK_THR(!neighbors.failed(), ErrorMemoryAllocationFailed);
+
+            typename Neighbors::Neighbor * const row = neighbors.data() + startSize;
+            const size_t rowSize                     = neighbors.size() - startSize;
+            daal::algorithms::internal::introSort<cpu>(row, row + rowSize,
+                                                       [](const typename Neighbors::Neighbor & a, const typename Neighbors::Neighbor & b) -> bool {
+                                                           return a.distance < b.distance;
+                                                       });
+            neighborCounts[first + i + 1] = rowSize;
+        }
+    });
+
+    localTLS.reduce([&](Local * ptr) -> void {
+        if (ptr)
+        {
+            service_scalable_free<algorithmFpType, cpu>(ptr->offsets);
+            ptr->offsetStack.clear();
+            ptr->stack.clear();
+            service_scalable_free<Local, cpu>(ptr);
+        }
+    });
+
+    status = safeStat.detach();
+    if (status)
+    {
+        neighborCounts[0] = 0;
+        for (size_t i = 0; i < xRowCount; ++i)
+        {
+            neighborCounts[i + 1] += neighborCounts[i];
+        }
+
+        DAAL_INT64 * rowOffsets     = nullptr;
+        DAAL_INT64 * indices        = nullptr;
+        algorithmFpType * distances = nullptr;
+        status                      = result.allocate(xRowCount, neighborCounts[xRowCount], rowOffsets, indices, distances);
+        ReadColumns<int, cpu> mtModelIndices(*modelIndices, 0, 0, modelIndices->getNumberOfRows());
+        if (status && !mtModelIndices.status())
+        {
+            status = mtModelIndices.status();
+        }
+
+        if (status)
+        {
+            const int * const modelIndicesPtr = mtModelIndices.get();
+            for (size_t i = 0; i <= xRowCount; ++i)
+            {
+                rowOffsets[i] = neighborCounts[i];
+            }
+
+            daal::threader_for(blockCount, blockCount, [&](int iBlock) {
+                const size_t first          = iBlock * rowsPerBlock;
+                const size_t offset         = neighborCounts[first];
+                const Neighbors & neighbors = blockNeighbors[iBlock];
+                const auto * const src      = neighbors.data();
+
+                for (size_t j = 0; j < neighbors.size(); ++j)
+                {
+                    indices[offset + j]   = modelIndicesPtr[src[j].index];
+                    distances[offset + j] = metric.finalize(src[j].distance);
+                }
+            });
+        }
+    }
+
+    return status;
+}
+
 template <typename algorithmFpType, CpuType cpu>
 DAAL_FORCEINLINE void computeDistance(size_t start, size_t end, algorithmFpType * distance, const algorithmFpType * query, const bool isHomogenSOA,
                                       const NumericTable & data, data_management::BlockDescriptor<algorithmFpType> xBD[2],
-                                      services::internal::TArrayScalable<algorithmFpType *, cpu> & soa_arrays)
+                                      services::internal::TArrayScalable<algorithmFpType *, cpu> & soa_arrays,
+                                      const SearchMetric<algorithmFpType, cpu> & metric)
 {
     for (size_t i = start; i < end; ++i)
     {
@@ -319,10 +733,7 @@ DAAL_FORCEINLINE void computeDistance(size_t start, size_t end, algorithmFpType
         DAAL_PREFETCH_READ_T0(nx);
         DAAL_PREFETCH_READ_T0(nx + 16);
 
-        for (size_t i = 0; i < end - start; ++i)
-        {
-            distance[i] += (query[j - 1] - dx[i]) * (query[j - 1] - dx[i]);
-        }
+        metric.accumulate(query[j - 1], dx, end - start, distance);
 
         releaseNtData<algorithmFpType, cpu>(isHomogenSOA, data, xBD[curBDIdx]);
 
@@ -330,10 +741,7 @@ DAAL_FORCEINLINE void computeDistance(size_t start, size_t end, algorithmFpType
         services::internal::swap<cpu, const algorithmFpType *>(dx, nx);
     }
     {
-        for (size_t i = 0; i < end - start; ++i)
-        {
-            distance[i] += (query[j - 1] - dx[i]) * (query[j - 1] - dx[i]);
-        }
+        metric.accumulate(query[j - 1], dx, end - start, distance);
 
         releaseNtData<algorithmFpType, cpu>(isHomogenSOA, data, xBD[curBDIdx]);
     }
@@ -341,16 +749,37 @@ DAAL_FORCEINLINE void computeDistance(size_t start, size_t end, algorithmFpType
 
 template <typename algorithmFpType, CpuType cpu>
 void KNNClassificationPredictKernel<algorithmFpType, defaultDense, cpu>::findNearestNeighbors(
-    const algorithmFpType * query, Heap<GlobalNeighbors<algorithmFpType, cpu>, cpu> & heap,
-    kdtree_knn_classification::internal::Stack<SearchNode<algorithmFpType>, cpu> & stack, size_t k, algorithmFpType radius,
-    const KDTreeTable & kdTreeTable, size_t rootTreeNodeIndex, const NumericTable & data, const bool isHomogenSOA,
+    const algorithmFpType * query, Heap<GlobalNeighbors<algorithmFpType, cpu>, cpu> & heap, SearchStack & stack, OffsetStack & offsetStack,
+    algorithmFpType * offsets, size_t k, algorithmFpType radius, const SearchMetric<algorithmFpType, cpu> & metric, const KDTreeTable & kdTreeTable,
+    size_t rootTreeNodeIndex, const NumericTable & data, const bool isHomogenSOA,
     services::internal::TArrayScalable<algorithmFpType *, cpu> & soa_arrays)
 {
     heap.reset();
+    HeapVisitor<algorithmFpType, cpu> visitor(heap, k);
+    searchTree(query, visitor, stack, offsetStack, offsets, radius, metric, kdTreeTable, rootTreeNodeIndex, data, isHomogenSOA, soa_arrays);
+}
+
+/* Depth-first search that visits every point of the tree within the radius from the query.
+ * The lower bound of the distance to a node is updated incrementally from the per-dimension offsets of the node box,
+ * the offsets changed on the way to the current node are kept in offsetStack and restored when the search backtracks */
+template <typename algorithmFpType, CpuType cpu>
+template <typename Visitor>
+void KNNClassificationPredictKernel<algorithmFpType, defaultDense, cpu>::searchTree(
+    const algorithmFpType * query, Visitor & visitor, SearchStack & stack, OffsetStack & offsetStack, algorithmFpType * offsets,
+    algorithmFpType radius, const SearchMetric<algorithmFpType, cpu> & metric, const KDTreeTable & kdTreeTable, size_t rootTreeNodeIndex,
+    const NumericTable & data, const bool isHomogenSOA, services::internal::TArrayScalable<algorithmFpType *, cpu> & soa_arrays)
+{
     stack.reset();
-    GlobalNeighbors<algorithmFpType, cpu> curNeighbor;
+    offsetStack.reset();
+    const size_t xColumnCount = data.getNumberOfColumns();
+    for (size_t j = 0; j < xColumnCount; ++j)
+    {
+        offsets[j] = 0;
+    }
+
     size_t i;
     SearchNode<algorithmFpType> cur, toPush;
+    OffsetChange<algorithmFpType> change;
     const KDTreeNode * node;
     cur.nodeIndex   = rootTreeNodeIndex;
     cur.minDistance = 0;
@@ -367,67 +796,58 @@ void KNNClassificationPredictKernel<algorithmFpType, defaultDense, cpu>::findNea
             start = node->leftIndex;
             end   = node->rightIndex;
 
-            computeDistance<algorithmFpType, cpu>(start, end, distance, query, isHomogenSOA, data, xBD, soa_arrays);
+            computeDistance<algorithmFpType, cpu>(start, end, distance, query, isHomogenSOA, data, xBD, soa_arrays, metric);
 
             for (i = start; i < end; ++i)
             {
                 if (distance[i - start] <= radius)
                 {
-                    curNeighbor.distance = distance[i - start];
-                    curNeighbor.index    = i;
-                    if (heap.size() < k)
-                    {
-                        heap.push(curNeighbor, k);
-
-                        if (heap.size() == k)
-                        {
-                            radius = heap.getMax()->distance;
-                        }
-                    }
-                    else
-                    {
-                        if (heap.getMax()->distance > curNeighbor.distance)
-                        {
-                            heap.replaceMax(curNeighbor);
-                            radius = heap.getMax()->distance;
-                        }
-                    }
+                    visitor.visit(i, distance[i - start], radius);
                 }
             }
-
-            if (!stack.empty())
-            {
-                cur = stack.pop();
-                DAAL_PREFETCH_READ_T0(static_cast<const KDTreeNode *>(kdTreeTable.getArray()) + cur.nodeIndex);
-            }
-            else
-            {
-                break;
-            }
         }
         else
         {
-            algorithmFpType val        = query[node->dimension];
-            const algorithmFpType diff = val - node->cutPoint;
-
-            if (cur.minDistance <= radius)
+            const algorithmFpType diff = query[node->dimension] - node->cutPoint;
+
+            cur.nodeIndex          = (diff < 0) ? node->leftIndex : node->rightIndex;
+            toPush.nodeIndex       = (diff < 0) ? node->rightIndex : node->leftIndex;
+            toPush.dimension       = node->dimension;
+            toPush.offset          = (diff < 0) ? -diff : diff;
+            toPush.offsetStackSize = offsetStack.size();
+            toPush.minDistance     = metric.childBound(cur.minDistance, offsets[node->dimension], toPush.offset);
+            if (toPush.minDistance <= radius)
             {
-                cur.nodeIndex    = (diff < 0) ? node->leftIndex : node->rightIndex;
-                toPush.nodeIndex = (diff < 0) ? node->rightIndex : node->leftIndex;
-                val -= node->cutPoint;
-                toPush.minDistance = cur.minDistance + val * val;
                 stack.push(toPush);
             }
-            else if (!stack.empty())
-            {
-                cur = stack.pop();
-                DAAL_PREFETCH_READ_T0(static_cast<const KDTreeNode *>(kdTreeTable.getArray()) + cur.nodeIndex);
-            }
-            else
+            continue;
+        }
+
+        bool found = false;
+        while (!stack.empty())
+        {
+            cur = stack.pop();
+            if (cur.minDistance <= radius)
             {
+                found = true;
                 break;
             }
         }
+        if (!found)
+        {
+            break;
+        }
+
+        DAAL_PREFETCH_READ_T0(static_cast<const KDTreeNode *>(kdTreeTable.getArray()) + cur.nodeIndex);
+        while (offsetStack.size() > cur.offsetStackSize)
+        {
+            change                    = offsetStack.pop();
+            offsets[change.dimension] = change.offset;
+        }
+        change.dimension = cur.dimension;
+        change.offset    = offsets[cur.dimension];
+        offsetStack.push(change);
+        offsets[cur.dimension] = cur.offset;
     }
 }
 
@@ -435,7 +855,8 @@ template <typename algorithmFpType, CpuType cpu>
 services::Status KNNClassificationPredictKernel<algorithmFpType, defaultDense, cpu>::predict(
     algorithmFpType * predictedClass, const Heap<GlobalNeighbors<algorithmFpType, cpu>, cpu> & heap, const NumericTable * labels, size_t k,
     VoteWeights voteWeights, const NumericTable * modelIndices, data_management::BlockDescriptor<int> & indices,
-    data_management::BlockDescriptor<algorithmFpType> & distances, size_t index, const size_t nClasses)
+    data_management::BlockDescriptor<algorithmFpType> & distances, size_t index, const size_t nClasses,
+    const SearchMetric<algorithmFpType, cpu> & metric)
 {
     typedef daal::internal::Math<algorithmFpType, cpu> Math;
 
@@ -479,7 +900,7 @@ services::Status KNNClassificationPredictKernel<algorithmFpType, defaultDense, c
             distancesPtr[i] = heap[i].distance;
         }
 
-        Math::vSqrt(heapSize, distancesPtr, distancesPtr);
+        metric.finalize(heapSize, distancesPtr);
 
         for (size_t i = heapSize; i < nDistances; ++i)
         {
@@ -547,7 +968,7 @@ services::Status KNNClassificationPredictKernel<algorithmFpType, defaultDense, c
             {
                 for (size_t i = 0; i < heapSize; ++i)
                 {
-                    classWeights[(size_t)(classes[i])] += Math::sSqrt(1 / heap[i].distance);
+                    classWeights[(size_t)(classes[i])] += 1 / metric.finalize(heap[i].distance);
                 }
             }
         }
@@ -28,6 +28,7 @@
 #include "algorithms/kmeans/kmeans_types.h"
 #include "algorithms/kmeans/kmeans_batch.h"
 #include "algorithms/kmeans/kmeans_distributed.h"
+#include "algorithms/kmeans/kmeans_online.h"
 #include "src/algorithms/kmeans/kmeans_lloyd_kernel.h"
 #include "src/algorithms/kmeans/oneapi/kmeans_dense_lloyd_batch_kernel_ucapi.h"
 #include "src/algorithms/kmeans/oneapi/kmeans_lloyd_distr_step1_kernel_ucapi.h"
@@ -50,7 +51,7 @@ BatchContainer<algorithmFPType, method, cpu>::BatchContainer(daal::services::Env
     auto & context    = services::internal::getDefaultContext();
     auto & deviceInfo = context.getInfoDevice();
 
-    if (deviceInfo.isCpu)
+    if (deviceInfo.isCpu || method != lloydDense)
     {
         __DAAL_INITIALIZE_KERNELS(internal::KMeansBatchKernel, method, algorithmFPType);
     }
@@ -297,6 +298,84 @@ services::Status DistributedContainer<step2Master, algorithmFPType, method, cpu>
     }
 }
 
+template <typename algorithmFPType, Method method, CpuType cpu>
+OnlineContainer<algorithmFPType, method, cpu>::OnlineContainer(daal::services::Environment::env * daalEnv)
+{
+    __DAAL_INITIALIZE_KERNELS(internal::KMeansOnlineKernel, method, algorithmFPType);
+}
+
+template <typename algorithmFPType, Method method, CpuType cpu>
+OnlineContainer<algorithmFPType, method, cpu>::~OnlineContainer()
+{
+    __DAAL_DEINITIALIZE_KERNELS();
+}
+
+template <typename algorithmFPType, Method method, CpuType cpu>
+services::Status OnlineContainer<algorithmFPType, method, cpu>::setupCompute()
+{
+    Input * input        = static_cast<Input *>(_in);
+    PartialResult * pres = static_cast<PartialResult *>(_pres);
+    Parameter * par      = static_cast<Parameter *>(_par);
+
+    services::Status s;
+    if (!(par->resultsToEvaluate & computeAssignments || par->assignFlag))
+    {
+        return s;
+    }
+
+    const size_t nRows          = input->get(data)->getNumberOfRows();
+    NumericTablePtr assignments = pres->get(partialAssignments);
+    if (!assignments || assignments->getNumberOfRows() != nRows)
+    {
+        pres->set(partialAssignments, HomogenNumericTable<int>::create(1, nRows, NumericTable::doAllocate, &s));
+    }
+    return s;
+}
+
+template <typename algorithmFPType, Method method, CpuType cpu>
+services::Status OnlineContainer<algorithmFPType, method, cpu>::compute()
+{
+    Input * input        = static_cast<Input *>(_in);
+    PartialResult * pres = static_cast<PartialResult *>(_pres);
+    Parameter * par      = static_cast<Parameter *>(_par);
+
+    NumericTable * a[1];
+    a[0] = static_cast<NumericTable *>(input->get(data).get());
+
+    const bool isAssignments = par->resultsToEvaluate & computeAssignments || par->assignFlag;
+    NumericTable * r[6];
+    r[0] = static_cast<NumericTable *>(pres->get(nObservations).get());
+    r[1] = static_cast<NumericTable *>(pres->get(partialSums).get());
+    r[2] = static_cast<NumericTable *>(pres->get(partialObjectiveFunction).get());
+    r[3] = static_cast<NumericTable *>(pres->get(partialCandidatesDistances).get());
+    r[4] = static_cast<NumericTable *>(pres->get(partialCandidatesCentroids).get());
+    r[5] = isAssignments ? static_cast<NumericTable *>(pres->get(partialAssignments).get()) : nullptr;
+
+    daal::services::Environment::env & env = *_env;
+    __DAAL_CALL_KERNEL(env, internal::KMeansOnlineKernel, __DAAL_KERNEL_ARGUMENTS(method, algorithmFPType), compute, a, r, par);
+}
+
+template <typename algorithmFPType, Method method, CpuType cpu>
+services::Status OnlineContainer<algorithmFPType, method, cpu>::finalizeCompute()
+{
+    PartialResult * pres = static_cast<PartialResult *>(_pres);
+    Result * res         = static_cast<Result *>(_res);
+    Parameter * par      = static_cast<Parameter *>(_par);
+
+    NumericTable * a[3];
+    a[0] = static_cast<NumericTable *>(pres->get(nObservations).get());
+    a[1] = static_cast<NumericTable *>(pres->get(partialSums).get());
+    a[2] = static_cast<NumericTable *>(pres->get(partialObjectiveFunction).get());
+
+    NumericTable * r[3];
+    r[0] = static_cast<NumericTable *>(res->get(centroids).get());
+    r[1] = static_cast<NumericTable *>(res->get(objectiveFunction).get());
+    r[2] = static_cast<NumericTable *>(res->get(nIterations).get());
+
+    daal::services::Environment::env & env = *_env;
+    __DAAL_CALL_KERNEL(env, internal::KMeansOnlineKernel, __DAAL_KERNEL_ARGUMENTS(method, algorithmFPType), finalizeCompute, a, r, par);
+}
+
 } // namespace interface2
 } // namespace kmeans
 } // namespace algorithms
@@ -0,0 +1,383 @@
+/* file: kmeans_hamerly_batch_impl.i */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of Lloyd method for K-means algorithm accelerated with
+//  Hamerly distance bounds.
+//--
+*/
+
+#include "algorithms/algorithm.h"
+#include "data_management/data/numeric_table.h"
+#include "src/threading/threading.h"
+#include "services/daal_defines.h"
+#include "src/externals/service_memory.h"
+#include "src/data_management/service_numeric_table.h"
+#include "src/services/service_defines.h"
+
+#include "src/algorithms/kmeans/kmeans_lloyd_impl.i"
+#include "src/algorithms/kmeans/kmeans_lloyd_postprocessing.h"
+
+#include "src/externals/service_ittnotify.h"
+
+DAAL_ITTNOTIFY_DOMAIN(kmeans.dense.hamerly.batch);
+
+using namespace daal::internal;
+using namespace daal::services::internal;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace kmeans
+{
+namespace internal
+{
+/* Computes a half of the distance from each centroid to the nearest other centroid */
+template <typename algorithmFPType, CpuType cpu>
+void computeHalfDistances(const size_t p, const size_t nClusters, const algorithmFPType * const clusters, algorithmFPType * const gram,
+                          algorithmFPType * const halfDist)
+{
+    if (nClusters == 1)
+    {
+        halfDist[0] = MaxVal<algorithmFPType>::get();
+        return;
+    }
+
+    const char transa           = 't';
+    const char transb           = 'n';
+    const DAAL_INT _m           = nClusters;
+    const DAAL_INT _n           = nClusters;
+    const DAAL_INT _k           = p;
+    const algorithmFPType alpha = 1.0;
+    const DAAL_INT lda          = p;
+    const DAAL_INT ldy          = p;
+    const algorithmFPType beta  = 0.0;
+    const DAAL_INT ldaty        = nClusters;
+
+    Blas<algorithmFPType, cpu>::xxgemm(&transa, &transb, &_m, &_n, &_k, &alpha, clusters, &lda, clusters, &ldy, &beta, gram, &ldaty);
+
+    daal::threader_for(nClusters, nClusters, [=](size_t i) {
+        algorithmFPType minDist = MaxVal<algorithmFPType>::get();
+        for (size_t j = 0; j < nClusters; j++)
+        {
+            const algorithmFPType dist = gram[i * nClusters + i] + gram[j * nClusters + j] - gram[i * nClusters + j] * 2.0;
+            if (j != i && dist < minDist)
+            {
+                minDist = dist;
+            }
+        }
+        halfDist[i] = (minDist > algorithmFPType(0)) ? Math<algorithmFPType, cpu>::sSqrt(minDist) * 0.5 : algorithmFPType(0);
+    });
+}
+
+/* Decreases the lower bounds by the largest shift of the centroids other than the assigned one */
+template <typename algorithmFPType, CpuType cpu>
+void updateLowerBounds(const size_t n, const size_t p, const size_t nClusters, const algorithmFPType * const oldClusters,
+                       const algorithmFPType * const newClusters, const int * const assignments, algorithmFPType * const lowerBounds)
+{
+    algorithmFPType maxShift    = algorithmFPType(0);
+    algorithmFPType secondShift = algorithmFPType(0);
+    int maxShiftIdx             = -1;
+
+    for (size_t i = 0; i < nClusters; i++)
+    {
+        algorithmFPType shift = algorithmFPType(0);
+        PRAGMA_IVDEP
+        PRAGMA_ICC_NO16(omp simd reduction(+ : shift))
+        for (size_t j = 0; j < p; j++)
+        {
+            shift += (newClusters[i * p + j] - oldClusters[i * p + j]) * (newClusters[i * p + j] - oldClusters[i * p + j]);
+        }
+        shift = Math<algorithmFPType, cpu>::sSqrt(shift);
+
+        if (shift > maxShift)
+        {
+            secondShift = maxShift;
+            maxShift    = shift;
+            maxShiftIdx = (int)i;
+        }
+        else if (shift > secondShift)
+        {
+            secondShift = shift;
+        }
+    }
+
+    if (maxShift == algorithmFPType(0))
+    {
+        return;
+    }
+
+    const size_t blockSizeDefault = 4096;
+    const size_t nBlocks          = n / blockSizeDefault + !!(n % blockSizeDefault);
+
+    daal::threader_for(nBlocks, nBlocks, [=](size_t iBlock) {
+        const size_t iStart = iBlock * blockSizeDefault;
+        const size_t iEnd   = (iBlock == nBlocks - 1) ? n : iStart + blockSizeDefault;
+        for (size_t i = iStart; i < iEnd; i++)
+        {
+            lowerBounds[i] -= (assignments[i] == maxShiftIdx) ? secondShift : maxShift;
+        }
+    });
+}
+
+template <typename algorithmFPType, CpuType cpu>
+Status KMeansBatchKernel<hamerlyDense, algorithmFPType, cpu>::compute(const NumericTable * const * a, const NumericTable * const * r,
+                                                                      const Parameter * par)
+{
+    Status s;
+    NumericTable * ntData  = const_cast<NumericTable *>(a[0]);
+    const size_t nIter     = par->maxIterations;
+    const size_t n         = ntData->getNumberOfRows();
+    const size_t p         = ntData->getNumberOfColumns();
+    const size_t nClusters = par->nClusters;
+    int result             = 0;
+
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nClusters, sizeof(int));
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nClusters, p);
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nClusters * p, sizeof(algorithmFPType));
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nClusters, nClusters);
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nClusters * nClusters, sizeof(algorithmFPType));
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, p, sizeof(algorithmFPType));
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, n, sizeof(algorithmFPType));
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, n, sizeof(int));
+
+    TArray<int, cpu> clusterS0(nClusters);
+    TArray<algorithmFPType, cpu> clusterS1(nClusters * p);
+    DAAL_CHECK(clusterS0.get() && clusterS1.get(), services::ErrorMemoryAllocationFailed);
+
+    /* Categorial variables check and support: begin */
+    int catFlag = 0;
+    for (size_t i = 0; i < p; i++)
+    {
+        if (ntData->getFeatureType(i) == features::DAAL_CATEGORICAL)
+        {
+            catFlag = 1;
+            break;
+        }
+    }
+    TArray<algorithmFPType, cpu> catCoef(catFlag ? p : 0);
+    if (catFlag)
+    {
+        DAAL_CHECK(catCoef.get(), services::ErrorMemoryAllocationFailed);
+        for (size_t i = 0; i < p; i++)
+        {
+            if (ntData->getFeatureType(i) == features::DAAL_CATEGORICAL)
+            {
+                catCoef[i] = par->gamma;
+            }
+            else
+            {
+                catCoef[i] = (algorithmFPType)1.0;
+            }
+        }
+    }
+
+    ReadRows<algorithmFPType, cpu> mtInClusters(*const_cast<NumericTable *>(a[1]), 0, nClusters);
+    DAAL_CHECK_BLOCK_STATUS(mtInClusters);
+    algorithmFPType * inClusters = const_cast<algorithmFPType *>(mtInClusters.get());
+
+    WriteOnlyRows<algorithmFPType, cpu> mtClusters(const_cast<NumericTable *>(r[0]), 0, nClusters);
+    DAAL_CHECK_BLOCK_STATUS(mtClusters);
+    algorithmFPType * clusters = mtClusters.get();
+
+    TArray<algorithmFPType, cpu> tClusters;
+    if (clusters == nullptr && nIter != 0)
+    {
+        tClusters.reset(nClusters * p);
+        clusters = tClusters.get();
+    }
+
+    NumericTable * assignmetsNT = nullptr;
+    NumericTablePtr assignmentsPtr;
+    if (r[1])
+    {
+        assignmetsNT = const_cast<NumericTable *>(r[1]);
+    }
+    else if (par->resultsToEvaluate & computeExactObjectiveFunction)
+    {
+        assignmentsPtr = HomogenNumericTableCPU<int, cpu>::create(1, n, &s);
+        DAAL_CHECK_MALLOC(s);
+        assignmetsNT = assignmentsPtr.get();
+    }
+
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, p, sizeof(double));
+
+    TArray<double, cpu> dS1(p);
+    DAAL_CHECK(dS1.get(), services::ErrorMemoryAllocationFailed);
+
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nClusters, sizeof(algorithmFPType));
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nClusters, sizeof(size_t));
+
+    TArray<algorithmFPType, cpu> cValues(nClusters);
+    TArray<size_t, cpu> cIndices(nClusters);
+
+    /* Bounds are kept between iterations: the current assignment and the lower bound
+     * of the distance to the second closest centroid for each observation */
+    TArray<int, cpu> hAssignments(n);
+    TArray<algorithmFPType, cpu> lowerBounds(n);
+    TArray<algorithmFPType, cpu> halfDist(nClusters);
+    TArray<algorithmFPType, cpu> gram(nClusters * nClusters);
+    TArray<algorithmFPType, cpu> oldClusters(nClusters * p);
+    DAAL_CHECK(hAssignments.get() && lowerBounds.get() && halfDist.get() && gram.get() && oldClusters.get(),
+               services::ErrorMemoryAllocationFailed);
+    service_memset<int, cpu>(hAssignments.get(), -1, n);
+    service_memset<algorithmFPType, cpu>(lowerBounds.get(), algorithmFPType(0), n);
+
+    algorithmFPType oldTargetFunc(0.0);
+
+    size_t blockSize = 0;
+    DAAL_SAFE_CPU_CALL((blockSize = BSHelper<lloydDense, algorithmFPType, cpu>::kmeansGetBlockSize(n, p, nClusters)), (blockSize = 512))
+
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, blockSize, p);
+    StaticTlsMem<algorithmFPType, cpu> tlsRows(blockSize * p);
+    StaticTlsMem<size_t, cpu> tlsRowIdx(blockSize);
+
+    size_t kIter;
+
+    for (kIter = 0; kIter < nIter; kIter++)
+    {
+        auto task = TaskKMeansLloyd<algorithmFPType, cpu>::create(p, nClusters, inClusters, blockSize);
+        DAAL_CHECK(task.get(), services::ErrorMemoryAllocationFailed);
+        {
+            DAAL_ITTNOTIFY_SCOPED_TASK(computeHalfDistances);
+            computeHalfDistances<algorithmFPType, cpu>(p, nClusters, inClusters, gram.get(), halfDist.get());
+        }
+        {
+            DAAL_ITTNOTIFY_SCOPED_TASK(addNTToTaskThreaded);
+            /* For the last iteration we do not need to recount of assignmets */
+            s = task->addNTToTaskThreadedHamerly(ntData, blockSize, halfDist.get(), hAssignments.get(), lowerBounds.get(), tlsRows, tlsRowIdx,
+                                                 assignmetsNT && (kIter == nIter - 1) ? assignmetsNT : nullptr);
+        }
+
+        if (!s)
+        {
+            task->kmeansClearClusters(&oldTargetFunc);
+            break;
+        }
+
+        {
+            DAAL_ITTNOTIFY_SCOPED_TASK(kmeansPartialReduceCentroids);
+            task->template kmeansComputeCentroids<lloydDense>(clusterS0.get(), clusterS1.get(), dS1.get());
+        }
+
+        size_t cNum;
+        DAAL_CHECK_STATUS(s, task->kmeansComputeCentroidsCandidates(cValues.get(), cIndices.get(), cNum));
+        size_t cPos = 0;
+
+        algorithmFPType newCentersGoalFunc = (algorithmFPType)0.0;
+
+        result |= daal::services::internal::daal_memcpy_s(oldClusters.get(), nClusters * p * sizeof(algorithmFPType), inClusters,
+                                                          nClusters * p * sizeof(algorithmFPType));
+
+        {
+            DAAL_ITTNOTIFY_SCOPED_TASK(kmeansMergeReduceCentroids);
+
+            for (size_t i = 0; i < nClusters; i++)
+            {
+                if (clusterS0[i] > 0)
+                {
+                    const algorithmFPType coeff = 1.0 / clusterS0[i];
+
+                    PRAGMA_IVDEP
+                    PRAGMA_VECTOR_ALWAYS
+                    for (size_t j = 0; j < p; j++)
+                    {
+                        clusters[i * p + j] = clusterS1[i * p + j] * coeff;
+                    }
+                }
+                else
+                {
+                    DAAL_CHECK(cPos < cNum, services::ErrorKMeansNumberOfClustersIsTooLarge);
+                    newCentersGoalFunc += cValues[cPos];
+                    ReadRows<algorithmFPType, cpu> mtRow(ntData, cIndices[cPos], 1);
+                    const algorithmFPType * row = mtRow.get();
+                    result |=
+                        daal::services::internal::daal_memcpy_s(&clusters[i * p], p * sizeof(algorithmFPType), row, p * sizeof(algorithmFPType));
+                    cPos++;
+                }
+            }
+        }
+
+        {
+            DAAL_ITTNOTIFY_SCOPED_TASK(updateLowerBounds);
+            updateLowerBounds<algorithmFPType, cpu>(n, p, nClusters, oldClusters.get(), clusters, hAssignments.get(), lowerBounds.get());
+        }
+
+        {
+            DAAL_ITTNOTIFY_SCOPED_TASK(kmeansUpdateObjectiveFunction);
+            if (par->accuracyThreshold > (algorithmFPType)0.0)
+            {
+                algorithmFPType newTargetFunc = (algorithmFPType)0.0;
+
+                task->kmeansClearClusters(&newTargetFunc);
+                newTargetFunc -= newCentersGoalFunc;
+
+                if (internal::Math<algorithmFPType, cpu>::sFabs(oldTargetFunc - newTargetFunc) < par->accuracyThreshold)
+                {
+                    kIter++;
+                    break;
+                }
+
+                oldTargetFunc = newTargetFunc;
+            }
+            else
+            {
+                task->kmeansClearClusters(&oldTargetFunc);
+                oldTargetFunc -= newCentersGoalFunc;
+            }
+        }
+        inClusters = clusters;
+    }
+
+    if (!nIter)
+    {
+        clusters = inClusters;
+    }
+
+    if (par->resultsToEvaluate & computeAssignments || par->assignFlag || par->resultsToEvaluate & computeExactObjectiveFunction)
+    {
+        PostProcessing<lloydDense, algorithmFPType, cpu>::computeAssignments(p, nClusters, clusters, ntData, catCoef.get(), assignmetsNT,
+                                                                             blockSize);
+    }
+
+    WriteOnlyRows<algorithmFPType, cpu> mtTarget(*const_cast<NumericTable *>(r[2]), 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(mtTarget);
+    if (par->resultsToEvaluate & computeExactObjectiveFunction)
+    {
+        algorithmFPType exactTargetFunc = algorithmFPType(0);
+        PostProcessing<lloydDense, algorithmFPType, cpu>::computeExactObjectiveFunction(p, nClusters, clusters, ntData, catCoef.get(), assignmetsNT,
+                                                                                        exactTargetFunc, blockSize);
+
+        *mtTarget.get() = exactTargetFunc;
+    }
+    else
+    {
+        *mtTarget.get() = oldTargetFunc;
+    }
+
+    WriteOnlyRows<int, cpu> mtIterations(*const_cast<NumericTable *>(r[3]), 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(mtIterations);
+    *mtIterations.get() = kIter;
+    return (!result) ? s : services::Status(services::ErrorMemoryCopyFailedInternal);
+}
+
+} // namespace internal
+} // namespace kmeans
+} // namespace algorithms
+} // namespace daal
@@ -89,6 +89,26 @@ services::Status Input::check(const daal::algorithms::Parameter * parameter, int
     return checkNumericTable(get(inputCentroids).get(), inputCentroidsStr(), 0, 0, inputFeatures, kmPar->nClusters);
 }
 
+/**
+* Checks input objects for the K-Means algorithm in the online processing mode
+* \param[in] par     Algorithm parameter
+* \param[in] method  Computation method of the algorithm
+*/
+services::Status OnlineInput::check(const daal::algorithms::Parameter * parameter, int method) const
+{
+    services::Status s;
+    const interface2::Parameter * kmPar = static_cast<const interface2::Parameter *>(parameter);
+    DAAL_CHECK_STATUS(s, checkNumericTable(get(data).get(), dataStr(), (int)NumericTableIface::csrArray));
+    const size_t inputFeatures = get(data)->getNumberOfColumns();
+
+    /* Initial centroids are used only to initialize the partial results */
+    if (get(inputCentroids))
+    {
+        DAAL_CHECK_STATUS(s, checkNumericTable(get(inputCentroids).get(), inputCentroidsStr(), 0, 0, inputFeatures, kmPar->nClusters));
+    }
+    return s;
+}
+
 } // namespace interface1
 } // namespace kmeans
 } // namespace algorithms
@@ -28,7 +28,9 @@
 #include "src/algorithms/service_error_handling.h"
 
 #include "src/threading/threading.h"
+#include "src/algorithms/service_threading.h"
 #include "src/externals/service_blas.h"
+#include "src/externals/service_math.h"
 #include "src/externals/service_spblas.h"
 #include "src/services/service_data_utils.h"
 
@@ -108,6 +110,10 @@ struct TaskKMeansLloyd
     Status addNTToTaskThreadedCSR(const NumericTable * const ntData, const algorithmFPType * const catCoef, const size_t blockSizeDefault,
                                   NumericTable * ntAssign = nullptr);
 
+    Status addNTToTaskThreadedHamerly(const NumericTable * const ntData, const size_t blockSizeDefault, const algorithmFPType * const halfDist,
+                                      int * const assignments, algorithmFPType * const lowerBounds, StaticTlsMem<algorithmFPType, cpu> & tlsRows,
+                                      StaticTlsMem<size_t, cpu> & tlsRowIdx, NumericTable * ntAssign = nullptr);
+
     template <Method method>
     Status addNTToTaskThreaded(const NumericTable * const ntData, const algorithmFPType * const catCoef, const size_t blockSizeDefault,
                                NumericTable * ntAssign = nullptr);
@@ -343,6 +349,185 @@ Status TaskKMeansLloyd<algorithmFPType, cpu>::addNTToTaskThreadedCSR(const Numer
     return safeStat.detach();
 }
 
+/* Assignment step of the Hamerly method. An observation keeps its centroid if the distance to it does not exceed
+ * max(halfDist[a], lowerBounds[i]), where halfDist[a] is a half of the distance from centroid a to the nearest other centroid
+ * and lowerBounds[i] is a lower bound of the distance to the second closest centroid. Distances to all the centroids
+ * are computed with GEMM only for the observations that failed the test. */
+template <typename algorithmFPType, CpuType cpu>
+Status TaskKMeansLloyd<algorithmFPType, cpu>::addNTToTaskThreadedHamerly(const NumericTable * const ntData, const size_t blockSizeDefault,
+                                                                         const algorithmFPType * const halfDist, int * const assignments,
+                                                                         algorithmFPType * const lowerBounds,
+                                                                         StaticTlsMem<algorithmFPType, cpu> & tlsRows,
+                                                                         StaticTlsMem<size_t, cpu> & tlsRowIdx, NumericTable * ntAssign)
+{
+    const size_t n = ntData->getNumberOfRows();
+
+    size_t nBlocks = n / blockSizeDefault;
+    nBlocks += (nBlocks * blockSizeDefault != n);
+
+    SafeStatus safeStat;
+    daal::static_threader_for(nBlocks, [=, &safeStat, &tlsRows, &tlsRowIdx](const int k, size_t tid) {
+        struct TlsTask<algorithmFPType, cpu> * tt = tls_task->local(tid);
+        DAAL_CHECK_MALLOC_THR(tt);
+        algorithmFPType * const rows = tlsRows.local(tid);
+        size_t * const rowIdx        = tlsRowIdx.local(tid);
+        DAAL_CHECK_MALLOC_THR(rows && rowIdx);
+
+        const size_t blockSize = (k == nBlocks - 1) ? n - k * blockSizeDefault : blockSizeDefault;
+        const size_t iStart    = k * blockSizeDefault;
+
+        ReadRows<algorithmFPType, cpu> mtData(*const_cast<NumericTable *>(ntData), iStart, blockSize);
+        DAAL_CHECK_BLOCK_STATUS_THR(mtData);
+        const algorithmFPType * const data = mtData.get();
+
+        const size_t p                           = dim;
+        const size_t nClusters                   = clNum;
+        const algorithmFPType * const inClusters = cCenters;
+        const algorithmFPType * const clustersSq = clSq;
+
+        algorithmFPType * x_clusters = tt->mklBuff;
+
+        int * cS0             = tt->cS0;
+        algorithmFPType * cS1 = tt->cS1;
+
+        int * const blockAssignments       = assignments + iStart;
+        algorithmFPType * const blockBound = lowerBounds + iStart;
+
+        algorithmFPType goal = algorithmFPType(0);
+
+        auto addToCluster = [&](const algorithmFPType * const x, size_t clusterIdx, algorithmFPType goalVal, size_t i) {
+            PRAGMA_IVDEP
+            for (size_t j = 0; j < p; j++)
+            {
+                cS1[clusterIdx * p + j] += x[j];
+            }
+            kmeansInsertCandidate(tt, goalVal, iStart + i);
+            cS0[clusterIdx]++;
+            goal += goalVal;
+        };
+
+        size_t nRecompute = 0;
+        for (size_t i = 0; i < blockSize; i++)
+        {
+            const algorithmFPType * const x = data + i * p;
+            const int clusterIdx            = blockAssignments[i];
+            if (clusterIdx >= 0)
+            {
+                const algorithmFPType * const c = inClusters + clusterIdx * p;
+                algorithmFPType dist            = algorithmFPType(0);
+                PRAGMA_IVDEP
+                PRAGMA_ICC_NO16(omp simd reduction(+ : dist))
+                for (size_t j = 0; j < p; j++)
+                {
+                    dist += (x[j] - c[j]) * (x[j] - c[j]);
+                }
+
+                const algorithmFPType bound = (halfDist[clusterIdx] > blockBound[i]) ? halfDist[clusterIdx] : blockBound[i];
+                if (dist <= bound * bound)
+                {
+                    addToCluster(x, clusterIdx, dist, i);
+                    continue;
+                }
+            }
+
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t j = 0; j < p; j++)
+            {
+                rows[nRecompute * p + j] = x[j];
+            }
+            rowIdx[nRecompute++] = i;
+        }
+
+        if (nRecompute > 0)
+        {
+            const char transa           = 't';
+            const char transb           = 'n';
+            const DAAL_INT _m           = nRecompute;
+            const DAAL_INT _n           = nClusters;
+            const DAAL_INT _k           = p;
+            const algorithmFPType alpha = -1.0;
+            const DAAL_INT lda          = p;
+            const DAAL_INT ldy          = p;
+            const algorithmFPType beta  = 1.0;
+            const DAAL_INT ldaty        = nRecompute;
+
+            for (size_t j = 0; j < nClusters; j++)
+            {
+                PRAGMA_IVDEP
+                PRAGMA_VECTOR_ALWAYS
+                for (size_t i = 0; i < nRecompute; i++)
+                {
+                    x_clusters[i + j * nRecompute] = clustersSq[j];
+                }
+            }
+
+            Blas<algorithmFPType, cpu>::xxgemm(&transa, &transb, &_m, &_n, &_k, &alpha, rows, &lda, inClusters, &ldy, &beta, x_clusters, &ldaty);
+
+            for (size_t i = 0; i < nRecompute; i++)
+            {
+                algorithmFPType minGoalVal    = x_clusters[i];
+                algorithmFPType secondGoalVal = MaxVal<algorithmFPType>::get();
+                size_t minIdx                 = 0;
+
+                for (size_t j = 1; j < nClusters; j++)
+                {
+                    const algorithmFPType localGoalVal = x_clusters[i + j * nRecompute];
+                    if (localGoalVal < minGoalVal)
+                    {
+                        secondGoalVal = minGoalVal;
+                        minGoalVal    = localGoalVal;
+                        minIdx        = j;
+                    }
+                    else if (localGoalVal < secondGoalVal)
+                    {
+                        secondGoalVal = localGoalVal;
+                    }
+                }
+
+                const algorithmFPType * const x = rows + i * p;
+                algorithmFPType xSq             = algorithmFPType(0);
+                PRAGMA_IVDEP
+                PRAGMA_ICC_NO16(omp simd reduction(+ : xSq))
+                for (size_t j = 0; j < p; j++)
+                {
+                    xSq += x[j] * x[j];
+                }
+
+                const size_t iRow = rowIdx[i];
+                DAAL_ASSERT(minIdx <= services::internal::MaxVal<int>::get())
+                blockAssignments[iRow] = (int)minIdx;
+                if (nClusters > 1)
+                {
+                    const algorithmFPType secondDist = secondGoalVal * 2.0 + xSq;
+                    blockBound[iRow] = (secondDist > algorithmFPType(0)) ? Math<algorithmFPType, cpu>::sSqrt(secondDist) : algorithmFPType(0);
+                }
+                else
+                {
+                    blockBound[iRow] = MaxVal<algorithmFPType>::get();
+                }
+
+                const algorithmFPType minDist = minGoalVal * 2.0 + xSq;
+                addToCluster(x, minIdx, minDist, iRow);
+            }
+        }
+
+        tt->goalFunc += goal;
+
+        if (ntAssign)
+        {
+            WriteOnlyRows<int, cpu> assignBlock(ntAssign, iStart, blockSize);
+            DAAL_CHECK_BLOCK_STATUS_THR(assignBlock);
+            int * const blockResult = assignBlock.get();
+            for (size_t i = 0; i < blockSize; i++)
+            {
+                blockResult[i] = blockAssignments[i];
+            }
+        }
+    });
+    return safeStat.detach();
+}
+
 template <typename algorithmFPType, CpuType cpu>
 template <Method method>
 Status TaskKMeansLloyd<algorithmFPType, cpu>::addNTToTaskThreaded(const NumericTable * const ntData, const algorithmFPType * const catCoef,
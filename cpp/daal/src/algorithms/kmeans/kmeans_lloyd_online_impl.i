@@ -0,0 +1,279 @@
+/* file: kmeans_lloyd_online_impl.i */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of mini-batch K-means algorithm in the online processing mode.
+//--
+*/
+
+#include "algorithms/algorithm.h"
+#include "data_management/data/numeric_table.h"
+#include "src/threading/threading.h"
+#include "services/daal_defines.h"
+#include "src/externals/service_memory.h"
+#include "src/data_management/service_numeric_table.h"
+#include "src/services/service_defines.h"
+
+#include "src/algorithms/kmeans/kmeans_lloyd_impl.i"
+
+#include "src/externals/service_ittnotify.h"
+
+DAAL_ITTNOTIFY_DOMAIN(kmeans.dense.lloyd.online);
+
+using namespace daal::internal;
+using namespace daal::services::internal;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace kmeans
+{
+namespace internal
+{
+template <Method method, typename algorithmFPType, CpuType cpu>
+Status KMeansOnlineKernel<method, algorithmFPType, cpu>::compute(const NumericTable * const * a, const NumericTable * const * r, const Parameter * par)
+{
+    NumericTable * ntData        = const_cast<NumericTable *>(a[0]);
+    NumericTable * ntAssignments = const_cast<NumericTable *>(r[5]);
+
+    const size_t n         = ntData->getNumberOfRows();
+    const size_t p         = ntData->getNumberOfColumns();
+    const size_t nClusters = par->nClusters;
+    int result             = 0;
+    size_t blockSize       = 0;
+    DAAL_SAFE_CPU_CALL((blockSize = BSHelper<method, algorithmFPType, cpu>::kmeansGetBlockSize(n, p, nClusters)), (blockSize = 512))
+
+    WriteRows<algorithmFPType, cpu> mtCounts(*const_cast<NumericTable *>(r[0]), 0, nClusters);
+    DAAL_CHECK_BLOCK_STATUS(mtCounts);
+    algorithmFPType * counts = mtCounts.get();
+    WriteRows<algorithmFPType, cpu> mtSums(*const_cast<NumericTable *>(r[1]), 0, nClusters);
+    DAAL_CHECK_BLOCK_STATUS(mtSums);
+    algorithmFPType * sums = mtSums.get();
+    WriteRows<algorithmFPType, cpu> mtTargetFunc(*const_cast<NumericTable *>(r[2]), 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(mtTargetFunc);
+    algorithmFPType * goalFunc = mtTargetFunc.get();
+    algorithmFPType blockGoalFunc = (algorithmFPType)0.0;
+    WriteOnlyRows<algorithmFPType, cpu> mtCValues(*const_cast<NumericTable *>(r[3]), 0, nClusters);
+    DAAL_CHECK_BLOCK_STATUS(mtCValues);
+    algorithmFPType * cValues = mtCValues.get();
+    WriteOnlyRows<algorithmFPType, cpu> mtCCentroids(*const_cast<NumericTable *>(r[4]), 0, nClusters);
+    DAAL_CHECK_BLOCK_STATUS(mtCCentroids);
+    algorithmFPType * cCentroids = mtCCentroids.get();
+
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nClusters, p);
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nClusters * p, sizeof(algorithmFPType));
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nClusters, sizeof(size_t));
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, p, sizeof(double));
+
+    TArray<algorithmFPType, cpu> clusters(nClusters * p);
+    TArray<int, cpu> clusterS0(nClusters);
+    TArray<algorithmFPType, cpu> clusterS1(nClusters * p);
+    TArray<double, cpu> dS1(method == defaultDense ? p : 0);
+    TArray<size_t, cpu> cIndices(nClusters);
+    DAAL_CHECK_MALLOC(clusters.get() && clusterS0.get() && clusterS1.get() && cIndices.get());
+    if (method == defaultDense)
+    {
+        DAAL_CHECK_MALLOC(dS1.get());
+    }
+
+    /* Current centroids: the mean of the observations assigned so far, or the initial (relocated) centroid */
+    for (size_t i = 0; i < nClusters; i++)
+    {
+        const algorithmFPType coeff = (counts[i] > 0) ? (algorithmFPType)1.0 / counts[i] : (algorithmFPType)1.0;
+
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t j = 0; j < p; j++)
+        {
+            clusters[i * p + j] = sums[i * p + j] * coeff;
+        }
+    }
+
+    /* Relocating an empty cluster moves a candidate observation out of the cluster it was assigned to,
+     * so the assignments of the block are needed whenever a cluster may stay empty */
+    bool hasEmptyClusters = false;
+    for (size_t i = 0; i < nClusters; i++)
+    {
+        hasEmptyClusters |= (counts[i] == 0);
+    }
+    const bool isAssignments = (par->resultsToEvaluate & computeAssignments || par->assignFlag) && ntAssignments;
+
+    Status s;
+    NumericTable * ntBlockAssignments = isAssignments ? ntAssignments : nullptr;
+    TArray<int, cpu> blockAssignments(isAssignments || !hasEmptyClusters ? 0 : n);
+    NumericTablePtr ntBlockAssignmentsPtr;
+    if (!isAssignments && hasEmptyClusters)
+    {
+        DAAL_CHECK_MALLOC(blockAssignments.get());
+        ntBlockAssignmentsPtr = HomogenNumericTableCPU<int, cpu>::create(blockAssignments.get(), 1, n, &s);
+        DAAL_CHECK_STATUS_VAR(s);
+        ntBlockAssignments = ntBlockAssignmentsPtr.get();
+    }
+
+    size_t cNum = 0;
+    {
+        auto task = TaskKMeansLloyd<algorithmFPType, cpu>::create(p, nClusters, clusters.get(), blockSize);
+        DAAL_CHECK(task.get(), services::ErrorMemoryAllocationFailed);
+
+        {
+            DAAL_ITTNOTIFY_SCOPED_TASK(addNTToTaskThreaded);
+            s = task->template addNTToTaskThreaded<method>(ntData, nullptr, blockSize, ntBlockAssignments);
+        }
+        if (!s)
+        {
+            task->kmeansClearClusters(&blockGoalFunc);
+            return s;
+        }
+
+        task->template kmeansComputeCentroids<method>(clusterS0.get(), clusterS1.get(), dS1.get());
+
+        DAAL_CHECK_STATUS(s, task->kmeansComputeCentroidsCandidates(cValues, cIndices.get(), cNum));
+        for (size_t i = 0; i < cNum; i++)
+        {
+            ReadRows<algorithmFPType, cpu> mtRow(ntData, cIndices[i], 1);
+            DAAL_CHECK_BLOCK_STATUS(mtRow);
+            const algorithmFPType * row = mtRow.get();
+            result |= daal::services::internal::daal_memcpy_s(&cCentroids[i * p], p * sizeof(algorithmFPType), row, p * sizeof(algorithmFPType));
+        }
+        for (size_t i = cNum; i < nClusters; i++)
+        {
+            cValues[i] = (algorithmFPType)-1.0;
+        }
+
+        task->kmeansClearClusters(&blockGoalFunc);
+    }
+
+    /* The objective function is accumulated over all the blocks processed so far */
+    *goalFunc += blockGoalFunc;
+
+    {
+        DAAL_ITTNOTIFY_SCOPED_TASK(kmeansUpdateCentroids);
+
+        /* The learning rate of a centroid is the inverse number of observations assigned to it,
+         * so each centroid stays equal to the mean of all the observations assigned to it so far */
+        for (size_t i = 0; i < nClusters; i++)
+        {
+            if (clusterS0[i] == 0)
+            {
+                continue;
+            }
+
+            const algorithmFPType keep = (counts[i] > 0) ? (algorithmFPType)1.0 : (algorithmFPType)0.0;
+
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t j = 0; j < p; j++)
+            {
+                sums[i * p + j] = sums[i * p + j] * keep + clusterS1[i * p + j];
+            }
+            counts[i] += clusterS0[i];
+        }
+
+        /* Clusters without observations are moved to the observations most distant from their centroids.
+         * The observation is moved from the cluster it was assigned to, so it is counted only once */
+        size_t cPos = 0;
+        if (cNum > 0 && ntBlockAssignments)
+        {
+            WriteRows<int, cpu> mtAssignments(ntBlockAssignments, 0, n);
+            DAAL_CHECK_BLOCK_STATUS(mtAssignments);
+            int * assignments = mtAssignments.get();
+
+            for (size_t i = 0; i < nClusters && cPos < cNum; i++)
+            {
+                if (counts[i] != 0 || clusterS0[i] != 0)
+                {
+                    continue;
+                }
+                const algorithmFPType * row = &cCentroids[cPos * p];
+                const size_t jCluster       = assignments[cIndices[cPos]];
+                counts[jCluster] -= 1;
+                if (counts[jCluster] > 0)
+                {
+                    PRAGMA_IVDEP
+                    PRAGMA_VECTOR_ALWAYS
+                    for (size_t j = 0; j < p; j++)
+                    {
+                        sums[jCluster * p + j] -= row[j];
+                    }
+                }
+                else
+                {
+                    result |= daal::services::internal::daal_memcpy_s(&sums[jCluster * p], p * sizeof(algorithmFPType), &clusters[jCluster * p],
+                                                                      p * sizeof(algorithmFPType));
+                }
+
+                result |= daal::services::internal::daal_memcpy_s(&sums[i * p], p * sizeof(algorithmFPType), row, p * sizeof(algorithmFPType));
+                counts[i]                   = 1;
+                assignments[cIndices[cPos]] = (int)i;
+                cPos++;
+            }
+        }
+    }
+
+    return (!result) ? s : services::Status(services::ErrorMemoryCopyFailedInternal);
+}
+
+template <Method method, typename algorithmFPType, CpuType cpu>
+Status KMeansOnlineKernel<method, algorithmFPType, cpu>::finalizeCompute(const NumericTable * const * a, const NumericTable * const * r,
+                                                                         const Parameter * par)
+{
+    const size_t nClusters = par->nClusters;
+    const size_t p         = a[1]->getNumberOfColumns();
+
+    ReadRows<algorithmFPType, cpu> mtCounts(*const_cast<NumericTable *>(a[0]), 0, nClusters);
+    DAAL_CHECK_BLOCK_STATUS(mtCounts);
+    const algorithmFPType * counts = mtCounts.get();
+    ReadRows<algorithmFPType, cpu> mtSums(*const_cast<NumericTable *>(a[1]), 0, nClusters);
+    DAAL_CHECK_BLOCK_STATUS(mtSums);
+    const algorithmFPType * sums = mtSums.get();
+    ReadRows<algorithmFPType, cpu> mtInTarget(*const_cast<NumericTable *>(a[2]), 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(mtInTarget);
+
+    WriteOnlyRows<algorithmFPType, cpu> mtClusters(*const_cast<NumericTable *>(r[0]), 0, nClusters);
+    DAAL_CHECK_BLOCK_STATUS(mtClusters);
+    algorithmFPType * clusters = mtClusters.get();
+
+    for (size_t i = 0; i < nClusters; i++)
+    {
+        const algorithmFPType coeff = (counts[i] > 0) ? (algorithmFPType)1.0 / counts[i] : (algorithmFPType)1.0;
+
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t j = 0; j < p; j++)
+        {
+            clusters[i * p + j] = sums[i * p + j] * coeff;
+        }
+    }
+
+    WriteOnlyRows<algorithmFPType, cpu> mtTarget(*const_cast<NumericTable *>(r[1]), 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(mtTarget);
+    *mtTarget.get() = *mtInTarget.get();
+
+    /* Every observation is used in a single update of the centroids */
+    WriteOnlyRows<int, cpu> mtIterations(*const_cast<NumericTable *>(r[2]), 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(mtIterations);
+    *mtIterations.get() = 1;
+
+    return Status();
+}
+
+} // namespace internal
+} // namespace kmeans
+} // namespace algorithms
+} // namespace daal
@@ -25,6 +25,9 @@
 #define __KMEANS_PARTIALRESULT_
 
 #include "algorithms/kmeans/kmeans_types.h"
+#include "src/data_management/service_numeric_table.h"
+#include "src/services/service_data_utils.h"
+#include "src/services/daal_strings.h"
 
 using namespace daal::data_management;
 
@@ -76,6 +79,46 @@ DAAL_EXPORT services::Status PartialResult::allocate(const daal::algorithms::Inp
     return status;
 }
 
+/**
+ * Initializes partial results of the K-Means algorithm in the online processing mode
+ * \param[in] input        Pointer to the structure of the input objects
+ * \param[in] parameter    Pointer to the structure of the algorithm parameters
+ * \param[in] method       Computation method of the algorithm
+ */
+template <typename algorithmFPType>
+DAAL_EXPORT services::Status PartialResult::initialize(const daal::algorithms::Input * input, const daal::algorithms::Parameter * parameter,
+                                                       const int method)
+{
+    const interface2::Parameter * kmPar2 = dynamic_cast<const interface2::Parameter *>(parameter);
+    if (kmPar2 == nullptr) return services::Status(daal::services::ErrorNullParameterNotSupported);
+
+    const Input * algInput = static_cast<const Input *>(input);
+    const size_t nFeatures = algInput->getNumberOfFeatures();
+    const size_t nClusters = kmPar2->nClusters;
+
+    services::Status s;
+    NumericTable * ntInputCentroids = algInput->get(inputCentroids).get();
+    DAAL_CHECK_STATUS(s, checkNumericTable(ntInputCentroids, inputCentroidsStr(), 0, 0, nFeatures, nClusters));
+
+    DAAL_CHECK_STATUS(s, get(nObservations)->assign((algorithmFPType)0.0))
+    DAAL_CHECK_STATUS(s, get(partialObjectiveFunction)->assign((algorithmFPType)0.0))
+    DAAL_CHECK_STATUS(s, get(partialCandidatesDistances)->assign((algorithmFPType)-1.0))
+    DAAL_CHECK_STATUS(s, get(partialCandidatesCentroids)->assign((algorithmFPType)0.0))
+
+    /* Until a cluster gets observations, the partial sum keeps its centroid */
+    daal::internal::ReadRows<algorithmFPType, sse2> centroidsBlock(ntInputCentroids, 0, nClusters);
+    DAAL_CHECK_BLOCK_STATUS(centroidsBlock)
+    daal::internal::WriteOnlyRows<algorithmFPType, sse2> sumsBlock(get(partialSums).get(), 0, nClusters);
+    DAAL_CHECK_BLOCK_STATUS(sumsBlock)
+
+    const size_t size = nFeatures * nClusters * sizeof(algorithmFPType);
+    if (daal::services::internal::daal_memcpy_s(sumsBlock.get(), size, centroidsBlock.get(), size))
+    {
+        return services::Status(services::ErrorMemoryCopyFailedInternal);
+    }
+    return s;
+}
+
 } // namespace kmeans
 } // namespace algorithms
 } // namespace daal
@@ -100,7 +100,8 @@ services::Status PartialResult::check(const daal::algorithms::Input * input, con
         if (kmPar2->resultsToEvaluate & computeAssignments || kmPar2->assignFlag)
         {
             Input * algInput = dynamic_cast<Input *>(const_cast<daal::algorithms::Input *>(input));
-            if (!algInput)
+            /* In the online processing mode the assignments are reallocated for every block of data */
+            if (!algInput || dynamic_cast<const OnlineInput *>(input))
             {
                 return s;
             }
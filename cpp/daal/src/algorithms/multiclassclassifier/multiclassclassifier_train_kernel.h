@@ -38,6 +38,17 @@ namespace daal
 {
 namespace algorithms
 {
+namespace svm
+{
+namespace training
+{
+namespace internal
+{
+struct SVMCacheStatistics;
+} // namespace internal
+} // namespace training
+} // namespace svm
+
 namespace multi_class_classifier
 {
 namespace training
@@ -51,6 +62,9 @@ struct KernelParameter
     services::SharedPtr<algorithms::classifier::prediction::Batch> prediction; /*!< Two-class classifier prediction stage */
     size_t maxIterations;                                                      /*!< Maximum number of iterations */
     double accuracyThreshold;                                                  /*!< Convergence threshold */
+    /* If not null, the kernel matrix cache statistics of the two-class SVM models are added to this structure.
+     * The two-class training algorithm provides them if svm::training::computeCacheStatistics is requested */
+    svm::training::internal::SVMCacheStatistics * svmCacheStatistics = nullptr;
 };
 
 template <Method method, typename AlgorithmFPtype, CpuType cpu>
@@ -160,6 +160,11 @@ services::Status MultiClassClassifierTrainKernel<oneAgainstOne, algorithmFPType,
                 return;
             }
             pModel = local->getModel();
+            if (par.svmCacheStatistics)
+            {
+                const services::Status statisticsStatus = local->addCacheStatistics();
+                DAAL_CHECK_STATUS_THR(statisticsStatus);
+            }
         }
         model->setTwoClassClassifierModel(imodel, pModel);
         if (svmModel)
@@ -184,7 +189,10 @@ services::Status MultiClassClassifierTrainKernel<oneAgainstOne, algorithmFPType,
             *mtBiases.get() = svmModelPtr->getBias();
         }
     });
-    lsTask.reduce([=, &safeStat](TSubTask * local) { delete local; });
+    lsTask.reduce([=, &safeStat](TSubTask * local) {
+        if (par.svmCacheStatistics) *par.svmCacheStatistics += local->getCacheStatistics();
+        delete local;
+    });
 
     if (svmModel)
     {
@@ -32,6 +32,7 @@
 #include "src/externals/service_memory.h"
 #include "src/data_management/service_numeric_table.h"
 #include "src/algorithms/multiclassclassifier/multiclassclassifier_train_kernel.h"
+#include "src/algorithms/svm/svm_train_cache.h"
 
 using namespace daal::internal;
 using namespace daal::services::internal;
@@ -88,6 +89,25 @@ public:
 
     classifier::ModelPtr getModel() { return _simpleTraining->getResult()->get(classifier::training::model); }
 
+    /* Adds the kernel matrix cache statistics of the last trained two-class SVM model if they are computed */
+    services::Status addCacheStatistics()
+    {
+        const auto svmResult = services::dynamicPointerCast<svm::training::Result, classifier::training::Result>(_simpleTraining->getResult());
+        if (!svmResult) return services::Status();
+        const NumericTablePtr statisticsTable = svmResult->get(svm::training::cacheStatistics);
+        if (!statisticsTable) return services::Status();
+
+        ReadRows<double, cpu> statisticsRows(statisticsTable.get(), 0, 1);
+        DAAL_CHECK_BLOCK_STATUS(statisticsRows);
+        const double * const statisticsData = statisticsRows.get();
+        _cacheStatistics.nHits += size_t(statisticsData[0]);
+        _cacheStatistics.nMisses += size_t(statisticsData[1]);
+        _cacheStatistics.nEvictions += size_t(statisticsData[2]);
+        return services::Status();
+    }
+
+    const svm::training::internal::SVMCacheStatistics & getCacheStatistics() const { return _cacheStatistics; }
+
 protected:
     typedef HomogenNumericTableCPU<algorithmFPType, cpu> HomogenNT;
 
@@ -123,6 +143,7 @@ protected:
     NumericTablePtr _subsetXTable;
     NumericTablePtr _subsetWTable;
     services::SharedPtr<classifier::training::Batch> _simpleTraining;
+    svm::training::internal::SVMCacheStatistics _cacheStatistics;
 };
 
 template <typename algorithmFPType, CpuType cpu>
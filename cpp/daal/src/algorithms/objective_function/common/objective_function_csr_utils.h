@@ -0,0 +1,318 @@
+/* file: objective_function_csr_utils.h */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Utilities of the objective functions for the data sets in the CSR format.
+//
+//  The rows of the data set are processed in blocks, the products of a block
+//  and the argument are computed by the sparse BLAS, the products of the
+//  transposed block are accumulated into the thread local arrays by the
+//  non-zero values of the block, so the cost of every pass over the data set
+//  is proportional to the number of non-zero values.
+//--
+*/
+
+#ifndef __OBJECTIVE_FUNCTION_CSR_UTILS_H__
+#define __OBJECTIVE_FUNCTION_CSR_UTILS_H__
+
+#include "data_management/data/csr_numeric_table.h"
+#include "src/algorithms/service_threading.h"
+#include "src/data_management/service_numeric_table.h"
+#include "src/externals/service_memory.h"
+#include "src/externals/service_spblas.h"
+#include "src/services/service_arrays.h"
+#include "src/services/service_utils.h"
+#include "src/threading/threading.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace optimization_solver
+{
+namespace objective_function
+{
+namespace internal
+{
+using namespace daal::internal;
+using namespace daal::services;
+using namespace daal::services::internal;
+using namespace daal::data_management;
+
+/*
+ * Rows of the CSR data set and their dependent variables, the column indices and the row offsets are one-based.
+ * The rows are either all the rows of the data set or the rows given by the batch indices of the objective function
+ */
+template <typename algorithmFPType, CpuType cpu>
+class CSRDataSet
+{
+public:
+    CSRDataSet() : _values(nullptr), _cols(nullptr), _rows(nullptr), _y(nullptr), _nRows(0), _nCols(0) {}
+
+    static bool isCSR(const NumericTable * dataNT) { return dynamic_cast<const CSRNumericTableIface *>(dataNT) != nullptr; }
+
+    Status init(NumericTable * dataNT, NumericTable * dependentVariablesNT, const NumericTable * indNT, size_t yDim)
+    {
+        CSRNumericTableIface * const csrData = dynamic_cast<CSRNumericTableIface *>(dataNT);
+        DAAL_CHECK(csrData, ErrorIncorrectTypeOfInputNumericTable);
+
+        const size_t nAllRows = dataNT->getNumberOfRows();
+        _nCols                = dataNT->getNumberOfColumns();
+
+        _dataRows.set(csrData, 0, nAllRows);
+        DAAL_CHECK_BLOCK_STATUS(_dataRows);
+        _yRows.set(dependentVariablesNT, 0, nAllRows);
+        DAAL_CHECK_BLOCK_STATUS(_yRows);
+
+        if (!indNT)
+        {
+            _values = _dataRows.values();
+            _cols   = _dataRows.cols();
+            _rows   = _dataRows.rows();
+            _y      = _yRows.get();
+            _nRows  = nAllRows;
+            return Status();
+        }
+
+        const size_t n = indNT->getNumberOfColumns();
+        ReadRows<int, cpu> indRows(const_cast<NumericTable *>(indNT), 0, 1);
+        DAAL_CHECK_BLOCK_STATUS(indRows);
+        const int * const ind = indRows.get();
+
+        const algorithmFPType * const allValues = _dataRows.values();
+        const size_t * const allCols            = _dataRows.cols();
+        const size_t * const allRows            = _dataRows.rows();
+        const algorithmFPType * const allY      = _yRows.get();
+
+        size_t nNonZeros = 0;
+        for (size_t i = 0; i < n; ++i) nNonZeros += allRows[ind[i] + 1] - allRows[ind[i]];
+
+        DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, n, yDim);
+        _valuesArray.reset(nNonZeros);
+        _colsArray.reset(nNonZeros);
+        _rowsArray.reset(n + 1);
+        _yArray.reset(n * yDim);
+        DAAL_CHECK_MALLOC((_valuesArray.get() || !nNonZeros) && (_colsArray.get() || !nNonZeros) && _rowsArray.get() && _yArray.get());
+
+        size_t * const rows = _rowsArray.get();
+        rows[0]             = 1;
+        for (size_t i = 0; i < n; ++i)
+        {
+            const size_t iRow   = ind[i];
+            const size_t begin  = allRows[iRow] - 1;
+            const size_t nInRow = allRows[iRow + 1] - allRows[iRow];
+            tmemcpy<algorithmFPType, cpu>(_valuesArray.get() + rows[i] - 1, allValues + begin, nInRow);
+            tmemcpy<size_t, cpu>(_colsArray.get() + rows[i] - 1, allCols + begin, nInRow);
+            tmemcpy<algorithmFPType, cpu>(_yArray.get() + i * yDim, allY + iRow * yDim, yDim);
+            rows[i + 1] = rows[i] + nInRow;
+        }
+
+        _values = _valuesArray.get();
+        _cols   = _colsArray.get();
+        _rows   = rows;
+        _y      = _yArray.get();
+        _nRows  = n;
+        return Status();
+    }
+
+    size_t getNumberOfRows() const { return _nRows; }
+    size_t getNumberOfColumns() const { return _nCols; }
+
+    /* Dependent variables of the rows starting from iStartRow */
+    const algorithmFPType * y(size_t iStartRow) const { return _y + iStartRow; }
+
+    /* xb[i] = x[iStartRow + i] * beta, i = 0, ..., nRowsInBlock - 1, beta contains nCols values */
+    void applyBeta(size_t iStartRow, size_t nRowsInBlock, const algorithmFPType * beta, algorithmFPType * xb) const
+    {
+        const char transa          = 'N';
+        const char matdescra[6]    = { 'G', 0, 0, 'F', 0, 0 };
+        const algorithmFPType one  = 1.0;
+        const algorithmFPType zero = 0.0;
+        const DAAL_INT m           = static_cast<DAAL_INT>(nRowsInBlock);
+        const DAAL_INT k           = static_cast<DAAL_INT>(_nCols);
+        const size_t offset        = _rows[iStartRow] - 1;
+
+        SpBlas<algorithmFPType, cpu>::xxcsrmv(&transa, &m, &k, &one, matdescra, _values + offset, (const DAAL_INT *)(_cols + offset),
+                                              (const DAAL_INT *)(_rows + iStartRow), (const DAAL_INT *)(_rows + iStartRow + 1), beta, &zero, xb);
+    }
+
+    /*
+     * xb[i * nColumns + c] = x[iStartRow + i] * beta[c * ldBeta, ..., c * ldBeta + nCols - 1], c = 0, ..., nColumns - 1.
+     * The sparse BLAS returns the column-major product for one-based indices, so it is transposed through the buffer
+     */
+    void applyBeta(size_t iStartRow, size_t nRowsInBlock, const algorithmFPType * beta, size_t ldBeta, size_t nColumns, algorithmFPType * buffer,
+                   algorithmFPType * xb) const
+    {
+        const char transa          = 'N';
+        const char matdescra[6]    = { 'G', 0, 0, 'F', 0, 0 };
+        const algorithmFPType one  = 1.0;
+        const algorithmFPType zero = 0.0;
+        const DAAL_INT m           = static_cast<DAAL_INT>(nRowsInBlock);
+        const DAAL_INT n           = static_cast<DAAL_INT>(nColumns);
+        const DAAL_INT k           = static_cast<DAAL_INT>(_nCols);
+        const DAAL_INT ldb         = static_cast<DAAL_INT>(ldBeta);
+        const size_t offset        = _rows[iStartRow] - 1;
+
+        SpBlas<algorithmFPType, cpu>::xxcsrmm(&transa, &m, &n, &k, &one, matdescra, _values + offset, (const DAAL_INT *)(_cols + offset),
+                                              (const DAAL_INT *)(_rows + iStartRow), beta, &ldb, &zero, buffer, &m);
+
+        for (size_t i = 0; i < nRowsInBlock; ++i)
+        {
+            for (size_t c = 0; c < nColumns; ++c) xb[i * nColumns + c] = buffer[c * nRowsInBlock + i];
+        }
+    }
+
+    /* g[c * ldg + j] += sum_i x[iStartRow + i][j] * r[i * nColumns + c], c = 0, ..., nColumns - 1 */
+    void addTransposedProduct(size_t iStartRow, size_t nRowsInBlock, const algorithmFPType * r, size_t nColumns, algorithmFPType * g,
+                              size_t ldg) const
+    {
+        for (size_t i = 0; i < nRowsInBlock; ++i)
+        {
+            const size_t begin               = _rows[iStartRow + i] - 1;
+            const size_t end                 = _rows[iStartRow + i + 1] - 1;
+            const algorithmFPType * const ri = r + i * nColumns;
+            for (size_t c = 0; c < nColumns; ++c)
+            {
+                const algorithmFPType rc   = ri[c];
+                algorithmFPType * const gc = g + c * ldg - 1;
+                PRAGMA_IVDEP
+                for (size_t idx = begin; idx < end; ++idx) gc[_cols[idx]] += _values[idx] * rc;
+            }
+        }
+    }
+
+    /* h += sum_i w[i] * (1, x[iStartRow + i])' * (1, x[iStartRow + i]) over the upper triangle, h is (nCols + 1) x (nCols + 1) */
+    void addWeightedGram(size_t iStartRow, size_t nRowsInBlock, const algorithmFPType * w, algorithmFPType * h) const
+    {
+        const size_t nBeta = _nCols + 1;
+        for (size_t i = 0; i < nRowsInBlock; ++i)
+        {
+            const size_t begin       = _rows[iStartRow + i] - 1;
+            const size_t end         = _rows[iStartRow + i + 1] - 1;
+            const algorithmFPType wi = w ? w[i] : algorithmFPType(1);
+            h[0] += wi;
+            for (size_t idx = begin; idx < end; ++idx)
+            {
+                const algorithmFPType wx = wi * _values[idx];
+                h[_cols[idx]] += wx;
+                algorithmFPType * const hj = h + _cols[idx] * nBeta;
+                for (size_t jdx = begin; jdx < end; ++jdx)
+                {
+                    if (_cols[jdx] >= _cols[idx]) hj[_cols[jdx]] += wx * _values[jdx];
+                }
+            }
+        }
+    }
+
+    /* x = x[iRow] in the dense format */
+    void getDenseRow(size_t iRow, algorithmFPType * x) const
+    {
+        service_memset_seq<algorithmFPType, cpu>(x, algorithmFPType(0), _nCols);
+        for (size_t idx = _rows[iRow] - 1; idx < _rows[iRow + 1] - 1; ++idx) x[_cols[idx] - 1] += _values[idx];
+    }
+
+    /* Maximal squared norm of the rows */
+    algorithmFPType getMaxSquaredNorm() const
+    {
+        const size_t blockSize = 256;
+        const size_t nBlocks   = _nRows / blockSize + !!(_nRows % blockSize);
+
+        TlsMem<algorithmFPType, cpu, services::internal::ScalableCalloc<algorithmFPType, cpu> > tlsData(1);
+        daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock) {
+            algorithmFPType * const maxNorm = tlsData.local();
+            if (!maxNorm) return;
+            const size_t end = services::internal::min<cpu, size_t>((iBlock + 1) * blockSize, _nRows);
+            for (size_t i = iBlock * blockSize; i < end; ++i)
+            {
+                algorithmFPType norm = 0;
+                for (size_t idx = _rows[i] - 1; idx < _rows[i + 1] - 1; ++idx) norm += _values[idx] * _values[idx];
+                if (norm > *maxNorm) *maxNorm = norm;
+            }
+        });
+
+        algorithmFPType globalMaxNorm = 0;
+        tlsData.reduce([&](algorithmFPType * maxNorm) {
+            if (maxNorm && globalMaxNorm < *maxNorm) globalMaxNorm = *maxNorm;
+        });
+        return globalMaxNorm;
+    }
+
+private:
+    const algorithmFPType * _values;
+    const size_t * _cols;
+    const size_t * _rows;
+    const algorithmFPType * _y;
+    size_t _nRows;
+    size_t _nCols;
+
+    ReadRowsCSR<algorithmFPType, cpu> _dataRows;
+    ReadRows<algorithmFPType, cpu> _yRows;
+    TArrayScalable<algorithmFPType, cpu> _valuesArray;
+    TArrayScalable<size_t, cpu> _colsArray;
+    TArrayScalable<size_t, cpu> _rowsArray;
+    TArrayScalable<algorithmFPType, cpu> _yArray;
+};
+
+/* res = sum of the thread local arrays of n values, the sum is computed in parallel by the blocks of the values */
+template <typename algorithmFPType, CpuType cpu>
+Status reduceThreadLocalSums(TlsSum<algorithmFPType, cpu> & tlsSum, algorithmFPType * res, size_t n)
+{
+    const size_t maxThreads = threader_get_max_threads_number();
+    TArray<algorithmFPType *, cpu> localsArray(maxThreads);
+    DAAL_CHECK_MALLOC(localsArray.get());
+    algorithmFPType ** const locals = localsArray.get();
+
+    size_t nLocals = 0;
+    bool isFitted  = true;
+    tlsSum.reduce([&](algorithmFPType * local) {
+        if (!local) return;
+        if (nLocals < maxThreads)
+            locals[nLocals++] = local;
+        else
+            isFitted = false;
+    });
+    if (!isFitted)
+    {
+        tlsSum.reduceTo(res, n);
+        return Status();
+    }
+
+    const size_t blockSize = 4096;
+    const size_t nBlocks   = n / blockSize + !!(n % blockSize);
+    daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock) {
+        const size_t begin = iBlock * blockSize;
+        const size_t end   = services::internal::min<cpu, size_t>(begin + blockSize, n);
+        service_memset_seq<algorithmFPType, cpu>(res + begin, algorithmFPType(0), end - begin);
+        for (size_t t = 0; t < nLocals; ++t)
+        {
+            const algorithmFPType * const local = locals[t];
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t j = begin; j < end; ++j) res[j] += local[j];
+        }
+    });
+    return Status();
+}
+
+} // namespace internal
+} // namespace objective_function
+} // namespace optimization_solver
+} // namespace algorithms
+} // namespace daal
+
+#endif
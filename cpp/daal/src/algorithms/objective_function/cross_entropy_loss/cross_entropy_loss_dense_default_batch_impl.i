@@ -201,19 +201,17 @@ void addHessInPt(algorithmFPType * h, const algorithmFPType * xi, const algorith
 }
 
 template <typename algorithmFPType, Method method, CpuType cpu>
-services::Status CrossEntropyLossKernel<algorithmFPType, method, cpu>::doCompute(const NumericTable * dataNT,
-                                                                                 const NumericTable * dependentVariablesNT, size_t nRows, size_t n,
-                                                                                 size_t p, NumericTable * betaNT, NumericTable * valueNT,
-                                                                                 NumericTable * hessianNT, NumericTable * gradientNT,
-                                                                                 NumericTable * nonSmoothTermValue, NumericTable * proximalProjection,
-                                                                                 NumericTable * lipschitzConstant, Parameter * parameter)
+services::Status CrossEntropyLossKernel<algorithmFPType, method, cpu>::doCompute(
+    const NumericTable * dataNT, const NumericTable * dependentVariablesNT, size_t nRows, size_t n, size_t p, NumericTable * betaNT,
+    NumericTable * valueNT, NumericTable * hessianNT, NumericTable * gradientNT, NumericTable * nonSmoothTermValue, NumericTable * proximalProjection,
+    NumericTable * lipschitzConstant, Parameter * parameter, const objective_function::internal::CSRDataSet<algorithmFPType, cpu> * csrData)
 {
     const size_t nClasses = parameter->nClasses;
 
     DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, n, nClasses);
     DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, n * nClasses, sizeof(algorithmFPType));
 
-    TArrayScalable<algorithmFPType, cpu> f(n * nClasses);
+    TArrayScalable<algorithmFPType, cpu> f(csrData ? 0 : n * nClasses);
     const size_t nBetaPerClass = p + 1;
     DAAL_ASSERT(betaNT->getNumberOfColumns() == 1);
     DAAL_ASSERT(betaNT->getNumberOfRows() == nClasses * nBetaPerClass);
@@ -279,38 +277,45 @@ services::Status CrossEntropyLossKernel<algorithmFPType, method, cpu>::doCompute
         nBlocks += (nBlocks * blockSize != n);
         algorithmFPType globalMaxNorm = 0;
 
-        TlsMem<algorithmFPType, cpu, services::internal::ScalableCalloc<algorithmFPType, cpu> > tlsData(lipschitzConstant->getNumberOfRows());
-        SafeStatus safeStat;
-        daal::threader_for(nBlocks, nBlocks, [&](const size_t iBlock) {
-            algorithmFPType & _maxNorm = *tlsData.local();
-            const size_t startRow      = iBlock * blockSize;
-            const size_t finishRow     = (iBlock + 1 == nBlocks ? n : (iBlock + 1) * blockSize);
-            algorithmFPType curentNorm = 0;
-            ReadRows<algorithmFPType, cpu> xr(const_cast<NumericTable *>(dataNT), startRow, finishRow - startRow);
-            DAAL_CHECK_BLOCK_STATUS_THR(xr);
-            const algorithmFPType * const x = xr.get();
-            for (size_t i = 0; i < finishRow - startRow; i++)
-            {
-                curentNorm = 0;
-
-                PRAGMA_IVDEP
-                PRAGMA_VECTOR_ALWAYS
-                for (size_t j = 0; j < p; j++)
+        if (csrData)
+        {
+            globalMaxNorm = csrData->getMaxSquaredNorm();
+        }
+        else
+        {
+            TlsMem<algorithmFPType, cpu, services::internal::ScalableCalloc<algorithmFPType, cpu> > tlsData(lipschitzConstant->getNumberOfRows());
+            SafeStatus safeStat;
+            daal::threader_for(nBlocks, nBlocks, [&](const size_t iBlock) {
+                algorithmFPType & _maxNorm = *tlsData.local();
+                const size_t startRow      = iBlock * blockSize;
+                const size_t finishRow     = (iBlock + 1 == nBlocks ? n : (iBlock + 1) * blockSize);
+                algorithmFPType curentNorm = 0;
+                ReadRows<algorithmFPType, cpu> xr(const_cast<NumericTable *>(dataNT), startRow, finishRow - startRow);
+                DAAL_CHECK_BLOCK_STATUS_THR(xr);
+                const algorithmFPType * const x = xr.get();
+                for (size_t i = 0; i < finishRow - startRow; i++)
                 {
-                    curentNorm += x[i * p + j] * x[i * p + j];
+                    curentNorm = 0;
+
+                    PRAGMA_IVDEP
+                    PRAGMA_VECTOR_ALWAYS
+                    for (size_t j = 0; j < p; j++)
+                    {
+                        curentNorm += x[i * p + j] * x[i * p + j];
+                    }
+                    if (curentNorm > _maxNorm)
+                    {
+                        _maxNorm = curentNorm;
+                    }
                 }
-                if (curentNorm > _maxNorm)
+            });
+            tlsData.reduce([&](algorithmFPType * maxNorm) {
+                if (globalMaxNorm < *maxNorm)
                 {
-                    _maxNorm = curentNorm;
+                    globalMaxNorm = *maxNorm;
                 }
-            }
-        });
-        tlsData.reduce([&](algorithmFPType * maxNorm) {
-            if (globalMaxNorm < *maxNorm)
-            {
-                globalMaxNorm = *maxNorm;
-            }
-        });
+            });
+        }
 
         algorithmFPType alpha_scaled = algorithmFPType(parameter->penaltyL2) / algorithmFPType(n);
         algorithmFPType lipschitz    = 0.25 * (globalMaxNorm + algorithmFPType(parameter->interceptFlag)) + alpha_scaled;
@@ -318,6 +323,11 @@ services::Status CrossEntropyLossKernel<algorithmFPType, method, cpu>::doCompute
         c                            = 2 * lipschitz + displacement;
     }
 
+    if (csrData && (valueNT || gradientNT || hessianNT))
+    {
+        return doComputeCSR(*csrData, b, valueNT, hessianNT, gradientNT, parameter);
+    }
+
     const size_t nRowsInBlock = 512;
     const size_t nDataBlocks  = n / nRowsInBlock + !!(n % nRowsInBlock);
 
@@ -576,6 +586,170 @@ services::Status CrossEntropyLossKernel<algorithmFPType, method, cpu>::doCompute
     return services::Status();
 }
 
+/*
+ * Value, gradient and Hessian of the cross-entropy loss for the data set in the CSR format.
+ * The gradients and the Hessians of the blocks are accumulated in the thread local arrays
+ */
+template <typename algorithmFPType, Method method, CpuType cpu>
+services::Status CrossEntropyLossKernel<algorithmFPType, method, cpu>::doComputeCSR(
+    const objective_function::internal::CSRDataSet<algorithmFPType, cpu> & data, const algorithmFPType * b, NumericTable * valueNT,
+    NumericTable * hessianNT, NumericTable * gradientNT, Parameter * parameter)
+{
+    services::Status s;
+    const size_t n             = data.getNumberOfRows();
+    const size_t p             = data.getNumberOfColumns();
+    const size_t nClasses      = parameter->nClasses;
+    const size_t nBetaPerClass = p + 1;
+    const size_t nBeta         = nClasses * nBetaPerClass;
+
+    const algorithmFPType div             = static_cast<algorithmFPType>(1) / static_cast<algorithmFPType>(n);
+    const bool interceptFlag              = parameter->interceptFlag;
+    const algorithmFPType interceptFactor = (interceptFlag ? 1 : 0);
+
+    const size_t nRowsInBlock = 512;
+    const size_t nDataBlocks  = n / nRowsInBlock + !!(n % nRowsInBlock);
+
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nRowsInBlock, nClasses);
+    const size_t blockSize = nRowsInBlock * nClasses;
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, blockSize, 3);
+
+    /* probabilities, the buffer of the sparse BLAS and the logarithms of the probabilities of the block, one row in the dense format */
+    TlsMem<algorithmFPType, cpu> tlsData(3 * blockSize + p);
+
+    TArrayScalable<algorithmFPType, cpu> values;
+    if (valueNT)
+    {
+        values.reset(nDataBlocks);
+        DAAL_CHECK_MALLOC(values.get());
+    }
+    TlsSum<algorithmFPType, cpu> tlsGradient(gradientNT ? nBeta : 1);
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nBeta, nBeta);
+    TlsSum<algorithmFPType, cpu> tlsHessian(hessianNT ? nBeta * nBeta : 1);
+
+    SafeStatus safeStat;
+    daal::threader_for(nDataBlocks, nDataBlocks, [&](size_t iBlock) {
+        const size_t iStartRow               = iBlock * nRowsInBlock;
+        const size_t nRowsToProcess          = (iBlock == nDataBlocks - 1) ? n - iBlock * nRowsInBlock : nRowsInBlock;
+        const algorithmFPType * const yLocal = data.y(iStartRow);
+
+        algorithmFPType * const f = tlsData.local();
+        DAAL_CHECK_THR(f, services::ErrorMemoryAllocationFailed);
+        algorithmFPType * const buffer = f + blockSize;
+        algorithmFPType * const logP   = f + 2 * blockSize;
+        algorithmFPType * const x      = f + 3 * blockSize;
+
+        //f = X*b + b0
+        {
+            DAAL_ITTNOTIFY_SCOPED_TASK(applyBeta);
+            data.applyBeta(iStartRow, nRowsToProcess, b + 1, nBetaPerClass, nClasses, buffer, f);
+            if (interceptFlag)
+            {
+                for (size_t i = 0; i < nRowsToProcess; ++i)
+                {
+                    for (size_t j = 0; j < nClasses; ++j) f[i * nClasses + j] += b[j * nBetaPerClass];
+                }
+            }
+        }
+
+        //f = softmax(f)
+        softmax(f, f, nRowsToProcess, nClasses, nullptr, nullptr);
+
+        if (valueNT)
+        {
+            DAAL_ITTNOTIFY_SCOPED_TASK(crossEntropy.computeValueResult);
+            daal::internal::Math<algorithmFPType, cpu>::vLog(nRowsToProcess * nClasses, f, logP);
+
+            algorithmFPType localValue(0);
+            for (size_t i = 0; i < nRowsToProcess; ++i) localValue += logP[i * nClasses + static_cast<size_t>(yLocal[i])];
+            values[iBlock] = localValue;
+        }
+
+        if (hessianNT)
+        {
+            algorithmFPType * const h = tlsHessian.local();
+            DAAL_CHECK_THR(h, services::ErrorMemoryAllocationFailed);
+            for (size_t i = 0; i < nRowsToProcess; ++i)
+            {
+                data.getDenseRow(iStartRow + i, x);
+                addHessInPt<algorithmFPType, cpu>(h, x, f + i * nClasses, interceptFactor, nClasses, nBetaPerClass, nBeta);
+            }
+        }
+
+        if (gradientNT)
+        {
+            DAAL_ITTNOTIFY_SCOPED_TASK(applyGradient);
+            algorithmFPType * const g = tlsGradient.local();
+            DAAL_CHECK_THR(g, services::ErrorMemoryAllocationFailed);
+
+            for (size_t i = 0; i < nRowsToProcess; ++i) --(f[i * nClasses + static_cast<size_t>(yLocal[i])]);
+            data.addTransposedProduct(iStartRow, nRowsToProcess, f, nClasses, g + 1, nBetaPerClass);
+
+            if (interceptFlag)
+            {
+                for (size_t i = 0; i < nRowsToProcess; ++i)
+                {
+                    for (size_t j = 0; j < nClasses; ++j) g[j * nBetaPerClass] += f[i * nClasses + j];
+                }
+            }
+        }
+    });
+    DAAL_CHECK_SAFE_STATUS();
+
+    if (valueNT)
+    {
+        WriteRows<algorithmFPType, cpu> vr(valueNT, 0, 1);
+        DAAL_CHECK_BLOCK_STATUS(vr);
+        algorithmFPType & value = *vr.get();
+        value                   = 0;
+        for (size_t i = 0; i < nDataBlocks; ++i) value += values[i];
+        value *= -div;
+
+        for (size_t i = 0; i < nClasses; i++)
+        {
+            for (size_t j = 1; j < nBetaPerClass; j++)
+            {
+                const algorithmFPType bij = b[i * nBetaPerClass + j];
+                value += bij * bij * parameter->penaltyL2 + (bij < 0 ? -bij : bij) * parameter->penaltyL1;
+            }
+        }
+    }
+
+    if (gradientNT)
+    {
+        WriteRows<algorithmFPType, cpu> gr(gradientNT, 0, nBeta);
+        DAAL_CHECK_BLOCK_STATUS(gr);
+        algorithmFPType * const g = gr.get();
+        DAAL_CHECK_STATUS(s, (objective_function::internal::reduceThreadLocalSums<algorithmFPType, cpu>(tlsGradient, g, nBeta)));
+
+        for (size_t i = 0; i < nBeta; ++i) g[i] *= div;
+        for (size_t i = 0; i < nClasses; i++)
+        {
+            for (size_t j = 1; j < nBetaPerClass; j++) g[i * nBetaPerClass + j] += 2 * b[i * nBetaPerClass + j] * parameter->penaltyL2;
+        }
+    }
+
+    if (hessianNT)
+    {
+        WriteRows<algorithmFPType, cpu> hr(hessianNT, 0, nBeta);
+        DAAL_CHECK_BLOCK_STATUS(hr);
+        algorithmFPType * const h = hr.get();
+        DAAL_CHECK_STATUS(s, (objective_function::internal::reduceThreadLocalSums<algorithmFPType, cpu>(tlsHessian, h, nBeta * nBeta)));
+
+        //hessian is a symmetrical matrix
+        for (size_t i = 0; i < nBeta; ++i)
+        {
+            h[i * nBeta + i] *= div;
+            for (size_t j = i + 1; j < nBeta; ++j)
+            {
+                h[i * nBeta + j] *= div;
+                h[j * nBeta + i] = h[i * nBeta + j];
+            }
+            h[i * nBeta + i] += (i % nBetaPerClass) ? 2 * parameter->penaltyL2 : 0;
+        }
+    }
+    return s;
+}
+
 template <typename algorithmFPType, Method method, CpuType cpu>
 services::Status CrossEntropyLossKernel<algorithmFPType, method, cpu>::compute(NumericTable * dataNT, NumericTable * dependentVariablesNT,
                                                                                NumericTable * betaNT, NumericTable * valueNT,
@@ -590,6 +764,13 @@ services::Status CrossEntropyLossKernel<algorithmFPType, method, cpu>::compute(N
     if (ntInd && (ntInd->getNumberOfColumns() == nRows)) ntInd = nullptr;
     services::Status s;
     const size_t p = dataNT->getNumberOfColumns();
+    if (objective_function::internal::CSRDataSet<algorithmFPType, cpu>::isCSR(dataNT))
+    {
+        objective_function::internal::CSRDataSet<algorithmFPType, cpu> csrData;
+        DAAL_CHECK_STATUS(s, csrData.init(dataNT, dependentVariablesNT, ntInd, 1));
+        return doCompute(dataNT, dependentVariablesNT, nRows, csrData.getNumberOfRows(), p, betaNT, valueNT, hessianNT, gradientNT,
+                         nonSmoothTermValue, proximalProjection, lipschitzConstant, parameter, &csrData);
+    }
     if (ntInd)
     {
         const size_t n = ntInd->getNumberOfColumns();
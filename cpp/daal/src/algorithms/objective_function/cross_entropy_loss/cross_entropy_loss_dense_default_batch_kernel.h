@@ -26,6 +26,7 @@
 #include "src/algorithms/kernel.h"
 #include "src/data_management/service_numeric_table.h"
 #include "src/externals/service_blas.h"
+#include "src/algorithms/objective_function/common/objective_function_csr_utils.h"
 #include "data_management/data/numeric_table.h"
 
 namespace daal
@@ -62,7 +63,10 @@ protected:
     services::Status doCompute(const NumericTable * dataNT, const NumericTable * dependentVariablesNT, size_t nRows, size_t n, size_t p,
                                NumericTable * betaNT, NumericTable * valueNT, NumericTable * hessianNT, NumericTable * gradientNT,
                                NumericTable * nonSmoothTermValue, NumericTable * proximalProjection, NumericTable * lipschitzConstant,
-                               Parameter * parameter);
+                               Parameter * parameter, const objective_function::internal::CSRDataSet<algorithmFPType, cpu> * csrData = nullptr);
+
+    services::Status doComputeCSR(const objective_function::internal::CSRDataSet<algorithmFPType, cpu> & data, const algorithmFPType * b,
+                                  NumericTable * valueNT, NumericTable * hessianNT, NumericTable * gradientNT, Parameter * parameter);
 
 private:
     TArrayScalable<algorithmFPType, cpu> _aX;
@@ -123,11 +123,10 @@ void LogLossKernel<algorithmFPType, method, cpu>::sigmoid(const algorithmFPType
 }
 
 template <typename algorithmFPType, Method method, CpuType cpu>
-services::Status LogLossKernel<algorithmFPType, method, cpu>::doCompute(const NumericTable * dataNT, const NumericTable * dependentVariablesNT,
-                                                                        size_t n, size_t p, NumericTable * betaNT, NumericTable * valueNT,
-                                                                        NumericTable * hessianNT, NumericTable * gradientNT,
-                                                                        NumericTable * nonSmoothTermValue, NumericTable * proximalProjection,
-                                                                        NumericTable * lipschitzConstant, Parameter * parameter)
+services::Status LogLossKernel<algorithmFPType, method, cpu>::doCompute(
+    const NumericTable * dataNT, const NumericTable * dependentVariablesNT, size_t n, size_t p, NumericTable * betaNT, NumericTable * valueNT,
+    NumericTable * hessianNT, NumericTable * gradientNT, NumericTable * nonSmoothTermValue, NumericTable * proximalProjection,
+    NumericTable * lipschitzConstant, Parameter * parameter, const objective_function::internal::CSRDataSet<algorithmFPType, cpu> * csrData)
 {
     SafeStatus safeStat;
     const size_t nBeta = p + 1;
@@ -195,35 +194,42 @@ services::Status LogLossKernel<algorithmFPType, method, cpu>::doCompute(const Nu
         const size_t nBlocks          = n / blockSize + !!(n % blockSize);
         algorithmFPType globalMaxNorm = 0;
 
-        TlsMem<algorithmFPType, cpu, services::internal::ScalableCalloc<algorithmFPType, cpu> > tlsData(lipschitzConstant->getNumberOfRows());
-
-        daal::threader_for(nBlocks, nBlocks, [&](const size_t iBlock) {
-            algorithmFPType & _maxNorm = *tlsData.local();
-            const size_t startRow      = iBlock * blockSize;
-            const size_t finishRow     = (iBlock + 1 == nBlocks ? n : (iBlock + 1) * blockSize);
-            ReadRows<algorithmFPType, cpu> xr(const_cast<NumericTable *>(dataNT), startRow, finishRow - startRow);
-            DAAL_CHECK_BLOCK_STATUS_THR(xr);
-            const algorithmFPType * const x = xr.get();
-            algorithmFPType curentNorm      = 0;
-            for (size_t i = 0; i < finishRow - startRow; i++)
-            {
-                curentNorm = 0;
-                for (size_t j = 0; j < p; j++)
+        if (csrData)
+        {
+            globalMaxNorm = csrData->getMaxSquaredNorm();
+        }
+        else
+        {
+            TlsMem<algorithmFPType, cpu, services::internal::ScalableCalloc<algorithmFPType, cpu> > tlsData(lipschitzConstant->getNumberOfRows());
+
+            daal::threader_for(nBlocks, nBlocks, [&](const size_t iBlock) {
+                algorithmFPType & _maxNorm = *tlsData.local();
+                const size_t startRow      = iBlock * blockSize;
+                const size_t finishRow     = (iBlock + 1 == nBlocks ? n : (iBlock + 1) * blockSize);
+                ReadRows<algorithmFPType, cpu> xr(const_cast<NumericTable *>(dataNT), startRow, finishRow - startRow);
+                DAAL_CHECK_BLOCK_STATUS_THR(xr);
+                const algorithmFPType * const x = xr.get();
+                algorithmFPType curentNorm      = 0;
+                for (size_t i = 0; i < finishRow - startRow; i++)
                 {
-                    curentNorm += x[i * p + j] * x[i * p + j];
+                    curentNorm = 0;
+                    for (size_t j = 0; j < p; j++)
+                    {
+                        curentNorm += x[i * p + j] * x[i * p + j];
+                    }
+                    if (curentNorm > _maxNorm)
+                    {
+                        _maxNorm = curentNorm;
+                    }
                 }
-                if (curentNorm > _maxNorm)
+            });
+            tlsData.reduce([&](algorithmFPType * maxNorm) {
+                if (globalMaxNorm < *maxNorm)
                 {
-                    _maxNorm = curentNorm;
+                    globalMaxNorm = *maxNorm;
                 }
-            }
-        });
-        tlsData.reduce([&](algorithmFPType * maxNorm) {
-            if (globalMaxNorm < *maxNorm)
-            {
-                globalMaxNorm = *maxNorm;
-            }
-        });
+            });
+        }
 
         algorithmFPType alpha_scaled = algorithmFPType(parameter->penaltyL2) / algorithmFPType(n);
         algorithmFPType lipschitz    = 0.25 * (globalMaxNorm + algorithmFPType(parameter->interceptFlag)) + alpha_scaled;
@@ -248,6 +254,11 @@ services::Status LogLossKernel<algorithmFPType, method, cpu>::doCompute(const Nu
         v = nonSmoothTerm;
     }
 
+    if (csrData && (valueNT || gradientNT || hessianNT))
+    {
+        return doComputeCSR(*csrData, b, valueNT, hessianNT, gradientNT, parameter);
+    }
+
     if (valueNT || gradientNT || hessianNT)
     {
         TNArray<algorithmFPType, 16, cpu> f;
@@ -561,6 +572,158 @@ services::Status LogLossKernel<algorithmFPType, method, cpu>::doCompute(const Nu
     return services::Status();
 }
 
+/*
+ * Value, gradient and Hessian of the logistic loss for the data set in the CSR format.
+ * The gradients and the Hessians of the blocks are accumulated in the thread local arrays
+ */
+template <typename algorithmFPType, Method method, CpuType cpu>
+services::Status LogLossKernel<algorithmFPType, method, cpu>::doComputeCSR(
+    const objective_function::internal::CSRDataSet<algorithmFPType, cpu> & data, const algorithmFPType * b, NumericTable * valueNT,
+    NumericTable * hessianNT, NumericTable * gradientNT, Parameter * parameter)
+{
+    services::Status s;
+    const size_t n     = data.getNumberOfRows();
+    const size_t p     = data.getNumberOfColumns();
+    const size_t nBeta = p + 1;
+
+    const algorithmFPType div = static_cast<algorithmFPType>(1) / static_cast<algorithmFPType>(n);
+    const bool bIntercept     = parameter->interceptFlag;
+
+    const size_t nRowsInBlock = 512;
+    const size_t nDataBlocks  = n / nRowsInBlock + !!(n % nRowsInBlock);
+
+    /* f = X*b + b0, s = sigm(f), s1 = 1 - s and the logarithm of s1 for every row of the block */
+    TlsMem<algorithmFPType, cpu> tlsData(4 * nRowsInBlock);
+
+    TArrayScalable<algorithmFPType, cpu> values;
+    if (valueNT)
+    {
+        values.reset(nDataBlocks);
+        DAAL_CHECK_MALLOC(values.get());
+    }
+    TlsSum<algorithmFPType, cpu> tlsGradient(gradientNT ? nBeta : 1);
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nBeta, nBeta);
+    TlsSum<algorithmFPType, cpu> tlsHessian(hessianNT ? nBeta * nBeta : 1);
+
+    SafeStatus safeStat;
+    daal::threader_for(nDataBlocks, nDataBlocks, [&](size_t iBlock) {
+        const size_t iStartRow      = iBlock * nRowsInBlock;
+        const size_t nRowsToProcess = (iBlock == nDataBlocks - 1) ? n - iBlock * nRowsInBlock : nRowsInBlock;
+        const algorithmFPType * const yLocal = data.y(iStartRow);
+
+        algorithmFPType * const f = tlsData.local();
+        DAAL_CHECK_THR(f, services::ErrorMemoryAllocationFailed);
+        algorithmFPType * const sg = f + nRowsInBlock;
+        algorithmFPType * const ls = f + 3 * nRowsInBlock;
+
+        {
+            DAAL_ITTNOTIFY_SCOPED_TASK(applyBeta);
+            data.applyBeta(iStartRow, nRowsToProcess, b + 1, f);
+            if (bIntercept)
+            {
+                PRAGMA_IVDEP
+                PRAGMA_VECTOR_ALWAYS
+                for (size_t i = 0; i < nRowsToProcess; ++i) f[i] += b[0];
+            }
+        }
+
+        {
+            DAAL_ITTNOTIFY_SCOPED_TASK(sigmoids);
+            vexp<algorithmFPType, cpu>(f, sg, nRowsToProcess);
+            sigmoids<algorithmFPType, cpu>(sg, nRowsToProcess, nRowsInBlock);
+        }
+
+        if (valueNT)
+        {
+            DAAL_ITTNOTIFY_SCOPED_TASK(logLoss.computeValueResult);
+            daal::internal::Math<algorithmFPType, cpu>::vLog(nRowsToProcess, sg, f);
+            daal::internal::Math<algorithmFPType, cpu>::vLog(nRowsToProcess, sg + nRowsInBlock, ls);
+
+            algorithmFPType localValue(0);
+            for (size_t i = 0; i < nRowsToProcess; ++i)
+            {
+                localValue += yLocal[i] * f[i] + (static_cast<algorithmFPType>(1) - yLocal[i]) * ls[i];
+            }
+            values[iBlock] = -localValue * div;
+        }
+
+        if (gradientNT)
+        {
+            DAAL_ITTNOTIFY_SCOPED_TASK(applyGradient);
+            algorithmFPType * const g = tlsGradient.local();
+            DAAL_CHECK_THR(g, services::ErrorMemoryAllocationFailed);
+
+            algorithmFPType interceptGradLocal(0);
+            for (size_t i = 0; i < nRowsToProcess; ++i)
+            {
+                f[i] = sg[i] - yLocal[i];
+                interceptGradLocal += f[i];
+            }
+            data.addTransposedProduct(iStartRow, nRowsToProcess, f, 1, g + 1, p);
+            if (bIntercept) g[0] += interceptGradLocal;
+        }
+
+        if (hessianNT)
+        {
+            algorithmFPType * const h = tlsHessian.local();
+            DAAL_CHECK_THR(h, services::ErrorMemoryAllocationFailed);
+
+            /* sigmoid derivatives */
+            for (size_t i = 0; i < nRowsToProcess; ++i) f[i] = sg[i] * sg[i + nRowsInBlock];
+            data.addWeightedGram(iStartRow, nRowsToProcess, f, h);
+        }
+    });
+    DAAL_CHECK_SAFE_STATUS();
+
+    if (valueNT)
+    {
+        WriteRows<algorithmFPType, cpu> vr(valueNT, 0, 1);
+        DAAL_CHECK_BLOCK_STATUS(vr);
+        algorithmFPType & value = *vr.get();
+        value                   = 0;
+        for (size_t i = 0; i < nDataBlocks; ++i) value += values[i];
+
+        for (size_t i = 1; i < nBeta; ++i)
+        {
+            value += b[i] * b[i] * parameter->penaltyL2 + (b[i] < 0 ? -b[i] : b[i]) * parameter->penaltyL1;
+        }
+    }
+
+    if (gradientNT)
+    {
+        WriteRows<algorithmFPType, cpu> gr(gradientNT, 0, nBeta);
+        DAAL_CHECK_BLOCK_STATUS(gr);
+        algorithmFPType * const g = gr.get();
+        DAAL_CHECK_STATUS(s, (objective_function::internal::reduceThreadLocalSums<algorithmFPType, cpu>(tlsGradient, g, nBeta)));
+
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t i = 0; i < nBeta; ++i) g[i] *= div;
+        for (size_t i = 1; i < nBeta; ++i) g[i] += 2. * b[i] * parameter->penaltyL2;
+    }
+
+    if (hessianNT)
+    {
+        WriteRows<algorithmFPType, cpu> hr(hessianNT, 0, nBeta);
+        DAAL_CHECK_BLOCK_STATUS(hr);
+        algorithmFPType * const h = hr.get();
+        DAAL_CHECK_STATUS(s, (objective_function::internal::reduceThreadLocalSums<algorithmFPType, cpu>(tlsHessian, h, nBeta * nBeta)));
+
+        for (size_t j = 0; j < nBeta; ++j)
+        {
+            for (size_t k = j; k < nBeta; ++k)
+            {
+                const algorithmFPType val = (j || k == 0 || bIntercept) ? h[j * nBeta + k] * div : 0;
+                h[j * nBeta + k]          = val;
+                h[k * nBeta + j]          = val;
+            }
+            if (j) h[j * nBeta + j] += 2. * parameter->penaltyL2;
+        }
+        if (!bIntercept) h[0] = 0;
+    }
+    return s;
+}
+
 template <typename algorithmFPType, Method method, CpuType cpu>
 services::Status LogLossKernel<algorithmFPType, method, cpu>::compute(NumericTable * dataNT, NumericTable * dependentVariablesNT,
                                                                       NumericTable * betaNT, NumericTable * valueNT, NumericTable * hessianNT,
@@ -575,6 +738,14 @@ services::Status LogLossKernel<algorithmFPType, method, cpu>::compute(NumericTab
     if (ntInd && (ntInd->getNumberOfColumns() == nRows)) ntInd = nullptr;
 
     const size_t p = dataNT->getNumberOfColumns();
+    if (objective_function::internal::CSRDataSet<algorithmFPType, cpu>::isCSR(dataNT))
+    {
+        services::Status s;
+        objective_function::internal::CSRDataSet<algorithmFPType, cpu> csrData;
+        DAAL_CHECK_STATUS(s, csrData.init(dataNT, dependentVariablesNT, ntInd, 1));
+        return doCompute(dataNT, dependentVariablesNT, csrData.getNumberOfRows(), p, betaNT, valueNT, hessianNT, gradientNT, nonSmoothTermValue,
+                         proximalProjection, lipschitzConstant, parameter, &csrData);
+    }
     if (ntInd)
     {
         const size_t n = ntInd->getNumberOfColumns();
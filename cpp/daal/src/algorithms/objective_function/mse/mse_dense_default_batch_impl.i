@@ -705,37 +705,47 @@ inline services::Status MSEKernel<algorithmFPType, method, cpu>::compute(Numeric
         nBlocks += (nBlocks * blockSize != n);
         algorithmFPType globalMaxNorm = 0;
 
-        TlsMem<algorithmFPType, cpu, services::internal::ScalableCalloc<algorithmFPType, cpu> > tlsData(lipschitzConstant->getNumberOfRows());
-        daal::threader_for(nBlocks, nBlocks, [&](const size_t iBlock) {
-            algorithmFPType & _maxNorm  = *tlsData.local();
-            const size_t startRow       = iBlock * blockSize;
-            const size_t finishRow      = (iBlock + 1 == nBlocks ? n : (iBlock + 1) * blockSize);
-            const size_t numRowsInBlock = finishRow - startRow;
-            algorithmFPType curentNorm  = 0;
-
-            ReadRows<algorithmFPType, cpu> xptr(dataNT, startRow, numRowsInBlock);
-            DAAL_CHECK_BLOCK_STATUS_THR(xptr);
-            const algorithmFPType * x = const_cast<algorithmFPType *>(xptr.get());
-
-            for (size_t i = 0; i < numRowsInBlock; ++i)
-            {
-                curentNorm = 0;
-                for (size_t j = 0; j < p; ++j)
+        if (objective_function::internal::CSRDataSet<algorithmFPType, cpu>::isCSR(dataNT))
+        {
+            services::Status s;
+            objective_function::internal::CSRDataSet<algorithmFPType, cpu> csrData;
+            DAAL_CHECK_STATUS(s, csrData.init(dataNT, dependentVariablesNT, nullptr, 1));
+            globalMaxNorm = csrData.getMaxSquaredNorm();
+        }
+        else
+        {
+            TlsMem<algorithmFPType, cpu, services::internal::ScalableCalloc<algorithmFPType, cpu> > tlsData(lipschitzConstant->getNumberOfRows());
+            daal::threader_for(nBlocks, nBlocks, [&](const size_t iBlock) {
+                algorithmFPType & _maxNorm  = *tlsData.local();
+                const size_t startRow       = iBlock * blockSize;
+                const size_t finishRow      = (iBlock + 1 == nBlocks ? n : (iBlock + 1) * blockSize);
+                const size_t numRowsInBlock = finishRow - startRow;
+                algorithmFPType curentNorm  = 0;
+
+                ReadRows<algorithmFPType, cpu> xptr(dataNT, startRow, numRowsInBlock);
+                DAAL_CHECK_BLOCK_STATUS_THR(xptr);
+                const algorithmFPType * x = const_cast<algorithmFPType *>(xptr.get());
+
+                for (size_t i = 0; i < numRowsInBlock; ++i)
                 {
-                    curentNorm += x[i * p + j] * x[i * p + j];
+                    curentNorm = 0;
+                    for (size_t j = 0; j < p; ++j)
+                    {
+                        curentNorm += x[i * p + j] * x[i * p + j];
+                    }
+                    if (curentNorm > _maxNorm)
+                    {
+                        _maxNorm = curentNorm;
+                    }
                 }
-                if (curentNorm > _maxNorm)
+            });
+            tlsData.reduce([&](algorithmFPType * maxNorm) {
+                if (globalMaxNorm < *maxNorm)
                 {
-                    _maxNorm = curentNorm;
+                    globalMaxNorm = *maxNorm;
                 }
-            }
-        });
-        tlsData.reduce([&](algorithmFPType * maxNorm) {
-            if (globalMaxNorm < *maxNorm)
-            {
-                globalMaxNorm = *maxNorm;
-            }
-        });
+            });
+        }
 
         algorithmFPType lipschitz = (globalMaxNorm + 1);
         c                         = 2 * lipschitz;
@@ -751,6 +761,13 @@ inline services::Status MSEKernel<algorithmFPType, method, cpu>::compute(Numeric
         return services::Status();
     }
 
+    if (objective_function::internal::CSRDataSet<algorithmFPType, cpu>::isCSR(dataNT))
+    {
+        const NumericTable * ntInd = parameter->batchIndices.get();
+        if (ntInd && ntInd->getNumberOfColumns() == nDataRows) ntInd = nullptr;
+        return computeCSR(dataNT, dependentVariablesNT, ntInd, argumentNT, valueNT, hessianNT, gradientNT);
+    }
+
     if (parameter->batchIndices.get() != NULL && parameter->batchIndices->getNumberOfColumns() != nDataRows)
     {
         MSETaskSample<algorithmFPType, cpu> task(dataNT, dependentVariablesNT, argumentNT, valueNT, hessianNT, gradientNT, parameter,
@@ -794,6 +811,124 @@ services::Status MSEKernel<algorithmFPType, method, cpu>::run(MSETask<algorithmF
     return s;
 }
 
+/*
+ * Value, gradient and Hessian of the MSE for the data set in the CSR format.
+ * The gradients and the Hessians of the blocks are accumulated in the thread local arrays
+ */
+template <typename algorithmFPType, Method method, CpuType cpu>
+services::Status MSEKernel<algorithmFPType, method, cpu>::computeCSR(NumericTable * dataNT, NumericTable * dependentVariablesNT,
+                                                                     const NumericTable * indNT, NumericTable * argumentNT, NumericTable * valueNT,
+                                                                     NumericTable * hessianNT, NumericTable * gradientNT)
+{
+    services::Status s;
+    objective_function::internal::CSRDataSet<algorithmFPType, cpu> data;
+    DAAL_CHECK_STATUS(s, data.init(dataNT, dependentVariablesNT, indNT, 1));
+
+    const size_t n            = data.getNumberOfRows();
+    const size_t nTheta       = data.getNumberOfColumns();
+    const size_t argumentSize = nTheta + 1;
+
+    ReadRows<algorithmFPType, cpu> argumentRows(argumentNT, 0, argumentSize);
+    DAAL_CHECK_BLOCK_STATUS(argumentRows);
+    const algorithmFPType * const theta = argumentRows.get();
+
+    const size_t nRowsInBlock = blockSizeDefault;
+    const size_t nDataBlocks  = n / nRowsInBlock + !!(n % nRowsInBlock);
+
+    TlsMem<algorithmFPType, cpu> tlsResidual(nRowsInBlock);
+    TArrayScalable<algorithmFPType, cpu> values;
+    if (valueNT)
+    {
+        values.reset(nDataBlocks);
+        DAAL_CHECK_MALLOC(values.get());
+    }
+    TlsSum<algorithmFPType, cpu> tlsGradient(gradientNT ? argumentSize : 1);
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, argumentSize, argumentSize);
+    TlsSum<algorithmFPType, cpu> tlsHessian(hessianNT ? argumentSize * argumentSize : 1);
+
+    SafeStatus safeStat;
+    daal::threader_for(nDataBlocks, nDataBlocks, [&](size_t iBlock) {
+        const size_t iStartRow      = iBlock * nRowsInBlock;
+        const size_t nRowsToProcess = (iBlock == nDataBlocks - 1) ? n - iBlock * nRowsInBlock : nRowsInBlock;
+
+        if (valueNT || gradientNT)
+        {
+            algorithmFPType * const r = tlsResidual.local();
+            DAAL_CHECK_THR(r, services::ErrorMemoryAllocationFailed);
+            const algorithmFPType * const y = data.y(iStartRow);
+
+            /* r = X * theta + theta0 - y */
+            data.applyBeta(iStartRow, nRowsToProcess, theta + 1, r);
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t i = 0; i < nRowsToProcess; ++i) r[i] += theta[0] - y[i];
+
+            if (valueNT)
+            {
+                algorithmFPType localValue(0);
+                for (size_t i = 0; i < nRowsToProcess; ++i) localValue += r[i] * r[i];
+                values[iBlock] = localValue;
+            }
+
+            if (gradientNT)
+            {
+                algorithmFPType * const g = tlsGradient.local();
+                DAAL_CHECK_THR(g, services::ErrorMemoryAllocationFailed);
+                for (size_t i = 0; i < nRowsToProcess; ++i) g[0] += r[i];
+                data.addTransposedProduct(iStartRow, nRowsToProcess, r, 1, g + 1, nTheta);
+            }
+        }
+
+        if (hessianNT)
+        {
+            algorithmFPType * const h = tlsHessian.local();
+            DAAL_CHECK_THR(h, services::ErrorMemoryAllocationFailed);
+            data.addWeightedGram(iStartRow, nRowsToProcess, nullptr, h);
+        }
+    });
+    DAAL_CHECK_SAFE_STATUS();
+
+    const algorithmFPType one          = 1.0;
+    const algorithmFPType batchSizeInv = one / n;
+    if (valueNT)
+    {
+        WriteRows<algorithmFPType, cpu> valueRows(valueNT, 0, 1);
+        DAAL_CHECK_BLOCK_STATUS(valueRows);
+        algorithmFPType & value = *valueRows.get();
+        value                   = 0;
+        for (size_t i = 0; i < nDataBlocks; ++i) value += values[i];
+        value /= (algorithmFPType)(2 * n);
+    }
+
+    if (gradientNT)
+    {
+        WriteRows<algorithmFPType, cpu> gradientRows(gradientNT, 0, argumentSize);
+        DAAL_CHECK_BLOCK_STATUS(gradientRows);
+        algorithmFPType * const gradient = gradientRows.get();
+        DAAL_CHECK_STATUS(s, (objective_function::internal::reduceThreadLocalSums<algorithmFPType, cpu>(tlsGradient, gradient, argumentSize)));
+        for (size_t j = 0; j < argumentSize; j++) gradient[j] *= batchSizeInv;
+    }
+
+    if (hessianNT)
+    {
+        WriteRows<algorithmFPType, cpu> hessianRows(hessianNT, 0, argumentSize);
+        DAAL_CHECK_BLOCK_STATUS(hessianRows);
+        algorithmFPType * const hessian = hessianRows.get();
+        DAAL_CHECK_STATUS(s, (objective_function::internal::reduceThreadLocalSums<algorithmFPType, cpu>(tlsHessian, hessian,
+                                                                                                          argumentSize * argumentSize)));
+        for (size_t i = 0; i < argumentSize; i++)
+        {
+            for (size_t j = i; j < argumentSize; j++)
+            {
+                hessian[i * argumentSize + j] *= batchSizeInv;
+                hessian[j * argumentSize + i] = hessian[i * argumentSize + j];
+            }
+        }
+        hessian[0] = one;
+    }
+    return s;
+}
+
 template <typename algorithmFPType, Method method, CpuType cpu>
 inline void MSEKernel<algorithmFPType, method, cpu>::computeMSE(size_t blockSize, MSETask<algorithmFPType, cpu> & task, algorithmFPType * data,
                                                                 algorithmFPType * argumentArray, algorithmFPType * dependentVariablesArray,
@@ -28,6 +28,7 @@
 #include "src/externals/service_blas.h"
 #include "data_management/data/numeric_table.h"
 #include "data_management/data/soa_numeric_table.h"
+#include "src/algorithms/objective_function/common/objective_function_csr_utils.h"
 
 namespace daal
 {
@@ -222,6 +223,9 @@ private:
 
     Status run(MSETask<algorithmFPType, cpu> & task);
 
+    Status computeCSR(NumericTable * dataNT, NumericTable * dependentVariablesNT, const NumericTable * indNT, NumericTable * argumentNT,
+                      NumericTable * valueNT, NumericTable * hessianNT, NumericTable * gradientNT);
+
     TArray<algorithmFPType, cpu> residual;
     TArray<algorithmFPType, cpu> gramMatrix;
     TArray<algorithmFPType, cpu> XY;
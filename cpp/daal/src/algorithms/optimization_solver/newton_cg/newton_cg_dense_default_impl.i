@@ -0,0 +1,776 @@
+/* file: newton_cg_dense_default_impl.i */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of Newton conjugate gradient algorithm.
+//
+//  Every iteration solves the Newton system H * d = -g inexactly by the
+//  conjugate gradient method, the tolerance of the inner solve decreases
+//  together with the norm of the gradient. The Hessian is not formed: the
+//  product of the Hessian of the logistic or the cross-entropy loss and
+//  a vector is computed exactly as X' * D * X * v, for other objective
+//  functions it is the forward difference of the gradients:
+//      H * v ~ (g(x + h * v) - g(x)) / h.
+//  The step is accepted by the trust region test (Steihaug conjugate gradient)
+//  or by the backtracking line search with the Armijo condition.
+//--
+*/
+
+#ifndef __NEWTON_CG_DENSE_DEFAULT_IMPL_I__
+#define __NEWTON_CG_DENSE_DEFAULT_IMPL_I__
+
+#include "src/externals/service_blas.h"
+#include "src/externals/service_math.h"
+#include "src/externals/service_memory.h"
+#include "src/data_management/service_numeric_table.h"
+#include "src/services/service_algo_utils.h"
+#include "src/services/service_arrays.h"
+#include "src/services/service_data_utils.h"
+#include "src/services/service_utils.h"
+#include "src/services/daal_strings.h"
+#include "src/algorithms/service_threading.h"
+#include "src/algorithms/objective_function/common/objective_function_csr_utils.h"
+#include "algorithms/optimization_solver/iterative_solver/iterative_solver_types.h"
+#include "algorithms/optimization_solver/objective_function/logistic_loss_batch.h"
+#include "algorithms/optimization_solver/objective_function/cross_entropy_loss_batch.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace optimization_solver
+{
+namespace newton_cg
+{
+namespace internal
+{
+using namespace daal::internal;
+using namespace daal::services;
+using namespace daal::services::internal;
+
+/*
+ * Product of the Hessian of the logistic or the cross-entropy loss and a vector:
+ *     H * v = X' * D * X * v / n + 2 * penaltyL2 * v,
+ * where X is the data set with the column of ones for the intercept (the column of zeros if the intercept is not used),
+ * D is the diagonal matrix of s * (1 - s), s = sigmoid(X * b), for the logistic loss and the block diagonal matrix
+ * of diag(p) - p * p', p = softmax(B * x), for the cross-entropy loss. The penalty does not apply to the intercepts.
+ * D is computed once for an argument, so every product is two passes over the data set
+ */
+template <typename algorithmFPType, CpuType cpu>
+class LossHessianProduct
+{
+public:
+    typedef objective_function::internal::CSRDataSet<algorithmFPType, cpu> CSRDataSetType;
+
+    LossHessianProduct()
+        : _dataNT(nullptr), _nRowsInBlock(512), _n(0), _p(0), _nClasses(0), _isLogistic(false), _isCSR(false), _interceptFactor(0), _penaltyL2(0)
+    {}
+
+    /* isApplicable is set if the objective function is the logistic or the cross-entropy loss of the argument of nBeta values */
+    Status init(const sum_of_functions::BatchPtr & function, size_t nBeta, bool & isApplicable);
+
+    /* Computes the matrix D at the argument b */
+    Status setArgument(const algorithmFPType * b);
+
+    /* Hv = H * v */
+    Status apply(const algorithmFPType * v, algorithmFPType * Hv);
+
+private:
+    size_t getNumberOfBlocks() const { return _n / _nRowsInBlock + !!(_n % _nRowsInBlock); }
+
+    /* xb[i * nClasses + c] = x[iStartRow + i] * b_c, x is the dense block of the rows or nullptr for the CSR data set */
+    void applyArgument(size_t iStartRow, size_t nRows, const algorithmFPType * x, const algorithmFPType * b, algorithmFPType * buffer,
+                       algorithmFPType * xb) const;
+
+    /* g_c += sum_i x[iStartRow + i] * r[i * nClasses + c] */
+    void addTransposedProduct(size_t iStartRow, size_t nRows, const algorithmFPType * x, const algorithmFPType * r, algorithmFPType * g) const;
+
+    NumericTable * _dataNT;
+    CSRDataSetType _csrData;
+    size_t _nRowsInBlock;
+    size_t _n;
+    size_t _p;
+    size_t _nClasses;
+    bool _isLogistic;
+    bool _isCSR;
+    algorithmFPType _interceptFactor;
+    algorithmFPType _penaltyL2;
+    TArrayScalable<algorithmFPType, cpu> _weights; /* s * (1 - s) of the logistic loss or the probabilities of the cross-entropy loss */
+};
+
+template <typename algorithmFPType, CpuType cpu>
+Status LossHessianProduct<algorithmFPType, cpu>::init(const sum_of_functions::BatchPtr & function, size_t nBeta, bool & isApplicable)
+{
+    isApplicable = false;
+
+    NumericTable * dependentVariablesNT = nullptr;
+    bool interceptFlag                  = false;
+
+    const logistic_loss::Parameter * logLossPar = dynamic_cast<const logistic_loss::Parameter *>(function->sumOfFunctionsParameter);
+    const logistic_loss::Input * logLossInput   = dynamic_cast<const logistic_loss::Input *>(function->sumOfFunctionsInput);
+    const cross_entropy_loss::Parameter * cePar = dynamic_cast<const cross_entropy_loss::Parameter *>(function->sumOfFunctionsParameter);
+    const cross_entropy_loss::Input * ceInput   = dynamic_cast<const cross_entropy_loss::Input *>(function->sumOfFunctionsInput);
+    if (logLossPar && logLossInput)
+    {
+        _dataNT              = logLossInput->get(logistic_loss::data).get();
+        dependentVariablesNT = logLossInput->get(logistic_loss::dependentVariables).get();
+        _nClasses            = 1;
+        _isLogistic          = true;
+        interceptFlag        = logLossPar->interceptFlag;
+        _penaltyL2           = logLossPar->penaltyL2;
+        DAAL_CHECK_EX(logLossPar->penaltyL1 == 0.0f, ErrorIncorrectParameter, ParameterName, penaltyL1Str());
+    }
+    else if (cePar && ceInput)
+    {
+        _dataNT              = ceInput->get(cross_entropy_loss::data).get();
+        dependentVariablesNT = ceInput->get(cross_entropy_loss::dependentVariables).get();
+        _nClasses            = cePar->nClasses;
+        _isLogistic          = false;
+        interceptFlag        = cePar->interceptFlag;
+        _penaltyL2           = cePar->penaltyL2;
+        DAAL_CHECK_EX(cePar->penaltyL1 == 0.0f, ErrorIncorrectParameter, ParameterName, penaltyL1Str());
+    }
+    if (!_dataNT || !dependentVariablesNT) return Status();
+
+    _p               = _dataNT->getNumberOfColumns();
+    _interceptFactor = interceptFlag ? algorithmFPType(1) : algorithmFPType(0);
+    if (nBeta != _nClasses * (_p + 1)) return Status();
+
+    Status s;
+    _isCSR = CSRDataSetType::isCSR(_dataNT);
+    if (_isCSR)
+    {
+        DAAL_CHECK_STATUS(s, _csrData.init(_dataNT, dependentVariablesNT, nullptr, 1));
+        _n = _csrData.getNumberOfRows();
+    }
+    else
+    {
+        _n = _dataNT->getNumberOfRows();
+    }
+
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, _n, _nClasses);
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, _nRowsInBlock * 2, _nClasses);
+    _weights.reset(_n * _nClasses);
+    DAAL_CHECK_MALLOC(_weights.get());
+
+    isApplicable = true;
+    return s;
+}
+
+template <typename algorithmFPType, CpuType cpu>
+void LossHessianProduct<algorithmFPType, cpu>::applyArgument(size_t iStartRow, size_t nRows, const algorithmFPType * x, const algorithmFPType * b,
+                                                            algorithmFPType * buffer, algorithmFPType * xb) const
+{
+    const size_t nBetaPerClass = _p + 1;
+    if (_isCSR)
+    {
+        _csrData.applyBeta(iStartRow, nRows, b + 1, nBetaPerClass, _nClasses, buffer, xb);
+    }
+    else
+    {
+        const char trans           = 'T';
+        const char notrans         = 'N';
+        const algorithmFPType one  = 1.0;
+        const algorithmFPType zero = 0.0;
+        const DAAL_INT m           = static_cast<DAAL_INT>(_nClasses);
+        const DAAL_INT n           = static_cast<DAAL_INT>(nRows);
+        const DAAL_INT k           = static_cast<DAAL_INT>(_p);
+        const DAAL_INT ldb         = static_cast<DAAL_INT>(nBetaPerClass);
+        Blas<algorithmFPType, cpu>::xxgemm(&trans, &notrans, &m, &n, &k, &one, b + 1, &ldb, x, &k, &zero, xb, &m);
+    }
+
+    if (_interceptFactor != algorithmFPType(0))
+    {
+        for (size_t i = 0; i < nRows; ++i)
+        {
+            for (size_t c = 0; c < _nClasses; ++c) xb[i * _nClasses + c] += b[c * nBetaPerClass];
+        }
+    }
+}
+
+template <typename algorithmFPType, CpuType cpu>
+void LossHessianProduct<algorithmFPType, cpu>::addTransposedProduct(size_t iStartRow, size_t nRows, const algorithmFPType * x,
+                                                                   const algorithmFPType * r, algorithmFPType * g) const
+{
+    const size_t nBetaPerClass = _p + 1;
+    if (_isCSR)
+    {
+        _csrData.addTransposedProduct(iStartRow, nRows, r, _nClasses, g + 1, nBetaPerClass);
+    }
+    else
+    {
+        const char trans          = 'T';
+        const char notrans        = 'N';
+        const algorithmFPType one = 1.0;
+        const DAAL_INT m          = static_cast<DAAL_INT>(_p);
+        const DAAL_INT n          = static_cast<DAAL_INT>(_nClasses);
+        const DAAL_INT k          = static_cast<DAAL_INT>(nRows);
+        const DAAL_INT ldc        = static_cast<DAAL_INT>(nBetaPerClass);
+        Blas<algorithmFPType, cpu>::xxgemm(&notrans, &trans, &m, &n, &k, &one, x, &m, r, &n, &one, g + 1, &ldc);
+    }
+
+    if (_interceptFactor != algorithmFPType(0))
+    {
+        for (size_t i = 0; i < nRows; ++i)
+        {
+            for (size_t c = 0; c < _nClasses; ++c) g[c * nBetaPerClass] += r[i * _nClasses + c];
+        }
+    }
+}
+
+template <typename algorithmFPType, CpuType cpu>
+Status LossHessianProduct<algorithmFPType, cpu>::setArgument(const algorithmFPType * b)
+{
+    const size_t nBlocks               = getNumberOfBlocks();
+    const algorithmFPType expThreshold = Math<algorithmFPType, cpu>::vExpThreshold();
+    TlsMem<algorithmFPType, cpu> tlsBuffer(_nRowsInBlock * _nClasses);
+
+    SafeStatus safeStat;
+    daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock) {
+        const size_t iStartRow = iBlock * _nRowsInBlock;
+        const size_t nRows     = services::internal::min<cpu, size_t>(_nRowsInBlock, _n - iStartRow);
+
+        algorithmFPType * const buffer = tlsBuffer.local();
+        DAAL_CHECK_THR(buffer, ErrorMemoryAllocationFailed);
+
+        ReadRows<algorithmFPType, cpu> xr;
+        if (!_isCSR)
+        {
+            xr.set(_dataNT, iStartRow, nRows);
+            DAAL_CHECK_BLOCK_STATUS_THR(xr);
+        }
+
+        algorithmFPType * const w = _weights.get() + iStartRow * _nClasses;
+        applyArgument(iStartRow, nRows, xr.get(), b, buffer, w);
+
+        if (_isLogistic)
+        {
+            /* w = s * (1 - s), s = 1 / (1 + exp(-f)) */
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t i = 0; i < nRows; ++i) w[i] = (-w[i] < expThreshold) ? expThreshold : -w[i];
+            Math<algorithmFPType, cpu>::vExp(nRows, w, w);
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t i = 0; i < nRows; ++i)
+            {
+                const algorithmFPType sigm = algorithmFPType(1) / (algorithmFPType(1) + w[i]);
+                w[i]                       = sigm * (algorithmFPType(1) - sigm);
+            }
+        }
+        else
+        {
+            /* w_i = softmax(f_i) */
+            for (size_t i = 0; i < nRows; ++i)
+            {
+                algorithmFPType * const wi = w + i * _nClasses;
+                algorithmFPType maxValue   = wi[0];
+                for (size_t c = 1; c < _nClasses; ++c) maxValue = (wi[c] > maxValue) ? wi[c] : maxValue;
+                for (size_t c = 0; c < _nClasses; ++c) wi[c] = (wi[c] - maxValue < expThreshold) ? expThreshold : wi[c] - maxValue;
+            }
+            Math<algorithmFPType, cpu>::vExp(nRows * _nClasses, w, w);
+            for (size_t i = 0; i < nRows; ++i)
+            {
+                algorithmFPType * const wi = w + i * _nClasses;
+                algorithmFPType sum        = 0;
+                for (size_t c = 0; c < _nClasses; ++c) sum += wi[c];
+                const algorithmFPType invSum = algorithmFPType(1) / sum;
+                for (size_t c = 0; c < _nClasses; ++c) wi[c] *= invSum;
+            }
+        }
+    });
+    return safeStat.detach();
+}
+
+template <typename algorithmFPType, CpuType cpu>
+Status LossHessianProduct<algorithmFPType, cpu>::apply(const algorithmFPType * v, algorithmFPType * Hv)
+{
+    const size_t nBetaPerClass = _p + 1;
+    const size_t nBeta         = _nClasses * nBetaPerClass;
+    const size_t nBlocks       = getNumberOfBlocks();
+    const algorithmFPType div  = algorithmFPType(1) / algorithmFPType(_n);
+
+    TlsMem<algorithmFPType, cpu> tlsBuffer(2 * _nRowsInBlock * _nClasses);
+    TlsSum<algorithmFPType, cpu> tlsHv(nBeta);
+
+    SafeStatus safeStat;
+    daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock) {
+        const size_t iStartRow = iBlock * _nRowsInBlock;
+        const size_t nRows     = services::internal::min<cpu, size_t>(_nRowsInBlock, _n - iStartRow);
+
+        algorithmFPType * const buffer = tlsBuffer.local();
+        algorithmFPType * const hv     = tlsHv.local();
+        DAAL_CHECK_THR(buffer && hv, ErrorMemoryAllocationFailed);
+        algorithmFPType * const xv = buffer + _nRowsInBlock * _nClasses;
+
+        ReadRows<algorithmFPType, cpu> xr;
+        if (!_isCSR)
+        {
+            xr.set(_dataNT, iStartRow, nRows);
+            DAAL_CHECK_BLOCK_STATUS_THR(xr);
+        }
+
+        /* xv = D * X * v / n */
+        applyArgument(iStartRow, nRows, xr.get(), v, buffer, xv);
+        const algorithmFPType * const w = _weights.get() + iStartRow * _nClasses;
+        if (_isLogistic)
+        {
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t i = 0; i < nRows; ++i) xv[i] *= w[i] * div;
+        }
+        else
+        {
+            for (size_t i = 0; i < nRows; ++i)
+            {
+                const algorithmFPType * const wi = w + i * _nClasses;
+                algorithmFPType * const xvi      = xv + i * _nClasses;
+                algorithmFPType wxv              = 0;
+                for (size_t c = 0; c < _nClasses; ++c) wxv += wi[c] * xvi[c];
+                for (size_t c = 0; c < _nClasses; ++c) xvi[c] = wi[c] * (xvi[c] - wxv) * div;
+            }
+        }
+
+        addTransposedProduct(iStartRow, nRows, xr.get(), xv, hv);
+    });
+    DAAL_CHECK_SAFE_STATUS();
+
+    Status s;
+    DAAL_CHECK_STATUS(s, (objective_function::internal::reduceThreadLocalSums<algorithmFPType, cpu>(tlsHv, Hv, nBeta)));
+
+    const algorithmFPType twoPenaltyL2 = algorithmFPType(2) * _penaltyL2;
+    if (twoPenaltyL2 > 0)
+    {
+        for (size_t c = 0; c < _nClasses; ++c)
+        {
+            for (size_t j = 1; j < nBetaPerClass; ++j) Hv[c * nBetaPerClass + j] += twoPenaltyL2 * v[c * nBetaPerClass + j];
+        }
+    }
+    return s;
+}
+
+template <typename algorithmFPType, CpuType cpu>
+class NewtonCGTask
+{
+public:
+    typedef daal::internal::Math<algorithmFPType, cpu> MathInst;
+
+    NewtonCGTask(size_t n) : _n(n), _value(0), _trialValue(0), _isExactHessian(false), _isHessianUpToDate(false) {}
+
+    Status init(NumericTable * inputArgument, Parameter * parameter);
+
+    /* Computes the value and the gradient of the objective function at the current argument */
+    Status computeStart();
+
+    /* Computes the value and the gradient of the objective function at x + step * d */
+    Status computeTrial(const algorithmFPType * d, algorithmFPType step);
+
+    /* Makes the trial argument the current one */
+    void acceptTrial();
+
+    /*
+     * Computes the inexact Newton step d, its norm is bounded by radius in the trust region mode.
+     * The predicted reduction of the quadratic model is returned in predicted,
+     * onBoundary is set if the step reaches the border of the trust region
+     */
+    Status computeStep(size_t nInnerIterations, bool isTrustRegion, algorithmFPType radius, algorithmFPType tolerance, algorithmFPType & predicted,
+                       bool & onBoundary);
+
+    algorithmFPType dot(const algorithmFPType * a, const algorithmFPType * b) const
+    {
+        const DAAL_INT n   = static_cast<DAAL_INT>(_n);
+        const DAAL_INT one = 1;
+        return Blas<algorithmFPType, cpu>::xxdot(&n, a, &one, b, &one);
+    }
+
+    algorithmFPType norm(const algorithmFPType * a) const { return MathInst::sSqrt(dot(a, a)); }
+
+    /* y += alpha * x */
+    void axpy(algorithmFPType alpha, const algorithmFPType * x, algorithmFPType * y) const
+    {
+        const DAAL_INT n   = static_cast<DAAL_INT>(_n);
+        const DAAL_INT one = 1;
+        Blas<algorithmFPType, cpu>::xxaxpy(&n, &alpha, x, &one, y, &one);
+    }
+
+    static bool isFinite(algorithmFPType value) { return MathInst::sFabs(value) <= MaxVal<algorithmFPType>::get(); }
+
+    algorithmFPType * argument() { return _x.get(); }
+    algorithmFPType * gradient() { return _g.get(); }
+    algorithmFPType * step() { return _z.get(); }
+    algorithmFPType value() const { return _value; }
+    algorithmFPType trialValue() const { return _trialValue; }
+
+private:
+    /* Hv = H * v */
+    Status hessianProduct(const algorithmFPType * v, algorithmFPType * Hv);
+
+    static Status computeFunction(const sum_of_functions::BatchPtr & function, algorithmFPType * value, algorithmFPType * gradient, size_t n);
+
+    size_t _n;
+    algorithmFPType _value;
+    algorithmFPType _trialValue;
+
+    sum_of_functions::BatchPtr _function;        /* computes the value and the gradient at _xTrial */
+    sum_of_functions::BatchPtr _shiftedFunction; /* computes the gradient at _xShifted if the Hessian product is not exact */
+
+    LossHessianProduct<algorithmFPType, cpu> _lossHessian;
+    bool _isExactHessian;
+    bool _isHessianUpToDate; /* the Hessian of the loss is computed at the current argument */
+
+    TArray<algorithmFPType, cpu> _x;
+    TArray<algorithmFPType, cpu> _g;
+    TArray<algorithmFPType, cpu> _xTrial;
+    TArray<algorithmFPType, cpu> _gTrial;
+    TArray<algorithmFPType, cpu> _xShifted;
+    TArray<algorithmFPType, cpu> _gShifted;
+
+    /* conjugate gradient vectors: the step, the product of the Hessian and the step, the residual, the direction and its product */
+    TArray<algorithmFPType, cpu> _z;
+    TArray<algorithmFPType, cpu> _Hz;
+    TArray<algorithmFPType, cpu> _r;
+    TArray<algorithmFPType, cpu> _p;
+    TArray<algorithmFPType, cpu> _Hp;
+};
+
+template <typename algorithmFPType, CpuType cpu>
+Status NewtonCGTask<algorithmFPType, cpu>::init(NumericTable * inputArgument, Parameter * parameter)
+{
+    Status s;
+    _x.reset(_n);
+    _g.reset(_n);
+    _xTrial.reset(_n);
+    _gTrial.reset(_n);
+    _z.reset(_n);
+    _Hz.reset(_n);
+    _r.reset(_n);
+    _p.reset(_n);
+    _Hp.reset(_n);
+    DAAL_CHECK_MALLOC(_x.get() && _g.get() && _xTrial.get() && _gTrial.get());
+    DAAL_CHECK_MALLOC(_z.get() && _Hz.get() && _r.get() && _p.get() && _Hp.get());
+
+    {
+        ReadRows<algorithmFPType, cpu> argumentRows(*inputArgument, 0, _n);
+        DAAL_CHECK_BLOCK_STATUS(argumentRows);
+        tmemcpy<algorithmFPType, cpu>(_x.get(), argumentRows.get(), _n);
+    }
+
+    NumericTablePtr trialTable = HomogenNumericTableCPU<algorithmFPType, cpu>::create(_xTrial.get(), 1, _n, &s);
+    DAAL_CHECK_STATUS_VAR(s);
+
+    /* the Newton step needs the exact gradient, so all the terms of the objective function are used.
+       The function of the parameter belongs to the caller and is not changed */
+    _function = parameter->function->clone();
+    DAAL_CHECK_MALLOC(_function.get());
+    _function->sumOfFunctionsParameter->batchIndices     = NumericTablePtr();
+    _function->sumOfFunctionsParameter->resultsToCompute = objective_function::gradient | objective_function::value;
+    _function->sumOfFunctionsInput->set(sum_of_functions::argument, trialTable);
+
+    DAAL_CHECK_STATUS(s, _lossHessian.init(_function, _n, _isExactHessian));
+    if (_isExactHessian) return s;
+
+    _xShifted.reset(_n);
+    _gShifted.reset(_n);
+    DAAL_CHECK_MALLOC(_xShifted.get() && _gShifted.get());
+    NumericTablePtr shiftedTable = HomogenNumericTableCPU<algorithmFPType, cpu>::create(_xShifted.get(), 1, _n, &s);
+    DAAL_CHECK_STATUS_VAR(s);
+
+    _shiftedFunction = _function->clone();
+    DAAL_CHECK_MALLOC(_shiftedFunction.get());
+    _shiftedFunction->sumOfFunctionsParameter->resultsToCompute = objective_function::gradient;
+    _shiftedFunction->sumOfFunctionsInput->set(sum_of_functions::argument, shiftedTable);
+    return s;
+}
+
+template <typename algorithmFPType, CpuType cpu>
+Status NewtonCGTask<algorithmFPType, cpu>::computeFunction(const sum_of_functions::BatchPtr & function, algorithmFPType * value,
+                                                          algorithmFPType * gradient, size_t n)
+{
+    Status s;
+    DAAL_CHECK_STATUS(s, function->computeNoThrow());
+
+    NumericTable * gradientTable = function->getResult()->get(objective_function::gradientIdx).get();
+    DAAL_CHECK(gradientTable, ErrorNullNumericTable);
+    ReadRows<algorithmFPType, cpu> gradientRows(*gradientTable, 0, n);
+    DAAL_CHECK_BLOCK_STATUS(gradientRows);
+    tmemcpy<algorithmFPType, cpu>(gradient, gradientRows.get(), n);
+
+    if (value)
+    {
+        NumericTable * valueTable = function->getResult()->get(objective_function::valueIdx).get();
+        DAAL_CHECK(valueTable, ErrorNullNumericTable);
+        ReadRows<algorithmFPType, cpu> valueRows(*valueTable, 0, 1);
+        DAAL_CHECK_BLOCK_STATUS(valueRows);
+        *value = valueRows.get()[0];
+    }
+    return s;
+}
+
+template <typename algorithmFPType, CpuType cpu>
+Status NewtonCGTask<algorithmFPType, cpu>::computeStart()
+{
+    tmemcpy<algorithmFPType, cpu>(_xTrial.get(), _x.get(), _n);
+    _isHessianUpToDate = false;
+    return computeFunction(_function, &_value, _g.get(), _n);
+}
+
+template <typename algorithmFPType, CpuType cpu>
+Status NewtonCGTask<algorithmFPType, cpu>::computeTrial(const algorithmFPType * d, algorithmFPType step)
+{
+    tmemcpy<algorithmFPType, cpu>(_xTrial.get(), _x.get(), _n);
+    axpy(step, d, _xTrial.get());
+    return computeFunction(_function, &_trialValue, _gTrial.get(), _n);
+}
+
+template <typename algorithmFPType, CpuType cpu>
+void NewtonCGTask<algorithmFPType, cpu>::acceptTrial()
+{
+    tmemcpy<algorithmFPType, cpu>(_x.get(), _xTrial.get(), _n);
+    tmemcpy<algorithmFPType, cpu>(_g.get(), _gTrial.get(), _n);
+    _value             = _trialValue;
+    _isHessianUpToDate = false;
+}
+
+template <typename algorithmFPType, CpuType cpu>
+Status NewtonCGTask<algorithmFPType, cpu>::hessianProduct(const algorithmFPType * v, algorithmFPType * Hv)
+{
+    if (_isExactHessian)
+    {
+        Status s;
+        if (!_isHessianUpToDate)
+        {
+            DAAL_CHECK_STATUS(s, _lossHessian.setArgument(_x.get()));
+            _isHessianUpToDate = true;
+        }
+        return _lossHessian.apply(v, Hv);
+    }
+
+    const algorithmFPType vNorm = norm(v);
+    if (vNorm == algorithmFPType(0))
+    {
+        service_memset_seq<algorithmFPType, cpu>(Hv, algorithmFPType(0), _n);
+        return Status();
+    }
+
+    /* the step balances the truncation error of the difference and the rounding error of the gradient */
+    const algorithmFPType h = MathInst::sSqrt(EpsilonVal<algorithmFPType>::get()) * (algorithmFPType(1) + norm(_x.get())) / vNorm;
+
+    tmemcpy<algorithmFPType, cpu>(_xShifted.get(), _x.get(), _n);
+    axpy(h, v, _xShifted.get());
+
+    Status s;
+    DAAL_CHECK_STATUS(s, computeFunction(_shiftedFunction, nullptr, _gShifted.get(), _n));
+
+    const algorithmFPType invH   = algorithmFPType(1) / h;
+    const algorithmFPType * g    = _g.get();
+    const algorithmFPType * gNew = _gShifted.get();
+    for (size_t i = 0; i < _n; ++i) Hv[i] = (gNew[i] - g[i]) * invH;
+    return s;
+}
+
+/* Returns tau >= 0 such that ||z + tau * p|| = radius, ||z|| <= radius is assumed */
+template <typename algorithmFPType, CpuType cpu>
+algorithmFPType boundaryStep(algorithmFPType zz, algorithmFPType zp, algorithmFPType pp, algorithmFPType radius)
+{
+    const algorithmFPType disc = zp * zp + pp * (radius * radius - zz);
+    return (-zp + daal::internal::Math<algorithmFPType, cpu>::sSqrt(disc > 0 ? disc : algorithmFPType(0))) / pp;
+}
+
+template <typename algorithmFPType, CpuType cpu>
+Status NewtonCGTask<algorithmFPType, cpu>::computeStep(size_t nInnerIterations, bool isTrustRegion, algorithmFPType radius,
+                                                      algorithmFPType tolerance, algorithmFPType & predicted, bool & onBoundary)
+{
+    Status s;
+    algorithmFPType * const z  = _z.get();
+    algorithmFPType * const Hz = _Hz.get();
+    algorithmFPType * const r  = _r.get();
+    algorithmFPType * const p  = _p.get();
+    algorithmFPType * const Hp = _Hp.get();
+    const algorithmFPType * g  = _g.get();
+
+    /* z = 0, r = -g - H * z, p = r */
+    service_memset_seq<algorithmFPType, cpu>(z, algorithmFPType(0), _n);
+    service_memset_seq<algorithmFPType, cpu>(Hz, algorithmFPType(0), _n);
+    for (size_t i = 0; i < _n; ++i)
+    {
+        r[i] = -g[i];
+        p[i] = -g[i];
+    }
+    algorithmFPType rr = dot(r, r);
+    onBoundary         = false;
+
+    for (size_t iInner = 0; iInner < nInnerIterations && MathInst::sSqrt(rr) > tolerance; ++iInner)
+    {
+        DAAL_CHECK_STATUS(s, hessianProduct(p, Hp));
+        const algorithmFPType pHp = dot(p, Hp);
+
+        if (!(pHp > 0))
+        {
+            /* the direction of non-positive curvature */
+            if (isTrustRegion)
+            {
+                const algorithmFPType tau = boundaryStep<algorithmFPType, cpu>(dot(z, z), dot(z, p), dot(p, p), radius);
+                axpy(tau, p, z);
+                axpy(tau, Hp, Hz);
+                onBoundary = true;
+            }
+            else if (iInner == 0)
+            {
+                /* the steepest descent direction */
+                tmemcpy<algorithmFPType, cpu>(z, p, _n);
+                service_memset_seq<algorithmFPType, cpu>(Hz, algorithmFPType(0), _n);
+            }
+            break;
+        }
+
+        const algorithmFPType alpha = rr / pHp;
+        if (isTrustRegion)
+        {
+            const algorithmFPType zz = dot(z, z);
+            const algorithmFPType zp = dot(z, p);
+            const algorithmFPType pp = dot(p, p);
+            if (zz + algorithmFPType(2) * alpha * zp + alpha * alpha * pp >= radius * radius)
+            {
+                const algorithmFPType tau = boundaryStep<algorithmFPType, cpu>(zz, zp, pp, radius);
+                axpy(tau, p, z);
+                axpy(tau, Hp, Hz);
+                onBoundary = true;
+                break;
+            }
+        }
+
+        axpy(alpha, p, z);
+        axpy(alpha, Hp, Hz);
+        axpy(-alpha, Hp, r);
+
+        const algorithmFPType rrNew = dot(r, r);
+        const algorithmFPType beta  = rrNew / rr;
+        rr                          = rrNew;
+        for (size_t i = 0; i < _n; ++i) p[i] = r[i] + beta * p[i];
+    }
+
+    /* the reduction of the quadratic model m(z) = f + g' * z + z' * H * z / 2 */
+    predicted = -(dot(g, z) + algorithmFPType(0.5) * dot(z, Hz));
+    return s;
+}
+
+/**
+ *  \brief Kernel for Newton conjugate gradient calculation
+ */
+template <typename algorithmFPType, Method method, CpuType cpu>
+services::Status NewtonCGKernel<algorithmFPType, method, cpu>::compute(HostAppIface * pHost, NumericTable * inputArgument, NumericTable * minimum,
+                                                                      NumericTable * nIterations, Parameter * parameter)
+{
+    typedef daal::internal::Math<algorithmFPType, cpu> MathInst;
+
+    Status s;
+    const size_t n             = inputArgument->getNumberOfRows();
+    const size_t maxIterations = parameter->nIterations;
+    const bool isTrustRegion   = (parameter->globalization == trustRegion);
+    const algorithmFPType one(1);
+
+    DAAL_CHECK(maxIterations <= services::internal::MaxVal<int>::get(), ErrorIterativeSolverIncorrectMaxNumberOfIterations);
+
+    NewtonCGTask<algorithmFPType, cpu> task(n);
+    DAAL_CHECK_STATUS(s, task.init(inputArgument, parameter));
+
+    const algorithmFPType accuracyThreshold = parameter->accuracyThreshold;
+    const algorithmFPType armijoFactor      = 1.0e-04;
+    const algorithmFPType minRatio          = 1.0e-04;
+    const size_t maxLineSearchSteps         = 30;
+
+    algorithmFPType radius = parameter->trustRegionRadius;
+    size_t iIteration      = 0;
+
+    if (maxIterations)
+    {
+        DAAL_CHECK_STATUS(s, task.computeStart());
+    }
+
+    services::internal::HostAppHelper host(pHost, 10);
+    for (; iIteration < maxIterations; ++iIteration)
+    {
+        DAAL_CHECK_BREAK(!s || host.isCancelled(s, 1));
+
+        const algorithmFPType gNorm = task.norm(task.gradient());
+        const algorithmFPType xNorm = task.norm(task.argument());
+        if (gNorm <= accuracyThreshold * MathInst::sMax(one, xNorm)) break;
+
+        /* forcing sequence of the inexact Newton method, the convergence is superlinear */
+        const algorithmFPType forcing = MathInst::sMin(algorithmFPType(0.5), MathInst::sSqrt(gNorm));
+
+        algorithmFPType predicted = 0;
+        bool onBoundary           = false;
+        DAAL_CHECK_STATUS(s, task.computeStep(parameter->nInnerIterations, isTrustRegion, radius, forcing * gNorm, predicted, onBoundary));
+
+        const algorithmFPType * d   = task.step();
+        const algorithmFPType dNorm = task.norm(d);
+        if (!(dNorm > EpsilonVal<algorithmFPType>::get() * (one + xNorm))) break;
+
+        if (isTrustRegion)
+        {
+            DAAL_CHECK_STATUS(s, task.computeTrial(d, one));
+            const algorithmFPType actual = task.value() - task.trialValue();
+            const algorithmFPType ratio  = (predicted > 0 && task.isFinite(task.trialValue())) ? actual / predicted : algorithmFPType(-1);
+
+            if (ratio < algorithmFPType(0.25))
+                radius = algorithmFPType(0.25) * dNorm;
+            else if (ratio > algorithmFPType(0.75) && onBoundary)
+                radius = algorithmFPType(2) * radius;
+
+            if (ratio > minRatio) task.acceptTrial();
+            /* the region is smaller than the precision of the argument, no further progress is possible */
+            if (!(radius > EpsilonVal<algorithmFPType>::get() * (one + xNorm))) break;
+        }
+        else
+        {
+            const algorithmFPType slope = task.dot(task.gradient(), d);
+            if (!(slope < 0)) break;
+
+            algorithmFPType stepLength  = one;
+            bool isAccepted             = false;
+            for (size_t iStep = 0; iStep < maxLineSearchSteps && !isAccepted; ++iStep, stepLength *= algorithmFPType(0.5))
+            {
+                DAAL_CHECK_STATUS(s, task.computeTrial(d, stepLength));
+                isAccepted = task.isFinite(task.trialValue()) && (task.trialValue() <= task.value() + armijoFactor * stepLength * slope);
+            }
+            if (!isAccepted) break;
+            task.acceptTrial();
+        }
+    }
+    DAAL_CHECK_STATUS_VAR(s);
+
+    {
+        WriteRows<algorithmFPType, cpu> minimumRows(*minimum, 0, n);
+        DAAL_CHECK_BLOCK_STATUS(minimumRows);
+        tmemcpy<algorithmFPType, cpu>(minimumRows.get(), task.argument(), n);
+    }
+
+    WriteRows<int, cpu> nIterationsRows(nIterations, 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(nIterationsRows);
+    *nIterationsRows.get() = int(iIteration);
+    return s;
+}
+
+} // namespace internal
+} // namespace newton_cg
+} // namespace optimization_solver
+} // namespace algorithms
+} // namespace daal
+
+#endif
@@ -0,0 +1,112 @@
+/* file: newton_cg_types.cpp */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of newton_cg solver classes.
+//--
+*/
+
+#include "algorithms/optimization_solver/newton_cg/newton_cg_types.h"
+#include "algorithms/optimization_solver/objective_function/logistic_loss_types.h"
+#include "algorithms/optimization_solver/objective_function/cross_entropy_loss_types.h"
+#include "algorithms/optimization_solver/objective_function/mse_types.h"
+#include "src/services/serialization_utils.h"
+#include "src/services/daal_strings.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace optimization_solver
+{
+namespace newton_cg
+{
+namespace interface1
+{
+namespace
+{
+/* The non-smooth L1 term is not a part of the gradient and the Hessian of the objective function */
+bool hasPenaltyL1(const sum_of_functions::BatchPtr & function)
+{
+    const sum_of_functions::Parameter * par = function->sumOfFunctionsParameter;
+
+    const logistic_loss::Parameter * logLossPar = dynamic_cast<const logistic_loss::Parameter *>(par);
+    if (logLossPar) return logLossPar->penaltyL1 != 0.0f;
+
+    const cross_entropy_loss::Parameter * cePar = dynamic_cast<const cross_entropy_loss::Parameter *>(par);
+    if (cePar) return cePar->penaltyL1 != 0.0f;
+
+    const mse::Parameter * msePar = dynamic_cast<const mse::Parameter *>(par);
+    if (!msePar || !msePar->penaltyL1) return false;
+
+    data_management::NumericTable * penaltyL1 = msePar->penaltyL1.get();
+    const size_t nRows                        = penaltyL1->getNumberOfRows();
+    const size_t nCols                        = penaltyL1->getNumberOfColumns();
+    data_management::BlockDescriptor<double> block;
+    penaltyL1->getBlockOfRows(0, nRows, data_management::readOnly, block);
+    const double * values = block.getBlockPtr();
+    bool isNonZero        = false;
+    for (size_t i = 0; values && i < nRows * nCols && !isNonZero; i++)
+    {
+        isNonZero = (values[i] != 0.0);
+    }
+    penaltyL1->releaseBlockOfRows(block);
+    return isNonZero;
+}
+} // namespace
+
+__DAAL_REGISTER_SERIALIZATION_CLASS(Result, SERIALIZATION_NEWTON_CG_RESULT_ID);
+
+Parameter::Parameter(const sum_of_functions::BatchPtr & function, size_t nIterations, double accuracyThreshold, size_t nInnerIterations,
+                     Globalization globalization)
+    : optimization_solver::iterative_solver::Parameter(function, nIterations, accuracyThreshold, false, 1),
+      nInnerIterations(nInnerIterations),
+      globalization(globalization),
+      trustRegionRadius(1.0)
+{}
+
+services::Status Parameter::check() const
+{
+    services::Status s = iterative_solver::Parameter::check();
+    if (!s) return s;
+
+    DAAL_CHECK_EX(nInnerIterations > 0, services::ErrorIncorrectParameter, services::ParameterName, nInnerIterationsStr());
+    DAAL_CHECK_EX(trustRegionRadius > 0, services::ErrorIncorrectParameter, services::ParameterName, trustRegionRadiusStr());
+    DAAL_CHECK_EX(!function || !function->sumOfFunctionsParameter || !hasPenaltyL1(function), services::ErrorIncorrectParameter,
+                  services::ParameterName, penaltyL1Str());
+    return s;
+}
+
+Input::Input() {}
+Input::Input(const Input & other) : super(other) {}
+
+services::Status Input::check(const daal::algorithms::Parameter * par, int method) const
+{
+    return super::check(par, method);
+}
+
+services::Status Result::check(const daal::algorithms::Input * input, const daal::algorithms::Parameter * par, int method) const
+{
+    return super::check(input, par, method);
+}
+
+} // namespace interface1
+} // namespace newton_cg
+} // namespace optimization_solver
+} // namespace algorithms
+} // namespace daal
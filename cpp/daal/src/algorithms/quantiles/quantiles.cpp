@@ -47,8 +47,20 @@ Parameter::Parameter(const NumericTablePtr quantileOrders) : daal::algorithms::P
     }
 }
 
-Input::Input() : daal::algorithms::Input(lastInputId + 1) {}
-Input::Input(const Input & other) : daal::algorithms::Input(other) {}
+Input::Input() : InputIface(lastInputId + 1) {}
+Input::Input(const Input & other) : InputIface(other) {}
+
+/**
+ * Returns the number of columns in the input data set
+ * \return Number of columns in the input data set
+ */
+Status Input::getNumberOfColumns(size_t & nCols) const
+{
+    NumericTablePtr dataTable = get(data);
+    Status s                  = checkNumericTable(dataTable.get(), dataStr());
+    nCols                     = s ? dataTable->getNumberOfColumns() : 0;
+    return s;
+}
 
 /**
  * Returns an input object for the quantiles algorithm
@@ -115,24 +127,56 @@ void Result::set(ResultId id, const NumericTablePtr & value)
  */
 Status Result::check(const daal::algorithms::Input * in, const daal::algorithms::Parameter * par, int method) const
 {
-    const Input * input         = static_cast<const Input *>(in);
+    size_t nFeatures = 0;
+    Status s;
+    DAAL_CHECK_STATUS(s, (static_cast<const InputIface *>(in))->getNumberOfColumns(nFeatures));
+    return checkImpl(nFeatures, par);
+}
+
+/**
+ * Checks the correctness of the Result object
+ * \param[in] partialResult Pointer to the partial results
+ * \param[in] par           Pointer to the parameters structure
+ * \param[in] method        Algorithm computation method
+ */
+Status Result::check(const daal::algorithms::PartialResult * partialResult, const daal::algorithms::Parameter * par, int method) const
+{
+    size_t nFeatures = 0;
+    Status s;
+    DAAL_CHECK_STATUS(s, (static_cast<const PartialResult *>(partialResult))->getNumberOfColumns(nFeatures));
+    return checkImpl(nFeatures, par);
+}
+
+Status Result::checkImpl(size_t nFeatures, const daal::algorithms::Parameter * par) const
+{
     const Parameter * parameter = static_cast<const Parameter *>(par);
 
     Status s = checkNumericTable(parameter->quantileOrders.get(), quantileOrdersStr(), 0, 0, 0, 1);
     if (!s) return s;
 
-    size_t nVectors  = input->get(data)->getNumberOfColumns();
-    size_t nFeatures = parameter->quantileOrders->getNumberOfColumns();
+    size_t nQuantileOrders = parameter->quantileOrders->getNumberOfColumns();
 
     int unexpectedLayouts = (int)NumericTableIface::csrArray | (int)NumericTableIface::upperPackedTriangularMatrix
                             | (int)NumericTableIface::lowerPackedTriangularMatrix | (int)NumericTableIface::upperPackedSymmetricMatrix
                             | (int)NumericTableIface::lowerPackedSymmetricMatrix;
 
-    s |= checkNumericTable(get(quantiles).get(), quantilesStr(), unexpectedLayouts, 0, nFeatures, nVectors);
+    s |= checkNumericTable(get(quantiles).get(), quantilesStr(), unexpectedLayouts, 0, nQuantileOrders, nFeatures);
     return s;
 }
 
 } // namespace interface1
+
+namespace interface2
+{
+Parameter::Parameter(const NumericTablePtr quantileOrders, size_t compression) : interface1::Parameter(quantileOrders), compression(compression) {}
+
+Status Parameter::check() const
+{
+    DAAL_CHECK_EX(compression > 0, ErrorIncorrectParameter, ParameterName, compressionStr());
+    return interface1::Parameter::check();
+}
+
+} // namespace interface2
 } // namespace quantiles
 } // namespace algorithms
 } // namespace daal
@@ -38,7 +38,7 @@ namespace quantiles
 template <typename algorithmFPType, Method method, CpuType cpu>
 BatchContainer<algorithmFPType, method, cpu>::BatchContainer(daal::services::Environment::env * daalEnv)
 {
-    __DAAL_INITIALIZE_KERNELS(internal::QuantilesKernel, defaultDense, algorithmFPType);
+    __DAAL_INITIALIZE_KERNELS(internal::QuantilesKernel, method, algorithmFPType);
 }
 
 template <typename algorithmFPType, Method method, CpuType cpu>
@@ -52,15 +52,15 @@ services::Status BatchContainer<algorithmFPType, method, cpu>::compute()
 {
     Result * result = static_cast<Result *>(_res);
     Input * input   = static_cast<Input *>(_in);
-    Parameter * par = static_cast<Parameter *>(_par);
 
+    /* the default method only needs the parameters of the first version of the interface */
     NumericTable * dataTable           = static_cast<NumericTable *>(input->get(data).get());
     NumericTable * quantilesTable      = static_cast<NumericTable *>(result->get(quantiles).get());
-    NumericTable * quantileOrdersTable = par->quantileOrders.get();
+    NumericTable * quantileOrdersTable = static_cast<interface1::Parameter *>(_par)->quantileOrders.get();
 
     daal::services::Environment::env & env = *_env;
-    __DAAL_CALL_KERNEL(env, internal::QuantilesKernel, __DAAL_KERNEL_ARGUMENTS(defaultDense, algorithmFPType), compute, *dataTable,
-                       *quantileOrdersTable, *quantilesTable);
+    __DAAL_CALL_KERNEL(env, internal::QuantilesKernel, __DAAL_KERNEL_ARGUMENTS(method, algorithmFPType), compute, *dataTable, *quantileOrdersTable,
+                       *quantilesTable, _par);
 }
 
 } // namespace quantiles
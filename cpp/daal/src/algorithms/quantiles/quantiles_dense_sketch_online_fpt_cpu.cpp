@@ -0,0 +1,43 @@
+/* file: quantiles_dense_sketch_online_fpt_cpu.cpp */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Instantiation of online quantiles kernel.
+//--
+*/
+
+#include "src/algorithms/quantiles/quantiles_online_container.h"
+#include "src/algorithms/quantiles/quantiles_sketch_impl.i"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace quantiles
+{
+namespace interface1
+{
+template class OnlineContainer<DAAL_FPTYPE, sketchDense, DAAL_CPU>;
+} // namespace interface1
+namespace internal
+{
+template class QuantilesOnlineKernel<sketchDense, DAAL_FPTYPE, DAAL_CPU>;
+} // namespace internal
+} // namespace quantiles
+} // namespace algorithms
+} // namespace daal
@@ -52,8 +52,32 @@ DAAL_EXPORT services::Status Result::allocate(const daal::algorithms::Input * in
     return s;
 }
 
+/**
+ * Allocates memory to store final results of the quantile algorithms
+ * \param[in] partialResult Partial results of the quantiles algorithm
+ * \param[in] parameter     Parameters of the quantiles algorithm
+ * \param[in] method        Algorithm computation method
+ */
+template <typename algorithmFPType>
+DAAL_EXPORT services::Status Result::allocate(const daal::algorithms::PartialResult * partialResult, const daal::algorithms::Parameter * parameter,
+                                              const int method)
+{
+    services::Status s;
+    const Parameter * par = static_cast<const Parameter *>(parameter);
+
+    size_t nFeatures = 0;
+    DAAL_CHECK_STATUS(s, static_cast<const PartialResult *>(partialResult)->getNumberOfColumns(nFeatures));
+    size_t nQuantileOrders = par->quantileOrders->getNumberOfColumns();
+
+    set(quantiles,
+        data_management::HomogenNumericTable<algorithmFPType>::create(nQuantileOrders, nFeatures, data_management::NumericTable::doAllocate, &s));
+    return s;
+}
+
 template DAAL_EXPORT services::Status Result::allocate<DAAL_FPTYPE>(const daal::algorithms::Input * input, const daal::algorithms::Parameter * par,
                                                                     const int method);
+template DAAL_EXPORT services::Status Result::allocate<DAAL_FPTYPE>(const daal::algorithms::PartialResult * partialResult,
+                                                                    const daal::algorithms::Parameter * par, const int method);
 
 } // namespace interface1
 } // namespace quantiles
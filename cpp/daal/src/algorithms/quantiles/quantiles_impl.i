@@ -42,7 +42,8 @@ namespace internal
 {
 template <Method method, typename algorithmFPType, CpuType cpu>
 services::Status QuantilesKernel<method, algorithmFPType, cpu>::compute(const NumericTable & dataTable, const NumericTable & quantileOrdersTable,
-                                                                        NumericTable & quantilesTable)
+                                                                        NumericTable & quantilesTable,
+                                                                        const daal::algorithms::Parameter * par)
 {
     const size_t nFeatures       = dataTable.getNumberOfColumns();
     const size_t nVectors        = dataTable.getNumberOfRows();
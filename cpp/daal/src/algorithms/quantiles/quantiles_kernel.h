@@ -25,7 +25,10 @@
 #define __QUANTILES_KERNEL_H__
 
 #include "data_management/data/numeric_table.h"
+#include "data_management/data/data_collection.h"
 #include "algorithms/quantiles/quantiles_batch.h"
+#include "algorithms/quantiles/quantiles_online.h"
+#include "algorithms/quantiles/quantiles_distributed.h"
 
 #include "src/services/service_defines.h"
 #include "src/data_management/service_micro_table.h"
@@ -44,7 +47,32 @@ template <Method method, typename algorithmFPType, CpuType cpu>
 struct QuantilesKernel : public Kernel
 {
     virtual ~QuantilesKernel() {}
-    services::Status compute(const NumericTable & dataTable, const NumericTable & quantileOrdersTable, NumericTable & quantilesTable);
+    services::Status compute(const NumericTable & dataTable, const NumericTable & quantileOrdersTable, NumericTable & quantilesTable,
+                             const daal::algorithms::Parameter * par);
+};
+
+template <typename algorithmFPType, CpuType cpu>
+struct QuantilesKernel<sketchDense, algorithmFPType, cpu> : public Kernel
+{
+    virtual ~QuantilesKernel() {}
+    services::Status compute(const NumericTable & dataTable, const NumericTable & quantileOrdersTable, NumericTable & quantilesTable,
+                             const daal::algorithms::Parameter * par);
+};
+
+template <Method method, typename algorithmFPType, CpuType cpu>
+struct QuantilesOnlineKernel : public Kernel
+{
+    virtual ~QuantilesOnlineKernel() {}
+    services::Status compute(const NumericTable & dataTable, PartialResult * partialResult, const Parameter * par);
+    services::Status finalizeCompute(const PartialResult * partialResult, NumericTable & quantilesTable, const Parameter * par);
+};
+
+template <Method method, typename algorithmFPType, CpuType cpu>
+struct QuantilesDistributedKernel : public Kernel
+{
+    virtual ~QuantilesDistributedKernel() {}
+    services::Status compute(data_management::DataCollection * partialResultsCollection, PartialResult * partialResult, const Parameter * par);
+    services::Status finalizeCompute(const PartialResult * partialResult, NumericTable & quantilesTable, const Parameter * par);
 };
 
 } // namespace internal
@@ -0,0 +1,118 @@
+/* file: quantiles_partial_result.cpp */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of quantiles partial result methods.
+//--
+*/
+
+#include "algorithms/quantiles/quantiles_types.h"
+#include "src/services/serialization_utils.h"
+#include "src/services/daal_strings.h"
+
+using namespace daal::data_management;
+using namespace daal::services;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace quantiles
+{
+namespace interface1
+{
+__DAAL_REGISTER_SERIALIZATION_CLASS(PartialResult, SERIALIZATION_QUANTILES_PARTIAL_RESULT_ID);
+
+PartialResult::PartialResult() : daal::algorithms::PartialResult(lastPartialResultId + 1) {}
+
+/**
+ * Returns the number of columns in the input data set
+ * \return Number of columns in the input data set
+ */
+Status PartialResult::getNumberOfColumns(size_t & nCols) const
+{
+    NumericTablePtr ntPtr = NumericTable::cast(Argument::get(partialMinimum));
+    Status s              = checkNumericTable(ntPtr.get(), partialMinimumStr());
+    nCols                 = (s ? ntPtr->getNumberOfColumns() : 0);
+    return s;
+}
+
+/**
+ * Returns the partial result of the quantiles algorithm
+ * \param[in] id   Identifier of the partial result, \ref PartialResultId
+ * \return Partial result that corresponds to the given identifier
+ */
+NumericTablePtr PartialResult::get(PartialResultId id) const
+{
+    return staticPointerCast<NumericTable, SerializationIface>(Argument::get(id));
+}
+
+/**
+ * Sets the partial result of the quantiles algorithm
+ * \param[in] id    Identifier of the partial result
+ * \param[in] ptr   Pointer to the partial result
+ */
+void PartialResult::set(PartialResultId id, const NumericTablePtr & ptr)
+{
+    Argument::set(id, ptr);
+}
+
+/**
+ * Checks correctness of the partial result
+ * \param[in] parameter %Parameter of the algorithm
+ * \param[in] method    Computation method
+ */
+Status PartialResult::check(const daal::algorithms::Parameter * parameter, int method) const
+{
+    Status s;
+    size_t nFeatures = 0;
+    DAAL_CHECK_STATUS(s, getNumberOfColumns(nFeatures));
+    return checkImpl(nFeatures, parameter);
+}
+
+/**
+ * Checks the correctness of partial result
+ * \param[in] input     Pointer to the structure with input objects
+ * \param[in] parameter Pointer to the structure of algorithm parameters
+ * \param[in] method    Computation method
+ */
+Status PartialResult::check(const daal::algorithms::Input * input, const daal::algorithms::Parameter * parameter, int method) const
+{
+    Status s;
+    size_t nFeatures = 0;
+    DAAL_CHECK_STATUS(s, static_cast<const InputIface *>(input)->getNumberOfColumns(nFeatures));
+    return checkImpl(nFeatures, parameter);
+}
+
+Status PartialResult::checkImpl(size_t nFeatures, const daal::algorithms::Parameter * parameter) const
+{
+    Status s;
+    const size_t capacity       = static_cast<const interface2::Parameter *>(parameter)->compression + 2;
+    const int unexpectedLayouts = (int)packed_mask;
+
+    DAAL_CHECK_STATUS(s, checkNumericTable(get(sketchCentroids).get(), sketchCentroidsStr(), unexpectedLayouts, 0, capacity, nFeatures));
+    DAAL_CHECK_STATUS(s, checkNumericTable(get(sketchWeights).get(), sketchWeightsStr(), unexpectedLayouts, 0, capacity, nFeatures));
+    DAAL_CHECK_STATUS(s, checkNumericTable(get(partialMinimum).get(), partialMinimumStr(), unexpectedLayouts, 0, nFeatures, 1));
+    DAAL_CHECK_STATUS(s, checkNumericTable(get(partialMaximum).get(), partialMaximumStr(), unexpectedLayouts, 0, nFeatures, 1));
+    return s;
+}
+
+} // namespace interface1
+} // namespace quantiles
+} // namespace algorithms
+} // namespace daal
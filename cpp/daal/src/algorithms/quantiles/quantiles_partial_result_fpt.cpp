@@ -0,0 +1,89 @@
+/* file: quantiles_partial_result_fpt.cpp */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of quantiles partial result methods.
+//--
+*/
+
+#include "algorithms/quantiles/quantiles_types.h"
+#include "src/services/service_data_utils.h"
+
+using namespace daal::data_management;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace quantiles
+{
+namespace interface1
+{
+/**
+ * Allocates memory to store partial results of the quantiles algorithm
+ * \param[in] input     Pointer to the structure with input objects
+ * \param[in] parameter Pointer to the structure of algorithm parameters
+ * \param[in] method    Computation method
+ */
+template <typename algorithmFPType>
+DAAL_EXPORT services::Status PartialResult::allocate(const daal::algorithms::Input * input, const daal::algorithms::Parameter * parameter,
+                                                     const int method)
+{
+    services::Status s;
+    size_t nFeatures = 0;
+    DAAL_CHECK_STATUS(s, static_cast<const InputIface *>(input)->getNumberOfColumns(nFeatures));
+
+    const size_t capacity = static_cast<const interface2::Parameter *>(parameter)->compression + 2;
+
+    set(sketchCentroids, HomogenNumericTable<algorithmFPType>::create(capacity, nFeatures, NumericTable::doAllocate, &s));
+    set(sketchWeights, HomogenNumericTable<double>::create(capacity, nFeatures, NumericTable::doAllocate, &s));
+    set(partialMinimum, HomogenNumericTable<algorithmFPType>::create(nFeatures, 1, NumericTable::doAllocate, &s));
+    set(partialMaximum, HomogenNumericTable<algorithmFPType>::create(nFeatures, 1, NumericTable::doAllocate, &s));
+    return s;
+}
+
+/**
+ * Initializes memory to store partial results of the quantiles algorithm
+ * \param[in] input     Pointer to the structure with input objects
+ * \param[in] parameter Pointer to the structure of algorithm parameters
+ * \param[in] method    Computation method
+ * \return Status of initialization
+ */
+template <typename algorithmFPType>
+DAAL_EXPORT services::Status PartialResult::initialize(const daal::algorithms::Input * input, const daal::algorithms::Parameter * parameter,
+                                                       const int method)
+{
+    services::Status s;
+    const algorithmFPType maxVal = services::internal::MaxVal<algorithmFPType>::get();
+
+    DAAL_CHECK_STATUS(s, get(sketchCentroids)->assign(algorithmFPType(0)));
+    DAAL_CHECK_STATUS(s, get(sketchWeights)->assign(0.0));
+    DAAL_CHECK_STATUS(s, get(partialMinimum)->assign(maxVal));
+    DAAL_CHECK_STATUS(s, get(partialMaximum)->assign(-maxVal));
+    return s;
+}
+
+template DAAL_EXPORT services::Status PartialResult::allocate<DAAL_FPTYPE>(const daal::algorithms::Input * input,
+                                                                           const daal::algorithms::Parameter * parameter, const int method);
+template DAAL_EXPORT services::Status PartialResult::initialize<DAAL_FPTYPE>(const daal::algorithms::Input * input,
+                                                                             const daal::algorithms::Parameter * parameter, const int method);
+
+} // namespace interface1
+} // namespace quantiles
+} // namespace algorithms
+} // namespace daal
@@ -0,0 +1,198 @@
+/* file: quantiles_sketch.h */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Mergeable t-digest sketch used by the sketchDense method of quantiles.
+//
+//  A sketch of one feature is a sequence of centroids (mean, weight) sorted by
+//  mean. The centroids are merged so that the increase of the scale function
+//  k(q) over a centroid does not exceed 1, where q is the fraction of the total
+//  weight before the centroid and
+//      k(q) = delta / 4 * (sqrt(2q) - 1),           q <= 1/2,
+//      k(q) = delta / 4 * (1 - sqrt(2(1 - q))),     q >  1/2.
+//  The range of k(q) is delta / 2 and any two adjacent centroids cover more than 1,
+//  so the sketch never keeps more than delta + 1 centroids. The scale function
+//  is steep near q = 0 and q = 1, therefore the centroids at the tails are small
+//  and the extreme quantiles are accurate.
+//--
+*/
+
+#ifndef __QUANTILES_SKETCH_H__
+#define __QUANTILES_SKETCH_H__
+
+#include "src/services/service_defines.h"
+#include "src/externals/service_math.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace quantiles
+{
+namespace internal
+{
+/* Number of observations processed in one block */
+#define __QUANTILES_SKETCH_BLOCK_SIZE 1024
+
+template <typename algorithmFPType, CpuType cpu>
+class TDigest
+{
+public:
+    TDigest(size_t compression) : _delta(double(compression)), _capacity(compression + 2) {}
+
+    /* Maximal number of centroids in the sketch */
+    size_t capacity() const { return _capacity; }
+
+    /* Number of centroids in the sketch */
+    size_t size(const double * weights) const
+    {
+        size_t n = 0;
+        while (n < _capacity && weights[n] > 0) ++n;
+        return n;
+    }
+
+    /*
+     * Merges nAdd centroids sorted by means into the sketch (means, weights).
+     * Unit weights are used if addWeights is null.
+     * bufMeans and bufWeights must have room for capacity() + nAdd elements.
+     */
+    void merge(algorithmFPType * means, double * weights, const algorithmFPType * addMeans, const double * addWeights, size_t nAdd,
+               algorithmFPType * bufMeans, double * bufWeights) const
+    {
+        if (!nAdd) return;
+        const size_t n = size(weights);
+
+        size_t i           = 0;
+        size_t j           = 0;
+        size_t m           = 0;
+        double totalWeight = 0;
+        while (i < n || j < nAdd)
+        {
+            if (j == nAdd || (i < n && means[i] <= addMeans[j]))
+            {
+                bufMeans[m]   = means[i];
+                bufWeights[m] = weights[i++];
+            }
+            else
+            {
+                bufMeans[m]   = addMeans[j];
+                bufWeights[m] = addWeights ? addWeights[j] : 1.0;
+                ++j;
+            }
+            totalWeight += bufWeights[m++];
+        }
+        compress(bufMeans, bufWeights, m, totalWeight, means, weights);
+    }
+
+    /*
+     * Computes the quantile of order q by the piecewise linear interpolation
+     * between the minimum, the centers of the centroids and the maximum
+     */
+    algorithmFPType quantile(const algorithmFPType * means, const double * weights, algorithmFPType minValue, algorithmFPType maxValue,
+                             algorithmFPType q) const
+    {
+        const size_t n = size(weights);
+        if (!n) return algorithmFPType(0);
+
+        double totalWeight = 0;
+        for (size_t i = 0; i < n; ++i) totalWeight += weights[i];
+        const double target = double(q) * totalWeight;
+
+        double leftPos            = 0;
+        algorithmFPType leftValue = minValue;
+        double cumWeight          = 0;
+        for (size_t i = 0; i <= n; ++i)
+        {
+            const double rightPos            = (i < n) ? cumWeight + weights[i] / 2 : totalWeight;
+            const algorithmFPType rightValue = (i < n) ? means[i] : maxValue;
+            if (target <= rightPos)
+            {
+                if (rightPos <= leftPos) return rightValue;
+                const double t = (target - leftPos) / (rightPos - leftPos);
+                return algorithmFPType(double(leftValue) + t * (double(rightValue) - double(leftValue)));
+            }
+            if (i < n) cumWeight += weights[i];
+            leftPos   = rightPos;
+            leftValue = rightValue;
+        }
+        return maxValue;
+    }
+
+private:
+    double scale(double q) const
+    {
+        typedef daal::internal::Math<double, cpu> MathType;
+        return (q <= 0.5) ? _delta / 4 * (MathType::sSqrt(2 * q) - 1) : _delta / 4 * (1 - MathType::sSqrt(2 * (1 - q)));
+    }
+
+    double scaleInverse(double k) const
+    {
+        const double x = 4 * k / _delta;
+        if (x <= -1) return 0;
+        if (x >= 1) return 1;
+        return (x <= 0) ? (1 + x) * (1 + x) / 2 : 1 - (1 - x) * (1 - x) / 2;
+    }
+
+    /* Greedily merges the sorted centroids while the increase of the scale function stays within 1 */
+    void compress(const algorithmFPType * bufMeans, const double * bufWeights, size_t m, double totalWeight, algorithmFPType * means,
+                  double * weights) const
+    {
+        size_t nOut         = 0;
+        double mean         = bufMeans[0];
+        double weight       = bufWeights[0];
+        double weightBefore = 0;
+        double weightLimit  = totalWeight * scaleInverse(scale(0) + 1);
+        for (size_t i = 1; i < m; ++i)
+        {
+            const double w = bufWeights[i];
+            /* the last slot of the sketch absorbs the rest, this protects from the rounding errors only */
+            if (weightBefore + weight + w <= weightLimit || nOut + 1 == _capacity)
+            {
+                weight += w;
+                mean += (double(bufMeans[i]) - mean) * w / weight;
+            }
+            else
+            {
+                means[nOut]   = algorithmFPType(mean);
+                weights[nOut] = weight;
+                ++nOut;
+                weightBefore += weight;
+                weightLimit = totalWeight * scaleInverse(scale(weightBefore / totalWeight) + 1);
+                mean        = bufMeans[i];
+                weight      = w;
+            }
+        }
+        means[nOut]   = algorithmFPType(mean);
+        weights[nOut] = weight;
+        for (size_t i = nOut + 1; i < _capacity; ++i)
+        {
+            means[i]   = 0;
+            weights[i] = 0;
+        }
+    }
+
+    const double _delta;
+    const size_t _capacity;
+};
+
+} // namespace internal
+} // namespace quantiles
+} // namespace algorithms
+} // namespace daal
+
+#endif
@@ -0,0 +1,284 @@
+/* file: quantiles_sketch_impl.i */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of sketch method for quantiles computation in the batch,
+//  online and distributed processing modes
+//--
+*/
+
+#ifndef __QUANTILES_SKETCH_IMPL__
+#define __QUANTILES_SKETCH_IMPL__
+
+#include "src/data_management/service_numeric_table.h"
+#include "src/externals/service_memory.h"
+#include "src/algorithms/service_error_handling.h"
+#include "src/algorithms/service_sort.h"
+#include "src/algorithms/service_threading.h"
+#include "src/services/service_data_utils.h"
+#include "src/algorithms/quantiles/quantiles_sketch.h"
+
+using namespace daal::internal;
+using namespace daal::services;
+using namespace daal::services::internal;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace quantiles
+{
+namespace internal
+{
+/* Adds the observations of the data table to the sketches of features, the observations with missing values are skipped */
+template <typename algorithmFPType, CpuType cpu>
+services::Status updateSketches(const NumericTable & dataTable, const TDigest<algorithmFPType, cpu> & digest, algorithmFPType * const centroids,
+                                double * const weights, algorithmFPType * const minimum, algorithmFPType * const maximum)
+{
+    const size_t nFeatures = dataTable.getNumberOfColumns();
+    const size_t nRows     = dataTable.getNumberOfRows();
+    const size_t capacity  = digest.capacity();
+    const size_t blockSize = __QUANTILES_SKETCH_BLOCK_SIZE;
+    const size_t nBlocks   = nRows / blockSize + !!(nRows % blockSize);
+
+    /* sorted observations of a feature and the buffer to merge them with the sketch */
+    daal::TlsMem<algorithmFPType, cpu> tlsMeans(2 * blockSize + capacity);
+    daal::TlsMem<double, cpu> tlsWeights(blockSize + capacity);
+
+    ReadRows<algorithmFPType, cpu> dataRows(const_cast<NumericTable &>(dataTable));
+    SafeStatus safeStat;
+    for (size_t iBlock = 0; iBlock < nBlocks; ++iBlock)
+    {
+        const size_t startRow     = iBlock * blockSize;
+        const size_t nRowsInBlock = (iBlock + 1 == nBlocks) ? nRows - startRow : blockSize;
+
+        const algorithmFPType * const data = dataRows.next(startRow, nRowsInBlock);
+        DAAL_CHECK_BLOCK_STATUS(dataRows);
+
+        daal::threader_for(nFeatures, nFeatures, [&](size_t iFeature) {
+            algorithmFPType * const values = tlsMeans.local();
+            double * const bufWeights      = tlsWeights.local();
+            DAAL_CHECK_MALLOC_THR(values && bufWeights);
+            algorithmFPType * const bufMeans = values + blockSize;
+
+            algorithmFPType minValue = minimum[iFeature];
+            algorithmFPType maxValue = maximum[iFeature];
+            size_t nValues           = 0;
+            for (size_t i = 0; i < nRowsInBlock; ++i)
+            {
+                const algorithmFPType value = data[i * nFeatures + iFeature];
+                if (IsNaN<algorithmFPType, cpu>::get(value)) continue;
+                values[nValues++] = value;
+                minValue          = (value < minValue) ? value : minValue;
+                maxValue          = (value > maxValue) ? value : maxValue;
+            }
+            minimum[iFeature] = minValue;
+            maximum[iFeature] = maxValue;
+
+            daal::algorithms::internal::qSort<algorithmFPType, cpu>(nValues, values);
+            digest.merge(centroids + iFeature * capacity, weights + iFeature * capacity, values, nullptr, nValues, bufMeans, bufWeights);
+        });
+        DAAL_CHECK_SAFE_STATUS();
+    }
+    return Status();
+}
+
+template <typename algorithmFPType, CpuType cpu>
+services::Status computeQuantiles(const TDigest<algorithmFPType, cpu> & digest, const algorithmFPType * const centroids, const double * const weights,
+                                  const algorithmFPType * const minimum, const algorithmFPType * const maximum,
+                                  const NumericTable & quantileOrdersTable, NumericTable & quantilesTable)
+{
+    const size_t nFeatures       = quantilesTable.getNumberOfRows();
+    const size_t nQuantileOrders = quantilesTable.getNumberOfColumns();
+    const size_t capacity        = digest.capacity();
+
+    ReadRows<algorithmFPType, cpu> quantileOrdersBlock(const_cast<NumericTable &>(quantileOrdersTable), 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(quantileOrdersBlock)
+    const algorithmFPType * const quantileOrders = quantileOrdersBlock.get();
+
+    for (size_t k = 0; k < nQuantileOrders; ++k)
+    {
+        DAAL_CHECK(quantileOrders[k] >= 0 && quantileOrders[k] <= 1, services::ErrorQuantileOrderValueIsInvalid);
+    }
+
+    WriteOnlyRows<algorithmFPType, cpu> quantilesBlock(quantilesTable, 0, nFeatures);
+    DAAL_CHECK_BLOCK_STATUS(quantilesBlock)
+    algorithmFPType * const quantiles = quantilesBlock.get();
+
+    daal::threader_for(nFeatures, nFeatures, [&](size_t iFeature) {
+        for (size_t k = 0; k < nQuantileOrders; ++k)
+        {
+            quantiles[iFeature * nQuantileOrders + k] = digest.quantile(centroids + iFeature * capacity, weights + iFeature * capacity,
+                                                                        minimum[iFeature], maximum[iFeature], quantileOrders[k]);
+        }
+    });
+    return Status();
+}
+
+template <typename algorithmFPType, CpuType cpu>
+services::Status finalizeSketches(const PartialResult * partialResult, NumericTable & quantilesTable, const Parameter * par)
+{
+    const size_t nFeatures = quantilesTable.getNumberOfRows();
+    const TDigest<algorithmFPType, cpu> digest(par->compression);
+
+    ReadRows<algorithmFPType, cpu> centroidsBlock(partialResult->get(sketchCentroids).get(), 0, nFeatures);
+    DAAL_CHECK_BLOCK_STATUS(centroidsBlock)
+    ReadRows<double, cpu> weightsBlock(partialResult->get(sketchWeights).get(), 0, nFeatures);
+    DAAL_CHECK_BLOCK_STATUS(weightsBlock)
+    ReadRows<algorithmFPType, cpu> minimumBlock(partialResult->get(partialMinimum).get(), 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(minimumBlock)
+    ReadRows<algorithmFPType, cpu> maximumBlock(partialResult->get(partialMaximum).get(), 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(maximumBlock)
+
+    return computeQuantiles<algorithmFPType, cpu>(digest, centroidsBlock.get(), weightsBlock.get(), minimumBlock.get(), maximumBlock.get(),
+                                                  *par->quantileOrders, quantilesTable);
+}
+
+template <typename algorithmFPType, CpuType cpu>
+services::Status QuantilesKernel<sketchDense, algorithmFPType, cpu>::compute(const NumericTable & dataTable, const NumericTable & quantileOrdersTable,
+                                                                             NumericTable & quantilesTable,
+                                                                             const daal::algorithms::Parameter * par)
+{
+    const size_t nFeatures = dataTable.getNumberOfColumns();
+    const TDigest<algorithmFPType, cpu> digest(static_cast<const Parameter *>(par)->compression);
+    const size_t capacity = digest.capacity();
+
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nFeatures, capacity);
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nFeatures * capacity, sizeof(double));
+
+    TArray<algorithmFPType, cpu> centroids(nFeatures * capacity);
+    TArray<double, cpu> weights(nFeatures * capacity);
+    TArray<algorithmFPType, cpu> minimum(nFeatures);
+    TArray<algorithmFPType, cpu> maximum(nFeatures);
+    DAAL_CHECK_MALLOC(centroids.get() && weights.get() && minimum.get() && maximum.get());
+
+    service_memset<double, cpu>(weights.get(), 0.0, nFeatures * capacity);
+    service_memset<algorithmFPType, cpu>(minimum.get(), MaxVal<algorithmFPType>::get(), nFeatures);
+    service_memset<algorithmFPType, cpu>(maximum.get(), -MaxVal<algorithmFPType>::get(), nFeatures);
+
+    Status s;
+    DAAL_CHECK_STATUS(s, (updateSketches<algorithmFPType, cpu>(dataTable, digest, centroids.get(), weights.get(), minimum.get(), maximum.get())));
+    return computeQuantiles<algorithmFPType, cpu>(digest, centroids.get(), weights.get(), minimum.get(), maximum.get(), quantileOrdersTable,
+                                                  quantilesTable);
+}
+
+template <Method method, typename algorithmFPType, CpuType cpu>
+services::Status QuantilesOnlineKernel<method, algorithmFPType, cpu>::compute(const NumericTable & dataTable, PartialResult * partialResult,
+                                                                              const Parameter * par)
+{
+    const size_t nFeatures = dataTable.getNumberOfColumns();
+    const TDigest<algorithmFPType, cpu> digest(par->compression);
+
+    WriteRows<algorithmFPType, cpu> centroidsBlock(partialResult->get(sketchCentroids).get(), 0, nFeatures);
+    DAAL_CHECK_BLOCK_STATUS(centroidsBlock)
+    WriteRows<double, cpu> weightsBlock(partialResult->get(sketchWeights).get(), 0, nFeatures);
+    DAAL_CHECK_BLOCK_STATUS(weightsBlock)
+    WriteRows<algorithmFPType, cpu> minimumBlock(partialResult->get(partialMinimum).get(), 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(minimumBlock)
+    WriteRows<algorithmFPType, cpu> maximumBlock(partialResult->get(partialMaximum).get(), 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(maximumBlock)
+
+    return updateSketches<algorithmFPType, cpu>(dataTable, digest, centroidsBlock.get(), weightsBlock.get(), minimumBlock.get(),
+                                                maximumBlock.get());
+}
+
+template <Method method, typename algorithmFPType, CpuType cpu>
+services::Status QuantilesOnlineKernel<method, algorithmFPType, cpu>::finalizeCompute(const PartialResult * partialResult,
+                                                                                      NumericTable & quantilesTable, const Parameter * par)
+{
+    return finalizeSketches<algorithmFPType, cpu>(partialResult, quantilesTable, par);
+}
+
+template <Method method, typename algorithmFPType, CpuType cpu>
+services::Status QuantilesDistributedKernel<method, algorithmFPType, cpu>::compute(data_management::DataCollection * partialResultsCollection,
+                                                                                   PartialResult * partialResult, const Parameter * par)
+{
+    size_t nFeatures = 0;
+    Status s;
+    DAAL_CHECK_STATUS(s, partialResult->getNumberOfColumns(nFeatures));
+
+    const TDigest<algorithmFPType, cpu> digest(par->compression);
+    const size_t capacity = digest.capacity();
+
+    WriteRows<algorithmFPType, cpu> centroidsBlock(partialResult->get(sketchCentroids).get(), 0, nFeatures);
+    DAAL_CHECK_BLOCK_STATUS(centroidsBlock)
+    WriteRows<double, cpu> weightsBlock(partialResult->get(sketchWeights).get(), 0, nFeatures);
+    DAAL_CHECK_BLOCK_STATUS(weightsBlock)
+    WriteRows<algorithmFPType, cpu> minimumBlock(partialResult->get(partialMinimum).get(), 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(minimumBlock)
+    WriteRows<algorithmFPType, cpu> maximumBlock(partialResult->get(partialMaximum).get(), 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(maximumBlock)
+
+    algorithmFPType * const centroids = centroidsBlock.get();
+    double * const weights            = weightsBlock.get();
+    algorithmFPType * const minimum   = minimumBlock.get();
+    algorithmFPType * const maximum   = maximumBlock.get();
+
+    daal::TlsMem<algorithmFPType, cpu> tlsMeans(2 * capacity);
+    daal::TlsMem<double, cpu> tlsWeights(2 * capacity);
+
+    const size_t nBlocks = partialResultsCollection->size();
+    for (size_t iBlock = 0; iBlock < nBlocks; ++iBlock)
+    {
+        const PartialResult * localResult = static_cast<const PartialResult *>((*partialResultsCollection)[iBlock].get());
+
+        ReadRows<algorithmFPType, cpu> localCentroidsBlock(localResult->get(sketchCentroids).get(), 0, nFeatures);
+        DAAL_CHECK_BLOCK_STATUS(localCentroidsBlock)
+        ReadRows<double, cpu> localWeightsBlock(localResult->get(sketchWeights).get(), 0, nFeatures);
+        DAAL_CHECK_BLOCK_STATUS(localWeightsBlock)
+        ReadRows<algorithmFPType, cpu> localMinimumBlock(localResult->get(partialMinimum).get(), 0, 1);
+        DAAL_CHECK_BLOCK_STATUS(localMinimumBlock)
+        ReadRows<algorithmFPType, cpu> localMaximumBlock(localResult->get(partialMaximum).get(), 0, 1);
+        DAAL_CHECK_BLOCK_STATUS(localMaximumBlock)
+
+        const algorithmFPType * const localCentroids = localCentroidsBlock.get();
+        const double * const localWeights            = localWeightsBlock.get();
+        const algorithmFPType * const localMinimum   = localMinimumBlock.get();
+        const algorithmFPType * const localMaximum   = localMaximumBlock.get();
+
+        SafeStatus safeStat;
+        daal::threader_for(nFeatures, nFeatures, [&](size_t iFeature) {
+            algorithmFPType * const bufMeans = tlsMeans.local();
+            double * const bufWeights        = tlsWeights.local();
+            DAAL_CHECK_MALLOC_THR(bufMeans && bufWeights);
+
+            minimum[iFeature] = (localMinimum[iFeature] < minimum[iFeature]) ? localMinimum[iFeature] : minimum[iFeature];
+            maximum[iFeature] = (localMaximum[iFeature] > maximum[iFeature]) ? localMaximum[iFeature] : maximum[iFeature];
+
+            const double * const addWeights = localWeights + iFeature * capacity;
+            digest.merge(centroids + iFeature * capacity, weights + iFeature * capacity, localCentroids + iFeature * capacity, addWeights,
+                         digest.size(addWeights), bufMeans, bufWeights);
+        });
+        DAAL_CHECK_SAFE_STATUS();
+    }
+    return s;
+}
+
+template <Method method, typename algorithmFPType, CpuType cpu>
+services::Status QuantilesDistributedKernel<method, algorithmFPType, cpu>::finalizeCompute(const PartialResult * partialResult,
+                                                                                           NumericTable & quantilesTable, const Parameter * par)
+{
+    return finalizeSketches<algorithmFPType, cpu>(partialResult, quantilesTable, par);
+}
+
+} // namespace internal
+} // namespace quantiles
+} // namespace algorithms
+} // namespace daal
+
+#endif
@@ -24,6 +24,7 @@
 #include "algorithms/sorting/sorting_types.h"
 #include "src/services/serialization_utils.h"
 #include "src/services/daal_strings.h"
+#include "src/services/service_data_utils.h"
 
 using namespace daal::data_management;
 using namespace daal::services;
@@ -65,10 +66,34 @@ void Input::set(InputId id, const NumericTablePtr & ptr)
  * \param[in] method    Algorithm computation method
  * \param[in] par       Pointer to the parameters of the algorithm
  */
-Status Input::check(const Parameter * par, int method) const
+Status Input::check(const daal::algorithms::Parameter * par, int method) const
 {
     const int unexpectedLayouts = packed_mask;
-    return checkNumericTable(get(data).get(), dataStr(), unexpectedLayouts);
+    Status s;
+    DAAL_CHECK_STATUS(s, checkNumericTable(get(data).get(), dataStr(), unexpectedLayouts));
+
+    const Parameter * parameter = static_cast<const Parameter *>(par);
+    if (!parameter) return s;
+
+    const size_t nFeatures = get(data)->getNumberOfColumns();
+    const size_t nVectors  = get(data)->getNumberOfRows();
+    if (parameter->mode == selectTopK)
+    {
+        DAAL_CHECK_EX(parameter->k <= nVectors, ErrorIncorrectParameter, ParameterName, kStr());
+    }
+    if (parameter->mode == sortRows)
+    {
+        for (size_t i = 0; i < parameter->keyColumns.size(); ++i)
+        {
+            DAAL_CHECK_EX(parameter->keyColumns[i] < nFeatures, ErrorIncorrectParameter, ParameterName, keyColumnsStr());
+        }
+    }
+    const bool isValueSort = parameter->mode == sortColumns && parameter->order == ascending && !(parameter->resultsToCompute & computeSortedIndices);
+    if (!isValueSort)
+    {
+        DAAL_CHECK_EX(nVectors <= static_cast<size_t>(services::internal::MaxVal<int>::get()), ErrorIncorrectNumberOfRows, ArgumentName, dataStr());
+    }
+    return s;
 }
 
 Result::Result() : daal::algorithms::Result(lastResultId + 1) {}
@@ -99,18 +124,56 @@ void Result::set(ResultId id, const NumericTablePtr & value)
  * \param[in] par     %Parameter of algorithm
  * \param[in] method Algorithm computation method
  */
-Status Result::check(const daal::algorithms::Input * in, const Parameter * par, int method) const
+Status Result::check(const daal::algorithms::Input * in, const daal::algorithms::Parameter * par, int method) const
 {
     const Input * input = static_cast<const Input *>(in);
 
+    const Parameter defaultParameter;
+    const Parameter * parameter = par ? static_cast<const Parameter *>(par) : &defaultParameter;
+
     const size_t nFeatures      = input->get(data)->getNumberOfColumns();
     const size_t nVectors       = input->get(data)->getNumberOfRows();
+    const size_t nResultRows    = (parameter->mode == selectTopK) ? parameter->k : nVectors;
     const int unexpectedLayouts = packed_mask;
 
-    return checkNumericTable(get(sortedData).get(), sortedDataStr(), unexpectedLayouts, 0, nFeatures, nVectors);
+    Status s;
+    if (parameter->resultsToCompute & computeSortedData)
+    {
+        DAAL_CHECK_STATUS(s, checkNumericTable(get(sortedData).get(), sortedDataStr(), unexpectedLayouts, 0, nFeatures, nResultRows));
+    }
+    if (parameter->resultsToCompute & computeSortedIndices)
+    {
+        const size_t nIndexColumns = (parameter->mode == sortRows) ? 1 : nFeatures;
+        DAAL_CHECK_STATUS(s, checkNumericTable(get(sortedIndices).get(), sortedIndicesStr(), unexpectedLayouts, 0, nIndexColumns, nResultRows));
+    }
+    return s;
 }
 
 } // namespace interface1
+
+namespace interface2
+{
+Parameter::Parameter(SortingMode mode, SortOrder order, size_t k, DAAL_UINT64 resultsToCompute)
+    : daal::algorithms::Parameter(), mode(mode), order(order), k(k), resultsToCompute(resultsToCompute)
+{}
+
+/**
+ * Checks the correctness of the parameter
+ */
+Status Parameter::check() const
+{
+    DAAL_CHECK_EX(resultsToCompute & (computeSortedData | computeSortedIndices), ErrorIncorrectParameter, ParameterName, resultsToComputeStr());
+    if (mode == selectTopK)
+    {
+        DAAL_CHECK_EX(k > 0, ErrorIncorrectParameter, ParameterName, kStr());
+    }
+    if (mode == sortRows)
+    {
+        DAAL_CHECK_EX(keyColumns.size() > 0, ErrorIncorrectParameter, ParameterName, keyColumnsStr());
+    }
+    return Status();
+}
+} // namespace interface2
 } // namespace sorting
 } // namespace algorithms
 } // namespace daal
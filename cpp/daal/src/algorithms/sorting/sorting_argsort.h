@@ -0,0 +1,255 @@
+/* file: sorting_argsort.h */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Declaration of the stable sort of positions by floating-point values.
+//
+//  The values are mapped to unsigned integer keys that preserve the order of
+//  the values, the keys are sorted by the least significant digit radix sort.
+//  The observations are split into blocks, every thread builds the histogram
+//  of digits and scatters the keys of its block, so the sort is stable.
+//  Large arrays of double precision values are sorted by the parallel
+//  comparison sort of the threading layer, the values with equal keys are
+//  ordered by positions there.
+//--
+*/
+
+#ifndef __SORTING_ARGSORT_H__
+#define __SORTING_ARGSORT_H__
+
+#include "algorithms/sorting/sorting_types.h"
+#include "src/threading/threading.h"
+#include "src/externals/service_memory.h"
+#include "src/services/service_arrays.h"
+#include "src/services/service_data_utils.h"
+#include "src/services/service_utils.h"
+
+#define __SORTING_RADIX_BITS        8
+#define __SORTING_RADIX_SIZE        (1 << __SORTING_RADIX_BITS)
+#define __SORTING_MIN_BLOCK_SIZE    16384
+#define __SORTING_MIN_ROWS_PARALLEL 65536
+#define __SORTING_BLOCK_SIZE        4096
+
+namespace daal
+{
+namespace algorithms
+{
+namespace sorting
+{
+namespace internal
+{
+using namespace daal::services;
+using namespace daal::services::internal;
+
+template <typename algorithmFPType>
+struct RadixKey;
+
+template <>
+struct RadixKey<float>
+{
+    typedef uint32_t type;
+};
+
+template <>
+struct RadixKey<double>
+{
+    typedef uint64_t type;
+};
+
+template <typename KeyType>
+struct KeyPosition
+{
+    KeyType key;
+    int position;
+};
+
+template <typename algorithmFPType, CpuType cpu>
+class ArgSorter
+{
+public:
+    typedef typename RadixKey<algorithmFPType>::type KeyType;
+    typedef KeyPosition<KeyType> Item;
+    typedef daal::IdxValType<algorithmFPType> Pair;
+
+    ArgSorter() : _n(0), _nBlocks(1), _blockSize(0) {}
+
+    /* isParallel specifies if the sort of one array may use several threads */
+    Status init(size_t n, bool isParallel)
+    {
+        _n         = n;
+        _nBlocks   = isParallel ? services::internal::min<cpu, size_t>(threader_get_max_threads_number(), n / __SORTING_MIN_BLOCK_SIZE) : 1;
+        _nBlocks   = services::internal::max<cpu, size_t>(_nBlocks, 1);
+        _blockSize = n / _nBlocks + !!(n % _nBlocks);
+
+        _positions.reset(n);
+        DAAL_CHECK_MALLOC(_positions.get());
+        if (_nBlocks > 1 && sizeof(algorithmFPType) == sizeof(double))
+        {
+            _pairs.reset(n);
+            DAAL_CHECK_MALLOC(_pairs.get());
+            return Status();
+        }
+        _items.reset(n);
+        _buffer.reset(n);
+        _histograms.reset(_nBlocks * __SORTING_RADIX_SIZE);
+        DAAL_CHECK_MALLOC(_items.get() && _buffer.get() && _histograms.get());
+        return Status();
+    }
+
+    /*
+     * Sorts positions 0, ..., n - 1 by the values getValue(position) in the given order.
+     * The positions with equal values keep their order, the positions of NaN values are placed last.
+     * Returns the sorted positions, they are valid until the next call
+     */
+    template <typename GetValue>
+    const int * sort(const GetValue & getValue, SortOrder order)
+    {
+        if (_pairs.get())
+        {
+            comparisonSort(getValue, order);
+            return _positions.get();
+        }
+
+        Item * items  = _items.get();
+        Item * buffer = _buffer.get();
+        forEachBlock([&](size_t iBlock, size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i)
+            {
+                items[i].key      = toKey(getValue(i), order);
+                items[i].position = int(i);
+            }
+        });
+
+        radixSort(items, buffer);
+
+        int * const positions = _positions.get();
+        forEachBlock([&](size_t iBlock, size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) positions[i] = items[i].position;
+        });
+        return positions;
+    }
+
+private:
+    /* -0 and +0 are mapped to the same key, NaN values are mapped to the largest key in both orders */
+    static KeyType toKey(algorithmFPType value, SortOrder order)
+    {
+        if (IsNaN<algorithmFPType, cpu>::get(value)) return ~KeyType(0);
+        if (value == algorithmFPType(0)) value = algorithmFPType(0);
+
+        const KeyType signBit = KeyType(1) << (sizeof(KeyType) * 8 - 1);
+        const KeyType bits    = *reinterpret_cast<const KeyType *>(&value);
+        const KeyType key     = (bits & signBit) ? ~bits : (bits | signBit);
+        return (order == descending) ? ~key : key;
+    }
+
+    template <typename Func>
+    void forEachBlock(const Func & func) const
+    {
+        if (_nBlocks == 1)
+        {
+            func(0, 0, _n);
+            return;
+        }
+        daal::threader_for(_nBlocks, _nBlocks, [&](size_t iBlock) {
+            const size_t begin = iBlock * _blockSize;
+            const size_t end   = services::internal::min<cpu, size_t>(begin + _blockSize, _n);
+            func(iBlock, begin, end);
+        });
+    }
+
+    void radixSort(Item *& items, Item *& buffer)
+    {
+        size_t * const histograms = _histograms.get();
+        for (size_t shift = 0; shift < sizeof(KeyType) * 8; shift += __SORTING_RADIX_BITS)
+        {
+            forEachBlock([&](size_t iBlock, size_t begin, size_t end) {
+                size_t * const histogram = histograms + iBlock * __SORTING_RADIX_SIZE;
+                service_memset_seq<size_t, cpu>(histogram, 0, __SORTING_RADIX_SIZE);
+                for (size_t i = begin; i < end; ++i) ++histogram[(items[i].key >> shift) & (__SORTING_RADIX_SIZE - 1)];
+            });
+
+            /* the offsets are accumulated digit by digit and block by block, so the keys with equal digits keep their order */
+            bool isDigitCommon = false;
+            size_t offset      = 0;
+            for (size_t digit = 0; digit < __SORTING_RADIX_SIZE; ++digit)
+            {
+                const size_t digitOffset = offset;
+                for (size_t iBlock = 0; iBlock < _nBlocks; ++iBlock)
+                {
+                    const size_t count                                = histograms[iBlock * __SORTING_RADIX_SIZE + digit];
+                    histograms[iBlock * __SORTING_RADIX_SIZE + digit] = offset;
+                    offset += count;
+                }
+                isDigitCommon |= (offset - digitOffset == _n);
+            }
+            if (isDigitCommon) continue;
+
+            forEachBlock([&](size_t iBlock, size_t begin, size_t end) {
+                size_t * const histogram = histograms + iBlock * __SORTING_RADIX_SIZE;
+                for (size_t i = begin; i < end; ++i) buffer[histogram[(items[i].key >> shift) & (__SORTING_RADIX_SIZE - 1)]++] = items[i];
+            });
+            Item * const tmp = items;
+            items            = buffer;
+            buffer           = tmp;
+        }
+    }
+
+    template <typename GetValue>
+    void comparisonSort(const GetValue & getValue, SortOrder order)
+    {
+        Pair * const pairs    = _pairs.get();
+        int * const positions = _positions.get();
+
+        size_t nValues = 0;
+        for (size_t i = 0; i < _n; ++i)
+        {
+            const algorithmFPType value = getValue(i);
+            if (IsNaN<algorithmFPType, cpu>::get(value)) continue;
+            pairs[nValues].value = (order == descending) ? -value : value;
+            pairs[nValues].index = i;
+            ++nValues;
+        }
+
+        daal::parallel_sort<algorithmFPType>(pairs, pairs + nValues);
+
+        forEachBlock([&](size_t iBlock, size_t begin, size_t end) {
+            end = services::internal::min<cpu, size_t>(end, nValues);
+            for (size_t i = begin; i < end; ++i) positions[i] = int(pairs[i].index);
+        });
+        for (size_t i = 0; i < _n; ++i)
+        {
+            if (IsNaN<algorithmFPType, cpu>::get(getValue(i))) positions[nValues++] = int(i);
+        }
+    }
+
+    size_t _n;
+    size_t _nBlocks;
+    size_t _blockSize;
+    TArray<int, cpu> _positions;
+    TArray<Item, cpu> _items;
+    TArray<Item, cpu> _buffer;
+    TArray<size_t, cpu> _histograms;
+    TArray<Pair, cpu> _pairs;
+};
+
+} // namespace internal
+} // namespace sorting
+} // namespace algorithms
+} // namespace daal
+
+#endif
@@ -53,9 +53,16 @@ services::Status BatchContainer<algorithmFPType, method, cpu>::compute()
     Result * result = static_cast<Result *>(_res);
     Input * input   = static_cast<Input *>(_in);
 
+    /* The algorithms built with the interface1::Batch do not set the parameter */
+    const Parameter defaultParameter;
+    const Parameter * par = _par ? static_cast<const Parameter *>(_par) : &defaultParameter;
+
+    NumericTable * sortedTable  = (par->resultsToCompute & computeSortedData) ? result->get(sortedData).get() : nullptr;
+    NumericTable * indicesTable = (par->resultsToCompute & computeSortedIndices) ? result->get(sortedIndices).get() : nullptr;
+
     daal::services::Environment::env & env = *_env;
     __DAAL_CALL_KERNEL(env, internal::SortingKernel, __DAAL_KERNEL_ARGUMENTS(defaultDense, algorithmFPType), compute, *(input->get(data).get()),
-                       *(result->get(sortedData).get()));
+                       sortedTable, indicesTable, *par);
 }
 
 } // namespace sorting
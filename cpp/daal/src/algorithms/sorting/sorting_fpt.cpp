@@ -41,16 +41,43 @@ namespace interface1
 template <typename algorithmFPType>
 DAAL_EXPORT services::Status Result::allocate(const daal::algorithms::Input * input, const int method)
 {
-    const Input * in = static_cast<const Input *>(input);
+    const Parameter defaultParameter;
+    return allocate<algorithmFPType>(input, &defaultParameter, method);
+}
+
+/**
+ * Allocates memory to store final results of the sorting algorithms
+ * \param[in] input     Input objects for the sorting algorithm
+ * \param[in] par       %Parameter of the sorting algorithm
+ * \param[in] method    Algorithm computation method
+ */
+template <typename algorithmFPType>
+DAAL_EXPORT services::Status Result::allocate(const daal::algorithms::Input * input, const daal::algorithms::Parameter * par, const int method)
+{
+    const Input * in            = static_cast<const Input *>(input);
+    const Parameter defaultParameter;
+    const Parameter * parameter = par ? static_cast<const Parameter *>(par) : &defaultParameter;
 
-    const size_t nFeatures = in->get(data)->getNumberOfColumns();
-    const size_t nVectors  = in->get(data)->getNumberOfRows();
+    const size_t nFeatures   = in->get(data)->getNumberOfColumns();
+    const size_t nVectors    = in->get(data)->getNumberOfRows();
+    const size_t nResultRows = (parameter->mode == selectTopK) ? parameter->k : nVectors;
     services::Status st;
-    set(sortedData, HomogenNumericTable<algorithmFPType>::create(nFeatures, nVectors, NumericTable::doAllocate, &st));
+    if (parameter->resultsToCompute & computeSortedData)
+    {
+        set(sortedData, HomogenNumericTable<algorithmFPType>::create(nFeatures, nResultRows, NumericTable::doAllocate, &st));
+        DAAL_CHECK_STATUS_VAR(st);
+    }
+    if (parameter->resultsToCompute & computeSortedIndices)
+    {
+        const size_t nIndexColumns = (parameter->mode == sortRows) ? 1 : nFeatures;
+        set(sortedIndices, HomogenNumericTable<int>::create(nIndexColumns, nResultRows, NumericTable::doAllocate, &st));
+    }
     return st;
 }
 
 template DAAL_EXPORT services::Status Result::allocate<DAAL_FPTYPE>(const daal::algorithms::Input * input, const int method);
+template DAAL_EXPORT services::Status Result::allocate<DAAL_FPTYPE>(const daal::algorithms::Input * input, const daal::algorithms::Parameter * par,
+                                                                    const int method);
 
 } // namespace interface1
 } // namespace sorting
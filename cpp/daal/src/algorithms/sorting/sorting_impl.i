@@ -24,6 +24,9 @@
 #ifndef __SORTING_IMPL__
 #define __SORTING_IMPL__
 
+#include "src/algorithms/sorting/sorting_argsort.h"
+#include "src/algorithms/service_error_handling.h"
+
 namespace daal
 {
 namespace algorithms
@@ -33,7 +36,22 @@ namespace sorting
 namespace internal
 {
 template <Method method, typename algorithmFPType, CpuType cpu>
-Status SortingKernel<method, algorithmFPType, cpu>::compute(const NumericTable & inputTable, NumericTable & outputTable)
+Status SortingKernel<method, algorithmFPType, cpu>::compute(const NumericTable & inputTable, NumericTable * sortedTable, NumericTable * indicesTable,
+                                                            const Parameter & par)
+{
+    if (par.mode == sortColumns && par.order == ascending && !indicesTable)
+    {
+        return computeValues(inputTable, *sortedTable);
+    }
+    if (par.mode == sortRows)
+    {
+        return computeRows(inputTable, sortedTable, indicesTable, par);
+    }
+    return computeColumns(inputTable, sortedTable, indicesTable, par);
+}
+
+template <Method method, typename algorithmFPType, CpuType cpu>
+Status SortingKernel<method, algorithmFPType, cpu>::computeValues(const NumericTable & inputTable, NumericTable & outputTable)
 {
     const size_t nFeatures = inputTable.getNumberOfColumns();
     const size_t nVectors  = inputTable.getNumberOfRows();
@@ -50,6 +68,160 @@ Status SortingKernel<method, algorithmFPType, cpu>::compute(const NumericTable &
     return Status();
 }
 
+template <Method method, typename algorithmFPType, CpuType cpu>
+Status SortingKernel<method, algorithmFPType, cpu>::computeColumns(const NumericTable & inputTable, NumericTable * sortedTable,
+                                                                   NumericTable * indicesTable, const Parameter & par)
+{
+    const size_t nFeatures   = inputTable.getNumberOfColumns();
+    const size_t nVectors    = inputTable.getNumberOfRows();
+    const size_t nResultRows = (par.mode == selectTopK) ? par.k : nVectors;
+
+    ReadRows<algorithmFPType, cpu> inputBlock(const_cast<NumericTable &>(inputTable), 0, nVectors);
+    DAAL_CHECK_BLOCK_STATUS(inputBlock);
+    const algorithmFPType * const data = inputBlock.get();
+
+    WriteOnlyRows<algorithmFPType, cpu> sortedBlock;
+    algorithmFPType * sorted = nullptr;
+    if (sortedTable)
+    {
+        sortedBlock.set(sortedTable, 0, nResultRows);
+        DAAL_CHECK_BLOCK_STATUS(sortedBlock);
+        sorted = sortedBlock.get();
+    }
+
+    WriteOnlyRows<int, cpu> indicesBlock;
+    int * indices = nullptr;
+    if (indicesTable)
+    {
+        indicesBlock.set(indicesTable, 0, nResultRows);
+        DAAL_CHECK_BLOCK_STATUS(indicesBlock);
+        indices = indicesBlock.get();
+    }
+
+    auto writeColumn = [&](size_t j, const int * positions, size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i)
+        {
+            const size_t pos = positions[i];
+            if (sorted) sorted[i * nFeatures + j] = data[pos * nFeatures + j];
+            if (indices) indices[i * nFeatures + j] = int(pos);
+        }
+    };
+
+    if (nVectors >= __SORTING_MIN_ROWS_PARALLEL || nFeatures == 1)
+    {
+        /* the columns are sorted one by one, every column is sorted by several threads */
+        ArgSorter<algorithmFPType, cpu> sorter;
+        DAAL_CHECK_STATUS_VAR(sorter.init(nVectors, true));
+
+        const size_t nBlocks = nResultRows / __SORTING_BLOCK_SIZE + !!(nResultRows % __SORTING_BLOCK_SIZE);
+        for (size_t j = 0; j < nFeatures; ++j)
+        {
+            const int * const positions = sorter.sort([&](size_t i) -> algorithmFPType { return data[i * nFeatures + j]; }, par.order);
+            daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock) {
+                const size_t begin = iBlock * __SORTING_BLOCK_SIZE;
+                const size_t end   = services::internal::min<cpu, size_t>(begin + __SORTING_BLOCK_SIZE, nResultRows);
+                writeColumn(j, positions, begin, end);
+            });
+        }
+        return Status();
+    }
+
+    /* the columns are sorted in parallel, every column is sorted by a single thread */
+    SafeStatus safeStat;
+    daal::tls<ArgSorter<algorithmFPType, cpu> *> sorterTls([&]() -> ArgSorter<algorithmFPType, cpu> * {
+        ArgSorter<algorithmFPType, cpu> * const sorter = new ArgSorter<algorithmFPType, cpu>();
+        if (sorter && !sorter->init(nVectors, false))
+        {
+            delete sorter;
+            return nullptr;
+        }
+        return sorter;
+    });
+
+    daal::threader_for(nFeatures, nFeatures, [&](size_t j) {
+        ArgSorter<algorithmFPType, cpu> * const sorter = sorterTls.local();
+        DAAL_CHECK_MALLOC_THR(sorter);
+        const int * const positions = sorter->sort([&](size_t i) -> algorithmFPType { return data[i * nFeatures + j]; }, par.order);
+        writeColumn(j, positions, 0, nResultRows);
+    });
+
+    sorterTls.reduce([](ArgSorter<algorithmFPType, cpu> * sorter) -> void { delete sorter; });
+    return safeStat.detach();
+}
+
+template <Method method, typename algorithmFPType, CpuType cpu>
+Status SortingKernel<method, algorithmFPType, cpu>::computeRows(const NumericTable & inputTable, NumericTable * sortedTable,
+                                                                NumericTable * indicesTable, const Parameter & par)
+{
+    const size_t nFeatures = inputTable.getNumberOfColumns();
+    const size_t nVectors  = inputTable.getNumberOfRows();
+
+    ReadRows<algorithmFPType, cpu> inputBlock(const_cast<NumericTable &>(inputTable), 0, nVectors);
+    DAAL_CHECK_BLOCK_STATUS(inputBlock);
+    const algorithmFPType * const data = inputBlock.get();
+
+    ArgSorter<algorithmFPType, cpu> sorter;
+    DAAL_CHECK_STATUS_VAR(sorter.init(nVectors, true));
+
+    TArray<int, cpu> permutationArray(nVectors);
+    TArray<int, cpu> bufferArray(nVectors);
+    DAAL_CHECK_MALLOC(permutationArray.get() && bufferArray.get());
+    int * permutation = permutationArray.get();
+    int * buffer      = bufferArray.get();
+
+    const size_t nBlocks = nVectors / __SORTING_BLOCK_SIZE + !!(nVectors % __SORTING_BLOCK_SIZE);
+    daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock) {
+        const size_t begin = iBlock * __SORTING_BLOCK_SIZE;
+        const size_t end   = services::internal::min<cpu, size_t>(begin + __SORTING_BLOCK_SIZE, nVectors);
+        for (size_t i = begin; i < end; ++i) permutation[i] = int(i);
+    });
+
+    /* the sort is stable, so sorting by the keys from the least significant to the most significant one orders the rows by all the keys */
+    for (size_t iKey = par.keyColumns.size(); iKey-- > 0;)
+    {
+        const size_t key            = par.keyColumns[iKey];
+        const int * const positions = sorter.sort(
+            [&](size_t i) -> algorithmFPType { return data[size_t(permutation[i]) * nFeatures + key]; }, par.order);
+        daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock) {
+            const size_t begin = iBlock * __SORTING_BLOCK_SIZE;
+            const size_t end   = services::internal::min<cpu, size_t>(begin + __SORTING_BLOCK_SIZE, nVectors);
+            for (size_t i = begin; i < end; ++i) buffer[i] = permutation[positions[i]];
+        });
+        int * const tmp = permutation;
+        permutation     = buffer;
+        buffer          = tmp;
+    }
+
+    if (sortedTable)
+    {
+        WriteOnlyRows<algorithmFPType, cpu> sortedBlock(sortedTable, 0, nVectors);
+        DAAL_CHECK_BLOCK_STATUS(sortedBlock);
+        algorithmFPType * const sorted = sortedBlock.get();
+        daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock) {
+            const size_t begin = iBlock * __SORTING_BLOCK_SIZE;
+            const size_t end   = services::internal::min<cpu, size_t>(begin + __SORTING_BLOCK_SIZE, nVectors);
+            for (size_t i = begin; i < end; ++i)
+            {
+                const algorithmFPType * const row = data + size_t(permutation[i]) * nFeatures;
+                for (size_t j = 0; j < nFeatures; ++j) sorted[i * nFeatures + j] = row[j];
+            }
+        });
+    }
+
+    if (indicesTable)
+    {
+        WriteOnlyRows<int, cpu> indicesBlock(indicesTable, 0, nVectors);
+        DAAL_CHECK_BLOCK_STATUS(indicesBlock);
+        int * const indices = indicesBlock.get();
+        daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock) {
+            const size_t begin = iBlock * __SORTING_BLOCK_SIZE;
+            const size_t end   = services::internal::min<cpu, size_t>(begin + __SORTING_BLOCK_SIZE, nVectors);
+            for (size_t i = begin; i < end; ++i) indices[i] = permutation[i];
+        });
+    }
+    return Status();
+}
+
 } // namespace internal
 } // namespace sorting
 } // namespace algorithms
@@ -45,7 +45,12 @@ template <Method method, typename algorithmFPType, CpuType cpu>
 struct SortingKernel : public Kernel
 {
     virtual ~SortingKernel() {}
-    Status compute(const NumericTable & inputTable, NumericTable & outputTable);
+    Status compute(const NumericTable & inputTable, NumericTable * sortedTable, NumericTable * indicesTable, const Parameter & par);
+
+private:
+    Status computeValues(const NumericTable & inputTable, NumericTable & outputTable);
+    Status computeColumns(const NumericTable & inputTable, NumericTable * sortedTable, NumericTable * indicesTable, const Parameter & par);
+    Status computeRows(const NumericTable & inputTable, NumericTable * sortedTable, NumericTable * indicesTable, const Parameter & par);
 };
 
 } // namespace internal
@@ -40,6 +40,7 @@ template class BatchContainer<DAAL_FPTYPE, defaultDense, DAAL_CPU>;
 namespace internal
 {
 template struct DAAL_EXPORT SVMPredictImpl<defaultDense, DAAL_FPTYPE, DAAL_CPU>;
+template struct DAAL_EXPORT SVWeightedSumKernel<DAAL_FPTYPE, DAAL_CPU>;
 
 } // namespace internal
 } // namespace prediction
@@ -29,6 +29,7 @@
 #include "src/externals/service_blas.h"
 #include "src/externals/service_memory.h"
 #include "src/services/service_environment.h"
+#include "algorithms/kernel_function/kernel_function_types_linear.h"
 
 namespace daal
 {
@@ -188,14 +189,92 @@ private:
     ReadRowsCSR<algorithmFPType, cpu> _svBlock;
 };
 
+template <typename algorithmFPType, CpuType cpu>
+services::Status SVWeightedSumKernel<algorithmFPType, cpu>::computeSum(const NumericTablePtr & svTable, const algorithmFPType * const svCoeff,
+                                                                       const size_t nSV, const size_t nFeatures, algorithmFPType * const w)
+{
+    service_memset_seq<algorithmFPType, cpu>(w, algorithmFPType(0.0), nFeatures);
+    if (nSV == 0)
+    {
+        return services::Status();
+    }
+
+    if (svTable->getDataLayout() == NumericTableIface::csrArray)
+    {
+        const bool toOneBaseRowIndices = true;
+        ReadRowsCSR<algorithmFPType, cpu> mtSV(dynamic_cast<CSRNumericTableIface *>(svTable.get()), 0, nSV, toOneBaseRowIndices);
+        DAAL_CHECK_BLOCK_STATUS(mtSV);
+        const algorithmFPType * const values = mtSV.values();
+        const size_t * const cols            = mtSV.cols();
+        const size_t * const rows            = mtSV.rows();
+
+        for (size_t i = 0; i < nSV; ++i)
+        {
+            for (size_t j = rows[i] - 1; j < rows[i + 1] - 1; ++j)
+            {
+                w[cols[j] - 1] += svCoeff[i] * values[j];
+            }
+        }
+    }
+    else
+    {
+        ReadRows<algorithmFPType, cpu> mtSV(*svTable, 0, nSV);
+        DAAL_CHECK_BLOCK_STATUS(mtSV);
+
+        char trans = 'N';
+        DAAL_INT m = nFeatures;
+        DAAL_INT n = nSV;
+        algorithmFPType alpha(1.0);
+        DAAL_INT ldA = nFeatures;
+        DAAL_INT incX(1);
+        algorithmFPType beta(0.0);
+        DAAL_INT incY(1);
+
+        Blas<algorithmFPType, cpu>::xgemv(&trans, &m, &n, &alpha, mtSV.get(), &ldA, svCoeff, &incX, &beta, w, &incY);
+    }
+    return services::Status();
+}
+
+template <typename algorithmFPType, CpuType cpu>
+services::Status SVWeightedSumKernel<algorithmFPType, cpu>::compute(const NumericTablePtr & svTable, const NumericTablePtr & svCoeffTable,
+                                                                    NumericTable & wTable)
+{
+    const size_t nSV       = svTable->getNumberOfRows();
+    const size_t nFeatures = svTable->getNumberOfColumns();
+
+    WriteOnlyRows<algorithmFPType, cpu> mtW(wTable, 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(mtW);
+    if (nSV == 0)
+    {
+        return computeSum(svTable, nullptr, nSV, nFeatures, mtW.get());
+    }
+
+    ReadColumns<algorithmFPType, cpu> mtSVCoeff(*svCoeffTable, 0, 0, nSV);
+    DAAL_CHECK_BLOCK_STATUS(mtSVCoeff);
+    return computeSum(svTable, mtSVCoeff.get(), nSV, nFeatures, mtW.get());
+}
+
 template <typename algorithmFPType, CpuType cpu>
 struct SVMPredictImpl<defaultDense, algorithmFPType, cpu> : public Kernel
 {
     services::Status compute(const NumericTablePtr & xTable, Model * model, NumericTable & r, const svm::Parameter * par)
+    {
+        return compute(xTable, model, r, par, NumericTablePtr());
+    }
+
+    services::Status compute(const NumericTablePtr & xTable, Model * model, NumericTable & r, const svm::Parameter * par,
+                             const NumericTablePtr & svWeightedSum)
     {
         kernel_function::KernelIfacePtr kernel = par->kernel->clone();
         DAAL_CHECK(kernel, ErrorNullParameterNotSupported);
 
+        const kernel_function::linear::Parameter * const linearPar =
+            dynamic_cast<const kernel_function::linear::Parameter *>(kernel->getParameter());
+        if (linearPar)
+        {
+            return computeLinear(xTable, model, r, algorithmFPType(linearPar->k), algorithmFPType(linearPar->b), svWeightedSum);
+        }
+
         const NumericTablePtr svCoeffTable = model->getClassificationCoefficients();
         const NumericTablePtr svTable      = model->getSupportVectors();
 
@@ -282,6 +361,106 @@ struct SVMPredictImpl<defaultDense, algorithmFPType, cpu> : public Kernel
         tlsTask.reduce([](PredictTask<algorithmFPType, cpu> * local) { delete local; });
         return safeStat.detach();
     }
+
+private:
+    /* With the linear kernel K(x, sv) = k * <x, sv> + b the decision function collapses to
+     * f(x) = k * <x, w> + b * sum(coeff) + bias, where w = sum(coeff_i * sv_i).
+     * w is taken from svWeightedSum if it is precomputed, otherwise it is computed into a local buffer,
+     * so the model is only read */
+    services::Status computeLinear(const NumericTablePtr & xTable, Model * model, NumericTable & r, const algorithmFPType k, const algorithmFPType b,
+                                   const NumericTablePtr & svWeightedSum)
+    {
+        services::Status status;
+        const NumericTablePtr svCoeffTable = model->getClassificationCoefficients();
+        const NumericTablePtr svTable      = model->getSupportVectors();
+
+        const size_t nVectors  = xTable->getNumberOfRows();
+        const size_t nFeatures = xTable->getNumberOfColumns();
+        const size_t nSV       = svTable->getNumberOfRows();
+
+        ReadColumns<algorithmFPType, cpu> mtSVCoeff(*svCoeffTable, 0, 0, nSV);
+        DAAL_CHECK_BLOCK_STATUS(mtSVCoeff);
+        const algorithmFPType * const svCoeff = mtSVCoeff.get();
+
+        algorithmFPType coeffSum(0.0);
+        for (size_t i = 0; i < nSV; ++i)
+        {
+            coeffSum += svCoeff[i];
+        }
+        const algorithmFPType shift = algorithmFPType(model->getBias()) + b * coeffSum;
+
+        ReadRows<algorithmFPType, cpu> mtW;
+        TArray<algorithmFPType, cpu> wArray;
+        const algorithmFPType * w = nullptr;
+        if (svWeightedSum && svWeightedSum->getNumberOfRows() == 1 && svWeightedSum->getNumberOfColumns() == nFeatures)
+        {
+            mtW.set(*svWeightedSum, 0, 1);
+            DAAL_CHECK_BLOCK_STATUS(mtW);
+            w = mtW.get();
+        }
+        else
+        {
+            DAAL_CHECK_MALLOC(wArray.reset(nFeatures));
+            using WeightedSumKernel = SVWeightedSumKernel<algorithmFPType, cpu>;
+            DAAL_CHECK_STATUS(status, WeightedSumKernel::computeSum(svTable, svCoeff, nSV, nFeatures, wArray.get()));
+            w = wArray.get();
+        }
+
+        const bool isSparse        = xTable->getDataLayout() == NumericTableIface::csrArray;
+        const size_t nRowsPerBlock = 128;
+        const size_t nBlocks       = nVectors / nRowsPerBlock + !!(nVectors % nRowsPerBlock);
+
+        SafeStatus safeStat;
+        daal::threader_for(nBlocks, nBlocks, [&](const size_t iBlock) {
+            const size_t startRow          = iBlock * nRowsPerBlock;
+            const size_t nRowsPerBlockReal = (iBlock != nBlocks - 1) ? nRowsPerBlock : nVectors - startRow;
+
+            WriteOnlyColumns<algorithmFPType, cpu> mtR(r, 0, startRow, nRowsPerBlockReal);
+            DAAL_CHECK_BLOCK_STATUS_THR(mtR);
+            algorithmFPType * const distanceBlock = mtR.get();
+
+            if (isSparse)
+            {
+                const bool toOneBaseRowIndices = true;
+                ReadRowsCSR<algorithmFPType, cpu> mtX(dynamic_cast<CSRNumericTableIface *>(xTable.get()), startRow, nRowsPerBlockReal,
+                                                      toOneBaseRowIndices);
+                DAAL_CHECK_BLOCK_STATUS_THR(mtX);
+                const algorithmFPType * const values = mtX.values();
+                const size_t * const cols            = mtX.cols();
+                const size_t * const rows            = mtX.rows();
+
+                for (size_t i = 0; i < nRowsPerBlockReal; ++i)
+                {
+                    algorithmFPType dot(0.0);
+                    for (size_t j = rows[i] - 1; j < rows[i + 1] - 1; ++j)
+                    {
+                        dot += values[j] * w[cols[j] - 1];
+                    }
+                    distanceBlock[i] = k * dot + shift;
+                }
+            }
+            else
+            {
+                ReadRows<algorithmFPType, cpu> mtX(*xTable, startRow, nRowsPerBlockReal);
+                DAAL_CHECK_BLOCK_STATUS_THR(mtX);
+
+                service_memset_seq<algorithmFPType, cpu>(distanceBlock, shift, nRowsPerBlockReal);
+
+                char trans = 'T';
+                DAAL_INT m = nFeatures;
+                DAAL_INT n = nRowsPerBlockReal;
+                algorithmFPType alpha(k);
+                DAAL_INT ldA = nFeatures;
+                DAAL_INT incX(1);
+                algorithmFPType beta(1.0);
+                DAAL_INT incY(1);
+
+                Blas<algorithmFPType, cpu>::xxgemv(&trans, &m, &n, &alpha, mtX.get(), &ldA, w, &incX, &beta, distanceBlock, &incY);
+            }
+        });
+
+        return safeStat.detach();
+    }
 };
 
 } // namespace internal
@@ -45,6 +45,23 @@ struct SVMPredictImpl : public Kernel
 {
     services::Status compute(const data_management::NumericTablePtr & xTable, Model * model, data_management::NumericTable & r,
                              const svm::Parameter * par);
+
+    /* svWeightedSum is the sum of the support vectors weighted with the classification coefficients
+     * computed by SVWeightedSumKernel, it is used instead of the model with the linear kernel */
+    services::Status compute(const data_management::NumericTablePtr & xTable, Model * model, data_management::NumericTable & r,
+                             const svm::Parameter * par, const data_management::NumericTablePtr & svWeightedSum);
+};
+
+/* Computes the sum of the support vectors weighted with the classification coefficients
+ * into the table of size 1 x nFeatures */
+template <typename algorithmFPType, CpuType cpu>
+struct SVWeightedSumKernel : public Kernel
+{
+    services::Status compute(const data_management::NumericTablePtr & svTable, const data_management::NumericTablePtr & svCoeffTable,
+                             data_management::NumericTable & wTable);
+
+    static services::Status computeSum(const data_management::NumericTablePtr & svTable, const algorithmFPType * const svCoeff,
+                                       const size_t nSV, const size_t nFeatures, algorithmFPType * const w);
 };
 
 } // namespace internal
@@ -80,10 +80,24 @@ services::Status Parameter::check() const
 
 namespace training
 {
+namespace interface3
+{
+services::Status Parameter::check() const
+{
+    services::Status s;
+    DAAL_CHECK_STATUS(s, svm::interface2::Parameter::check());
+    if (thunderShrinkingStep == 0)
+    {
+        return services::Status(services::Error::create(services::ErrorIncorrectParameter, services::ParameterName, thunderShrinkingStepStr()));
+    }
+    return s;
+}
+} // namespace interface3
+
 namespace interface1
 {
 __DAAL_REGISTER_SERIALIZATION_CLASS(Result, SERIALIZATION_SVM_TRAINING_RESULT_ID);
-Result::Result() : classifier::training::Result() {}
+Result::Result() : classifier::training::Result(lastResultNumericTableId + 1) {}
 
 /**
  * Returns the model trained with the SVM algorithm
@@ -95,6 +109,16 @@ daal::algorithms::svm::ModelPtr Result::get(classifier::training::ResultId id) c
     return services::staticPointerCast<daal::algorithms::svm::Model, data_management::SerializationIface>(Argument::get(id));
 }
 
+data_management::NumericTablePtr Result::get(ResultNumericTableId id) const
+{
+    return services::staticPointerCast<NumericTable, SerializationIface>(Argument::get(id));
+}
+
+void Result::set(ResultNumericTableId id, const data_management::NumericTablePtr & value)
+{
+    Argument::set(id, value);
+}
+
 Status Result::check(const daal::algorithms::Input * input, const daal::algorithms::Parameter * parameter, int method) const
 {
     Status s;
@@ -103,6 +127,12 @@ Status Result::check(const daal::algorithms::Input * input, const daal::algorith
     if (!m->getSupportVectors()) s.add(services::Error::create(ErrorModelNotFullInitialized, services::ArgumentName, supportVectorsStr()));
     if (!m->getClassificationCoefficients())
         s.add(services::Error::create(ErrorModelNotFullInitialized, services::ArgumentName, classificationCoefficientsStr()));
+
+    const interface3::Parameter * const par = dynamic_cast<const interface3::Parameter *>(parameter);
+    if (par && (par->resultsToCompute & computeCacheStatistics))
+    {
+        DAAL_CHECK_STATUS(s, checkNumericTable(get(cacheStatistics).get(), cacheStatisticsStr(), 0, 0, 3, 1));
+    }
     return s;
 }
 
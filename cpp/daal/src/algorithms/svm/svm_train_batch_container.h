@@ -24,6 +24,8 @@
 #include "algorithms/svm/svm_train.h"
 #include "src/algorithms/svm/svm_train_kernel.h"
 #include "src/algorithms/svm/svm_train_boser_kernel.h"
+#include "src/algorithms/svm/svm_train_cache.h"
+#include "src/data_management/service_numeric_table.h"
 #include "algorithms/classifier/classifier_training_types.h"
 #include "src/algorithms/svm/oneapi/svm_train_thunder_kernel_oneapi.h"
 
@@ -87,6 +89,19 @@ services::Status BatchContainer<algorithmFPType, method, cpu>::compute()
     kernelPar.doShrinking       = par->doShrinking;
     kernelPar.cacheSize         = par->cacheSize;
 
+    /* The thunder shrinking is only set with training::Parameter, interface2::Batch keeps it off */
+    const training::interface3::Parameter * const trainingPar = dynamic_cast<const training::interface3::Parameter *>(par);
+    if (trainingPar)
+    {
+        kernelPar.doThunderShrinking   = trainingPar->doThunderShrinking;
+        kernelPar.thunderShrinkingStep = trainingPar->thunderShrinkingStep;
+    }
+
+    /* The statistics are requested with training::Parameter::resultsToCompute, Result::allocate adds the table for them */
+    const NumericTablePtr cacheStatisticsTable = result->get(cacheStatistics);
+    internal::SVMCacheStatistics statistics;
+    if (cacheStatisticsTable) kernelPar.cacheStatistics = &statistics;
+
     daal::services::Environment::env & env = *_env;
 
     auto & context    = services::internal::getDefaultContext();
@@ -95,10 +110,19 @@ services::Status BatchContainer<algorithmFPType, method, cpu>::compute()
     {
         __DAAL_CALL_KERNEL_SYCL(env, internal::SVMTrainOneAPI, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), compute, x, *y, r, kernelPar);
     }
-    else
+
+    services::Status s = __DAAL_CALL_KERNEL_STATUS(env, internal::SVMTrainImpl, __DAAL_KERNEL_ARGUMENTS(method, algorithmFPType), compute, x, weights,
+                                                   *y, r, kernelPar);
+    if (s && cacheStatisticsTable)
     {
-        __DAAL_CALL_KERNEL(env, internal::SVMTrainImpl, __DAAL_KERNEL_ARGUMENTS(method, algorithmFPType), compute, x, weights, *y, r, kernelPar);
+        daal::internal::WriteOnlyRows<double, cpu> statisticsRows(cacheStatisticsTable.get(), 0, 1);
+        DAAL_CHECK_BLOCK_STATUS(statisticsRows);
+        double * const statisticsData = statisticsRows.get();
+        statisticsData[0]             = double(statistics.nHits);
+        statisticsData[1]             = double(statistics.nMisses);
+        statisticsData[2]             = double(statistics.nEvictions);
     }
+    return s;
 }
 } // namespace interface2
 } // namespace training
@@ -51,7 +51,25 @@ enum SVMCacheType
     noCache,     /*!< No storage for caching kernel function values is provided */
     simpleCache, /*!< Storage for caching ALL kernel function values is provided */
     lruCache     /*!< Storage for caching PART of kernel function values is provided;
-                         LRU algorithm is used to exclude values from cache */
+                         clock (second chance) approximation of LRU algorithm is used to exclude values from cache */
+};
+
+/**
+ * Statistics of the cache usage
+ */
+struct SVMCacheStatistics
+{
+    size_t nHits      = 0; /*!< Number of requested rows found in the cache */
+    size_t nMisses    = 0; /*!< Number of requested rows computed on request */
+    size_t nEvictions = 0; /*!< Number of rows excluded from the cache */
+
+    SVMCacheStatistics & operator+=(const SVMCacheStatistics & other)
+    {
+        nHits += other.nHits;
+        nMisses += other.nMisses;
+        nEvictions += other.nEvictions;
+        return *this;
+    }
 };
 
 /**
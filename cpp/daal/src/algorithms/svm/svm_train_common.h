@@ -21,7 +21,6 @@
 #include "src/data_management/service_numeric_table.h"
 #include "src/externals/service_ittnotify.h"
 #include "src/services/service_utils.h"
-#include "src/algorithms/service_hash_table.h"
 
 namespace daal
 {
@@ -104,72 +103,60 @@ private:
     }
 };
 
-template <CpuType cpu, typename TKey>
-class LRUCache
+/**
+ * Index of the kernel function rows kept in the cache.
+ * Rows are stored in the preallocated slots and are evicted with the clock (second chance) policy,
+ * so neither lookups nor insertions allocate memory.
+ * get() only reads the key-to-slot map and marks the slot as used, so lookups of different keys
+ * can run concurrently. put() moves the clock hand and must not run concurrently with other calls.
+ */
+template <CpuType cpu>
+class ClockCache
 {
 public:
-    LRUCache(const size_t capacity) : _capacity(capacity), _hashmap(capacity)
-    {
-        _freeIndexCache = -1;
-        _count          = 0;
-        _head           = nullptr;
-        _tail           = nullptr;
-    }
+    ClockCache(const size_t capacity) : _capacity(capacity), _hand(0), _count(0), _epoch(0), _nEvictions(0) {}
+
+    services::Status init(const size_t nKeys);
+
+    /* Starts a new group of lookups: slots used within the group are not evicted until the next group starts */
+    void nextEpoch() { ++_epoch; }
 
-    ~LRUCache()
+    /* Returns the slot of the key or -1 if the key is not cached, the state of the cache is not changed */
+    int64_t find(const uint32_t key) const { return _slotByKey[key]; }
+
+    /* Marks the slot as used in the current epoch */
+    void touch(const int64_t slot)
     {
-        LRUNode * curr = _head;
-        while (curr)
-        {
-            LRUNode * next = curr->next;
-            delete curr;
-            curr = next;
-        }
+        _referenced[slot] = 1;
+        _lastUse[slot]    = _epoch;
     }
 
-    void put(const TKey key);
-    int64_t getFreeIndex() const { return _freeIndexCache; }
-    int64_t get(const TKey key);
-
-private:
-    class LRUNode
+    /* Returns the slot of the key or -1 if the key is not cached */
+    int64_t get(const uint32_t key)
     {
-    public:
-        DAAL_NEW_DELETE();
-        static LRUNode * create(const TKey key, int64_t value)
+        const int64_t slot = find(key);
+        if (slot >= 0)
         {
-            auto val = new LRUNode(key, value);
-            if (val) return val;
-            delete val;
-            return nullptr;
+            touch(slot);
         }
+        return slot;
+    }
 
-        TKey getKey() const { return key_; }
-        int64_t getValue() const { return value_; }
-
-        void setKey(const TKey key) { key_ = key; }
-        void setValue(const int64_t value) { value_ = value; }
-
-    public:
-        LRUNode * next;
-        LRUNode * prev;
+    /* Inserts the key that is not cached and returns its slot or -1 if all slots are used in the current epoch */
+    int64_t put(const uint32_t key);
 
-    private:
-        LRUNode(const TKey key, int64_t value) : key_(key), value_(value), next(nullptr), prev(nullptr) {}
-        TKey key_;
-        int64_t value_;
-    };
+    size_t getNumberOfEvictions() const { return _nEvictions; }
 
+private:
     const size_t _capacity;
-    algorithms::internal::HashTable<cpu, TKey, LRUNode *> _hashmap;
-    LRUNode * _head;
-    LRUNode * _tail;
+    size_t _hand;
     size_t _count;
-    int64_t _freeIndexCache;
-
-private:
-    void enqueue(LRUNode * node);
-    int64_t dequeue();
+    size_t _epoch;
+    size_t _nEvictions;
+    TArray<int32_t, cpu> _slotByKey;
+    TArray<uint32_t, cpu> _keyBySlot;
+    TArray<size_t, cpu> _lastUse;
+    TArray<char, cpu> _referenced;
 };
 
 template <typename algorithmFPType, CpuType cpu>
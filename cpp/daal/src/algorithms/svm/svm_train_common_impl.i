@@ -148,104 +148,61 @@ void HelperTrainSVM<algorithmFPType, cpu>::WSSjLocal(const size_t jStart, const
     WSSjLocalBaseline(jStart, jEnd, KiBlock, kernelDiag, grad, I, GMin, Kii, tau, Bj, GMax, GMax2, delta, signNuType);
 }
 
-template <CpuType cpu, typename TKey>
-void LRUCache<cpu, TKey>::put(const TKey key)
+template <CpuType cpu>
+services::Status ClockCache<cpu>::init(const size_t nKeys)
 {
-    LRUNode * node = nullptr;
-    if (_hashmap.find(key, node))
-    {
-        enqueue(node);
-    }
-    else
-    {
-        node = LRUNode::create(key, _freeIndexCache + 1);
-        if (!node) return;
-        enqueue(node);
-        if (_count == _capacity)
-        {
-            const int64_t freeIndex = dequeue();
-            node->setValue(freeIndex);
-            _freeIndexCache = freeIndex;
-        }
-        else
-        {
-            ++_freeIndexCache;
-        }
-        _hashmap.insert(key, node);
-        ++_count;
-    }
-}
-
-template <CpuType cpu, typename TKey>
-int64_t LRUCache<cpu, TKey>::get(const TKey key)
-{
-    LRUNode * node = nullptr;
-    if (_hashmap.find(key, node))
-    {
-        enqueue(node);
-        return node->getValue();
-    }
-    else
-    {
-        return -1;
-    }
-}
+    _slotByKey.reset(nKeys);
+    _keyBySlot.reset(_capacity);
+    _lastUse.reset(_capacity);
+    _referenced.reset(_capacity);
+    DAAL_CHECK_MALLOC(_slotByKey.get() && _keyBySlot.get() && _lastUse.get() && _referenced.get());
 
-template <CpuType cpu, typename TKey>
-void LRUCache<cpu, TKey>::enqueue(LRUNode * node)
-{
-    if (!_head)
-    {
-        _head = node;
-        _tail = node;
-    }
-    else if (node != _head)
-    {
-        if (node == _tail)
-        {
-            _tail = node->prev;
-        }
-        LRUNode * prev = node->prev;
-        if (prev)
-        {
-            prev->next = node->next;
-        }
-        if (node->next)
-        {
-            node->next->prev = prev;
-        }
-        _head->prev = node;
-        node->next  = _head;
-        _head       = node;
-        _head->prev = nullptr;
-        _tail->next = nullptr;
-    }
+    service_memset_seq<int32_t, cpu>(_slotByKey.get(), int32_t(-1), nKeys);
+    service_memset_seq<size_t, cpu>(_lastUse.get(), size_t(0), _capacity);
+    service_memset_seq<char, cpu>(_referenced.get(), char(0), _capacity);
+    _hand       = 0;
+    _count      = 0;
+    _epoch      = 1;
+    _nEvictions = 0;
+    return services::Status();
 }
 
-template <CpuType cpu, typename TKey>
-int64_t LRUCache<cpu, TKey>::dequeue()
+template <CpuType cpu>
+int64_t ClockCache<cpu>::put(const uint32_t key)
 {
-    int64_t value = -1;
-    if (_head == _tail)
+    size_t slot = _count;
+    if (_count < _capacity)
     {
-        delete _head;
-        _head = nullptr;
-        _tail = nullptr;
+        ++_count;
     }
     else
     {
-        _hashmap.erase(_tail->getKey());
-        value          = _tail->getValue();
-        LRUNode * prev = _tail->prev;
-        if (_tail->prev)
+        /* Two full turns of the hand clear all the reference flags, so a slot unused in the current epoch is found if it exists */
+        size_t nSteps = 0;
+        for (; nSteps < 2 * _capacity; ++nSteps)
         {
-            _tail->prev->next = nullptr;
+            const size_t curr = _hand;
+            _hand             = (_hand + 1 == _capacity) ? 0 : _hand + 1;
+            if (_lastUse[curr] == _epoch) continue;
+            if (_referenced[curr])
+            {
+                _referenced[curr] = 0;
+                continue;
+            }
+            slot = curr;
+            break;
         }
-        delete _tail;
-        _tail = prev;
-        --_count;
+        if (nSteps == 2 * _capacity) return -1;
+
+        _slotByKey[_keyBySlot[slot]] = -1;
+        ++_nEvictions;
     }
-    return value;
+
+    _slotByKey[key]   = static_cast<int32_t>(slot);
+    _keyBySlot[slot]  = key;
+    _referenced[slot] = 1;
+    _lastUse[slot]    = _epoch;
+    return static_cast<int64_t>(slot);
 }
 
 template <typename algorithmFPType, CpuType cpu>
@@ -22,6 +22,7 @@
 */
 
 #include "algorithms/svm/svm_train_types.h"
+#include "data_management/data/homogen_numeric_table.h"
 
 namespace daal
 {
@@ -47,6 +48,12 @@ DAAL_EXPORT services::Status Result::allocate(const daal::algorithms::Input * in
     services::Status st;
     set(classifier::training::model, svm::Model::create<algorithmFPType>(algInput->get(classifier::training::data)->getNumberOfColumns(),
                                                                          algInput->get(classifier::training::data)->getDataLayout(), &st));
+
+    const interface3::Parameter * const par = dynamic_cast<const interface3::Parameter *>(parameter);
+    if (st && par && (par->resultsToCompute & computeCacheStatistics))
+    {
+        set(cacheStatistics, data_management::HomogenNumericTable<size_t>::create(3, 1, data_management::NumericTable::doAllocate, size_t(0), &st));
+    }
     return st;
 }
 
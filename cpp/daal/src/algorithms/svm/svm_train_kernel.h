@@ -51,11 +51,16 @@ enum class SvmType
     nu_regression
 };
 
-struct KernelParameter : svm::Parameter
+struct SVMCacheStatistics;
+
+struct KernelParameter : training::Parameter
 {
     double epsilon  = 0.1;
     double nu       = 0.5;
     SvmType svmType = SvmType::classification;
+    /* If not null, the thunder method adds the statistics of its working set kernel caches to this structure.
+     * The statistics help to choose cacheSize */
+    SVMCacheStatistics * cacheStatistics = nullptr;
 };
 
 template <Method method, typename algorithmFPType, CpuType cpu>
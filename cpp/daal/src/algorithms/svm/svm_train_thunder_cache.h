@@ -30,6 +30,7 @@
 #include "src/data_management/service_numeric_table.h"
 #include "src/algorithms/svm/svm_train_cache.h"
 #include "src/externals/service_service.h"
+#include "src/threading/threading.h"
 #include "data_management/data/soa_numeric_table.h"
 
 namespace daal
@@ -61,6 +62,8 @@ public:
 
     virtual services::Status resize(const size_t nSize) = 0;
 
+    virtual SVMCacheStatistics getStatistics() const = 0;
+
 protected:
     SVMCacheIface(const size_t cacheSize, const size_t lineSize, const kernel_function::KernelIfacePtr & kernel)
         : _lineSize(lineSize), _cacheSize(cacheSize), _kernel(kernel)
@@ -72,7 +75,8 @@ protected:
 };
 
 /**
- * LRU cache: kernel function values are cached
+ * LRU cache: kernel function values are cached.
+ * Cache lines are slots of a single preallocated buffer, rows are excluded with the clock policy
  */
 template <typename algorithmFPType, CpuType cpu>
 class SVMCache<thunder, lruCache, algorithmFPType, cpu> : public SVMCacheIface<thunder, algorithmFPType, cpu>
@@ -116,6 +120,7 @@ public:
         _cache.reset();
         _cacheData.reset();
         _soaData.reset();
+        _slots.reset();
         return services::Status();
     }
 
@@ -127,34 +132,58 @@ public:
         if (_soaData.size() < n)
         {
             _soaData.reset(n);
-            DAAL_CHECK_MALLOC(_soaData.get());
+            _slots.reset(n);
+            DAAL_CHECK_MALLOC(_soaData.get() && _slots.get());
         }
 
-        size_t nIndicesForKernel = 0;
+        _clockCache.nextEpoch();
+
+        /* Lookups do not change the state of the cache, so they are done without synchronization */
+        const size_t blockSize = 1024;
+        const size_t nBlocks   = n / blockSize + !!(n % blockSize);
+        daal::conditional_threader_for(nBlocks > 4, nBlocks, [&](const size_t iBlock) {
+            const size_t iStart = iBlock * blockSize;
+            const size_t iEnd   = services::internal::min<cpu, size_t>(n, iStart + blockSize);
+            for (size_t i = iStart; i < iEnd; ++i)
+            {
+                _slots[i] = _clockCache.find(indices[i] % nVectors);
+            }
+        });
 
-        for (int i = 0; i < n; ++i)
+        /* The same row can be requested several times, so the found slots are marked as used sequentially.
+         * All of them are marked before any insertion, so none of them is evicted by the rows of this request */
+        for (size_t i = 0; i < n; ++i)
         {
-            const uint32_t dataIndex = indices[i] % nVectors;
-            int64_t cacheIndex       = _lruCache.get(dataIndex);
+            const int64_t cacheIndex = _slots[i];
             if (cacheIndex != -1)
             {
-                // If index in cache
-                DAAL_ASSERT(cacheIndex < _cacheSize)
-                algorithmFPType * const cachei = _cache[cacheIndex];
-                _soaData[i]                    = cachei;
+                _clockCache.touch(cacheIndex);
             }
-            else
+            _soaData[i] = (cacheIndex != -1) ? _cache[cacheIndex] : nullptr;
+        }
+
+        size_t nIndicesForKernel = 0;
+        for (size_t i = 0; i < n; ++i)
+        {
+            if (_soaData[i]) continue;
+
+            const uint32_t dataIndex = indices[i] % nVectors;
+            // The row can be inserted by the previous index of the block
+            int64_t cacheIndex = _clockCache.get(dataIndex);
+            if (cacheIndex == -1)
             {
-                _lruCache.put(dataIndex);
-                cacheIndex = _lruCache.getFreeIndex();
-                DAAL_ASSERT(cacheIndex < _cacheSize)
-                algorithmFPType * const cachei          = _cache[cacheIndex];
-                _soaData[i]                             = cachei;
+                cacheIndex = _clockCache.put(dataIndex);
+                DAAL_CHECK(cacheIndex != -1, services::ErrorIncorrectInternalFunctionParameter);
                 _kernelIndex[nIndicesForKernel]         = cacheIndex;
                 _kernelOriginalIndex[nIndicesForKernel] = dataIndex;
                 ++nIndicesForKernel;
             }
+            DAAL_ASSERT(cacheIndex < _cacheSize)
+            _soaData[i] = _cache[cacheIndex];
         }
+        _nHits += n - nIndicesForKernel;
+        _nMisses += nIndicesForKernel;
+
         if (nIndicesForKernel != 0)
         {
             DAAL_CHECK_STATUS(status, computeKernel(nIndicesForKernel, _kernelOriginalIndex.get()));
@@ -164,6 +193,15 @@ public:
         return status;
     }
 
+    SVMCacheStatistics getStatistics() const override
+    {
+        SVMCacheStatistics statistics;
+        statistics.nHits      = _nHits;
+        statistics.nMisses    = _nMisses;
+        statistics.nEvictions = _clockCache.getNumberOfEvictions();
+        return statistics;
+    }
+
     services::Status resize(const size_t nSize) override
     {
         DAAL_ITTNOTIFY_SCOPED_TASK(cache.resize);
@@ -176,7 +214,7 @@ public:
 
 protected:
     SVMCache(const size_t cacheSize, const size_t lineSize, const NumericTablePtr & xTable, const kernel_function::KernelIfacePtr & kernel)
-        : super(cacheSize, lineSize, kernel), _lruCache(cacheSize), _xTable(xTable)
+        : super(cacheSize, lineSize, kernel), _clockCache(cacheSize), _xTable(xTable), _nHits(0), _nMisses(0)
     {}
 
     services::Status computeKernel(const size_t nWorkElements, const uint32_t * indices)
@@ -200,9 +238,8 @@ protected:
         _kernel->getInput()->set(kernel_function::X, _xTable);
         _kernel->getInput()->set(kernel_function::Y, _blockTask->getTableData());
 
-        kernel_function::ResultPtr shRes(new kernel_function::Result());
-        shRes->set(kernel_function::values, kernelComputeTable);
-        _kernel->setResult(shRes);
+        _kernelResult->set(kernel_function::values, kernelComputeTable);
+        _kernel->setResult(_kernelResult);
         DAAL_CHECK_STATUS(status, _kernel->computeNoThrow());
 
         return status;
@@ -279,18 +316,25 @@ protected:
         status |= initKernelIndex(nSize);
         status |= initCache();
         status |= initBlockTask(nSize);
+        status |= _clockCache.init(_xTable->getNumberOfRows());
+        _kernelResult.reset(new kernel_function::Result());
+        DAAL_CHECK_MALLOC(_kernelResult.get());
         return status;
     }
 
 protected:
-    LRUCache<cpu, uint32_t> _lruCache;
+    ClockCache<cpu> _clockCache;
     const NumericTablePtr & _xTable;
+    kernel_function::ResultPtr _kernelResult;
+    size_t _nHits;
+    size_t _nMisses;
     SubDataTaskBasePtr<algorithmFPType, cpu> _blockTask;
     TArray<uint32_t, cpu> _kernelOriginalIndex;
     TArray<uint32_t, cpu> _kernelIndex;
     TArrayScalable<algorithmFPType *, cpu> _cache;
     TArrayScalable<algorithmFPType, cpu> _cacheData;
     TArrayScalable<algorithmFPType *, cpu> _soaData;
+    TArrayScalable<int64_t, cpu> _slots;
 };
 
 } // namespace internal
@@ -78,15 +78,13 @@ services::Status SVMTrainImpl<thunder, algorithmFPType, cpu>::compute(const Nume
 
     services::Status status;
 
-    const algorithmFPType C                 = svmPar.C;
-    const algorithmFPType accuracyThreshold = svmPar.accuracyThreshold;
-    const algorithmFPType tau               = svmPar.tau;
-    const algorithmFPType epsilon           = svmPar.epsilon;
-    const algorithmFPType nu                = svmPar.nu;
-    const size_t maxIterations              = svmPar.maxIterations;
-    const size_t cacheSize                  = svmPar.cacheSize;
-    const auto kernel                       = svmPar.kernel->clone();
-    const auto svmType                      = svmPar.svmType;
+    const algorithmFPType C       = svmPar.C;
+    const algorithmFPType epsilon = svmPar.epsilon;
+    const algorithmFPType nu      = svmPar.nu;
+    const size_t maxIterations    = svmPar.maxIterations;
+    const size_t cacheSize        = svmPar.cacheSize;
+    const auto kernel             = svmPar.kernel->clone();
+    const auto svmType            = svmPar.svmType;
 
     const size_t nVectors = xTable->getNumberOfRows();
     DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nVectors, 2);
@@ -121,6 +119,54 @@ services::Status SVMTrainImpl<thunder, algorithmFPType, cpu>::compute(const Nume
     DAAL_CHECK_STATUS(status, workSet.init());
     const size_t nWS = workSet.getSize();
 
+    size_t defaultCacheSize = services::internal::min<cpu, size_t>(nVectors, cacheSize / nVectors / sizeof(algorithmFPType));
+    defaultCacheSize        = services::internal::max<cpu, size_t>(nWS, defaultCacheSize);
+    auto cachePtr           = SVMCache<thunder, lruCache, algorithmFPType, cpu>::create(defaultCacheSize, nWS, nVectors, xTable, kernel, status);
+    DAAL_CHECK_STATUS_VAR(status);
+
+    if (svmType == SvmType::nu_classification || svmType == SvmType::nu_regression)
+    {
+        DAAL_CHECK_STATUS(status, initGrad(xTable, kernel, nVectors, nTrainVectors, y, alpha, grad));
+    }
+
+    /* With shrinking, every thunderShrinkingStep iterations the problem is reduced to the vectors that can still be changed.
+     * The reduced problem is solved, then the gradient is reconstructed and the optimality is checked on all the vectors. */
+    const size_t nIterationsPerStep = svmPar.doThunderShrinking ? svmPar.thunderShrinkingStep : maxIterations;
+
+    size_t iter      = 0;
+    bool isConverged = false;
+    while (!isConverged && iter < maxIterations)
+    {
+        const size_t nIterations = services::internal::min<cpu, size_t>(nIterationsPerStep, maxIterations - iter);
+        DAAL_CHECK_STATUS(status, solve(xTable, cachePtr.get(), workSet, y, grad, alpha, cw, nVectors, nTrainVectors, svmPar, nIterations, iter,
+                                        isConverged));
+        if (!isConverged && iter < maxIterations)
+        {
+            DAAL_CHECK_STATUS(status, solveShrunk(xTable, kernel, y, grad, alpha, cw, nVectors, nTrainVectors, svmPar, iter));
+        }
+    }
+
+    if (svmPar.cacheStatistics)
+    {
+        *svmPar.cacheStatistics += cachePtr->getStatistics();
+    }
+    cachePtr->clear();
+    SaveResultTask<algorithmFPType, cpu> saveResult(nVectors, y, alpha, grad, svmType, cachePtr.get());
+    DAAL_CHECK_STATUS(status, saveResult.compute(xTable, *static_cast<Model *>(r), cw));
+
+    return status;
+}
+
+template <typename algorithmFPType, CpuType cpu>
+services::Status SVMTrainImpl<thunder, algorithmFPType, cpu>::solve(
+    const NumericTablePtr & xTable, SVMCacheIface<thunder, algorithmFPType, cpu> * cache, TaskWorkingSet<algorithmFPType, cpu> & workSet,
+    const algorithmFPType * y, algorithmFPType * grad, algorithmFPType * alpha, const algorithmFPType * cw, const size_t nVectors,
+    const size_t nTrainVectors, const KernelParameter & svmPar, const size_t nIterations, size_t & iter, bool & isConverged)
+{
+    services::Status status;
+
+    const size_t nWS = workSet.getSize();
+
     algorithmFPType diff     = algorithmFPType(0);
     algorithmFPType diffPrev = algorithmFPType(0);
     size_t sameLocalDiff     = 0;
@@ -134,23 +180,17 @@ services::Status SVMTrainImpl<thunder, algorithmFPType, cpu>::compute(const Nume
     TArray<char, cpu> I(nWS);
     DAAL_CHECK_MALLOC(I.get());
 
-    size_t defaultCacheSize = services::internal::min<cpu, size_t>(nVectors, cacheSize / nVectors / sizeof(algorithmFPType));
-    defaultCacheSize        = services::internal::max<cpu, size_t>(nWS, defaultCacheSize);
-    auto cachePtr           = SVMCache<thunder, lruCache, algorithmFPType, cpu>::create(defaultCacheSize, nWS, nVectors, xTable, kernel, status);
-    DAAL_CHECK_STATUS_VAR(status);
-
-    if (svmType == SvmType::nu_classification || svmType == SvmType::nu_regression)
-    {
-        DAAL_CHECK_STATUS(status, initGrad(xTable, kernel, nVectors, nTrainVectors, y, alpha, grad));
-    }
-
-    size_t iter = 0;
-    for (; iter < maxIterations; ++iter)
+    isConverged = false;
+    for (size_t i = 0; i < nIterations; ++i)
     {
-        if (iter != 0)
+        if (i != 0)
         {
             DAAL_CHECK_STATUS(status, workSet.copyLastToFirst());
         }
+        else
+        {
+            workSet.resetSelection();
+        }
 
         DAAL_CHECK_STATUS(status, workSet.select(y, alpha, grad, cw));
         const uint32_t * const wsIndices = workSet.getIndices();
@@ -158,24 +198,147 @@ services::Status SVMTrainImpl<thunder, algorithmFPType, cpu>::compute(const Nume
         {
             DAAL_ITTNOTIFY_SCOPED_TASK(getRowsBlock);
 
-            DAAL_CHECK_STATUS(status, cachePtr->getRowsBlock(wsIndices, nWS, kernelSOARes));
+            DAAL_CHECK_STATUS(status, cache->getRowsBlock(wsIndices, nWS, kernelSOARes));
         }
 
-        DAAL_CHECK_STATUS(status, SMOBlockSolver(y, grad, wsIndices, kernelSOARes, nVectors, nWS, cw, accuracyThreshold, tau, buffer.get(), I.get(),
-                                                 alpha, deltaAlpha.get(), diff, svmType));
+        DAAL_CHECK_STATUS(status, SMOBlockSolver(y, grad, wsIndices, kernelSOARes, nVectors, nWS, cw, svmPar.accuracyThreshold, svmPar.tau,
+                                                 buffer.get(), I.get(), alpha, deltaAlpha.get(), diff, svmPar.svmType));
 
         DAAL_CHECK_STATUS(status, updateGrad(kernelSOARes, deltaAlpha.get(), grad, nVectors, nTrainVectors, nWS));
-        if (checkStopCondition(diff, diffPrev, accuracyThreshold, sameLocalDiff) && iter >= nNoChanges) break;
+        ++iter;
+        if (checkStopCondition(diff, diffPrev, svmPar.accuracyThreshold, sameLocalDiff) && iter > nNoChanges)
+        {
+            isConverged = true;
+            break;
+        }
         diffPrev = diff;
     }
 
-    cachePtr->clear();
-    SaveResultTask<algorithmFPType, cpu> saveResult(nVectors, y, alpha, grad, svmType, cachePtr.get());
-    DAAL_CHECK_STATUS(status, saveResult.compute(xTable, *static_cast<Model *>(r), cw));
-
     return status;
 }
 
+template <typename algorithmFPType, CpuType cpu>
+services::Status SVMTrainImpl<thunder, algorithmFPType, cpu>::solveShrunk(const NumericTablePtr & xTable,
+                                                                          const kernel_function::KernelIfacePtr & kernel, const algorithmFPType * y,
+                                                                          algorithmFPType * grad, algorithmFPType * alpha, const algorithmFPType * cw,
+                                                                          const size_t nVectors, const size_t nTrainVectors,
+                                                                          const KernelParameter & svmPar, size_t & iter)
+{
+    DAAL_ITTNOTIFY_SCOPED_TASK(solveShrunk);
+
+    services::Status status;
+
+    const SvmType svmType   = svmPar.svmType;
+    const bool isNu         = (svmType == SvmType::nu_classification || svmType == SvmType::nu_regression);
+    const bool isRegression = (nTrainVectors != nVectors);
+
+    /* Bounds of the gradient over the up and low sets, separately for positive and negative labels in case of nu-SVM */
+    algorithmFPType GMin[2]  = { MaxVal<algorithmFPType>::get(), MaxVal<algorithmFPType>::get() };
+    algorithmFPType GMax2[2] = { -MaxVal<algorithmFPType>::get(), -MaxVal<algorithmFPType>::get() };
+    for (size_t i = 0; i < nTrainVectors; ++i)
+    {
+        const size_t sign = (isNu && y[i] > 0) ? 1 : 0;
+        if (HelperTrainSVM<algorithmFPType, cpu>::isUpper(y[i], alpha[i], cw[i]) && grad[i] < GMin[sign]) GMin[sign] = grad[i];
+        if (HelperTrainSVM<algorithmFPType, cpu>::isLower(y[i], alpha[i], cw[i]) && grad[i] > GMax2[sign]) GMax2[sign] = grad[i];
+    }
+
+    /* The vector is shrunk if it is bounded and cannot be a part of a violating pair */
+    auto isActive = [&](const size_t i) -> bool {
+        const size_t sign  = (isNu && y[i] > 0) ? 1 : 0;
+        const bool isUpper = HelperTrainSVM<algorithmFPType, cpu>::isUpper(y[i], alpha[i], cw[i]);
+        const bool isLower = HelperTrainSVM<algorithmFPType, cpu>::isLower(y[i], alpha[i], cw[i]);
+        return (isUpper && isLower) || (isUpper && grad[i] <= GMax2[sign]) || (isLower && grad[i] >= GMin[sign]);
+    };
+
+    TArray<uint32_t, cpu> activeRowsTArray(nVectors);
+    DAAL_CHECK_MALLOC(activeRowsTArray.get());
+    uint32_t * const activeRows = activeRowsTArray.get();
+
+    size_t nActiveRows = 0;
+    for (size_t i = 0; i < nVectors; ++i)
+    {
+        if (isActive(i) || (isRegression && isActive(i + nVectors)))
+        {
+            activeRows[nActiveRows++] = static_cast<uint32_t>(i);
+        }
+    }
+
+    /* The reduced problem has its own kernel cache, so shrinking pays off only if a noticeable part of the vectors is shrunk */
+    if (nActiveRows < 2 || nActiveRows * 4 > nVectors * 3)
+    {
+        return status;
+    }
+
+    SubDataTaskBase<algorithmFPType, cpu> * task = nullptr;
+    if (xTable->getDataLayout() == NumericTableIface::csrArray)
+    {
+        task = SubDataTaskCSR<algorithmFPType, cpu>::create(xTable, nActiveRows);
+    }
+    else
+    {
+        task = SubDataTaskDense<algorithmFPType, cpu>::create(xTable->getNumberOfColumns(), nActiveRows);
+    }
+    DAAL_CHECK_MALLOC(task);
+    SubDataTaskBasePtr<algorithmFPType, cpu> activeTask(task);
+    DAAL_CHECK_STATUS(status, activeTask->copyDataByIndices(activeRows, nActiveRows, xTable));
+    const NumericTablePtr xActiveTable = activeTask->getTableData();
+
+    const size_t nActiveTrainVectors = isRegression ? nActiveRows * 2 : nActiveRows;
+    TArray<algorithmFPType, cpu> activeBuffer(nActiveTrainVectors * 5);
+    DAAL_CHECK_MALLOC(activeBuffer.get());
+    algorithmFPType * const yActive        = activeBuffer.get();
+    algorithmFPType * const gradActive     = yActive + nActiveTrainVectors;
+    algorithmFPType * const alphaActive    = gradActive + nActiveTrainVectors;
+    algorithmFPType * const cwActive       = alphaActive + nActiveTrainVectors;
+    algorithmFPType * const alphaActiveOld = cwActive + nActiveTrainVectors;
+
+    size_t nNonZeroWeights = 0;
+    for (size_t k = 0; k < nActiveTrainVectors; ++k)
+    {
+        const size_t i    = (k < nActiveRows) ? activeRows[k] : activeRows[k - nActiveRows] + nVectors;
+        yActive[k]        = y[i];
+        gradActive[k]     = grad[i];
+        alphaActive[k]    = alpha[i];
+        alphaActiveOld[k] = alpha[i];
+        cwActive[k]       = cw[i];
+        nNonZeroWeights += static_cast<size_t>(cw[i] != algorithmFPType(0));
+    }
+
+    {
+        TaskWorkingSet<algorithmFPType, cpu> workSet(nNonZeroWeights, nActiveTrainVectors, maxBlockSize, svmType);
+        DAAL_CHECK_STATUS(status, workSet.init());
+        const size_t nWS = workSet.getSize();
+
+        size_t cacheSize = services::internal::min<cpu, size_t>(nActiveRows, svmPar.cacheSize / nActiveRows / sizeof(algorithmFPType));
+        cacheSize        = services::internal::max<cpu, size_t>(nWS, cacheSize);
+        auto cachePtr    = SVMCache<thunder, lruCache, algorithmFPType, cpu>::create(cacheSize, nWS, nActiveRows, xActiveTable, kernel, status);
+        DAAL_CHECK_STATUS_VAR(status);
+
+        bool isConverged = false;
+        DAAL_CHECK_STATUS(status, solve(xActiveTable, cachePtr.get(), workSet, yActive, gradActive, alphaActive, cwActive, nActiveRows,
+                                        nActiveTrainVectors, svmPar, svmPar.maxIterations - iter, iter, isConverged));
+        if (svmPar.cacheStatistics)
+        {
+            *svmPar.cacheStatistics += cachePtr->getStatistics();
+        }
+    }
+
+    /* Gradient reconstruction: the contributions of the changed coefficients are added to the gradient before shrinking */
+    TArray<algorithmFPType, cpu> deltaAlphaTArray(nTrainVectors);
+    DAAL_CHECK_MALLOC(deltaAlphaTArray.get());
+    algorithmFPType * const deltaAlpha = deltaAlphaTArray.get();
+    service_memset_seq<algorithmFPType, cpu>(deltaAlpha, algorithmFPType(0), nTrainVectors);
+
+    for (size_t k = 0; k < nActiveTrainVectors; ++k)
+    {
+        const size_t i = (k < nActiveRows) ? activeRows[k] : activeRows[k - nActiveRows] + nVectors;
+        deltaAlpha[i]  = alphaActive[k] - alphaActiveOld[k];
+        alpha[i]       = alphaActive[k];
+    }
+
+    return initGrad(xTable, kernel, nVectors, nTrainVectors, y, deltaAlpha, grad);
+}
+
 template <typename algorithmFPType, CpuType cpu>
 services::Status SVMTrainImpl<thunder, algorithmFPType, cpu>::classificationInit(NumericTable & yTable, const NumericTablePtr & wTable,
                                                                                  const algorithmFPType c, const algorithmFPType nu,
@@ -582,8 +745,9 @@ bool SVMTrainImpl<thunder, algorithmFPType, cpu>::checkStopCondition(const algor
 
 template <typename algorithmFPType, CpuType cpu>
 services::Status SVMTrainImpl<thunder, algorithmFPType, cpu>::initGrad(const NumericTablePtr & xTable, const kernel_function::KernelIfacePtr & kernel,
-                                                                       const size_t nVectors, const size_t nTrainVectors, algorithmFPType * const y,
-                                                                       algorithmFPType * const alpha, algorithmFPType * grad)
+                                                                       const size_t nVectors, const size_t nTrainVectors,
+                                                                       const algorithmFPType * const y, const algorithmFPType * const alpha,
+                                                                       algorithmFPType * grad)
 {
     services::Status status;
 
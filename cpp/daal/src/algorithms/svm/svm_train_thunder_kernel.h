@@ -32,6 +32,8 @@
 #include "src/data_management/service_micro_table.h"
 
 #include "src/algorithms/svm/svm_train_kernel.h"
+#include "src/algorithms/svm/svm_train_thunder_workset.h"
+#include "src/algorithms/svm/svm_train_thunder_cache.h"
 
 namespace daal
 {
@@ -58,6 +60,15 @@ private:
                                     const algorithmFPType epsilon, algorithmFPType * y, algorithmFPType * grad, algorithmFPType * alpha,
                                     algorithmFPType * cw, size_t & nNonZeroWeights, const SvmType svmType);
 
+    services::Status solve(const NumericTablePtr & xTable, SVMCacheIface<thunder, algorithmFPType, cpu> * cache,
+                           TaskWorkingSet<algorithmFPType, cpu> & workSet, const algorithmFPType * y, algorithmFPType * grad, algorithmFPType * alpha,
+                           const algorithmFPType * cw, const size_t nVectors, const size_t nTrainVectors, const KernelParameter & svmPar,
+                           const size_t nIterations, size_t & iter, bool & isConverged);
+
+    services::Status solveShrunk(const NumericTablePtr & xTable, const kernel_function::KernelIfacePtr & kernel, const algorithmFPType * y,
+                                 algorithmFPType * grad, algorithmFPType * alpha, const algorithmFPType * cw, const size_t nVectors,
+                                 const size_t nTrainVectors, const KernelParameter & svmPar, size_t & iter);
+
     services::Status SMOBlockSolver(const algorithmFPType * y, const algorithmFPType * grad, const uint32_t * wsIndices, algorithmFPType ** kernelWS,
                                     const size_t nVectors, const size_t nWS, const algorithmFPType * cw, const double eps, const double tau,
                                     algorithmFPType * buffer, char * I, algorithmFPType * alpha, algorithmFPType * deltaAlpha,
@@ -69,7 +80,8 @@ private:
     bool checkStopCondition(const algorithmFPType diff, const algorithmFPType diffPrev, const algorithmFPType eps, size_t & sameLocalDiff);
 
     services::Status initGrad(const NumericTablePtr & xTable, const kernel_function::KernelIfacePtr & kernel, const size_t nVectors,
-                              const size_t nTrainVectors, algorithmFPType * const y, algorithmFPType * const alpha, algorithmFPType * grad);
+                              const size_t nTrainVectors, const algorithmFPType * const y, const algorithmFPType * const alpha,
+                              algorithmFPType * grad);
 
     // One of the conditions for stopping is diff stays unchanged. nNoChanges - number of repetitions
     static const size_t nNoChanges = 5;
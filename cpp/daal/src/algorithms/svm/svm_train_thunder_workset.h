@@ -97,6 +97,12 @@ struct TaskWorkingSet
         return status;
     }
 
+    void resetSelection()
+    {
+        _nSelected = 0;
+        services::internal::service_memset_seq<bool, cpu>(_indicator.get(), false, _nVectors);
+    }
+
     services::Status select(const algorithmFPType * y, const algorithmFPType * alpha, const algorithmFPType * f, const algorithmFPType * cw)
     {
         DAAL_ITTNOTIFY_SCOPED_TASK(select);
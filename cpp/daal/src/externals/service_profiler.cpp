@@ -16,23 +16,467 @@
 *******************************************************************************/
 
 #include "src/externals/service_profiler.h"
+#include "services/collection.h"
+#include "services/daal_atomic_int.h"
+#include "src/algorithms/service_threading.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(_WIN32)
+    #include <windows.h>
+#else
+    #include <time.h>
+#endif
 
 namespace daal
 {
 namespace internal
 {
+namespace profiler
+{
+const size_t noNode = static_cast<size_t>(-1);
+
+/* Tree of the tasks stored in an array. Children of a node are kept in a singly linked list,
+   the node 0 is the root that corresponds to no task. */
+template <typename Node>
+class TaskTree
+{
+public:
+    TaskTree() { addNode("", noNode); }
+
+    size_t findOrAddChild(size_t parent, const char * name)
+    {
+        size_t last = noNode;
+        for (size_t child = _nodes[parent].firstChild; child != noNode; child = _nodes[child].nextSibling)
+        {
+            /* Task names are string literals, so the pointers usually match */
+            if (_nodes[child].name == name || strcmp(_nodes[child].name, name) == 0) return child;
+            last = child;
+        }
+
+        const size_t added = addNode(name, parent);
+        if (last == noNode)
+        {
+            _nodes[parent].firstChild = added;
+        }
+        else
+        {
+            _nodes[last].nextSibling = added;
+        }
+        return added;
+    }
+
+    size_t size() const { return _nodes.size(); }
+    Node & operator[](size_t i) { return _nodes[i]; }
+    const Node & operator[](size_t i) const { return _nodes[i]; }
+
+private:
+    size_t addNode(const char * name, size_t parent)
+    {
+        Node node;
+        node.name        = name;
+        node.parent      = parent;
+        node.firstChild  = noNode;
+        node.nextSibling = noNode;
+        _nodes.push_back(node);
+        return _nodes.size() - 1;
+    }
+
+    services::Collection<Node> _nodes;
+};
+
+struct TaskNode
+{
+    TaskNode() : name(""), parent(noNode), firstChild(noNode), nextSibling(noNode), callCount(0), totalTimeNs(0) {}
+
+    const char * name;
+    size_t parent;
+    size_t firstChild;
+    size_t nextSibling;
+    long long callCount;
+    long long totalTimeNs;
+};
+
+struct TaskFrame
+{
+    size_t node;
+    long long startTimeNs;
+};
+
+/* Statistics collected by a single thread. It is written only by the owning thread,
+   so no synchronization is required on the hot path. */
+struct ThreadProfile
+{
+    DAAL_NEW_DELETE();
+
+    explicit ThreadProfile(size_t threadNumber) : threadNumber(threadNumber) {}
+
+    size_t threadNumber;
+    TaskTree<TaskNode> nodes;
+    services::Collection<TaskFrame> stack;
+};
+
+struct ThreadStatistics
+{
+    ThreadStatistics() : threadNumber(0), callCount(0), totalTimeNs(0), selfTimeNs(0) {}
+
+    size_t threadNumber;
+    long long callCount;
+    long long totalTimeNs;
+    long long selfTimeNs;
+};
+
+/* Statistics of a task merged from all threads by its full path in the call tree */
+struct TaskStatistics
+{
+    TaskStatistics() : name(""), parent(noNode), firstChild(noNode), nextSibling(noNode), depth(0) {}
+
+    const char * name;
+    size_t parent;
+    size_t firstChild;
+    size_t nextSibling;
+    size_t depth;
+    ThreadStatistics total;
+    services::Collection<ThreadStatistics> threads;
+};
+
+inline long long getTimeNs()
+{
+#if defined(_WIN32)
+    LARGE_INTEGER counter, frequency;
+    QueryPerformanceCounter(&counter);
+    QueryPerformanceFrequency(&frequency);
+    return static_cast<long long>(static_cast<double>(counter.QuadPart) * 1e9 / static_cast<double>(frequency.QuadPart));
+#else
+    timespec time;
+    clock_gettime(CLOCK_MONOTONIC, &time);
+    return static_cast<long long>(time.tv_sec) * 1000000000LL + time.tv_nsec;
+#endif
+}
+
+class Registry
+{
+public:
+    DAAL_NEW_DELETE();
+
+    /* The registry is intentionally never destroyed: tasks may end in destructors of static
+       objects or in threads still running at exit, after the static destruction has begun */
+    static Registry & get()
+    {
+        static Registry * registry = new Registry();
+        return *registry;
+    }
+
+    bool isEnabled() const { return _isEnabled.get() != 0; }
+
+    void enable(bool isEnabled) { _isEnabled.set(isEnabled ? 1 : 0); }
+
+    ThreadProfile & getThreadProfile() { return *_profiles->local(); }
+
+    void startTask(const char * taskName)
+    {
+        ThreadProfile & profile = getThreadProfile();
+        const size_t parent     = profile.stack.size() ? profile.stack[profile.stack.size() - 1].node : 0;
+        const TaskFrame frame   = { profile.nodes.findOrAddChild(parent, taskName), getTimeNs() };
+        profile.stack.push_back(frame);
+    }
+
+    void endTask(const char * taskName)
+    {
+        ThreadProfile & profile = getThreadProfile();
+
+        /* Finds the innermost running task with the given name. A task that is not running
+           on this thread is ignored, so the call tree is not corrupted by unbalanced calls. */
+        size_t frameIndex = profile.stack.size();
+        while (frameIndex > 0)
+        {
+            const char * name = profile.nodes[profile.stack[frameIndex - 1].node].name;
+            if (name == taskName || strcmp(name, taskName) == 0) break;
+            --frameIndex;
+        }
+        if (frameIndex == 0) return;
+
+        /* The nested tasks that were not ended explicitly are ended together with the task */
+        const long long endTimeNs = getTimeNs();
+        while (profile.stack.size() >= frameIndex)
+        {
+            const size_t top      = profile.stack.size() - 1;
+            const TaskFrame frame = profile.stack[top];
+            profile.stack.erase(top);
+
+            TaskNode & node = profile.nodes[frame.node];
+            node.callCount += 1;
+            node.totalTimeNs += endTimeNs - frame.startTimeNs;
+        }
+    }
+
+    /* Releases the statistics of all the threads, the threads get new profiles on their next tasks */
+    void reset()
+    {
+        AUTOLOCK(_mutex);
+        releaseProfiles();
+        _nThreads.set(0);
+        _profiles = createProfiles();
+    }
+
+    void dump(const char * fileName, Profiler::ReportFormat format)
+    {
+        TaskTree<TaskStatistics> tasks;
+        {
+            AUTOLOCK(_mutex);
+            _profiles->reduce([&](ThreadProfile * profile) { collect(*profile, 0, 0, tasks); });
+        }
+
+        FILE * file = fileName ? fopen(fileName, "w") : stderr;
+        if (!file) return;
+
+        if (format == Profiler::flame)
+        {
+            writeCollapsedStacks(file, tasks, 0);
+        }
+        else
+        {
+            fprintf(file, "{\n  \"tasks\": [");
+            bool isFirstTask = true;
+            writeJson(file, tasks, 0, isFirstTask);
+            fprintf(file, "\n  ]\n}\n");
+        }
+
+        if (fileName)
+        {
+            fclose(file);
+        }
+        else
+        {
+            fflush(file);
+        }
+    }
+
+private:
+    typedef daal::tls<ThreadProfile *> ProfilesTls;
+
+    Registry() : _isEnabled(0), _nThreads(0), _format(Profiler::json), _profiles(nullptr)
+    {
+        _profiles = createProfiles();
+
+        const char * mode = getenv("DAAL_PROFILER");
+        if (mode && mode[0] != '\0' && strcmp(mode, "0") != 0)
+        {
+            _format             = (strcmp(mode, "flame") == 0) ? Profiler::flame : Profiler::json;
+            const char * output = getenv("DAAL_PROFILER_OUTPUT");
+            for (size_t i = 0; output && output[i] != '\0'; ++i)
+            {
+                _output.push_back(output[i]);
+            }
+            _output.push_back('\0');
+            _isEnabled.set(1);
+            atexit(writeReportAtExit);
+        }
+    }
+
+    static void writeReportAtExit()
+    {
+        Registry & registry = get();
+        registry.dump(registry._output.size() > 1 ? &registry._output[0] : nullptr, registry._format);
+    }
+
+    Registry(const Registry &);
+    Registry & operator=(const Registry &);
+
+    ProfilesTls * createProfiles()
+    {
+        return new ProfilesTls([this]() -> ThreadProfile * { return new ThreadProfile(_nThreads.inc() - 1); });
+    }
+
+    void releaseProfiles()
+    {
+        _profiles->reduce([](ThreadProfile * profile) { delete profile; });
+        delete _profiles;
+        _profiles = nullptr;
+    }
+
+    /* Merges the subtree of the thread call tree into the statistics keyed by the task path */
+    static long long collect(const ThreadProfile & profile, size_t node, size_t task, TaskTree<TaskStatistics> & tasks)
+    {
+        long long childrenTimeNs = 0;
+        for (size_t child = profile.nodes[node].firstChild; child != noNode; child = profile.nodes[child].nextSibling)
+        {
+            const TaskNode & childNode          = profile.nodes[child];
+            const size_t childTask              = tasks.findOrAddChild(task, childNode.name);
+            const long long grandChildrenTimeNs = collect(profile, child, childTask, tasks);
+            childrenTimeNs += childNode.totalTimeNs;
+
+            if (childNode.callCount == 0) continue;
+
+            TaskStatistics & statistics = tasks[childTask];
+            statistics.depth            = (task == 0) ? 0 : tasks[task].depth + 1;
+
+            ThreadStatistics thread;
+            thread.threadNumber = profile.threadNumber;
+            thread.callCount    = childNode.callCount;
+            thread.totalTimeNs  = childNode.totalTimeNs;
+            thread.selfTimeNs   = childNode.totalTimeNs - grandChildrenTimeNs;
+            statistics.threads.push_back(thread);
+
+            statistics.total.callCount += thread.callCount;
+            statistics.total.totalTimeNs += thread.totalTimeNs;
+            statistics.total.selfTimeNs += thread.selfTimeNs;
+        }
+        return childrenTimeNs;
+    }
+
+    /* Writes the names of the tasks on the path from the root separated by semicolons */
+    static void writePath(FILE * file, const TaskTree<TaskStatistics> & tasks, size_t task, bool isJson)
+    {
+        if (tasks[task].parent != 0)
+        {
+            writePath(file, tasks, tasks[task].parent, isJson);
+            fputc(';', file);
+        }
+        if (isJson)
+        {
+            writeJsonChars(file, tasks[task].name);
+        }
+        else
+        {
+            fputs(tasks[task].name, file);
+        }
+    }
+
+    static void writeCollapsedStacks(FILE * file, const TaskTree<TaskStatistics> & tasks, size_t parent)
+    {
+        for (size_t task = tasks[parent].firstChild; task != noNode; task = tasks[task].nextSibling)
+        {
+            const long long selfTimeUs = tasks[task].total.selfTimeNs / 1000;
+            if (tasks[task].total.callCount > 0 && selfTimeUs > 0)
+            {
+                writePath(file, tasks, task, false);
+                fprintf(file, " %lld\n", selfTimeUs);
+            }
+            writeCollapsedStacks(file, tasks, task);
+        }
+    }
+
+    /* Writes the characters of a JSON string literal escaping quotes, backslashes and control characters */
+    static void writeJsonChars(FILE * file, const char * str)
+    {
+        for (size_t i = 0; str[i] != '\0'; ++i)
+        {
+            const unsigned char c = static_cast<unsigned char>(str[i]);
+            if (c == '"' || c == '\\')
+            {
+                fputc('\\', file);
+                fputc(c, file);
+            }
+            else if (c < 0x20)
+            {
+                fprintf(file, "\\u%04x", static_cast<unsigned>(c));
+            }
+            else
+            {
+                fputc(c, file);
+            }
+        }
+    }
+
+    static void writeJson(FILE * file, const TaskTree<TaskStatistics> & tasks, size_t parent, bool & isFirstTask)
+    {
+        for (size_t task = tasks[parent].firstChild; task != noNode; task = tasks[task].nextSibling)
+        {
+            const TaskStatistics & statistics = tasks[task];
+            if (statistics.total.callCount > 0)
+            {
+                fprintf(file, "%s\n    {\"path\": \"", isFirstTask ? "" : ",");
+                writePath(file, tasks, task, true);
+                fprintf(file, "\", \"name\": \"");
+                writeJsonChars(file, statistics.name);
+                fprintf(file, "\", \"depth\": %zu, ", statistics.depth);
+                fprintf(file, "\"calls\": %lld, \"total_ms\": %.3f, \"self_ms\": %.3f, \"threads\": [", statistics.total.callCount,
+                        statistics.total.totalTimeNs * 1e-6, statistics.total.selfTimeNs * 1e-6);
+
+                for (size_t i = 0; i < statistics.threads.size(); ++i)
+                {
+                    const ThreadStatistics & thread = statistics.threads[i];
+                    fprintf(file, "%s{\"thread\": %zu, \"calls\": %lld, \"total_ms\": %.3f, \"self_ms\": %.3f}", i == 0 ? "" : ", ",
+                            thread.threadNumber, thread.callCount, thread.totalTimeNs * 1e-6, thread.selfTimeNs * 1e-6);
+                }
+                fprintf(file, "]}");
+                isFirstTask = false;
+            }
+            writeJson(file, tasks, task, isFirstTask);
+        }
+    }
+
+    services::Atomic<int> _isEnabled;
+    services::Atomic<size_t> _nThreads;
+    Profiler::ReportFormat _format;
+    services::Collection<char> _output;
+    Mutex _mutex;
+    ProfilesTls * _profiles;
+};
+
+/* Makes the registry to be constructed at library load, so the environment
+   is read once and the report is written at exit */
+static Registry & registryInstance = Registry::get();
+
+} // namespace profiler
+
 ProfilerTask Profiler::startTask(const char * taskName)
 {
     return ProfilerTask(taskName);
 }
 
-void Profiler::endTask(const char * taskName) {}
+void Profiler::endTask(const char * taskName)
+{
+    profiler::Registry & registry = profiler::Registry::get();
+    if (!registry.isEnabled()) return;
+
+    registry.endTask(taskName);
+}
+
+void Profiler::enable(bool isEnabled)
+{
+    profiler::Registry::get().enable(isEnabled);
+}
 
-ProfilerTask::ProfilerTask(const char * taskName) : _taskName(taskName) {}
+bool Profiler::isEnabled()
+{
+    return profiler::Registry::get().isEnabled();
+}
+
+void Profiler::dump(const char * fileName, ReportFormat format)
+{
+    profiler::Registry::get().dump(fileName, format);
+}
+
+void Profiler::reset()
+{
+    profiler::Registry::get().reset();
+}
+
+ProfilerTask::ProfilerTask(const char * taskName) : _taskName(taskName), _isActive(false)
+{
+    profiler::Registry & registry = profiler::Registry::get();
+    if (!registry.isEnabled()) return;
+
+    registry.startTask(taskName);
+    _isActive = true;
+}
+
+ProfilerTask::ProfilerTask(ProfilerTask && other) : _taskName(other._taskName), _isActive(other._isActive)
+{
+    other._isActive = false;
+}
 
 ProfilerTask::~ProfilerTask()
 {
-    Profiler::endTask(_taskName);
+    /* The task started while the profiling was enabled is ended even if the profiling is disabled now */
+    if (_isActive)
+    {
+        profiler::Registry::get().endTask(_taskName);
+    }
 }
 
 } // namespace internal
@@ -18,9 +18,20 @@
 /*
 //++
 //  Profiler for time measurement of kernels
+//
+//  Profiling is disabled by default and costs a single flag check per task.
+//  It is enabled either with the Profiler::enable() call or with the
+//  DAAL_PROFILER environment variable set to one of:
+//      json  - report with per-task and per-thread statistics in JSON format
+//      flame - collapsed stacks compatible with flamegraph.pl
+//  The report is written at program exit to the file specified in the
+//  DAAL_PROFILER_OUTPUT environment variable or to stderr.
 //--
 */
 
+#ifndef __SERVICE_PROFILER_H__
+#define __SERVICE_PROFILER_H__
+
 namespace daal
 {
 namespace internal
@@ -29,19 +40,42 @@ class ProfilerTask
 {
 public:
     ProfilerTask(const char * taskName);
+    ProfilerTask(ProfilerTask && other);
     ~ProfilerTask();
 
 private:
+    ProfilerTask(const ProfilerTask &);
+    ProfilerTask & operator=(const ProfilerTask &);
+
     const char * _taskName;
+    bool _isActive;
 };
 
-// This class is a stub in the library. Its redefinition will be in Bechmarks
 class Profiler
 {
 public:
+    enum ReportFormat
+    {
+        json,
+        flame
+    };
+
     static ProfilerTask startTask(const char * taskName);
     static void endTask(const char * taskName);
+
+    /* Enables or disables collection of the statistics for the tasks started after the call */
+    static void enable(bool isEnabled);
+    static bool isEnabled();
+
+    /* Writes the collected statistics to the file or to stderr if fileName is null.
+       Must be called when there are no running tasks. */
+    static void dump(const char * fileName, ReportFormat format);
+
+    /* Discards the collected statistics. Must be called when there are no running tasks. */
+    static void reset();
 };
 
 } // namespace internal
 } // namespace daal
+
+#endif
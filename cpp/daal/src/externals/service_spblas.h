@@ -63,6 +63,12 @@ struct SpBlas
         _impl<fpType, cpu>::xcsrmv(transa, m, k, alpha, matdescra, val, indx, pntrb, pntre, x, beta, y);
     }
 
+    static void xxcsrmv(const char * transa, const SizeType * m, const SizeType * k, const fpType * alpha, const char * matdescra, const fpType * val,
+                        const SizeType * indx, const SizeType * pntrb, const SizeType * pntre, const fpType * x, const fpType * beta, fpType * y)
+    {
+        _impl<fpType, cpu>::xxcsrmv(transa, m, k, alpha, matdescra, val, indx, pntrb, pntre, x, beta, y);
+    }
+
     static void xcsrmm(const char * transa, const SizeType * m, const SizeType * n, const SizeType * k, const fpType * alpha, const char * matdescra,
                        const fpType * val, const SizeType * indx, const SizeType * pntrb, const fpType * b, const SizeType * ldb, const fpType * beta,
                        fpType * c, const SizeType * ldc)
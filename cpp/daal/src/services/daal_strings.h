@@ -37,6 +37,8 @@
     DECLARE_DAAL_STRING_CONST(basicStatisticsMinimum)            \
     DECLARE_DAAL_STRING_CONST(basicStatisticsMaximum)            \
     DECLARE_DAAL_STRING_CONST(sortedData)                        \
+    DECLARE_DAAL_STRING_CONST(sortedIndices)                     \
+    DECLARE_DAAL_STRING_CONST(keyColumns)                        \
     DECLARE_DAAL_STRING_CONST(normalizedData)                    \
     DECLARE_DAAL_STRING_CONST(inputGradient)                     \
     DECLARE_DAAL_STRING_CONST(gradient)                          \
@@ -70,6 +72,9 @@
     DECLARE_DAAL_STRING_CONST(cosineDistance)                    \
     DECLARE_DAAL_STRING_CONST(quantiles)                         \
     DECLARE_DAAL_STRING_CONST(quantileOrders)                    \
+    DECLARE_DAAL_STRING_CONST(sketchCentroids)                   \
+    DECLARE_DAAL_STRING_CONST(sketchWeights)                     \
+    DECLARE_DAAL_STRING_CONST(compression)                       \
     DECLARE_DAAL_STRING_CONST(covariance)                        \
     DECLARE_DAAL_STRING_CONST(correlation)                       \
     DECLARE_DAAL_STRING_CONST(mean)                              \
@@ -189,6 +194,8 @@
     DECLARE_DAAL_STRING_CONST(outputOfStep4)                     \
     DECLARE_DAAL_STRING_CONST(batchIndices)                      \
     DECLARE_DAAL_STRING_CONST(batchSize)                         \
+    DECLARE_DAAL_STRING_CONST(nInnerIterations)                  \
+    DECLARE_DAAL_STRING_CONST(trustRegionRadius)                 \
     DECLARE_DAAL_STRING_CONST(singularValues)                    \
     DECLARE_DAAL_STRING_CONST(rightSingularMatrix)               \
     DECLARE_DAAL_STRING_CONST(leftSingularMatrix)                \
@@ -306,6 +313,8 @@
     DECLARE_DAAL_STRING_CONST(auxCoefficients)                   \
     DECLARE_DAAL_STRING_CONST(auxNumberOfCoefficients)           \
     DECLARE_DAAL_STRING_CONST(shrinkingStep)                     \
+    DECLARE_DAAL_STRING_CONST(cacheStatistics)                   \
+    DECLARE_DAAL_STRING_CONST(thunderShrinkingStep)              \
     DECLARE_DAAL_STRING_CONST(shrinkage)                         \
     DECLARE_DAAL_STRING_CONST(transformedData)                   \
     DECLARE_DAAL_STRING_CONST(classSize)                         \
@@ -378,7 +387,8 @@
     DECLARE_DAAL_STRING_CONST(step13Assignments)                 \
     DECLARE_DAAL_STRING_CONST(step13AssignmentQueries)           \
     DECLARE_DAAL_STRING_CONST(gramMatrix)                        \
-    DECLARE_DAAL_STRING_CONST(lassoParameters)
+    DECLARE_DAAL_STRING_CONST(lassoParameters)                   \
+    DECLARE_DAAL_STRING_CONST(resultsToCompute)
 
 /**
  *  Intel(R) oneAPI Data Analytics Library namespace
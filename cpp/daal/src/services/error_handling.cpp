@@ -925,6 +925,8 @@ void ErrorMessageCollection::parseResourceFile()
     // GBT error: -30000..-30099
     add(ErrorGbtIncorrectNumberOfTrees, "Number of trees in the model is not consistent with the number of classes");
     add(ErrorGbtPredictIncorrectNumberOfIterations, "Number of iterations value in GBT parameter is not consistent with the model");
+    add(ErrorGbtPredictShapOptionsNotSupported, "Requested combination of the GBT prediction results is not supported");
+    add(ErrorGbtPredictShapNoNodeCover, "Feature contributions require the node sample counts the model does not have");
 
     //Math errors: -90000..-90099
     add(ErrorDataSourseNotAvailable, "ErrorDataSourseNotAvailable");
@@ -132,6 +132,22 @@ struct SignBit<double, cpu>
     static int get(double val) { return ((_daal_dp_union_t *)&val)->bits.sign; }
 };
 
+/* Checks the bits of the value, so that the result does not depend on the floating-point model of the compiler */
+template <typename T, CpuType cpu>
+struct IsNaN;
+
+template <CpuType cpu>
+struct IsNaN<float, cpu>
+{
+    DAAL_FORCEINLINE static bool get(float val) { return (*(const uint32_t *)&val & 0x7FFFFFFFu) > 0x7F800000u; }
+};
+
+template <CpuType cpu>
+struct IsNaN<double, cpu>
+{
+    DAAL_FORCEINLINE static bool get(double val) { return (*(const uint64_t *)&val & 0x7FFFFFFFFFFFFFFFULL) > 0x7FF0000000000000ULL; }
+};
+
 template <typename T1, typename T2, CpuType cpu>
 void vectorConvertFuncCpu(size_t n, void * src, void * dst);
 
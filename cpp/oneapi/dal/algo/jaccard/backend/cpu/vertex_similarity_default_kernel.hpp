@@ -16,7 +16,9 @@
 
 #pragma once
 
+#include <algorithm>
 #include <memory>
+#include <vector>
 
 #include "oneapi/dal/algo/jaccard/common.hpp"
 #include "oneapi/dal/algo/jaccard/vertex_similarity_types.hpp"
@@ -26,6 +28,7 @@
 #include "oneapi/dal/backend/primitives/intersection/intersection.hpp"
 #include "oneapi/dal/common.hpp"
 #include "oneapi/dal/detail/policy.hpp"
+#include "oneapi/dal/detail/threading.hpp"
 #include "oneapi/dal/table/homogen.hpp"
 
 namespace oneapi::dal::preview::jaccard::backend {
@@ -107,6 +110,151 @@ vertex_similarity_result<task::all_vertex_pairs> jaccard(
     return res;
 }
 
+/// Column vertex with its Jaccard coefficient in the top-k search
+struct jaccard_candidate {
+    float coeff;
+    std::int32_t vertex;
+};
+
+/// Orders the candidates by descending coefficient, ties go to the smaller vertex
+ONEDAL_FORCEINLINE bool is_better(const jaccard_candidate &a, const jaccard_candidate &b) {
+    return a.coeff > b.coeff || (a.coeff == b.coeff && a.vertex < b.vertex);
+}
+
+template <typename Cpu>
+vertex_similarity_result<task::all_vertex_pairs> jaccard_top_k(
+    const detail::descriptor_base<task::all_vertex_pairs> &desc,
+    const dal::preview::detail::topology<int32_t> &t,
+    void *result_ptr) {
+    const auto row_begin = dal::detail::integral_cast<std::int32_t>(desc.get_row_range_begin());
+    const auto row_end = dal::detail::integral_cast<std::int32_t>(desc.get_row_range_end());
+    const auto column_begin =
+        dal::detail::integral_cast<std::int32_t>(desc.get_column_range_begin());
+    const auto column_end = dal::detail::integral_cast<std::int32_t>(desc.get_column_range_end());
+    const std::int64_t row_count = row_end - row_begin;
+    const std::int64_t column_count = column_end - column_begin;
+    const std::int64_t top_k = std::min(desc.get_top_k(), column_count);
+    const std::int64_t number_elements_in_result = row_count * top_k;
+
+    int *first_vertices = reinterpret_cast<int *>(result_ptr);
+    int *second_vertices = first_vertices + number_elements_in_result;
+    float *jaccard = reinterpret_cast<float *>(second_vertices + number_elements_in_result);
+
+    const std::int64_t thread_cnt = dal::detail::threader_get_max_threads();
+    const std::int64_t visited_size = column_count / 64 + 1;
+    auto visited_arr = array<std::uint64_t>::zeros(thread_cnt * visited_size);
+    auto heaps_arr = array<jaccard_candidate>::empty(thread_cnt * top_k);
+    auto row_sizes_arr = array<std::int64_t>::empty(row_count);
+    std::uint64_t *visited_data = visited_arr.get_mutable_data();
+    jaccard_candidate *heaps_data = heaps_arr.get_mutable_data();
+    std::int64_t *row_sizes = row_sizes_arr.get_mutable_data();
+    // Candidates marked in the visited bits of each thread, the capacity is kept between rows
+    std::vector<std::vector<std::int32_t>> touched_lists(thread_cnt);
+
+    // Neighbors of the neighbors of i, restricted to the column range
+    const auto for_each_two_hop_neighbor = [&](std::int32_t i, auto &&body) {
+        for (auto w_ = t.get_vertex_neighbors_begin(i); w_ != t.get_vertex_neighbors_end(i); ++w_) {
+            const auto w_neighbors_end = t.get_vertex_neighbors_end(*w_);
+            for (auto j_ = std::lower_bound(t.get_vertex_neighbors_begin(*w_),
+                                            w_neighbors_end,
+                                            column_begin);
+                 j_ != w_neighbors_end && *j_ < column_end;
+                 ++j_) {
+                body(*j_);
+            }
+        }
+    };
+
+    dal::detail::threader_for(row_count, row_count, [&](std::int32_t r) {
+        const std::int64_t thread_id = dal::detail::threader_get_current_thread_index();
+        std::uint64_t *visited = visited_data + thread_id * visited_size;
+        std::vector<std::int32_t> &touched = touched_lists[thread_id];
+        jaccard_candidate *heap = heaps_data + thread_id * top_k;
+        std::int64_t heap_size = 0;
+
+        const std::int32_t i = row_begin + r;
+        const std::int32_t i_neighbor_size = t.get_vertex_degree(i);
+        const auto i_neighbors = t.get_vertex_neighbors_begin(i);
+
+        // Only the vertices sharing a neighbor with i have non-zero coefficients
+        for_each_two_hop_neighbor(i, [&](std::int32_t j) {
+            const std::int32_t index = j - column_begin;
+            const std::uint64_t bit = std::uint64_t(1) << (index & 63);
+            if (j == i || (visited[index >> 6] & bit)) {
+                return;
+            }
+            visited[index >> 6] |= bit;
+            touched.push_back(index);
+
+            const std::int32_t j_neighbor_size = t.get_vertex_degree(j);
+            if (heap_size == top_k) {
+                // The coefficient never exceeds the ratio of the smaller and the larger degrees
+                const float bound = float(detail::min(i_neighbor_size, j_neighbor_size)) /
+                                    float(detail::max(i_neighbor_size, j_neighbor_size));
+                if (!is_better({ bound, j }, heap[0])) {
+                    return;
+                }
+            }
+
+            const auto intersection_value =
+                preview::backend::intersection<Cpu>(i_neighbors,
+                                                    t.get_vertex_neighbors_begin(j),
+                                                    i_neighbor_size,
+                                                    j_neighbor_size);
+            const jaccard_candidate candidate{
+                float(intersection_value) /
+                    float(i_neighbor_size + j_neighbor_size - intersection_value),
+                j
+            };
+
+            // The heap keeps the worst of the best top_k candidates on the top
+            if (heap_size < top_k) {
+                heap[heap_size++] = candidate;
+                std::push_heap(heap, heap + heap_size, is_better);
+            }
+            else if (is_better(candidate, heap[0])) {
+                std::pop_heap(heap, heap + heap_size, is_better);
+                heap[heap_size - 1] = candidate;
+                std::push_heap(heap, heap + heap_size, is_better);
+            }
+        });
+
+        for (const std::int32_t index : touched) {
+            visited[index >> 6] = 0;
+        }
+        touched.clear();
+
+        std::sort_heap(heap, heap + heap_size, is_better);
+        const std::int64_t row_offset = r * top_k;
+        for (std::int64_t k = 0; k < heap_size; ++k) {
+            second_vertices[row_offset + k] = heap[k].vertex;
+            jaccard[row_offset + k] = heap[k].coeff;
+        }
+        row_sizes[r] = heap_size;
+    });
+
+    // Pack the rows in place, the packed position never exceeds the source one
+    std::int64_t nnz = 0;
+    for (std::int64_t r = 0; r < row_count; ++r) {
+        const std::int64_t row_offset = r * top_k;
+        for (std::int64_t k = 0; k < row_sizes[r]; ++k) {
+            first_vertices[nnz] = row_begin + r;
+            second_vertices[nnz] = second_vertices[row_offset + k];
+            jaccard[nnz] = jaccard[row_offset + k];
+            nnz++;
+        }
+    }
+
+    vertex_similarity_result res(
+        homogen_table::wrap(first_vertices,
+                            number_elements_in_result,
+                            2,
+                            data_layout::column_major),
+        homogen_table::wrap(jaccard, number_elements_in_result, 1, data_layout::column_major),
+        nnz);
+    return res;
+}
+
 template <>
 vertex_similarity_result<task::all_vertex_pairs> jaccard<dal::backend::cpu_dispatch_avx512>(
     const detail::descriptor_base<task::all_vertex_pairs> &desc,
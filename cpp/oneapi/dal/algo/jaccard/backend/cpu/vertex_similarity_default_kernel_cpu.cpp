@@ -30,4 +30,9 @@ template vertex_similarity_result<task::all_vertex_pairs> jaccard<__CPU_TAG__>(
     const dal::preview::detail::topology<std::int32_t> &t,
     void *result_ptr);
 
+template vertex_similarity_result<task::all_vertex_pairs> jaccard_top_k<__CPU_TAG__>(
+    const detail::descriptor_base<task::all_vertex_pairs> &desc,
+    const dal::preview::detail::topology<std::int32_t> &t,
+    void *result_ptr);
+
 } // namespace oneapi::dal::preview::jaccard::backend
@@ -60,12 +60,14 @@ public:
     auto get_row_range_end() const -> std::int64_t;
     auto get_column_range_begin() const -> std::int64_t;
     auto get_column_range_end() const -> std::int64_t;
+    auto get_top_k() const -> std::int64_t;
 
 protected:
     void set_row_range_impl(std::int64_t begin, std::int64_t end);
     void set_column_range_impl(std::int64_t begin, std::int64_t end);
     void set_block_impl(const std::initializer_list<std::int64_t>& row_range,
                         const std::initializer_list<std::int64_t>& column_range);
+    void set_top_k_impl(std::int64_t top_k);
 
     dal::detail::pimpl<detail::descriptor_impl<task_t>> impl_;
 };
@@ -141,6 +143,24 @@ public:
         base_t::set_block_impl(row_range, column_range);
         return *this;
     }
+
+    /// Returns the number of the most similar vertices kept for every row vertex
+    std::int64_t get_top_k() const {
+        return base_t::get_top_k();
+    }
+
+    /// Sets the number of the most similar vertices from the column range kept for every
+    /// vertex from the row range. When top_k is greater than zero, only the vertex pairs
+    /// sharing at least one neighbor are evaluated, the pair of a vertex with itself is
+    /// skipped, and the result holds at most top_k pairs per row vertex ordered by
+    /// descending Jaccard coefficient. Zero means all the non-zero pairs of the block.
+    ///
+    /// @param [in] top_k  The number of the most similar vertices per row vertex
+    /// @remark default = 0
+    auto& set_top_k(std::int64_t top_k) {
+        base_t::set_top_k_impl(top_k);
+        return *this;
+    }
 };
 
 /// Structure for the caching builder
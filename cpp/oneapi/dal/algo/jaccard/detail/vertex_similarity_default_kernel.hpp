@@ -23,6 +23,8 @@
 
 namespace oneapi::dal::preview::jaccard::detail {
 
+struct top_k {};
+
 template <typename Float, typename Task, typename Topology, typename... Params>
 struct vertex_similarity {
     vertex_similarity_result<Task> operator()(const dal::detail::host_policy& ctx,
@@ -42,6 +44,18 @@ struct vertex_similarity<Float,
         void* result_ptr);
 };
 
+template <typename Float>
+struct vertex_similarity<Float,
+                         task::all_vertex_pairs,
+                         dal::preview::detail::topology<std::int32_t>,
+                         top_k> {
+    vertex_similarity_result<task::all_vertex_pairs> operator()(
+        const dal::detail::host_policy& ctx,
+        const detail::descriptor_base<task::all_vertex_pairs>& desc,
+        const dal::preview::detail::topology<std::int32_t>& t,
+        void* result_ptr);
+};
+
 template <typename Float, typename Method, typename Task, typename Topology>
 struct vertex_similarity_kernel_cpu {
     vertex_similarity_result<Task> operator()(const dal::detail::host_policy& ctx,
@@ -61,6 +75,22 @@ struct vertex_similarity_kernel_cpu<float, method::fast, task::all_vertex_pairs,
         const std::int64_t row_end = desc.get_row_range_end();
         const std::int64_t column_begin = desc.get_column_range_begin();
         const std::int64_t column_end = desc.get_column_range_end();
+        if (desc.get_top_k() > 0) {
+            // The result holds at most top_k pairs per row instead of the whole block
+            const std::int64_t top_k_per_row =
+                std::min(desc.get_top_k(), column_end - column_begin);
+            const std::int64_t number_elements_in_result =
+                dal::detail::check_mul_overflow(row_end - row_begin, top_k_per_row);
+            if (number_elements_in_result == 0) {
+                return vertex_similarity_result<task::all_vertex_pairs>();
+            }
+            const std::int64_t max_block_size = compute_max_block_size<
+                typename detail::descriptor_base<task::all_vertex_pairs>::float_t,
+                std::int32_t>(number_elements_in_result);
+            void* result_ptr = result_builder(max_block_size);
+            using kernel_t = vertex_similarity<float, task::all_vertex_pairs, Topology, top_k>;
+            return kernel_t()(ctx, desc, t, result_ptr);
+        }
         const std::int64_t number_elements_in_block =
             compute_number_elements_in_block(row_begin, row_end, column_begin, column_end);
         if (number_elements_in_block == 0) {
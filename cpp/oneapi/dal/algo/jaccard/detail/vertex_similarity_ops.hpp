@@ -76,6 +76,9 @@ struct vertex_similarity_ops {
             column_end >= dal::detail::limits<std::int32_t>::max()) {
             throw invalid_argument(msg::range_idx_gt_max_int32());
         }
+        if (param.get_top_k() < 0) {
+            throw invalid_argument(msg::negative_top_k());
+        }
     }
 
     template <typename Policy>
@@ -67,10 +67,12 @@ public:
     void check_vertex_similarity(const std::int64_t row_range_begin,
                                  const std::int64_t row_range_end,
                                  const std::int64_t column_range_begin,
-                                 const std::int64_t column_range_end) {
-        const auto jaccard_desc = dal::preview::jaccard::descriptor<>().set_block(
-            { row_range_begin, row_range_end },
-            { column_range_begin, column_range_end });
+                                 const std::int64_t column_range_end,
+                                 const std::int64_t top_k = 0) {
+        const auto jaccard_desc = dal::preview::jaccard::descriptor<>()
+                                      .set_block({ row_range_begin, row_range_end },
+                                                 { column_range_begin, column_range_end })
+                                      .set_top_k(top_k);
         const auto g = create_graph();
 
         dal::preview::jaccard::caching_builder builder;
@@ -106,4 +108,12 @@ JACCARD_BADARG_TEST("throws if block ranges is greater than vertex count") {
     REQUIRE_THROWS_AS(this->check_vertex_similarity(0, 8, 0, 8), out_of_range);
 }
 
+JACCARD_BADARG_TEST("accepts positive top_k") {
+    REQUIRE_NOTHROW(this->check_vertex_similarity(0, 2, 0, 3, 2));
+}
+
+JACCARD_BADARG_TEST("throws if top_k is negative") {
+    REQUIRE_THROWS_AS(this->check_vertex_similarity(0, 2, 0, 3, -1), invalid_argument);
+}
+
 } // namespace oneapi::dal::algo::jaccard::test
@@ -14,7 +14,11 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <algorithm>
 #include <array>
+#include <iterator>
+#include <utility>
+#include <vector>
 
 #include "oneapi/dal/algo/jaccard/vertex_similarity.hpp"
 #include "oneapi/dal/table/homogen.hpp"
@@ -135,6 +139,21 @@ public:
                                           24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34 };
 };
 
+class distinct_jaccard_coeffs_graph_type : public graph_base_data {
+public:
+    distinct_jaccard_coeffs_graph_type() {
+        vertex_count = 10;
+        edge_count = 19;
+        cols_count = edge_count * 2;
+        rows_count = vertex_count + 1;
+    }
+    std::array<std::int32_t, 10> degrees = { 4, 4, 4, 5, 3, 4, 4, 2, 4, 4 };
+    std::array<std::int32_t, 38> cols = { 1, 2, 3, 9, 0, 2, 3, 4, 0, 1, 3, 5, 0,
+                                          1, 2, 6, 9, 1, 5, 7, 2, 4, 6, 8, 3, 5,
+                                          8, 9, 4, 8, 5, 6, 7, 9, 0, 3, 6, 8 };
+    std::array<std::int64_t, 11> rows = { 0, 4, 8, 12, 17, 20, 24, 28, 30, 34, 38 };
+};
+
 class jaccard_test {
 public:
     template <typename GraphType>
@@ -196,8 +215,12 @@ public:
         homogen_table &vertex_pairs = static_cast<homogen_table &>(vertex_pairs_table);
         const auto vertex_pairs_data = vertex_pairs.get_data<int>();
         std::int64_t correct_pair_count = 0;
-        std::int64_t element_count = (desc.get_row_range_end() - desc.get_row_range_begin()) *
-                                     (desc.get_column_range_end() - desc.get_column_range_begin());
+        const std::int64_t column_count =
+            desc.get_column_range_end() - desc.get_column_range_begin();
+        const std::int64_t pairs_per_row =
+            desc.get_top_k() > 0 ? std::min(desc.get_top_k(), column_count) : column_count;
+        std::int64_t element_count =
+            (desc.get_row_range_end() - desc.get_row_range_begin()) * pairs_per_row;
         for (std::int64_t i = 0; i < nonzero_coeff_count; i++) {
             if (vertex_pairs_data[i] == correct_vertex_pairs[i] &&
                 vertex_pairs_data[i + element_count] == correct_vertex_pairs[i + element_count])
@@ -217,6 +240,130 @@ public:
         REQUIRE(correct_coeff_count == nonzero_coeff_count);
     }
 
+    /// Pairs of the row vertex with the column vertices ordered as in the top-k result:
+    /// by descending coefficient, ties go to the smaller vertex
+    using similar_vertices = std::vector<std::pair<float, std::int32_t>>;
+    using all_pairs_result_t = dal::preview::jaccard::vertex_similarity_result<
+        dal::preview::jaccard::task::all_vertex_pairs>;
+
+    static void sort_by_similarity(similar_vertices &row) {
+        std::sort(row.begin(), row.end(), [](const auto &a, const auto &b) {
+            return a.first > b.first || (a.first == b.first && a.second < b.second);
+        });
+    }
+
+    /// Computes the coefficients of all the pairs sharing a neighbor by definition,
+    /// the pairs of a vertex with itself are skipped
+    template <typename GraphType>
+    std::vector<similar_vertices> compute_brute_force_top_k(std::int64_t row_begin,
+                                                            std::int64_t row_end,
+                                                            std::int64_t column_begin,
+                                                            std::int64_t column_end,
+                                                            std::int64_t top_k) {
+        GraphType graph_data;
+        const auto neighbors_begin = [&](std::int64_t v) {
+            return graph_data.cols.begin() + graph_data.rows[v];
+        };
+        const auto neighbors_end = [&](std::int64_t v) {
+            return graph_data.cols.begin() + graph_data.rows[v + 1];
+        };
+
+        std::vector<similar_vertices> result;
+        for (std::int64_t i = row_begin; i < row_end; ++i) {
+            similar_vertices row;
+            for (std::int64_t j = column_begin; j < column_end; ++j) {
+                std::vector<std::int32_t> common;
+                std::set_intersection(neighbors_begin(i),
+                                      neighbors_end(i),
+                                      neighbors_begin(j),
+                                      neighbors_end(j),
+                                      std::back_inserter(common));
+                const std::int32_t intersection = common.size();
+                if (i != j && intersection > 0) {
+                    const std::int32_t union_size =
+                        graph_data.degrees[i] + graph_data.degrees[j] - intersection;
+                    row.emplace_back(float(intersection) / float(union_size), j);
+                }
+            }
+            sort_by_similarity(row);
+            row.resize(std::min<std::int64_t>(row.size(), top_k));
+            result.push_back(row);
+        }
+        return result;
+    }
+
+    /// Groups the result of the vertex similarity by the row vertices
+    static std::vector<similar_vertices> group_by_rows(const all_pairs_result_t &result,
+                                                       std::int64_t row_begin,
+                                                       std::int64_t row_end) {
+        const auto vertex_pairs_table = result.get_vertex_pairs();
+        const auto coeffs_table = result.get_coeffs();
+        const std::int64_t element_count = vertex_pairs_table.get_row_count();
+        const auto vertex_pairs =
+            static_cast<const homogen_table &>(vertex_pairs_table).get_data<int>();
+        const auto coeffs = static_cast<const homogen_table &>(coeffs_table).get_data<float>();
+
+        std::vector<similar_vertices> rows(row_end - row_begin);
+        for (std::int64_t k = 0; k < result.get_nonzero_coeff_count(); ++k) {
+            const std::int32_t i = vertex_pairs[k];
+            REQUIRE(i >= row_begin);
+            REQUIRE(i < row_end);
+            rows[i - row_begin].emplace_back(coeffs[k], vertex_pairs[k + element_count]);
+        }
+        return rows;
+    }
+
+    /// Checks the exact order of the top-k result against the brute-force reference and
+    /// against the result computed without top-k, with the self pairs removed
+    template <typename GraphType>
+    void check_top_k(std::int64_t row_begin,
+                     std::int64_t row_end,
+                     std::int64_t column_begin,
+                     std::int64_t column_end,
+                     std::int64_t top_k) {
+        const auto g = create_graph<GraphType>();
+        const auto expected = compute_brute_force_top_k<GraphType>(row_begin,
+                                                                   row_end,
+                                                                   column_begin,
+                                                                   column_end,
+                                                                   top_k);
+
+        const auto top_k_desc = dal::preview::jaccard::descriptor<>()
+                                    .set_block({ row_begin, row_end }, { column_begin, column_end })
+                                    .set_top_k(top_k);
+        dal::preview::jaccard::caching_builder top_k_builder;
+        const auto top_k_rows =
+            group_by_rows(dal::preview::vertex_similarity(top_k_desc, g, top_k_builder),
+                          row_begin,
+                          row_end);
+
+        const auto all_pairs_desc = dal::preview::jaccard::descriptor<>().set_block(
+            { row_begin, row_end },
+            { column_begin, column_end });
+        dal::preview::jaccard::caching_builder all_pairs_builder;
+        auto all_pairs_rows =
+            group_by_rows(dal::preview::vertex_similarity(all_pairs_desc, g, all_pairs_builder),
+                          row_begin,
+                          row_end);
+
+        for (std::int64_t r = 0; r < row_end - row_begin; ++r) {
+            CAPTURE(row_begin + r);
+            REQUIRE(top_k_rows[r] == expected[r]);
+
+            auto &all_pairs_row = all_pairs_rows[r];
+            const std::int32_t i = row_begin + r;
+            all_pairs_row.erase(std::remove_if(all_pairs_row.begin(),
+                                               all_pairs_row.end(),
+                                               [&](const auto &p) {
+                                                   return p.second == i;
+                                               }),
+                                all_pairs_row.end());
+            sort_by_similarity(all_pairs_row);
+            all_pairs_row.resize(std::min<std::int64_t>(all_pairs_row.size(), top_k));
+            REQUIRE(top_k_rows[r] == all_pairs_row);
+        }
+    }
+
     template <typename Graph, typename Task>
     void check_jaccard_zero_coeffs_only(
         const oneapi::dal::preview::jaccard::detail::descriptor_base<Task> &desc,
@@ -420,6 +567,49 @@ TEST_M(jaccard_test, "Zero jaccard coeffs graph, row of 32 elements, right of th
     this->check_jaccard_zero_coeffs_only<>(jaccard_desc, g);
 }
 
+TEST_M(jaccard_test, "Complete graph, top-k most similar vertices per row, self pairs skipped") {
+    auto jaccard_desc =
+        dal::preview::jaccard::descriptor<>().set_block({ 0, 2 }, { 0, 33 }).set_top_k(3);
+    std::array<std::int64_t, 12> vertex_pairs = { 0, 0, 0, 1, 1, 1, 1, 2, 3, 0, 2, 3 };
+    std::array<float, 6> jaccard_coeffs;
+    jaccard_coeffs.fill(0.93939);
+    this->check_jaccard<complete_graph_33_type>(jaccard_desc, 6, vertex_pairs, jaccard_coeffs);
+}
+
+TEST_M(jaccard_test, "Zero jaccard coeffs graph, top-k most similar vertices per row") {
+    const auto g = create_graph<zero_jaccard_coeff_graph_type>();
+    auto jaccard_desc =
+        dal::preview::jaccard::descriptor<>().set_block({ 0, 4 }, { 0, 34 }).set_top_k(2);
+    this->check_jaccard_zero_coeffs_only<>(jaccard_desc, g);
+}
+
+TEST_M(jaccard_test, "Distinct coeffs graph, top-k order and ties match brute force") {
+    for (std::int64_t top_k : { 1, 2, 3, 4, 5, 9, 10 }) {
+        CAPTURE(top_k);
+        this->check_top_k<distinct_jaccard_coeffs_graph_type>(0, 10, 0, 10, top_k);
+    }
+}
+
+TEST_M(jaccard_test, "Distinct coeffs graph, top-k of a block matches brute force") {
+    for (std::int64_t top_k : { 1, 2, 4 }) {
+        CAPTURE(top_k);
+        this->check_top_k<distinct_jaccard_coeffs_graph_type>(2, 7, 1, 6, top_k);
+        this->check_top_k<distinct_jaccard_coeffs_graph_type>(6, 10, 0, 4, top_k);
+    }
+}
+
+TEST_M(jaccard_test, "Distinct coeffs graph, top-k ties go to the smaller vertex") {
+    // Vertex 0 has the coefficients 1/2 with 3 and 1/3 with 1, 2 and 6
+    auto jaccard_desc =
+        dal::preview::jaccard::descriptor<>().set_block({ 0, 1 }, { 0, 10 }).set_top_k(3);
+    std::array<std::int64_t, 6> vertex_pairs = { 0, 0, 0, 3, 1, 2 };
+    std::array<float, 3> jaccard_coeffs = { 0.5f, 1.f / 3.f, 1.f / 3.f };
+    this->check_jaccard<distinct_jaccard_coeffs_graph_type>(jaccard_desc,
+                                                            3,
+                                                            vertex_pairs,
+                                                            jaccard_coeffs);
+}
+
 TEST_M(jaccard_test, "Null graph") {
     dal::preview::undirected_adjacency_vector_graph<> null_graph;
     auto jaccard_desc = dal::preview::jaccard::descriptor<>().set_block({ 0, 0 }, { 0, 0 });
@@ -100,7 +100,20 @@ struct infer_kernel_cpu<Float, method::by_default, task::clustering> {
     }
 };
 
+/// Inference does not depend on the training method, Hamerly bounds
+/// are only used to accelerate the training iterations
+template <typename Float>
+struct infer_kernel_cpu<Float, method::hamerly_dense, task::clustering> {
+    infer_result<task::clustering> operator()(const context_cpu& ctx,
+                                              const descriptor_t& desc,
+                                              const infer_input<task::clustering>& input) const {
+        return infer<Float, task::clustering>(ctx, desc, input);
+    }
+};
+
 template struct infer_kernel_cpu<float, method::by_default, task::clustering>;
 template struct infer_kernel_cpu<double, method::by_default, task::clustering>;
+template struct infer_kernel_cpu<float, method::hamerly_dense, task::clustering>;
+template struct infer_kernel_cpu<double, method::hamerly_dense, task::clustering>;
 
 } // namespace oneapi::dal::kmeans::backend
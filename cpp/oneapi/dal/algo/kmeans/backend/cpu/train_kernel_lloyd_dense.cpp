@@ -35,9 +35,24 @@ namespace daal_kmeans = daal::algorithms::kmeans;
 namespace daal_kmeans_init = daal::algorithms::kmeans::init;
 namespace interop = dal::backend::interop;
 
-template <typename Float, daal::CpuType Cpu>
-using daal_kmeans_lloyd_dense_kernel_t =
-    daal_kmeans::internal::KMeansBatchKernel<daal_kmeans::lloydDense, Float, Cpu>;
+template <daal_kmeans::Method Method>
+struct daal_kmeans_dense_kernel {
+    template <typename Float, daal::CpuType Cpu>
+    using type = daal_kmeans::internal::KMeansBatchKernel<Method, Float, Cpu>;
+};
+
+template <typename Method>
+struct daal_method_map;
+
+template <>
+struct daal_method_map<method::lloyd_dense> {
+    static constexpr daal_kmeans::Method value = daal_kmeans::lloydDense;
+};
+
+template <>
+struct daal_method_map<method::hamerly_dense> {
+    static constexpr daal_kmeans::Method value = daal_kmeans::hamerlyDense;
+};
 
 template <typename Float, daal::CpuType Cpu>
 using daal_kmeans_init_plus_plus_dense_kernel_t =
@@ -83,7 +98,7 @@ static daal::data_management::NumericTablePtr get_initial_centroids(
     return daal_initial_centroids;
 }
 
-template <typename Float, typename Task>
+template <typename Float, typename Method, typename Task>
 static train_result<Task> call_daal_kernel(const context_cpu& ctx,
                                            const descriptor_t& desc,
                                            const table& data,
@@ -125,11 +140,9 @@ static train_result<Task> call_daal_kernel(const context_cpu& ctx,
                                                        daal_objective_function_value.get(),
                                                        daal_iteration_count.get() };
 
+    using daal_kernel_t = daal_kmeans_dense_kernel<daal_method_map<Method>::value>;
     interop::status_to_exception(
-        interop::call_daal_kernel<Float, daal_kmeans_lloyd_dense_kernel_t>(ctx,
-                                                                           input,
-                                                                           output,
-                                                                           &par));
+        interop::call_daal_kernel<Float, daal_kernel_t::template type>(ctx, input, output, &par));
 
     return train_result<Task>()
         .set_responses(
@@ -142,14 +155,14 @@ static train_result<Task> call_daal_kernel(const context_cpu& ctx,
                                             .build()));
 }
 
-template <typename Float, typename Task>
+template <typename Float, typename Method, typename Task>
 static train_result<Task> train(const context_cpu& ctx,
                                 const descriptor_t& desc,
                                 const train_input<Task>& input) {
-    return call_daal_kernel<Float, Task>(ctx,
-                                         desc,
-                                         input.get_data(),
-                                         input.get_initial_centroids());
+    return call_daal_kernel<Float, Method, Task>(ctx,
+                                                 desc,
+                                                 input.get_data(),
+                                                 input.get_initial_centroids());
 }
 
 template <typename Float>
@@ -157,11 +170,22 @@ struct train_kernel_cpu<Float, method::lloyd_dense, task::clustering> {
     train_result<task::clustering> operator()(const context_cpu& ctx,
                                               const descriptor_t& desc,
                                               const train_input<task::clustering>& input) const {
-        return train<Float, task::clustering>(ctx, desc, input);
+        return train<Float, method::lloyd_dense, task::clustering>(ctx, desc, input);
+    }
+};
+
+template <typename Float>
+struct train_kernel_cpu<Float, method::hamerly_dense, task::clustering> {
+    train_result<task::clustering> operator()(const context_cpu& ctx,
+                                              const descriptor_t& desc,
+                                              const train_input<task::clustering>& input) const {
+        return train<Float, method::hamerly_dense, task::clustering>(ctx, desc, input);
     }
 };
 
 template struct train_kernel_cpu<float, method::lloyd_dense, task::clustering>;
 template struct train_kernel_cpu<double, method::lloyd_dense, task::clustering>;
+template struct train_kernel_cpu<float, method::hamerly_dense, task::clustering>;
+template struct train_kernel_cpu<double, method::hamerly_dense, task::clustering>;
 
 } // namespace oneapi::dal::kmeans::backend
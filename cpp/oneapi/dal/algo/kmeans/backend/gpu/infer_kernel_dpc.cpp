@@ -81,7 +81,20 @@ struct infer_kernel_gpu<Float, method::lloyd_dense, task::clustering> {
     }
 };
 
+template <typename Float>
+struct infer_kernel_gpu<Float, method::hamerly_dense, task::clustering> {
+    infer_result<task::clustering> operator()(const dal::backend::context_gpu& ctx,
+                                              const descriptor_t& params,
+                                              const infer_input<task::clustering>& input) const {
+        return infer_kernel_gpu<Float, method::lloyd_dense, task::clustering>{}(ctx,
+                                                                                params,
+                                                                                input);
+    }
+};
+
 template struct infer_kernel_gpu<float, method::by_default, task::clustering>;
 template struct infer_kernel_gpu<double, method::by_default, task::clustering>;
+template struct infer_kernel_gpu<float, method::hamerly_dense, task::clustering>;
+template struct infer_kernel_gpu<double, method::hamerly_dense, task::clustering>;
 
 } // namespace oneapi::dal::kmeans::backend
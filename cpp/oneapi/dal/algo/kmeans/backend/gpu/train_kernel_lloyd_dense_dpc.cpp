@@ -193,7 +193,22 @@ struct train_kernel_gpu<Float, method::lloyd_dense, task::clustering> {
     }
 };
 
+/// Hamerly bounds are not implemented for GPU, the Lloyd's kernel
+/// produces the same clusters
+template <typename Float>
+struct train_kernel_gpu<Float, method::hamerly_dense, task::clustering> {
+    train_result<task::clustering> operator()(const dal::backend::context_gpu& ctx,
+                                              const descriptor_t& params,
+                                              const train_input<task::clustering>& input) const {
+        return train_kernel_gpu<Float, method::lloyd_dense, task::clustering>{}(ctx,
+                                                                                params,
+                                                                                input);
+    }
+};
+
 template struct train_kernel_gpu<float, method::lloyd_dense, task::clustering>;
 template struct train_kernel_gpu<double, method::lloyd_dense, task::clustering>;
+template struct train_kernel_gpu<float, method::hamerly_dense, task::clustering>;
+template struct train_kernel_gpu<double, method::hamerly_dense, task::clustering>;
 
 } // namespace oneapi::dal::kmeans::backend
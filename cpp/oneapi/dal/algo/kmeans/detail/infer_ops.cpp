@@ -39,6 +39,8 @@ struct infer_ops_dispatcher<host_policy, Float, Method, Task> {
 
 INSTANTIATE(float, method::by_default, task::clustering)
 INSTANTIATE(double, method::by_default, task::clustering)
+INSTANTIATE(float, method::hamerly_dense, task::clustering)
+INSTANTIATE(double, method::hamerly_dense, task::clustering)
 
 } // namespace v1
 } // namespace oneapi::dal::kmeans::detail
@@ -107,8 +107,12 @@ private:
     };
 };
 
-#define KMEANS_BADARG_TEST(name) \
-    TEMPLATE_TEST_M(kmeans_badarg_test, name, "[kmeans][badarg]", method::lloyd_dense)
+#define KMEANS_BADARG_TEST(name)         \
+    TEMPLATE_TEST_M(kmeans_badarg_test,  \
+                    name,                \
+                    "[kmeans][badarg]",  \
+                    method::lloyd_dense, \
+                    method::hamerly_dense)
 
 KMEANS_BADARG_TEST("accepts positive cluster_count") {
     REQUIRE_NOTHROW(this->get_descriptor().set_cluster_count(1));
@@ -476,7 +476,8 @@ private:
     }
 };
 
-using kmeans_types = COMBINE_TYPES((float, double), (kmeans::method::lloyd_dense));
+using kmeans_types = COMBINE_TYPES((float, double),
+                                   (kmeans::method::lloyd_dense, kmeans::method::hamerly_dense));
 /*
 TEMPLATE_LIST_TEST_M(kmeans_batch_test,
                      "kmeans degenerated test",
@@ -0,0 +1,485 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include "oneapi/dal/algo/knn/common.hpp"
+#include "oneapi/dal/algo/knn/backend/cpu/minkowski_metric.hpp"
+#include "oneapi/dal/backend/common.hpp"
+#include "oneapi/dal/backend/dispatcher.hpp"
+#include "oneapi/dal/detail/common.hpp"
+#include "oneapi/dal/detail/threading.hpp"
+
+namespace oneapi::dal::knn::backend {
+
+/// The maximal number of training rows in a leaf of the ball tree
+inline constexpr std::int64_t ball_tree_leaf_size = 32;
+
+/// The number of queries searched by a single task
+inline constexpr std::int64_t ball_tree_query_block_size = 64;
+
+/// The number of rows processed by a single task when the statistics of a node
+/// are computed in parallel
+inline constexpr std::int64_t ball_tree_row_block_size = 4096;
+
+/// Returns the number of nodes of the ball tree over :literal:`row_count` rows.
+/// The leaves are the last level of the complete binary tree, each of them holds
+/// at most :literal:`ball_tree_leaf_size` rows.
+inline std::int64_t get_ball_tree_node_count(std::int64_t row_count) {
+    std::int64_t leaf_count = 1;
+    while (leaf_count * ball_tree_leaf_size < row_count) {
+        leaf_count *= 2;
+    }
+    return 2 * leaf_count - 1;
+}
+
+/// Returns the degree of the ball tree metric for the distance of the descriptor.
+/// The pruning relies on the triangle inequality, which does not hold for the
+/// Minkowski degree below one.
+template <typename Task>
+inline double get_ball_tree_degree(const detail::descriptor_base<Task>& desc) {
+    const double degree = get_minkowski_degree(desc);
+    if (degree < 1.0) {
+        throw invalid_argument{
+            dal::detail::error_messages::knn_ball_tree_minkowski_degree_lt_one()
+        };
+    }
+    return degree;
+}
+
+/// Read-only view of the ball tree, see :literal:`ball_tree_model_impl` for the layout
+template <typename Float>
+struct ball_tree_view {
+    /// The row-major training rows in the order of the tree nodes
+    const Float* data;
+    /// The original indices of the rows of :literal:`data`
+    const std::int64_t* indices;
+    /// The first and the past-the-end rows of each node
+    const std::int64_t* node_bounds;
+    /// The row-major centers of the balls of the nodes
+    const Float* centers;
+    /// The radii of the balls of the nodes
+    const Float* radii;
+    std::int64_t row_count;
+    std::int64_t column_count;
+    std::int64_t node_count;
+
+    bool is_leaf(std::int64_t node) const {
+        return 2 * node + 1 >= node_count;
+    }
+};
+
+template <typename Cpu, typename Float>
+struct ball_tree_builder {
+    /// Builds the ball tree over the row-major :literal:`data`. The nodes of a level are
+    /// built in parallel; the levels with fewer nodes than threads split the rows of
+    /// each node between the threads instead.
+    ///
+    /// @param[out] indices       The original indices of the reordered rows,
+    ///                           :literal:`row_count` values
+    /// @param[out] ordered_data  The reordered rows,
+    ///                           :literal:`row_count` x :literal:`column_count`
+    /// @param[out] node_bounds   The row ranges of the nodes,
+    ///                           2 x :literal:`node_count` values
+    /// @param[out] centers       The centers of the nodes,
+    ///                           :literal:`node_count` x :literal:`column_count`
+    /// @param[out] radii         The radii of the nodes, :literal:`node_count` values
+    void operator()(const Float* data,
+                    std::int64_t row_count,
+                    std::int64_t column_count,
+                    double degree,
+                    std::int64_t* indices,
+                    Float* ordered_data,
+                    std::int64_t* node_bounds,
+                    Float* centers,
+                    Float* radii) const {
+        const std::int64_t node_count = get_ball_tree_node_count(row_count);
+        const std::int64_t thread_count = dal::detail::threader_get_max_threads();
+        const minkowski_metric<Cpu, Float> metric{ degree };
+
+        for (std::int64_t i = 0; i < row_count; ++i) {
+            indices[i] = i;
+        }
+        node_bounds[0] = 0;
+        node_bounds[1] = row_count;
+
+        for (std::int64_t level_begin = 0, level_size = 1; level_begin < node_count;
+             level_begin += level_size, level_size *= 2) {
+            if (level_size >= thread_count) {
+                const auto task_count = dal::detail::integral_cast<std::int32_t>(level_size);
+                dal::detail::threader_for(task_count, task_count, [&](std::int32_t i) {
+                    build_node(data,
+                               column_count,
+                               node_count,
+                               metric,
+                               level_begin + i,
+                               false,
+                               indices,
+                               node_bounds,
+                               centers,
+                               radii);
+                });
+            }
+            else {
+                for (std::int64_t i = 0; i < level_size; ++i) {
+                    build_node(data,
+                               column_count,
+                               node_count,
+                               metric,
+                               level_begin + i,
+                               true,
+                               indices,
+                               node_bounds,
+                               centers,
+                               radii);
+                }
+            }
+        }
+
+        const std::int64_t block_count =
+            (row_count + ball_tree_row_block_size - 1) / ball_tree_row_block_size;
+        const auto task_count = dal::detail::integral_cast<std::int32_t>(block_count);
+        dal::detail::threader_for(task_count, task_count, [&](std::int32_t block) {
+            const std::int64_t first = block * ball_tree_row_block_size;
+            const std::int64_t last = std::min(first + ball_tree_row_block_size, row_count);
+            for (std::int64_t i = first; i < last; ++i) {
+                std::memcpy(ordered_data + i * column_count,
+                            data + indices[i] * column_count,
+                            column_count * sizeof(Float));
+            }
+        });
+    }
+
+private:
+    /// Computes the center and the spread of the rows of the node, splits the rows
+    /// between its children by the median of the feature with the largest spread
+    /// and computes the radius of the node
+    static void build_node(const Float* data,
+                           std::int64_t column_count,
+                           std::int64_t node_count,
+                           const minkowski_metric<Cpu, Float>& metric,
+                           std::int64_t node,
+                           bool is_parallel,
+                           std::int64_t* indices,
+                           std::int64_t* node_bounds,
+                           Float* centers,
+                           Float* radii) {
+        const std::int64_t begin = node_bounds[2 * node];
+        const std::int64_t end = node_bounds[2 * node + 1];
+        Float* center = centers + node * column_count;
+
+        std::vector<Float> lower(column_count, std::numeric_limits<Float>::max());
+        std::vector<Float> upper(column_count, std::numeric_limits<Float>::lowest());
+        compute_statistics(data,
+                           column_count,
+                           indices,
+                           begin,
+                           end,
+                           is_parallel,
+                           center,
+                           lower.data(),
+                           upper.data());
+        radii[node] =
+            compute_radius(data, column_count, metric, indices, begin, end, is_parallel, center);
+
+        const std::int64_t left = 2 * node + 1;
+        if (left >= node_count) {
+            return;
+        }
+
+        std::int64_t split_column = 0;
+        for (std::int64_t j = 1; j < column_count; ++j) {
+            if (upper[j] - lower[j] > upper[split_column] - lower[split_column]) {
+                split_column = j;
+            }
+        }
+
+        const std::int64_t middle = begin + (end - begin) / 2;
+        if (begin < end) {
+            std::nth_element(indices + begin,
+                             indices + middle,
+                             indices + end,
+                             [&](std::int64_t a, std::int64_t b) {
+                                 return data[a * column_count + split_column] <
+                                        data[b * column_count + split_column];
+                             });
+        }
+
+        node_bounds[2 * left] = begin;
+        node_bounds[2 * left + 1] = middle;
+        node_bounds[2 * left + 2] = middle;
+        node_bounds[2 * left + 3] = end;
+    }
+
+    static void compute_statistics(const Float* data,
+                                   std::int64_t column_count,
+                                   const std::int64_t* indices,
+                                   std::int64_t begin,
+                                   std::int64_t end,
+                                   bool is_parallel,
+                                   Float* mean,
+                                   Float* lower,
+                                   Float* upper) {
+        const auto accumulate = [&](std::int64_t first,
+                                    std::int64_t last,
+                                    Float* sum,
+                                    Float* lo,
+                                    Float* hi) {
+            for (std::int64_t i = first; i < last; ++i) {
+                const Float* row = data + indices[i] * column_count;
+                for (std::int64_t j = 0; j < column_count; ++j) {
+                    sum[j] += row[j];
+                    lo[j] = std::min(lo[j], row[j]);
+                    hi[j] = std::max(hi[j], row[j]);
+                }
+            }
+        };
+
+        std::fill(mean, mean + column_count, Float(0));
+        const std::int64_t block_count =
+            (end - begin + ball_tree_row_block_size - 1) / ball_tree_row_block_size;
+
+        if (!is_parallel || block_count < 2) {
+            accumulate(begin, end, mean, lower, upper);
+        }
+        else {
+            std::vector<Float> sums(block_count * column_count, Float(0));
+            std::vector<Float> lowers(block_count * column_count,
+                                      std::numeric_limits<Float>::max());
+            std::vector<Float> uppers(block_count * column_count,
+                                      std::numeric_limits<Float>::lowest());
+
+            const auto task_count = dal::detail::integral_cast<std::int32_t>(block_count);
+            dal::detail::threader_for(task_count, task_count, [&](std::int32_t block) {
+                const std::int64_t first = begin + block * ball_tree_row_block_size;
+                const std::int64_t last = std::min(first + ball_tree_row_block_size, end);
+                accumulate(first,
+                           last,
+                           sums.data() + block * column_count,
+                           lowers.data() + block * column_count,
+                           uppers.data() + block * column_count);
+            });
+
+            for (std::int64_t block = 0; block < block_count; ++block) {
+                for (std::int64_t j = 0; j < column_count; ++j) {
+                    mean[j] += sums[block * column_count + j];
+                    lower[j] = std::min(lower[j], lowers[block * column_count + j]);
+                    upper[j] = std::max(upper[j], uppers[block * column_count + j]);
+                }
+            }
+        }
+
+        if (end > begin) {
+            const Float inv_count = Float(1) / Float(end - begin);
+            for (std::int64_t j = 0; j < column_count; ++j) {
+                mean[j] *= inv_count;
+            }
+        }
+    }
+
+    static Float compute_radius(const Float* data,
+                                std::int64_t column_count,
+                                const minkowski_metric<Cpu, Float>& metric,
+                                const std::int64_t* indices,
+                                std::int64_t begin,
+                                std::int64_t end,
+                                bool is_parallel,
+                                const Float* center) {
+        const auto get_max_distance = [&](std::int64_t first, std::int64_t last) {
+            Float result = 0;
+            for (std::int64_t i = first; i < last; ++i) {
+                result = std::max(result,
+                                  metric.get_reduced_distance(center,
+                                                              data + indices[i] * column_count,
+                                                              column_count));
+            }
+            return result;
+        };
+
+        const std::int64_t block_count =
+            (end - begin + ball_tree_row_block_size - 1) / ball_tree_row_block_size;
+        if (!is_parallel || block_count < 2) {
+            return metric.finalize(get_max_distance(begin, end));
+        }
+
+        std::vector<Float> partial(block_count, Float(0));
+        const auto task_count = dal::detail::integral_cast<std::int32_t>(block_count);
+        dal::detail::threader_for(task_count, task_count, [&](std::int32_t block) {
+            const std::int64_t first = begin + block * ball_tree_row_block_size;
+            const std::int64_t last = std::min(first + ball_tree_row_block_size, end);
+            partial[block] = get_max_distance(first, last);
+        });
+        return metric.finalize(*std::max_element(partial.begin(), partial.end()));
+    }
+};
+
+template <typename Cpu, typename Float>
+struct ball_tree_radii {
+    /// Recomputes the radii of the nodes for another Minkowski degree
+    void operator()(const ball_tree_view<Float>& tree, double degree, Float* radii) const {
+        const minkowski_metric<Cpu, Float> metric{ degree };
+        const auto task_count = dal::detail::integral_cast<std::int32_t>(tree.node_count);
+        dal::detail::threader_for(task_count, task_count, [&](std::int32_t node) {
+            const Float* center = tree.centers + node * tree.column_count;
+            Float radius = 0;
+            for (std::int64_t i = tree.node_bounds[2 * node]; i < tree.node_bounds[2 * node + 1];
+                 ++i) {
+                radius = std::max(radius,
+                                  metric.get_reduced_distance(center,
+                                                              tree.data + i * tree.column_count,
+                                                              tree.column_count));
+            }
+            radii[node] = metric.finalize(radius);
+        });
+    }
+};
+
+/// Depth-first k-NN search of a single query. The nearer child is visited first,
+/// the node is skipped if the lower bound of the distance to its rows, the distance
+/// to its center minus its radius, exceeds the distance to the k-th neighbor found.
+template <typename Cpu, typename Float>
+class ball_tree_query {
+public:
+    ball_tree_query(const ball_tree_view<Float>& tree,
+                    const minkowski_metric<Cpu, Float>& metric,
+                    std::int64_t neighbor_count)
+            : tree_(tree),
+              metric_(metric),
+              neighbor_count_(neighbor_count),
+              heap_(neighbor_count) {}
+
+    /// Finds the neighbors of the query and writes their original indices sorted by
+    /// the distance. -1 and the maximal value of :literal:`Float` are written if the
+    /// tree has less rows than neighbors.
+    void search(const Float* query, std::int64_t* indices, Float* distances) {
+        query_ = query;
+        heap_size_ = 0;
+        bound_ = std::numeric_limits<Float>::max();
+
+        visit(0, metric_.get_distance(query_, tree_.centers, tree_.column_count));
+
+        std::sort_heap(heap_.begin(), heap_.begin() + heap_size_);
+        for (std::int64_t i = 0; i < heap_size_; ++i) {
+            indices[i] = tree_.indices[heap_[i].second];
+            distances[i] = metric_.finalize(heap_[i].first);
+        }
+        for (std::int64_t i = heap_size_; i < neighbor_count_; ++i) {
+            indices[i] = -1;
+            distances[i] = std::numeric_limits<Float>::max();
+        }
+    }
+
+private:
+    void visit(std::int64_t node, Float center_distance) {
+        if (center_distance - tree_.radii[node] > bound_) {
+            return;
+        }
+        if (tree_.is_leaf(node)) {
+            scan_leaf(node);
+            return;
+        }
+
+        const std::int64_t left = 2 * node + 1;
+        const std::int64_t right = left + 1;
+        const std::int64_t column_count = tree_.column_count;
+        const Float left_distance =
+            metric_.get_distance(query_, tree_.centers + left * column_count, column_count);
+        const Float right_distance =
+            metric_.get_distance(query_, tree_.centers + right * column_count, column_count);
+
+        if (left_distance <= right_distance) {
+            visit(left, left_distance);
+            visit(right, right_distance);
+        }
+        else {
+            visit(right, right_distance);
+            visit(left, left_distance);
+        }
+    }
+
+    void scan_leaf(std::int64_t node) {
+        const std::int64_t column_count = tree_.column_count;
+        const auto begin = heap_.begin();
+        for (std::int64_t i = tree_.node_bounds[2 * node]; i < tree_.node_bounds[2 * node + 1];
+             ++i) {
+            const Float distance =
+                metric_.get_reduced_distance(query_, tree_.data + i * column_count, column_count);
+            if (heap_size_ < neighbor_count_) {
+                heap_[heap_size_++] = { distance, i };
+                std::push_heap(begin, begin + heap_size_);
+                if (heap_size_ == neighbor_count_) {
+                    bound_ = metric_.finalize(heap_[0].first);
+                }
+            }
+            else if (distance < heap_[0].first) {
+                std::pop_heap(begin, begin + heap_size_);
+                heap_[heap_size_ - 1] = { distance, i };
+                std::push_heap(begin, begin + heap_size_);
+                bound_ = metric_.finalize(heap_[0].first);
+            }
+        }
+    }
+
+    const ball_tree_view<Float>& tree_;
+    const minkowski_metric<Cpu, Float>& metric_;
+    const std::int64_t neighbor_count_;
+    std::vector<std::pair<Float, std::int64_t>> heap_;
+    std::int64_t heap_size_ = 0;
+    Float bound_ = std::numeric_limits<Float>::max();
+    const Float* query_ = nullptr;
+};
+
+template <typename Cpu, typename Float>
+struct ball_tree_searcher {
+    /// Finds :literal:`neighbor_count` nearest rows of the tree for each query.
+    /// The queries are split into blocks searched in parallel.
+    ///
+    /// @param[out] indices    The original indices of the neighbors,
+    ///                        :literal:`query_count` x :literal:`neighbor_count`
+    /// @param[out] distances  The distances to the neighbors,
+    ///                        :literal:`query_count` x :literal:`neighbor_count`
+    void operator()(const ball_tree_view<Float>& tree,
+                    double degree,
+                    const Float* queries,
+                    std::int64_t query_count,
+                    std::int64_t neighbor_count,
+                    std::int64_t* indices,
+                    Float* distances) const {
+        const std::int64_t block_count =
+            (query_count + ball_tree_query_block_size - 1) / ball_tree_query_block_size;
+        const auto task_count = dal::detail::integral_cast<std::int32_t>(block_count);
+        const minkowski_metric<Cpu, Float> metric{ degree };
+
+        dal::detail::threader_for(task_count, task_count, [&](std::int32_t block) {
+            ball_tree_query<Cpu, Float> query{ tree, metric, neighbor_count };
+            const std::int64_t first = block * ball_tree_query_block_size;
+            const std::int64_t last = std::min(first + ball_tree_query_block_size, query_count);
+            for (std::int64_t i = first; i < last; ++i) {
+                query.search(queries + i * tree.column_count,
+                             indices + i * neighbor_count,
+                             distances + i * neighbor_count);
+            }
+        });
+    }
+};
+
+} // namespace oneapi::dal::knn::backend
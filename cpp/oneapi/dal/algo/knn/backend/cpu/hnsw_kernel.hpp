@@ -0,0 +1,628 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <functional>
+#include <immintrin.h>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "oneapi/dal/algo/knn/common.hpp"
+#include "oneapi/dal/algo/knn/backend/cpu/minkowski_metric.hpp"
+#include "oneapi/dal/backend/common.hpp"
+#include "oneapi/dal/backend/dispatcher.hpp"
+#include "oneapi/dal/detail/common.hpp"
+#include "oneapi/dal/detail/threading.hpp"
+
+namespace oneapi::dal::knn::backend {
+
+/// The number of rows inserted into the graph by a single task
+inline constexpr std::int64_t hnsw_insert_block_size = 256;
+
+/// The number of queries searched by a single task
+inline constexpr std::int64_t hnsw_query_block_size = 64;
+
+/// The seed of the engine that draws the levels of the nodes
+inline constexpr std::uint32_t hnsw_level_seed = 777;
+
+/// Draws the top layer of each node from the exponentially decaying distribution
+/// with the normalization factor :expr:`1 / ln(max_degree)`, so that each layer
+/// holds about :literal:`max_degree` times fewer nodes than the layer below.
+/// Returns the first node of the highest level, the entry point of the graph.
+inline std::int64_t draw_hnsw_levels(std::int64_t row_count,
+                                     std::int64_t max_degree,
+                                     std::int32_t* levels) {
+    std::mt19937 engine{ hnsw_level_seed };
+    std::uniform_real_distribution<double> uniform{ 0.0, 1.0 };
+    const double factor = 1.0 / std::log(double(max_degree));
+
+    std::int64_t entry_point = 0;
+    for (std::int64_t i = 0; i < row_count; ++i) {
+        levels[i] = static_cast<std::int32_t>(-std::log(1.0 - uniform(engine)) * factor);
+        if (levels[i] > levels[entry_point]) {
+            entry_point = i;
+        }
+    }
+    return entry_point;
+}
+
+/// Read-only view of the HNSW graph, see :literal:`hnsw_model_impl` for the layout
+template <typename Float>
+struct hnsw_view {
+    /// The row-major training rows
+    const Float* data;
+    /// The top layer of each node
+    const std::int32_t* levels;
+    /// The first block of the upper layers of each node
+    const std::int64_t* upper_offsets;
+    /// The link blocks of the bottom layer
+    const std::int32_t* base_links;
+    /// The link blocks of the upper layers
+    const std::int32_t* upper_links;
+    std::int64_t row_count;
+    std::int64_t column_count;
+    std::int64_t max_degree;
+    std::int64_t entry_point;
+
+    const Float* get_row(std::int64_t node) const {
+        return data + node * column_count;
+    }
+
+    std::int32_t get_max_level() const {
+        return levels[entry_point];
+    }
+
+    /// The maximal number of neighbors of a node in the layer
+    std::int64_t get_capacity(std::int32_t level) const {
+        return (level == 0) ? 2 * max_degree : max_degree;
+    }
+
+    /// The offset of the link block of the node in the layer
+    std::int64_t get_links_offset(std::int64_t node, std::int32_t level) const {
+        return (level == 0) ? node * (2 * max_degree + 1)
+                            : (upper_offsets[node] + level - 1) * (max_degree + 1);
+    }
+
+    /// The link block of the node in the layer: the number of the neighbors
+    /// followed by their indices
+    const std::int32_t* get_links(std::int64_t node, std::int32_t level) const {
+        return ((level == 0) ? base_links : upper_links) + get_links_offset(node, level);
+    }
+};
+
+/// The nodes visited by a single search. The set is an open addressing hash table
+/// with linear probing, so its size is proportional to the number of the visited nodes
+/// rather than to the number of the rows, and it is cleared in the same time.
+class hnsw_visited_set {
+public:
+    hnsw_visited_set() : slots_(std::int64_t(1) << min_slot_bits, empty_slot) {}
+
+    void clear() {
+        for (const std::int64_t slot : used_slots_) {
+            slots_[slot] = empty_slot;
+        }
+        used_slots_.clear();
+    }
+
+    /// Adds the node to the set. Returns false if the node is already in it.
+    bool insert(std::int32_t node) {
+        // The load factor is kept below 1/2, so the probe sequences stay short
+        if (2 * std::int64_t(used_slots_.size() + 1) > std::int64_t(slots_.size())) {
+            grow();
+        }
+        const std::int64_t mask = std::int64_t(slots_.size()) - 1;
+        for (std::int64_t slot = get_hash(node);; slot = (slot + 1) & mask) {
+            if (slots_[slot] == node) {
+                return false;
+            }
+            if (slots_[slot] == empty_slot) {
+                slots_[slot] = node;
+                used_slots_.push_back(slot);
+                return true;
+            }
+        }
+    }
+
+private:
+    static constexpr std::int32_t empty_slot = -1;
+    static constexpr std::int32_t min_slot_bits = 10;
+
+    /// Fibonacci hashing: the high bits of the product are well mixed even for
+    /// the consecutive indices of the nodes
+    std::int64_t get_hash(std::int32_t node) const {
+        return std::int64_t((std::uint64_t(std::uint32_t(node)) * 0x9E3779B97F4A7C15ull) >>
+                            (64 - slot_bits_));
+    }
+
+    void grow() {
+        std::vector<std::int32_t> nodes;
+        nodes.reserve(used_slots_.size());
+        for (const std::int64_t slot : used_slots_) {
+            nodes.push_back(slots_[slot]);
+        }
+        ++slot_bits_;
+        slots_.assign(std::int64_t(1) << slot_bits_, empty_slot);
+        used_slots_.clear();
+        for (const std::int32_t node : nodes) {
+            insert(node);
+        }
+    }
+
+    std::int32_t slot_bits_ = min_slot_bits;
+    std::vector<std::int32_t> slots_;
+    std::vector<std::int64_t> used_slots_;
+};
+
+/// The state of the searches run by a single task
+template <typename Cpu, typename Float>
+class hnsw_search_state {
+public:
+    using candidate_t = std::pair<Float, std::int32_t>;
+
+    explicit hnsw_search_state(std::int64_t max_degree) : neighbors_(2 * max_degree) {}
+
+    /// Moves from the entry to the nearest neighbor in the layer until no neighbor
+    /// is nearer to the query. The candidates keep the reduced distances.
+    ///
+    /// @param read_links  Copies the neighbors of a node in a layer to the buffer
+    ///                    and returns their number
+    template <typename ReadLinks>
+    candidate_t search_greedy(const hnsw_view<Float>& graph,
+                              const minkowski_metric<Cpu, Float>& metric,
+                              const Float* query,
+                              candidate_t entry,
+                              std::int32_t level,
+                              const ReadLinks& read_links) {
+        for (bool is_changed = true; is_changed;) {
+            is_changed = false;
+            const std::int64_t count = read_links(entry.second, level, neighbors_.data());
+            for (std::int64_t i = 0; i < count; ++i) {
+                const std::int32_t node = neighbors_[i];
+                const Float distance =
+                    metric.get_reduced_distance(query, graph.get_row(node), graph.column_count);
+                if (distance < entry.first) {
+                    entry = { distance, node };
+                    is_changed = true;
+                }
+            }
+        }
+        return entry;
+    }
+
+    /// Best-first search of the layer from the entry that tracks up to
+    /// :literal:`candidate_count` nearest nodes found. Returns them sorted by the distance.
+    template <typename ReadLinks>
+    const std::vector<candidate_t>& search_layer(const hnsw_view<Float>& graph,
+                                                 const minkowski_metric<Cpu, Float>& metric,
+                                                 const Float* query,
+                                                 candidate_t entry,
+                                                 std::int64_t candidate_count,
+                                                 std::int32_t level,
+                                                 const ReadLinks& read_links) {
+        visited_.clear();
+        visited_.insert(entry.second);
+
+        // The candidates to expand are a min-heap, the nodes found are a max-heap
+        const auto nearer_first = std::greater<candidate_t>{};
+        candidates_.assign(1, entry);
+        found_.assign(1, entry);
+
+        while (!candidates_.empty()) {
+            const candidate_t current = candidates_.front();
+            if (current.first > found_.front().first) {
+                break;
+            }
+            std::pop_heap(candidates_.begin(), candidates_.end(), nearer_first);
+            candidates_.pop_back();
+
+            const std::int64_t count = read_links(current.second, level, neighbors_.data());
+            for (std::int64_t i = 0; i < count; ++i) {
+                const std::int32_t node = neighbors_[i];
+                if (!visited_.insert(node)) {
+                    continue;
+                }
+
+                const Float distance =
+                    metric.get_reduced_distance(query, graph.get_row(node), graph.column_count);
+                const std::int64_t found_count = found_.size();
+                if (found_count < candidate_count || distance < found_.front().first) {
+                    candidates_.emplace_back(distance, node);
+                    std::push_heap(candidates_.begin(), candidates_.end(), nearer_first);
+                    found_.emplace_back(distance, node);
+                    std::push_heap(found_.begin(), found_.end());
+                    if (found_count + 1 > candidate_count) {
+                        std::pop_heap(found_.begin(), found_.end());
+                        found_.pop_back();
+                    }
+                }
+            }
+        }
+
+        std::sort_heap(found_.begin(), found_.end());
+        return found_;
+    }
+
+private:
+    hnsw_visited_set visited_;
+    std::vector<std::int32_t> neighbors_;
+    std::vector<candidate_t> candidates_;
+    std::vector<candidate_t> found_;
+};
+
+/// Keeps the states between the tasks, so that no more states are allocated than
+/// the tasks run concurrently and the buffers grown by the searches are reused.
+template <typename State>
+class hnsw_state_pool {
+public:
+    explicit hnsw_state_pool(std::int64_t max_degree) : max_degree_(max_degree) {}
+
+    std::unique_ptr<State> acquire() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (states_.empty()) {
+            return std::make_unique<State>(max_degree_);
+        }
+        auto state = std::move(states_.back());
+        states_.pop_back();
+        return state;
+    }
+
+    void release(std::unique_ptr<State> state) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        states_.push_back(std::move(state));
+    }
+
+private:
+    const std::int64_t max_degree_;
+    std::mutex mutex_;
+    std::vector<std::unique_ptr<State>> states_;
+};
+
+/// Guards the links of a node while the graph is built in parallel. The lock is held
+/// for a copy or an update of a single link block, so it spins with the pause instruction
+/// instead of yielding the thread.
+class hnsw_node_lock {
+public:
+    explicit hnsw_node_lock(std::atomic<bool>& flag) : flag_(flag) {
+        while (flag_.exchange(true, std::memory_order_acquire)) {
+            while (flag_.load(std::memory_order_relaxed)) {
+                _mm_pause();
+            }
+        }
+    }
+
+    ~hnsw_node_lock() {
+        flag_.store(false, std::memory_order_release);
+    }
+
+    hnsw_node_lock(const hnsw_node_lock&) = delete;
+    hnsw_node_lock& operator=(const hnsw_node_lock&) = delete;
+
+private:
+    std::atomic<bool>& flag_;
+};
+
+template <typename Cpu, typename Float>
+struct hnsw_builder {
+    /// Inserts the rows of the graph into it. The entry point is inserted first,
+    /// it has the highest level, so it stays the entry point for all the insertions.
+    /// The first block of rows is inserted sequentially, the other blocks are
+    /// inserted in parallel with the links of each node guarded by a spin lock.
+    ///
+    /// @param[in]  graph        The graph with the rows, the levels and the upper
+    ///                          offsets set. Its links are read through the view
+    ///                          and written through :literal:`base_links` and
+    ///                          :literal:`upper_links`.
+    /// @param[out] base_links   The link blocks of the bottom layer
+    /// @param[out] upper_links  The link blocks of the upper layers
+    void operator()(const hnsw_view<Float>& graph,
+                    double degree,
+                    std::int64_t ef_construction,
+                    std::int32_t* base_links,
+                    std::int32_t* upper_links) const {
+        using state_t = insert_state;
+
+        const std::int64_t row_count = graph.row_count;
+        const minkowski_metric<Cpu, Float> metric{ degree };
+        const std::int64_t candidate_count = std::max(ef_construction, graph.max_degree);
+
+        std::vector<std::atomic<bool>> locks(row_count);
+        const std::int64_t block_count =
+            (row_count + hnsw_insert_block_size - 1) / hnsw_insert_block_size;
+        const auto task_count = dal::detail::integral_cast<std::int32_t>(block_count);
+
+        dal::detail::threader_for(task_count, task_count, [&](std::int32_t block) {
+            const std::int64_t first = block * hnsw_insert_block_size;
+            const std::int64_t last = std::min(first + hnsw_insert_block_size, row_count);
+            for (std::int64_t node = first; node < last; ++node) {
+                const std::int32_t level = graph.levels[node];
+                for (std::int32_t l = 0; l <= level; ++l) {
+                    base_or_upper(base_links, upper_links, l)[graph.get_links_offset(node, l)] = 0;
+                }
+            }
+        });
+
+        hnsw_state_pool<state_t> pool{ graph.max_degree };
+        const auto insert_block = [&](std::int64_t block) {
+            auto state = pool.acquire();
+            const std::int64_t first = block * hnsw_insert_block_size;
+            const std::int64_t last = std::min(first + hnsw_insert_block_size, row_count);
+            for (std::int64_t node = first; node < last; ++node) {
+                if (node != graph.entry_point) {
+                    insert(graph,
+                           metric,
+                           candidate_count,
+                           node,
+                           locks.data(),
+                           base_links,
+                           upper_links,
+                           *state);
+                }
+            }
+            pool.release(std::move(state));
+        };
+
+        insert_block(0);
+        if (task_count > 1) {
+            dal::detail::threader_for(task_count - 1, task_count - 1, [&](std::int32_t block) {
+                insert_block(block + 1);
+            });
+        }
+    }
+
+private:
+    using candidate_t = typename hnsw_search_state<Cpu, Float>::candidate_t;
+
+    struct insert_state : public hnsw_search_state<Cpu, Float> {
+        explicit insert_state(std::int64_t max_degree)
+                : hnsw_search_state<Cpu, Float>(max_degree) {}
+
+        /// The neighbors of the inserted node
+        std::vector<candidate_t> selected;
+        /// The neighbors of a node the links of which are selected again
+        std::vector<candidate_t> pruned;
+        std::vector<candidate_t> reselected;
+    };
+
+    static std::int32_t* base_or_upper(std::int32_t* base_links,
+                                       std::int32_t* upper_links,
+                                       std::int32_t level) {
+        return (level == 0) ? base_links : upper_links;
+    }
+
+    static void insert(const hnsw_view<Float>& graph,
+                       const minkowski_metric<Cpu, Float>& metric,
+                       std::int64_t candidate_count,
+                       std::int64_t node,
+                       std::atomic<bool>* locks,
+                       std::int32_t* base_links,
+                       std::int32_t* upper_links,
+                       insert_state& state) {
+        const auto read_links = [&](std::int64_t other, std::int32_t l, std::int32_t* neighbors) {
+            hnsw_node_lock lock(locks[other]);
+            const std::int32_t* links = graph.get_links(other, l);
+            std::copy(links + 1, links + 1 + links[0], neighbors);
+            return std::int64_t(links[0]);
+        };
+
+        const Float* row = graph.get_row(node);
+        const std::int32_t level = graph.levels[node];
+        const std::int32_t max_level = graph.get_max_level();
+        const auto entry_point = static_cast<std::int32_t>(graph.entry_point);
+
+        candidate_t entry{
+            metric.get_reduced_distance(row, graph.get_row(entry_point), graph.column_count),
+            entry_point
+        };
+        for (std::int32_t l = max_level; l > level; --l) {
+            entry = state.search_greedy(graph, metric, row, entry, l, read_links);
+        }
+
+        for (std::int32_t l = std::min(level, max_level); l >= 0; --l) {
+            const auto& found =
+                state.search_layer(graph, metric, row, entry, candidate_count, l, read_links);
+            select_neighbors(graph, metric, found, graph.max_degree, node, state.selected);
+
+            {
+                hnsw_node_lock lock(locks[node]);
+                std::int32_t* links = base_or_upper(base_links, upper_links, l) +
+                                      graph.get_links_offset(node, l);
+                links[0] = static_cast<std::int32_t>(state.selected.size());
+                for (std::size_t i = 0; i < state.selected.size(); ++i) {
+                    links[i + 1] = state.selected[i].second;
+                }
+            }
+
+            for (const auto& neighbor : state.selected) {
+                connect(graph,
+                        metric,
+                        neighbor.second,
+                        { neighbor.first, static_cast<std::int32_t>(node) },
+                        l,
+                        locks,
+                        base_links,
+                        upper_links,
+                        state);
+            }
+
+            entry = found.front();
+        }
+    }
+
+    /// Adds the link to the new node to the links of the node. If the block is full,
+    /// the links are selected again among the old neighbors and the new node.
+    static void connect(const hnsw_view<Float>& graph,
+                        const minkowski_metric<Cpu, Float>& metric,
+                        std::int32_t node,
+                        candidate_t new_neighbor,
+                        std::int32_t level,
+                        std::atomic<bool>* locks,
+                        std::int32_t* base_links,
+                        std::int32_t* upper_links,
+                        insert_state& state) {
+        hnsw_node_lock lock(locks[node]);
+        std::int32_t* links =
+            base_or_upper(base_links, upper_links, level) + graph.get_links_offset(node, level);
+        const std::int64_t count = links[0];
+        const std::int64_t capacity = graph.get_capacity(level);
+
+        if (count < capacity) {
+            links[count + 1] = new_neighbor.second;
+            links[0] = static_cast<std::int32_t>(count + 1);
+            return;
+        }
+
+        const Float* row = graph.get_row(node);
+        state.pruned.assign(1, new_neighbor);
+        for (std::int64_t i = 0; i < count; ++i) {
+            const std::int32_t other = links[i + 1];
+            state.pruned.emplace_back(
+                metric.get_reduced_distance(row, graph.get_row(other), graph.column_count),
+                other);
+        }
+        std::sort(state.pruned.begin(), state.pruned.end());
+
+        select_neighbors(graph, metric, state.pruned, capacity, node, state.reselected);
+        links[0] = static_cast<std::int32_t>(state.reselected.size());
+        for (std::size_t i = 0; i < state.reselected.size(); ++i) {
+            links[i + 1] = state.reselected[i].second;
+        }
+    }
+
+    /// Selects up to :literal:`max_count` neighbors among the candidates sorted by
+    /// the distance. A candidate is kept if it is nearer to the node than to all
+    /// the neighbors kept before, so the links go in diverse directions and
+    /// the clusters of the rows stay connected.
+    static void select_neighbors(const hnsw_view<Float>& graph,
+                                 const minkowski_metric<Cpu, Float>& metric,
+                                 const std::vector<candidate_t>& candidates,
+                                 std::int64_t max_count,
+                                 std::int64_t node,
+                                 std::vector<candidate_t>& selected) {
+        selected.clear();
+        for (const auto& candidate : candidates) {
+            const std::int64_t selected_count = selected.size();
+            if (selected_count >= max_count) {
+                break;
+            }
+            if (candidate.second == node) {
+                continue;
+            }
+
+            const Float* row = graph.get_row(candidate.second);
+            bool is_diverse = true;
+            for (const auto& neighbor : selected) {
+                const Float distance = metric.get_reduced_distance(row,
+                                                                   graph.get_row(neighbor.second),
+                                                                   graph.column_count);
+                if (distance < candidate.first) {
+                    is_diverse = false;
+                    break;
+                }
+            }
+            if (is_diverse) {
+                selected.push_back(candidate);
+            }
+        }
+    }
+};
+
+template <typename Cpu, typename Float>
+struct hnsw_searcher {
+    /// Finds :literal:`neighbor_count` approximate nearest rows of the graph for
+    /// each query. The queries are split into blocks searched in parallel.
+    /// -1 and the maximal value of :literal:`Float` are written if less neighbors
+    /// than :literal:`neighbor_count` are found.
+    ///
+    /// @param[out] indices    The indices of the neighbors,
+    ///                        :literal:`query_count` x :literal:`neighbor_count`
+    /// @param[out] distances  The distances to the neighbors,
+    ///                        :literal:`query_count` x :literal:`neighbor_count`
+    void operator()(const hnsw_view<Float>& graph,
+                    double degree,
+                    std::int64_t ef_search,
+                    const Float* queries,
+                    std::int64_t query_count,
+                    std::int64_t neighbor_count,
+                    std::int64_t* indices,
+                    Float* distances) const {
+        using state_t = hnsw_search_state<Cpu, Float>;
+
+        const minkowski_metric<Cpu, Float> metric{ degree };
+        const std::int64_t candidate_count = std::max(ef_search, neighbor_count);
+        const std::int32_t max_level = graph.get_max_level();
+        const auto entry_point = static_cast<std::int32_t>(graph.entry_point);
+
+        const auto read_links = [&](std::int64_t node, std::int32_t l, std::int32_t* neighbors) {
+            const std::int32_t* links = graph.get_links(node, l);
+            std::copy(links + 1, links + 1 + links[0], neighbors);
+            return std::int64_t(links[0]);
+        };
+
+        hnsw_state_pool<state_t> pool{ graph.max_degree };
+        const std::int64_t block_count =
+            (query_count + hnsw_query_block_size - 1) / hnsw_query_block_size;
+        const auto task_count = dal::detail::integral_cast<std::int32_t>(block_count);
+
+        dal::detail::threader_for(task_count, task_count, [&](std::int32_t block) {
+            auto state = pool.acquire();
+            const std::int64_t first = block * hnsw_query_block_size;
+            const std::int64_t last = std::min(first + hnsw_query_block_size, query_count);
+            for (std::int64_t i = first; i < last; ++i) {
+                const Float* query = queries + i * graph.column_count;
+                typename state_t::candidate_t entry{
+                    metric.get_reduced_distance(query,
+                                                graph.get_row(entry_point),
+                                                graph.column_count),
+                    entry_point
+                };
+                for (std::int32_t l = max_level; l > 0; --l) {
+                    entry = state->search_greedy(graph, metric, query, entry, l, read_links);
+                }
+                const auto& found = state->search_layer(graph,
+                                                        metric,
+                                                        query,
+                                                        entry,
+                                                        candidate_count,
+                                                        0,
+                                                        read_links);
+
+                const std::int64_t found_count =
+                    std::min<std::int64_t>(found.size(), neighbor_count);
+                std::int64_t* query_indices = indices + i * neighbor_count;
+                Float* query_distances = distances + i * neighbor_count;
+                for (std::int64_t j = 0; j < found_count; ++j) {
+                    query_indices[j] = found[j].second;
+                    query_distances[j] = metric.finalize(found[j].first);
+                }
+                for (std::int64_t j = found_count; j < neighbor_count; ++j) {
+                    query_indices[j] = -1;
+                    query_distances[j] = std::numeric_limits<Float>::max();
+                }
+            }
+            pool.release(std::move(state));
+        });
+    }
+};
+
+} // namespace oneapi::dal::knn::backend
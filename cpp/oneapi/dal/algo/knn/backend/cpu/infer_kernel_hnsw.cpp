@@ -0,0 +1,121 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "oneapi/dal/algo/knn/backend/cpu/infer_kernel.hpp"
+#include "oneapi/dal/algo/knn/backend/cpu/hnsw_kernel.hpp"
+#include "oneapi/dal/algo/knn/backend/cpu/vote.hpp"
+#include "oneapi/dal/algo/knn/backend/model_conversion.hpp"
+#include "oneapi/dal/backend/dispatcher.hpp"
+
+#include "oneapi/dal/table/row_accessor.hpp"
+#include "oneapi/dal/table/detail/table_builder.hpp"
+
+namespace oneapi::dal::knn::backend {
+
+using dal::backend::context_cpu;
+
+template <typename Float, typename Task>
+static infer_result<Task> infer(const context_cpu& ctx,
+                                const detail::descriptor_base<Task>& desc,
+                                const infer_input<Task>& input) {
+    using msg = dal::detail::error_messages;
+
+    const auto trained_model =
+        dynamic_cast_to_knn_model<Task, hnsw_model_impl<Task>>(input.get_model());
+
+    const table& data = input.get_data();
+    const table graph_data = trained_model->get_data();
+    const std::int64_t query_count = data.get_row_count();
+    const std::int64_t column_count = graph_data.get_column_count();
+    const std::int64_t neighbor_count = desc.get_neighbor_count();
+
+    if (data.get_column_count() != column_count) {
+        throw invalid_argument{ msg::input_model_data_cc_neq_input_data_cc() };
+    }
+
+    const auto graph_data_arr = row_accessor<const Float>(graph_data).pull();
+    const hnsw_view<Float> graph{ graph_data_arr.get_data(),
+                                  trained_model->get_levels().get_data(),
+                                  trained_model->get_upper_offsets().get_data(),
+                                  trained_model->get_base_links().get_data(),
+                                  trained_model->get_upper_links().get_data(),
+                                  graph_data.get_row_count(),
+                                  column_count,
+                                  trained_model->get_max_degree(),
+                                  trained_model->get_entry_point() };
+
+    // The graph built for the training distance is searched with the inference
+    // distance, the search stays approximate if they differ
+    const double degree = get_minkowski_degree(desc);
+
+    const auto queries = row_accessor<const Float>(data).pull();
+    const std::int64_t result_size = dal::detail::check_mul_overflow(query_count, neighbor_count);
+    auto arr_indices = array<std::int64_t>::empty(result_size);
+    auto arr_distances = array<Float>::empty(result_size);
+
+    dal::backend::dispatch_by_cpu(ctx, [&](auto cpu) {
+        hnsw_searcher<decltype(cpu), Float>{}(graph,
+                                              degree,
+                                              desc.get_ef_search(),
+                                              queries.get_data(),
+                                              query_count,
+                                              neighbor_count,
+                                              arr_indices.get_mutable_data(),
+                                              arr_distances.get_mutable_data());
+    });
+
+    auto result = infer_result<Task>{};
+    if constexpr (std::is_same_v<Task, task::search>) {
+        result = result
+                     .set_indices(dal::detail::homogen_table_builder{}
+                                      .reset(arr_indices, query_count, neighbor_count)
+                                      .build())
+                     .set_distances(dal::detail::homogen_table_builder{}
+                                        .reset(arr_distances, query_count, neighbor_count)
+                                        .build());
+    }
+    else {
+        const auto responses = row_accessor<const Float>(trained_model->get_responses()).pull();
+        auto arr_responses = array<Float>::empty(query_count);
+        vote(responses.get_data(),
+             arr_indices.get_data(),
+             arr_distances.get_data(),
+             query_count,
+             neighbor_count,
+             desc.get_class_count(),
+             desc.get_voting_mode(),
+             arr_responses.get_mutable_data());
+        result = result.set_responses(
+            dal::detail::homogen_table_builder{}.reset(arr_responses, query_count, 1).build());
+    }
+    return result;
+}
+
+template <typename Float, typename Task>
+struct infer_kernel_cpu<Float, method::hnsw, Task> {
+    infer_result<Task> operator()(const context_cpu& ctx,
+                                  const detail::descriptor_base<Task>& desc,
+                                  const infer_input<Task>& input) const {
+        return infer<Float>(ctx, desc, input);
+    }
+};
+
+template struct infer_kernel_cpu<float, method::hnsw, task::classification>;
+template struct infer_kernel_cpu<double, method::hnsw, task::classification>;
+template struct infer_kernel_cpu<float, method::hnsw, task::search>;
+template struct infer_kernel_cpu<double, method::hnsw, task::search>;
+
+} // namespace oneapi::dal::knn::backend
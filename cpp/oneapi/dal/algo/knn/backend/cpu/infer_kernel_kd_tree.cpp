@@ -16,7 +16,11 @@
 
 #include <daal/src/algorithms/k_nearest_neighbors/kdtree_knn_classification_predict_dense_default_batch.h>
 
+#include <cmath>
+#include <tuple>
+
 #include "oneapi/dal/algo/knn/backend/cpu/infer_kernel.hpp"
+#include "oneapi/dal/algo/knn/backend/distance_impl.hpp"
 #include "oneapi/dal/algo/knn/backend/model_impl.hpp"
 #include "oneapi/dal/algo/knn/backend/model_conversion.hpp"
 #include "oneapi/dal/backend/interop/common.hpp"
@@ -24,6 +28,7 @@
 #include "oneapi/dal/backend/interop/table_conversion.hpp"
 
 #include "oneapi/dal/table/row_accessor.hpp"
+#include "oneapi/dal/table/detail/csr.hpp"
 
 namespace oneapi::dal::knn::backend {
 
@@ -38,6 +43,104 @@ template <typename Float, daal::CpuType Cpu>
 using daal_knn_kd_tree_kernel_t = daal_knn::prediction::internal::
     KNNClassificationPredictKernel<Float, daal_knn::prediction::defaultDense, Cpu>;
 
+using daal_kernel_parameter_t = daal_knn::prediction::internal::KernelParameter;
+
+template <typename Float>
+using daal_radius_search_result_iface_t =
+    daal_knn::prediction::internal::RadiusSearchResultIface<Float>;
+
+/// Keeps the neighbor lists of the radius search allocated by the DAAL kernel
+template <typename Float>
+class radius_search_result : public daal_radius_search_result_iface_t<Float> {
+public:
+    daal::services::Status allocate(std::size_t query_count,
+                                    std::size_t neighbor_count,
+                                    DAAL_INT64*& row_offsets,
+                                    DAAL_INT64*& indices,
+                                    Float*& distances) override {
+        try {
+            row_offsets_ = array<DAAL_INT64>::empty(
+                dal::detail::integral_cast<std::int64_t>(query_count + 1));
+            indices_ =
+                array<DAAL_INT64>::empty(dal::detail::integral_cast<std::int64_t>(neighbor_count));
+            distances_ =
+                array<Float>::empty(dal::detail::integral_cast<std::int64_t>(neighbor_count));
+        }
+        catch (const std::exception&) {
+            return daal::services::Status(daal::services::ErrorMemoryAllocationFailed);
+        }
+        row_offsets = row_offsets_.get_mutable_data();
+        indices = indices_.get_mutable_data();
+        distances = distances_.get_mutable_data();
+        return daal::services::Status();
+    }
+
+    /// Builds CSR tables of the neighbor distances and indices. The column indices
+    /// of both tables are the one-based indices of the neighbors in the training set
+    std::tuple<table, table> build(std::int64_t query_count, std::int64_t train_row_count) const {
+        const std::int64_t neighbor_count = distances_.get_count();
+        const DAAL_INT64* const offsets_ptr = row_offsets_.get_data();
+        const DAAL_INT64* const indices_ptr = indices_.get_data();
+
+        auto row_indices = array<std::int64_t>::empty(query_count + 1);
+        std::int64_t* const row_indices_ptr = row_indices.get_mutable_data();
+        for (std::int64_t i = 0; i <= query_count; ++i) {
+            row_indices_ptr[i] = offsets_ptr[i] + 1;
+        }
+
+        auto column_indices = array<std::int64_t>::empty(neighbor_count);
+        auto neighbor_indices = array<std::int32_t>::empty(neighbor_count);
+        std::int64_t* const column_indices_ptr = column_indices.get_mutable_data();
+        std::int32_t* const neighbor_indices_ptr = neighbor_indices.get_mutable_data();
+        for (std::int64_t i = 0; i < neighbor_count; ++i) {
+            column_indices_ptr[i] = indices_ptr[i] + 1;
+            neighbor_indices_ptr[i] = static_cast<std::int32_t>(indices_ptr[i]);
+        }
+
+        return { dal::detail::csr_table(neighbor_indices,
+                                        column_indices,
+                                        row_indices,
+                                        query_count,
+                                        train_row_count),
+                 dal::detail::csr_table(distances_,
+                                        column_indices,
+                                        row_indices,
+                                        query_count,
+                                        train_row_count) };
+    }
+
+private:
+    array<DAAL_INT64> row_offsets_;
+    array<DAAL_INT64> indices_;
+    array<Float> distances_;
+};
+
+template <typename Float, typename Task>
+static infer_result<Task> call_daal_radius_search(const context_cpu& ctx,
+                                                  const daal_kernel_parameter_t& daal_parameter,
+                                                  const table& data,
+                                                  const model<Task>& m) {
+    const std::int64_t row_count = data.get_row_count();
+    const auto daal_data = interop::convert_to_daal_table<Float>(data);
+    const auto model_ptr = dynamic_cast_to_knn_model<Task, kd_tree_model_impl<Task>>(m);
+    const auto& daal_model = model_ptr->get_interop()->get_daal_model();
+
+    const auto daal_kd_tree_model = static_cast<const daal_knn::Model*>(daal_model.get());
+    // Indices of the neighbors are returned as 32-bit integers, the cast checks they fit
+    const std::int64_t train_row_count = dal::detail::integral_cast<std::int32_t>(
+        daal_kd_tree_model->impl()->getData()->getNumberOfRows());
+
+    radius_search_result<Float> daal_result;
+    interop::status_to_exception(dal::backend::dispatch_by_cpu(ctx, [&](auto cpu) {
+        return daal_knn_kd_tree_kernel_t<Float,
+                                         interop::to_daal_cpu_type<decltype(cpu)>::value>()
+            .computeRadius(daal_data.get(), daal_model.get(), &daal_parameter, daal_result);
+    }));
+
+    const auto [indices, distances] = daal_result.build(row_count, train_row_count);
+    return infer_result<Task>{}.set_indices(indices).set_distances(distances);
+}
+
 template <typename Float, typename Task>
 static infer_result<Task> call_daal_kernel(const context_cpu& ctx,
                                            const detail::descriptor_base<Task>& desc,
@@ -56,7 +159,7 @@ static infer_result<Task> call_daal_kernel(const context_cpu& ctx,
 
     const std::int64_t dummy_seed = 777;
     const auto data_use_in_model = daal_knn::doNotUse;
-    daal_knn::Parameter daal_parameter(
+    daal_kernel_parameter_t daal_parameter(
         dal::detail::integral_cast<std::size_t>(desc.get_class_count()),
         dal::detail::integral_cast<std::size_t>(desc.get_neighbor_count()),
         dal::detail::integral_cast<int>(dummy_seed),
@@ -65,7 +168,19 @@ static infer_result<Task> call_daal_kernel(const context_cpu& ctx,
     const auto daal_voting_mode = convert_to_daal_kdtree_voting_mode(desc.get_voting_mode());
     daal_parameter.voteWeights = daal_voting_mode;
 
+    auto distance_impl = detail::get_distance_impl(desc);
+    if (!distance_impl) {
+        throw internal_error{ dal::detail::error_messages::unknown_distance_type() };
+    }
+    daal_parameter.pairwiseDistance = distance_impl->get_daal_distance_type();
+    daal_parameter.minkowskiDegree = distance_impl->get_degree();
+
     if constexpr (std::is_same_v<Task, task::search>) {
+        if (std::isfinite(desc.get_radius())) {
+            daal_parameter.radius = desc.get_radius();
+            return call_daal_radius_search<Float>(ctx, daal_parameter, data, m);
+        }
+
         daal_parameter.resultsToEvaluate = daal_classifier::none;
         daal_parameter.resultsToCompute =
             daal_knn::computeDistances | daal_knn::computeIndicesOfNeighbors;
@@ -0,0 +1,127 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "oneapi/dal/algo/knn/common.hpp"
+#include "oneapi/dal/algo/knn/backend/distance_impl.hpp"
+#include "oneapi/dal/backend/common.hpp"
+
+namespace oneapi::dal::knn::backend {
+
+/// Minkowski distance of the degree p > 0, the infinite degree stands for the
+/// Chebyshev distance. The rows are compared by the reduced distance, the sum of
+/// the p-th powers of the absolute differences, which keeps the order of the
+/// distances and does not need the root.
+///
+/// The metric is parameterized by the CPU, so that each kernel instantiated for
+/// a CPU gets the loops below vectorized for its instruction set.
+template <typename Cpu, typename Float>
+class minkowski_metric {
+public:
+    explicit minkowski_metric(double degree)
+            : degree_(degree),
+              inv_degree_(Float(1.0 / degree)),
+              kind_(std::isinf(degree) ? kind::chebyshev
+                    : (degree == 1.0)  ? kind::manhattan
+                    : (degree == 2.0)  ? kind::euclidean
+                                       : kind::minkowski) {}
+
+    double get_degree() const {
+        return degree_;
+    }
+
+    Float get_reduced_distance(const Float* x, const Float* y, std::int64_t column_count) const {
+        Float result = 0;
+        switch (kind_) {
+            case kind::euclidean:
+                PRAGMA_IVDEP
+                PRAGMA_VECTOR_ALWAYS
+                for (std::int64_t i = 0; i < column_count; ++i) {
+                    const Float diff = x[i] - y[i];
+                    result += diff * diff;
+                }
+                break;
+            case kind::manhattan:
+                PRAGMA_IVDEP
+                PRAGMA_VECTOR_ALWAYS
+                for (std::int64_t i = 0; i < column_count; ++i) {
+                    result += std::abs(x[i] - y[i]);
+                }
+                break;
+            case kind::minkowski: {
+                const Float degree = Float(degree_);
+                for (std::int64_t i = 0; i < column_count; ++i) {
+                    result += std::pow(std::abs(x[i] - y[i]), degree);
+                }
+                break;
+            }
+            case kind::chebyshev:
+                PRAGMA_IVDEP
+                PRAGMA_VECTOR_ALWAYS
+                for (std::int64_t i = 0; i < column_count; ++i) {
+                    result = std::max(result, std::abs(x[i] - y[i]));
+                }
+                break;
+        }
+        return result;
+    }
+
+    Float finalize(Float reduced_distance) const {
+        switch (kind_) {
+            case kind::euclidean: return std::sqrt(reduced_distance);
+            case kind::minkowski: return std::pow(reduced_distance, inv_degree_);
+            default: return reduced_distance;
+        }
+    }
+
+    Float get_distance(const Float* x, const Float* y, std::int64_t column_count) const {
+        return finalize(get_reduced_distance(x, y, column_count));
+    }
+
+private:
+    enum class kind { euclidean, manhattan, minkowski, chebyshev };
+
+    double degree_;
+    Float inv_degree_;
+    kind kind_;
+};
+
+/// Returns the degree of the Minkowski metric for the distance of the descriptor,
+/// infinity stands for the Chebyshev distance
+template <typename Task>
+inline double get_minkowski_degree(const detail::descriptor_base<Task>& desc) {
+    using msg = dal::detail::error_messages;
+    using daal_distance = detail::daal_distance_t;
+
+    const auto distance_impl = detail::get_distance_impl(desc);
+    if (!distance_impl) {
+        throw internal_error{ msg::unknown_distance_type() };
+    }
+
+    switch (distance_impl->get_daal_distance_type()) {
+        case daal_distance::euclidean: return 2.0;
+        case daal_distance::chebyshev: return std::numeric_limits<double>::infinity();
+        case daal_distance::minkowski: return distance_impl->get_degree();
+        default: throw internal_error{ msg::unknown_distance_type() };
+    }
+}
+
+} // namespace oneapi::dal::knn::backend
@@ -0,0 +1,92 @@
+/*******************************************************************************
+* Copyright 2020-2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "oneapi/dal/algo/knn/backend/cpu/train_kernel.hpp"
+#include "oneapi/dal/algo/knn/backend/cpu/ball_tree_kernel.hpp"
+#include "oneapi/dal/algo/knn/backend/model_impl.hpp"
+#include "oneapi/dal/backend/dispatcher.hpp"
+
+#include "oneapi/dal/table/row_accessor.hpp"
+#include "oneapi/dal/table/detail/table_builder.hpp"
+
+namespace oneapi::dal::knn::backend {
+
+using dal::backend::context_cpu;
+
+template <typename Float, typename Task>
+static train_result<Task> train(const context_cpu& ctx,
+                                const detail::descriptor_base<Task>& desc,
+                                const train_input<Task>& input) {
+    using model_t = model<Task>;
+
+    const table& data = input.get_data();
+    const std::int64_t row_count = data.get_row_count();
+    const std::int64_t column_count = data.get_column_count();
+    const std::int64_t node_count = get_ball_tree_node_count(row_count);
+
+    const double degree = get_ball_tree_degree(desc);
+
+    const auto data_arr = row_accessor<const Float>(data).pull();
+    auto indices = array<std::int64_t>::empty(row_count);
+    auto ordered_data =
+        array<Float>::empty(dal::detail::check_mul_overflow(row_count, column_count));
+    auto node_bounds = array<std::int64_t>::empty(2 * node_count);
+    auto centers = array<Float>::empty(dal::detail::check_mul_overflow(node_count, column_count));
+    auto radii = array<Float>::empty(node_count);
+
+    dal::backend::dispatch_by_cpu(ctx, [&](auto cpu) {
+        ball_tree_builder<decltype(cpu), Float>{}(data_arr.get_data(),
+                                                  row_count,
+                                                  column_count,
+                                                  degree,
+                                                  indices.get_mutable_data(),
+                                                  ordered_data.get_mutable_data(),
+                                                  node_bounds.get_mutable_data(),
+                                                  centers.get_mutable_data(),
+                                                  radii.get_mutable_data());
+    });
+
+    auto responses = table{};
+    if constexpr (!std::is_same_v<Task, task::search>) {
+        responses = input.get_responses();
+    }
+
+    const auto model_impl = std::make_shared<ball_tree_model_impl<Task>>(
+        dal::detail::homogen_table_builder{}.reset(ordered_data, row_count, column_count).build(),
+        responses,
+        indices,
+        node_bounds,
+        dal::detail::homogen_table_builder{}.reset(centers, node_count, column_count).build(),
+        dal::detail::homogen_table_builder{}.reset(radii, node_count, 1).build(),
+        degree);
+    return train_result<Task>().set_model(dal::detail::make_private<model_t>(model_impl));
+}
+
+template <typename Float, typename Task>
+struct train_kernel_cpu<Float, method::ball_tree, Task> {
+    train_result<Task> operator()(const context_cpu& ctx,
+                                  const detail::descriptor_base<Task>& desc,
+                                  const train_input<Task>& input) const {
+        return train<Float>(ctx, desc, input);
+    }
+};
+
+template struct train_kernel_cpu<float, method::ball_tree, task::classification>;
+template struct train_kernel_cpu<double, method::ball_tree, task::classification>;
+template struct train_kernel_cpu<float, method::ball_tree, task::search>;
+template struct train_kernel_cpu<double, method::ball_tree, task::search>;
+
+} // namespace oneapi::dal::knn::backend
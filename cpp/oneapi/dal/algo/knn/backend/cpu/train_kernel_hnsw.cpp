@@ -0,0 +1,113 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "oneapi/dal/algo/knn/backend/cpu/train_kernel.hpp"
+#include "oneapi/dal/algo/knn/backend/cpu/hnsw_kernel.hpp"
+#include "oneapi/dal/algo/knn/backend/model_impl.hpp"
+#include "oneapi/dal/backend/dispatcher.hpp"
+
+#include "oneapi/dal/table/row_accessor.hpp"
+#include "oneapi/dal/table/detail/table_builder.hpp"
+
+namespace oneapi::dal::knn::backend {
+
+using dal::backend::context_cpu;
+
+template <typename Float, typename Task>
+static train_result<Task> train(const context_cpu& ctx,
+                                const detail::descriptor_base<Task>& desc,
+                                const train_input<Task>& input) {
+    using model_t = model<Task>;
+    using msg = dal::detail::error_messages;
+
+    const table& data = input.get_data();
+    const std::int64_t row_count = data.get_row_count();
+    const std::int64_t column_count = data.get_column_count();
+    const std::int64_t max_degree = desc.get_max_degree();
+    const double degree = get_minkowski_degree(desc);
+
+    // The links keep 32-bit indices of the nodes
+    if (row_count > dal::detail::limits<std::int32_t>::max()) {
+        throw domain_error(msg::row_count_gt_max_int32());
+    }
+
+    auto levels = array<std::int32_t>::empty(row_count);
+    const std::int64_t entry_point =
+        draw_hnsw_levels(row_count, max_degree, levels.get_mutable_data());
+
+    auto upper_offsets = array<std::int64_t>::empty(row_count + 1);
+    std::int64_t* upper_offsets_ptr = upper_offsets.get_mutable_data();
+    upper_offsets_ptr[0] = 0;
+    for (std::int64_t i = 0; i < row_count; ++i) {
+        upper_offsets_ptr[i + 1] = upper_offsets_ptr[i] + levels[i];
+    }
+
+    auto base_links = array<std::int32_t>::empty(
+        dal::detail::check_mul_overflow(row_count, 2 * max_degree + 1));
+    auto upper_links = array<std::int32_t>::empty(
+        dal::detail::check_mul_overflow(upper_offsets_ptr[row_count], max_degree + 1));
+
+    const auto data_arr = row_accessor<const Float>(data).pull();
+    const hnsw_view<Float> graph{ data_arr.get_data(),
+                                  levels.get_data(),
+                                  upper_offsets.get_data(),
+                                  base_links.get_data(),
+                                  upper_links.get_data(),
+                                  row_count,
+                                  column_count,
+                                  max_degree,
+                                  entry_point };
+
+    dal::backend::dispatch_by_cpu(ctx, [&](auto cpu) {
+        hnsw_builder<decltype(cpu), Float>{}(graph,
+                                             degree,
+                                             desc.get_ef_construction(),
+                                             base_links.get_mutable_data(),
+                                             upper_links.get_mutable_data());
+    });
+
+    auto responses = table{};
+    if constexpr (!std::is_same_v<Task, task::search>) {
+        responses = input.get_responses();
+    }
+
+    const auto model_impl = std::make_shared<hnsw_model_impl<Task>>(data,
+                                                                    responses,
+                                                                    levels,
+                                                                    upper_offsets,
+                                                                    base_links,
+                                                                    upper_links,
+                                                                    entry_point,
+                                                                    max_degree,
+                                                                    degree);
+    return train_result<Task>().set_model(dal::detail::make_private<model_t>(model_impl));
+}
+
+template <typename Float, typename Task>
+struct train_kernel_cpu<Float, method::hnsw, Task> {
+    train_result<Task> operator()(const context_cpu& ctx,
+                                  const detail::descriptor_base<Task>& desc,
+                                  const train_input<Task>& input) const {
+        return train<Float>(ctx, desc, input);
+    }
+};
+
+template struct train_kernel_cpu<float, method::hnsw, task::classification>;
+template struct train_kernel_cpu<double, method::hnsw, task::classification>;
+template struct train_kernel_cpu<float, method::hnsw, task::search>;
+template struct train_kernel_cpu<double, method::hnsw, task::search>;
+
+} // namespace oneapi::dal::knn::backend
@@ -0,0 +1,84 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <vector>
+
+#include "oneapi/dal/algo/knn/common.hpp"
+#include "oneapi/dal/detail/common.hpp"
+#include "oneapi/dal/detail/threading.hpp"
+
+namespace oneapi::dal::knn::backend {
+
+/// The number of queries voted by a single task
+inline constexpr std::int64_t vote_query_block_size = 64;
+
+/// Votes for the class of each query by the responses of its neighbors. With the
+/// distance voting the neighbors at zero distance, if any, outweigh all the others.
+template <typename Float>
+inline void vote(const Float* responses,
+                 const std::int64_t* indices,
+                 const Float* distances,
+                 std::int64_t query_count,
+                 std::int64_t neighbor_count,
+                 std::int64_t class_count,
+                 voting_mode mode,
+                 Float* labels) {
+    const std::int64_t block_count =
+        (query_count + vote_query_block_size - 1) / vote_query_block_size;
+    const auto task_count = dal::detail::integral_cast<std::int32_t>(block_count);
+
+    dal::detail::threader_for(task_count, task_count, [&](std::int32_t block) {
+        std::vector<double> votes(class_count);
+        const std::int64_t first = block * vote_query_block_size;
+        const std::int64_t last = std::min(first + vote_query_block_size, query_count);
+        for (std::int64_t i = first; i < last; ++i) {
+            const std::int64_t* query_indices = indices + i * neighbor_count;
+            const Float* query_distances = distances + i * neighbor_count;
+
+            bool has_exact_match = false;
+            for (std::int64_t j = 0; j < neighbor_count; ++j) {
+                has_exact_match |= (query_indices[j] >= 0 && query_distances[j] == Float(0));
+            }
+
+            std::fill(votes.begin(), votes.end(), 0.0);
+            for (std::int64_t j = 0; j < neighbor_count; ++j) {
+                if (query_indices[j] < 0) {
+                    continue;
+                }
+                const auto label = static_cast<std::int64_t>(responses[query_indices[j]]);
+                if (label < 0 || label >= class_count) {
+                    continue;
+                }
+                if (mode == voting_mode::uniform) {
+                    votes[label] += 1.0;
+                }
+                else if (has_exact_match) {
+                    votes[label] += (query_distances[j] == Float(0)) ? 1.0 : 0.0;
+                }
+                else {
+                    votes[label] += 1.0 / query_distances[j];
+                }
+            }
+
+            labels[i] = Float(std::max_element(votes.begin(), votes.end()) - votes.begin());
+        }
+    });
+}
+
+} // namespace oneapi::dal::knn::backend
@@ -32,6 +32,7 @@ public:
 
 } // namespace v1
 
+using v1::daal_distance_t;
 using v1::distance_impl;
 
 } // namespace oneapi::dal::knn::detail
@@ -110,5 +110,195 @@ private:
     backend::model_interop* interop_;
 };
 
+/// The ball tree is a complete binary tree stored level by level: the children of
+/// the node i are the nodes 2i + 1 and 2i + 2. The training rows are reordered so
+/// that every node holds a contiguous range of them.
+template <typename Task>
+class ball_tree_model_impl : public model_impl<Task>,
+                             public KNN_SERIALIZABLE(Task,
+                                                     knn_ball_tree_classification_model_impl_id,
+                                                     knn_ball_tree_search_model_impl_id) {
+public:
+    ball_tree_model_impl() = default;
+
+    /// @param data         The training rows in the order of the tree nodes
+    /// @param responses    The responses in the original order of the training rows
+    /// @param indices      The original indices of the rows of :literal:`data`
+    /// @param node_bounds  The first and the past-the-end rows of each node
+    /// @param centers      The centers of the balls of the nodes
+    /// @param radii        The radii of the balls of the nodes
+    /// @param degree       The Minkowski degree the radii are computed for,
+    ///                     infinity stands for the Chebyshev distance
+    ball_tree_model_impl(const table& data,
+                         const table& responses,
+                         const array<std::int64_t>& indices,
+                         const array<std::int64_t>& node_bounds,
+                         const table& centers,
+                         const table& radii,
+                         double degree)
+            : data_(data),
+              responses_(responses),
+              indices_(indices),
+              node_bounds_(node_bounds),
+              centers_(centers),
+              radii_(radii),
+              degree_(degree) {}
+
+    backend::model_interop* get_interop() override {
+        return nullptr;
+    }
+
+    void serialize(dal::detail::output_archive& ar) const override {
+        ar(data_, responses_, indices_, node_bounds_, centers_, radii_, degree_);
+    }
+
+    void deserialize(dal::detail::input_archive& ar) override {
+        ar(data_, responses_, indices_, node_bounds_, centers_, radii_, degree_);
+    }
+
+    table get_data() const {
+        return data_;
+    }
+
+    table get_responses() const {
+        return responses_;
+    }
+
+    const array<std::int64_t>& get_indices() const {
+        return indices_;
+    }
+
+    const array<std::int64_t>& get_node_bounds() const {
+        return node_bounds_;
+    }
+
+    table get_centers() const {
+        return centers_;
+    }
+
+    table get_radii() const {
+        return radii_;
+    }
+
+    double get_degree() const {
+        return degree_;
+    }
+
+private:
+    table data_;
+    table responses_;
+    array<std::int64_t> indices_;
+    array<std::int64_t> node_bounds_;
+    table centers_;
+    table radii_;
+    double degree_ = 2.0;
+};
+
+/// The HNSW graph has a layer per level, the node i belongs to the layers from
+/// zero up to :expr:`levels[i]`. Each layer of a node has a fixed-size block of links:
+/// the number of the neighbors followed by their indices. The blocks of the bottom
+/// layer hold up to :expr:`2 * max_degree` neighbors and are stored by nodes in
+/// :literal:`base_links`. The blocks of the upper layers hold up to :literal:`max_degree`
+/// neighbors and are stored in :literal:`upper_links`, the blocks of the node i
+/// start from the block :expr:`upper_offsets[i]`.
+template <typename Task>
+class hnsw_model_impl : public model_impl<Task>,
+                        public KNN_SERIALIZABLE(Task,
+                                                knn_hnsw_classification_model_impl_id,
+                                                knn_hnsw_search_model_impl_id) {
+public:
+    hnsw_model_impl() = default;
+
+    /// @param data           The training rows
+    /// @param responses      The responses of the training rows
+    /// @param levels         The top layer of each node
+    /// @param upper_offsets  The first block of the upper layers of each node
+    /// @param base_links     The link blocks of the bottom layer
+    /// @param upper_links    The link blocks of the upper layers
+    /// @param entry_point    The node the search starts from, it belongs to the top layer
+    /// @param max_degree     The maximal number of neighbors in the upper layers
+    /// @param degree         The Minkowski degree the graph is built for,
+    ///                       infinity stands for the Chebyshev distance
+    hnsw_model_impl(const table& data,
+                    const table& responses,
+                    const array<std::int32_t>& levels,
+                    const array<std::int64_t>& upper_offsets,
+                    const array<std::int32_t>& base_links,
+                    const array<std::int32_t>& upper_links,
+                    std::int64_t entry_point,
+                    std::int64_t max_degree,
+                    double degree)
+            : data_(data),
+              responses_(responses),
+              levels_(levels),
+              upper_offsets_(upper_offsets),
+              base_links_(base_links),
+              upper_links_(upper_links),
+              entry_point_(entry_point),
+              max_degree_(max_degree),
+              degree_(degree) {}
+
+    backend::model_interop* get_interop() override {
+        return nullptr;
+    }
+
+    void serialize(dal::detail::output_archive& ar) const override {
+        ar(data_, responses_, levels_, upper_offsets_, base_links_, upper_links_);
+        ar(entry_point_, max_degree_, degree_);
+    }
+
+    void deserialize(dal::detail::input_archive& ar) override {
+        ar(data_, responses_, levels_, upper_offsets_, base_links_, upper_links_);
+        ar(entry_point_, max_degree_, degree_);
+    }
+
+    table get_data() const {
+        return data_;
+    }
+
+    table get_responses() const {
+        return responses_;
+    }
+
+    const array<std::int32_t>& get_levels() const {
+        return levels_;
+    }
+
+    const array<std::int64_t>& get_upper_offsets() const {
+        return upper_offsets_;
+    }
+
+    const array<std::int32_t>& get_base_links() const {
+        return base_links_;
+    }
+
+    const array<std::int32_t>& get_upper_links() const {
+        return upper_links_;
+    }
+
+    std::int64_t get_entry_point() const {
+        return entry_point_;
+    }
+
+    std::int64_t get_max_degree() const {
+        return max_degree_;
+    }
+
+    double get_degree() const {
+        return degree_;
+    }
+
+private:
+    table data_;
+    table responses_;
+    array<std::int32_t> levels_;
+    array<std::int64_t> upper_offsets_;
+    array<std::int32_t> base_links_;
+    array<std::int32_t> upper_links_;
+    std::int64_t entry_point_ = 0;
+    std::int64_t max_degree_ = 16;
+    double degree_ = 2.0;
+};
+
 } // namespace backend
 } // namespace oneapi::dal::knn
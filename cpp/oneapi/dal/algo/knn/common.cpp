@@ -14,6 +14,8 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <limits>
+
 #include "oneapi/dal/algo/knn/common.hpp"
 #include "oneapi/dal/algo/knn/backend/model_impl.hpp"
 #include "oneapi/dal/exceptions.hpp"
@@ -30,6 +32,10 @@ public:
     std::int64_t class_count = 2;
     std::int64_t neighbor_count = 1;
     voting_mode voting_mode_value = voting_mode::uniform;
+    double radius = std::numeric_limits<double>::infinity();
+    std::int64_t max_degree = 16;
+    std::int64_t ef_construction = 200;
+    std::int64_t ef_search = 64;
     detail::distance_ptr distance;
 };
 
@@ -79,6 +85,58 @@ void descriptor_base<Task>::set_voting_mode_impl(voting_mode value) {
     impl_->voting_mode_value = value;
 }
 
+template <typename Task>
+double descriptor_base<Task>::get_radius() const {
+    return impl_->radius;
+}
+
+template <typename Task>
+void descriptor_base<Task>::set_radius_impl(double value) {
+    if (value < 0.0) {
+        throw domain_error(dal::detail::error_messages::radius_lt_zero());
+    }
+    impl_->radius = value;
+}
+
+template <typename Task>
+std::int64_t descriptor_base<Task>::get_max_degree() const {
+    return impl_->max_degree;
+}
+
+template <typename Task>
+void descriptor_base<Task>::set_max_degree_impl(std::int64_t value) {
+    if (value < 2) {
+        throw domain_error(dal::detail::error_messages::max_degree_lt_two());
+    }
+    impl_->max_degree = value;
+}
+
+template <typename Task>
+std::int64_t descriptor_base<Task>::get_ef_construction() const {
+    return impl_->ef_construction;
+}
+
+template <typename Task>
+void descriptor_base<Task>::set_ef_construction_impl(std::int64_t value) {
+    if (value < 1) {
+        throw domain_error(dal::detail::error_messages::ef_construction_lt_one());
+    }
+    impl_->ef_construction = value;
+}
+
+template <typename Task>
+std::int64_t descriptor_base<Task>::get_ef_search() const {
+    return impl_->ef_search;
+}
+
+template <typename Task>
+void descriptor_base<Task>::set_ef_search_impl(std::int64_t value) {
+    if (value < 1) {
+        throw domain_error(dal::detail::error_messages::ef_search_lt_one());
+    }
+    impl_->ef_search = value;
+}
+
 template <typename Task>
 const detail::distance_ptr& descriptor_base<Task>::get_distance_impl() const {
     return impl_->distance;
@@ -122,6 +180,10 @@ ONEDAL_REGISTER_SERIALIZABLE(backend::brute_force_model_impl<task::classificatio
 ONEDAL_REGISTER_SERIALIZABLE(backend::kd_tree_model_impl<task::classification>)
 ONEDAL_REGISTER_SERIALIZABLE(backend::brute_force_model_impl<task::search>)
 ONEDAL_REGISTER_SERIALIZABLE(backend::kd_tree_model_impl<task::search>)
+ONEDAL_REGISTER_SERIALIZABLE(backend::ball_tree_model_impl<task::classification>)
+ONEDAL_REGISTER_SERIALIZABLE(backend::ball_tree_model_impl<task::search>)
+ONEDAL_REGISTER_SERIALIZABLE(backend::hnsw_model_impl<task::classification>)
+ONEDAL_REGISTER_SERIALIZABLE(backend::hnsw_model_impl<task::search>)
 ONEDAL_REGISTER_SERIALIZABLE(backend::model_interop)
 
 } // namespace v1
@@ -57,6 +57,13 @@ namespace v1 {
 /// Tag-type that denotes :ref:`k-d tree <knn_t_math_kd_tree>` computational method.
 struct kd_tree {};
 
+/// Tag-type that denotes :ref:`ball tree <knn_t_math_ball_tree>` computational method.
+struct ball_tree {};
+
+/// Tag-type that denotes :ref:`HNSW <knn_t_math_hnsw>` approximate computational
+/// method.
+struct hnsw {};
+
 /// Tag-type that denotes :ref:`brute-force <knn_t_math_brute_force>` computational
 /// method.
 struct brute_force {};
@@ -67,6 +74,8 @@ using by_default = brute_force;
 } // namespace v1
 
 using v1::kd_tree;
+using v1::ball_tree;
+using v1::hnsw;
 using v1::brute_force;
 using v1::by_default;
 
@@ -85,8 +94,11 @@ template <typename Float>
 constexpr bool is_valid_float_v = dal::detail::is_one_of_v<Float, float, double>;
 
 template <typename Method>
-constexpr bool is_valid_method_v =
-    dal::detail::is_one_of_v<Method, method::kd_tree, method::brute_force>;
+constexpr bool is_valid_method_v = dal::detail::is_one_of_v<Method,
+                                                            method::kd_tree,
+                                                            method::ball_tree,
+                                                            method::hnsw,
+                                                            method::brute_force>;
 
 template <typename Task>
 constexpr bool is_valid_task_v = dal::detail::is_one_of_v<Task, task::classification, task::search>;
@@ -98,6 +110,16 @@ constexpr bool is_valid_distance_v =
                                  chebyshev_distance::detail::descriptor_tag,
                                  cosine_distance::detail::descriptor_tag>;
 
+/// The k-d tree prunes the search with the coordinate-wise bounds and the ball tree
+/// with the triangle inequality, both hold for Minkowski and Chebyshev distances only.
+/// HNSW shares the distance kernels of the trees, so it supports the same distances.
+template <typename Method, typename Distance>
+constexpr bool is_valid_method_distance_v =
+    dal::detail::is_one_of_v<Method, method::brute_force> ||
+    dal::detail::is_tag_one_of_v<Distance,
+                                 minkowski_distance::detail::descriptor_tag,
+                                 chebyshev_distance::detail::descriptor_tag>;
+
 template <typename T>
 using enable_if_search_t = std::enable_if_t<std::is_same_v<std::decay_t<T>, task::search>>;
 
@@ -109,6 +131,9 @@ template <typename T>
 using enable_if_brute_force_t =
     std::enable_if_t<std::is_same_v<std::decay_t<T>, method::brute_force>>;
 
+template <typename T>
+using enable_if_hnsw_t = std::enable_if_t<std::is_same_v<std::decay_t<T>, method::hnsw>>;
+
 template <typename Task = task::by_default>
 class descriptor_base : public base {
     static_assert(is_valid_task_v<Task>);
@@ -126,6 +151,10 @@ public:
     std::int64_t get_class_count() const;
     std::int64_t get_neighbor_count() const;
     voting_mode get_voting_mode() const;
+    double get_radius() const;
+    std::int64_t get_max_degree() const;
+    std::int64_t get_ef_construction() const;
+    std::int64_t get_ef_search() const;
 
 protected:
     explicit descriptor_base(const detail::distance_ptr& distance);
@@ -133,6 +162,10 @@ protected:
     void set_class_count_impl(std::int64_t value);
     void set_neighbor_count_impl(std::int64_t value);
     void set_voting_mode_impl(voting_mode value);
+    void set_radius_impl(double value);
+    void set_max_degree_impl(std::int64_t value);
+    void set_ef_construction_impl(std::int64_t value);
+    void set_ef_search_impl(std::int64_t value);
     void set_distance_impl(const detail::distance_ptr& distance);
     const detail::distance_ptr& get_distance_impl() const;
 
@@ -151,9 +184,11 @@ using v1::is_valid_float_v;
 using v1::is_valid_method_v;
 using v1::is_valid_task_v;
 using v1::is_valid_distance_v;
+using v1::is_valid_method_distance_v;
 using v1::enable_if_search_t;
 using v1::enable_if_classification_t;
 using v1::enable_if_brute_force_t;
+using v1::enable_if_hnsw_t;
 
 } // namespace detail
 
@@ -163,12 +198,16 @@ namespace v1 {
 ///                     intermediate computations. Can be :expr:`float` or
 ///                     :expr:`double`.
 /// @tparam Method      Tag-type that specifies an implementation of algorithm. Can
-///                     be :expr:`method::brute_force` or :expr:`method::kd_tree`.
+///                     be :expr:`method::brute_force`, :expr:`method::kd_tree`,
+///                     :expr:`method::ball_tree` or :expr:`method::hnsw`.
 /// @tparam Task        Tag-type that specifies type of the problem to solve. Can
 ///                     be :expr:`task::classification`.
 /// @tparam Distance    The descriptor of the distance used for computations. Can be
 ///                     :expr:`minkowski_distance::descriptor` or
-///                     :expr:`chebyshev_distance::descriptor`
+///                     :expr:`chebyshev_distance::descriptor` with all the methods, or
+///                     :expr:`cosine_distance::descriptor` with :expr:`method::brute_force`
+///                     only. :expr:`method::ball_tree` requires the Minkowski degree
+///                     to be at least one.
 template <typename Float = float,
           typename Method = method::by_default,
           typename Task = task::by_default,
@@ -180,6 +219,9 @@ class descriptor : public detail::descriptor_base<Task> {
     static_assert(detail::is_valid_distance_v<Distance>,
                   "Custom distances for kNN is not supported. "
                   "Use one of the predefined distances.");
+    static_assert(detail::is_valid_method_distance_v<Method, Distance>,
+                  "k-d tree, ball tree and HNSW methods support Minkowski and "
+                  "Chebyshev distances only.");
 
     using base_t = detail::descriptor_base<Task>;
 
@@ -199,8 +241,6 @@ public:
 
     /// Creates a new instance of the class with the given :literal:`class_count`,
     /// :literal:`neighbor_count` and :literal:`distance` property values.
-    /// Used with :expr:`method::brute_force` only.
-    template <typename M = Method, typename = detail::enable_if_brute_force_t<M>>
     explicit descriptor(std::int64_t class_count,
                         std::int64_t neighbor_count,
                         const distance_t& distance)
@@ -250,19 +290,83 @@ public:
         return *this;
     }
 
-    /// Choose distance type for calculations. Used with :expr:`method::brute_force` only.
-    template <typename M = Method, typename = detail::enable_if_brute_force_t<M>>
+    /// Choose distance type for calculations.
     const distance_t& get_distance() const {
         using dist_t = detail::distance<distance_t>;
         const auto dist = std::static_pointer_cast<dist_t>(base_t::get_distance_impl());
-        return dist;
+        return dist->get_distance();
     }
 
-    template <typename M = Method, typename = detail::enable_if_brute_force_t<M>>
     auto& set_distance(const distance_t& dist) {
         base_t::set_distance_impl(std::make_shared<detail::distance<distance_t>>(dist));
         return *this;
     }
+
+    /// The radius of the search. If the radius is finite, inference returns all
+    /// the neighbors within the radius from each query instead of :literal:`neighbor_count`
+    /// nearest ones. Used with :expr:`task::search` and :expr:`method::kd_tree` only.
+    /// @invariant :expr:`radius >= 0`
+    /// @remark default = :expr:`std::numeric_limits<double>::infinity()`
+    template <typename T = Task, typename = detail::enable_if_search_t<T>>
+    double get_radius() const {
+        return base_t::get_radius();
+    }
+
+    template <typename T = Task, typename = detail::enable_if_search_t<T>>
+    auto& set_radius(double value) {
+        base_t::set_radius_impl(value);
+        return *this;
+    }
+
+    /// The maximal number of neighbors of a node in the upper layers of the HNSW
+    /// graph, the bottom layer keeps up to twice as many. Larger values improve
+    /// the recall at the cost of memory and training time.
+    /// Used with :expr:`method::hnsw` only.
+    /// @invariant :expr:`max_degree > 1`
+    /// @remark default = 16
+    template <typename M = Method, typename = detail::enable_if_hnsw_t<M>>
+    std::int64_t get_max_degree() const {
+        return base_t::get_max_degree();
+    }
+
+    template <typename M = Method, typename = detail::enable_if_hnsw_t<M>>
+    auto& set_max_degree(std::int64_t value) {
+        base_t::set_max_degree_impl(value);
+        return *this;
+    }
+
+    /// The number of candidate neighbors tracked while a row is inserted into
+    /// the HNSW graph. Larger values build a better graph but slow the training down.
+    /// Used with :expr:`method::hnsw` only.
+    /// @invariant :expr:`ef_construction > 0`
+    /// @remark default = 200
+    template <typename M = Method, typename = detail::enable_if_hnsw_t<M>>
+    std::int64_t get_ef_construction() const {
+        return base_t::get_ef_construction();
+    }
+
+    template <typename M = Method, typename = detail::enable_if_hnsw_t<M>>
+    auto& set_ef_construction(std::int64_t value) {
+        base_t::set_ef_construction_impl(value);
+        return *this;
+    }
+
+    /// The number of candidate neighbors tracked while a query is searched in
+    /// the HNSW graph, at least :literal:`neighbor_count` candidates are tracked.
+    /// Trades the recall for the latency of inference.
+    /// Used with :expr:`method::hnsw` only.
+    /// @invariant :expr:`ef_search > 0`
+    /// @remark default = 64
+    template <typename M = Method, typename = detail::enable_if_hnsw_t<M>>
+    std::int64_t get_ef_search() const {
+        return base_t::get_ef_search();
+    }
+
+    template <typename M = Method, typename = detail::enable_if_hnsw_t<M>>
+    auto& set_ef_search(std::int64_t value) {
+        base_t::set_ef_search_impl(value);
+        return *this;
+    }
 };
 
 /// @tparam Task Tag-type that specifies type of the problem to solve. Can
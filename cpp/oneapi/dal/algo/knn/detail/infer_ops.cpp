@@ -39,10 +39,18 @@ struct infer_ops_dispatcher<host_policy, Float, Method, Task> {
 
 INSTANTIATE(float, method::kd_tree, task::classification)
 INSTANTIATE(double, method::kd_tree, task::classification)
+INSTANTIATE(float, method::ball_tree, task::classification)
+INSTANTIATE(double, method::ball_tree, task::classification)
+INSTANTIATE(float, method::hnsw, task::classification)
+INSTANTIATE(double, method::hnsw, task::classification)
 INSTANTIATE(float, method::brute_force, task::classification)
 INSTANTIATE(double, method::brute_force, task::classification)
 INSTANTIATE(float, method::kd_tree, task::search)
 INSTANTIATE(double, method::kd_tree, task::search)
+INSTANTIATE(float, method::ball_tree, task::search)
+INSTANTIATE(double, method::ball_tree, task::search)
+INSTANTIATE(float, method::hnsw, task::search)
+INSTANTIATE(double, method::hnsw, task::search)
 INSTANTIATE(float, method::brute_force, task::search)
 INSTANTIATE(double, method::brute_force, task::search)
 
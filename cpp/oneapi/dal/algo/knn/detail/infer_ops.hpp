@@ -16,6 +16,8 @@
 
 #pragma once
 
+#include <cmath>
+
 #include "oneapi/dal/algo/knn/infer_types.hpp"
 #include "oneapi/dal/detail/error_messages.hpp"
 
@@ -44,6 +46,12 @@ struct infer_ops {
         if (!input.get_data().has_data()) {
             throw domain_error(msg::input_data_is_empty());
         }
+        if constexpr (std::is_same_v<task_t, task::search> &&
+                      !std::is_same_v<method_t, method::kd_tree>) {
+            if (std::isfinite(params.get_radius())) {
+                throw unimplemented(msg::knn_radius_search_is_implemented_for_kd_tree_only());
+            }
+        }
     }
 
     void check_postconditions(const Descriptor& params,
@@ -43,10 +43,12 @@ public:
     static constexpr std::int64_t infer_element_count = column_count * infer_row_count;
 
     static constexpr bool is_kd_tree = std::is_same_v<Method, knn::method::kd_tree>;
+    static constexpr bool is_ball_tree = std::is_same_v<Method, knn::method::ball_tree>;
+    static constexpr bool is_hnsw = std::is_same_v<Method, knn::method::hnsw>;
     static constexpr bool is_brute_force = std::is_same_v<Method, knn::method::brute_force>;
 
     bool not_available_on_device() {
-        return (get_policy().is_gpu() && is_kd_tree);
+        return (get_policy().is_gpu() && (is_kd_tree || is_ball_tree || is_hnsw));
     }
 
     auto get_descriptor(std::int64_t override_class_count = class_count,
@@ -88,7 +90,11 @@ private:
                                                                             -2.0, -1.0 };
 };
 
-using knn_types = COMBINE_TYPES((float), (knn::method::brute_force, knn::method::kd_tree));
+using knn_types = COMBINE_TYPES((float),
+                                (knn::method::brute_force,
+                                 knn::method::kd_tree,
+                                 knn::method::ball_tree,
+                                 knn::method::hnsw));
 
 #define KNN_BADARG_TEST(name) \
     TEMPLATE_LIST_TEST_M(knn_badarg_test, name, "[knn][badarg]", knn_types)
@@ -231,4 +237,17 @@ KNN_BADARG_TEST("throws if infer data is empty") {
                       domain_error);
 }
 
+KNN_BADARG_TEST("throws if HNSW parameters are out of range") {
+    using method_t = std::tuple_element_t<1, TestType>;
+    if constexpr (std::is_same_v<method_t, knn::method::hnsw>) {
+        auto knn_desc = this->get_descriptor();
+        REQUIRE_NOTHROW(knn_desc.set_max_degree(2));
+        REQUIRE_THROWS_AS(knn_desc.set_max_degree(1), domain_error);
+        REQUIRE_NOTHROW(knn_desc.set_ef_construction(1));
+        REQUIRE_THROWS_AS(knn_desc.set_ef_construction(0), domain_error);
+        REQUIRE_NOTHROW(knn_desc.set_ef_search(1));
+        REQUIRE_THROWS_AS(knn_desc.set_ef_search(0), domain_error);
+    }
+}
+
 } // namespace oneapi::dal::knn::test
@@ -62,10 +62,12 @@ public:
     }
 
     static constexpr bool is_kd_tree = std::is_same_v<Method, knn::method::kd_tree>;
+    static constexpr bool is_ball_tree = std::is_same_v<Method, knn::method::ball_tree>;
+    static constexpr bool is_hnsw = std::is_same_v<Method, knn::method::hnsw>;
     static constexpr bool is_brute_force = std::is_same_v<Method, knn::method::brute_force>;
 
     bool not_available_on_device() {
-        return (this->get_policy().is_gpu() && is_kd_tree);
+        return (this->get_policy().is_gpu() && (is_kd_tree || is_ball_tree || is_hnsw));
     }
 
     Float classification(const table& train_data,
@@ -226,7 +228,11 @@ public:
     }
 };
 
-using knn_types = COMBINE_TYPES((float, double), (knn::method::brute_force, knn::method::kd_tree));
+using knn_types = COMBINE_TYPES((float, double),
+                                (knn::method::brute_force,
+                                 knn::method::kd_tree,
+                                 knn::method::ball_tree,
+                                 knn::method::hnsw));
 using knn_bf_types = COMBINE_TYPES((float, double), (knn::method::brute_force));
 
 #define KNN_SMALL_TEST(name)                                               \
@@ -289,6 +295,8 @@ KNN_SYNTHETIC_TEST("knn nearest points test random uniform 513x301x17") {
     SKIP_IF(this->not_available_on_device());
     SKIP_IF(this->not_float64_friendly());
     SKIP_IF(this->is_kd_tree);
+    // HNSW search is approximate, the nearest neighbor may be missed
+    SKIP_IF(this->is_hnsw);
 
     constexpr std::int64_t train_row_count = 513;
     constexpr std::int64_t infer_row_count = 301;
@@ -317,6 +325,8 @@ KNN_SYNTHETIC_TEST("knn nearest points test random uniform 16390x20x5") {
     SKIP_IF(this->not_available_on_device());
     SKIP_IF(this->not_float64_friendly());
     SKIP_IF(this->is_kd_tree);
+    // HNSW search is approximate, the nearest neighbor may be missed
+    SKIP_IF(this->is_hnsw);
 
     constexpr std::int64_t train_row_count = 16390;
     constexpr std::int64_t infer_row_count = 20;
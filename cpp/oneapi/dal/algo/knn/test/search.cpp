@@ -0,0 +1,412 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "oneapi/dal/algo/knn/train.hpp"
+#include "oneapi/dal/algo/knn/infer.hpp"
+
+#include "oneapi/dal/table/homogen.hpp"
+#include "oneapi/dal/table/row_accessor.hpp"
+#include "oneapi/dal/table/detail/csr.hpp"
+#include "oneapi/dal/table/detail/csr_accessor.hpp"
+#include "oneapi/dal/test/engine/fixtures.hpp"
+
+namespace oneapi::dal::knn::test {
+
+namespace te = dal::test::engine;
+namespace de = dal::detail;
+
+template <typename TestType>
+class knn_search_test : public te::float_algo_fixture<std::tuple_element_t<0, TestType>> {
+public:
+    using Float = std::tuple_element_t<0, TestType>;
+    using Method = std::tuple_element_t<1, TestType>;
+
+    static constexpr bool is_kd_tree = std::is_same_v<Method, knn::method::kd_tree>;
+    static constexpr bool is_hnsw = std::is_same_v<Method, knn::method::hnsw>;
+
+    bool not_available_on_device() {
+        return this->get_policy().is_gpu();
+    }
+
+    template <typename Distance>
+    auto get_descriptor(std::int64_t neighbor_count, const Distance& distance) const {
+        return knn::descriptor<Float, Method, knn::task::search, Distance>(neighbor_count,
+                                                                           distance);
+    }
+
+    /// Computes the distances between all the pairs of the infer and train rows.
+    /// Non-positive degree stands for the Chebyshev distance.
+    static std::vector<double> naive_distances(const table& train_data,
+                                               const table& infer_data,
+                                               double degree) {
+        const auto train = row_accessor<const Float>(train_data).pull();
+        const auto infer = row_accessor<const Float>(infer_data).pull();
+        const std::int64_t train_count = train_data.get_row_count();
+        const std::int64_t infer_count = infer_data.get_row_count();
+        const std::int64_t column_count = train_data.get_column_count();
+
+        std::vector<double> distances(infer_count * train_count);
+        for (std::int64_t i = 0; i < infer_count; ++i) {
+            for (std::int64_t j = 0; j < train_count; ++j) {
+                double dist = 0.0;
+                for (std::int64_t c = 0; c < column_count; ++c) {
+                    const double diff = std::abs(double(infer[i * column_count + c]) -
+                                                 double(train[j * column_count + c]));
+                    dist = (degree > 0.0) ? dist + std::pow(diff, degree) : std::max(dist, diff);
+                }
+                distances[i * train_count + j] =
+                    (degree > 0.0) ? std::pow(dist, 1.0 / degree) : dist;
+            }
+        }
+        return distances;
+    }
+
+    static double get_tolerance() {
+        return std::is_same_v<Float, float> ? 1e-4 : 1e-9;
+    }
+
+    template <typename Distance>
+    void check_nearest_distances(const table& train_data,
+                                 const table& infer_data,
+                                 std::int64_t neighbor_count,
+                                 const Distance& distance,
+                                 double degree) {
+        const auto desc = this->get_descriptor(neighbor_count, distance);
+        const auto train_result = this->train(desc, train_data);
+        const auto infer_result = this->infer(desc, infer_data, train_result.get_model());
+
+        const table distances_table = infer_result.get_distances();
+        REQUIRE(distances_table.get_row_count() == infer_data.get_row_count());
+        REQUIRE(distances_table.get_column_count() == neighbor_count);
+
+        const auto distances = row_accessor<const Float>(distances_table).pull();
+        const auto reference = naive_distances(train_data, infer_data, degree);
+        const std::int64_t train_count = train_data.get_row_count();
+
+        for (std::int64_t i = 0; i < infer_data.get_row_count(); ++i) {
+            std::vector<double> expected(reference.begin() + i * train_count,
+                                         reference.begin() + (i + 1) * train_count);
+            std::sort(expected.begin(), expected.end());
+
+            std::vector<double> actual(distances.get_data() + i * neighbor_count,
+                                       distances.get_data() + (i + 1) * neighbor_count);
+            std::sort(actual.begin(), actual.end());
+
+            for (std::int64_t j = 0; j < neighbor_count; ++j) {
+                CAPTURE(i, j, actual[j], expected[j]);
+                REQUIRE(std::abs(actual[j] - expected[j]) <=
+                        get_tolerance() * std::max(1.0, expected[j]));
+            }
+        }
+    }
+
+    /// Checks that the share of the true nearest neighbors among the neighbors
+    /// found is at least :literal:`min_recall` and the distances are exact
+    template <typename Distance>
+    void check_recall(const table& train_data,
+                      const table& infer_data,
+                      std::int64_t neighbor_count,
+                      const Distance& distance,
+                      double degree,
+                      double min_recall) {
+        auto desc = this->get_descriptor(neighbor_count, distance);
+        if constexpr (is_hnsw) {
+            desc.set_max_degree(8).set_ef_construction(100).set_ef_search(64);
+        }
+        const auto train_result = this->train(desc, train_data);
+        const auto infer_result = this->infer(desc, infer_data, train_result.get_model());
+
+        const auto indices = row_accessor<const std::int32_t>(infer_result.get_indices()).pull();
+        const auto distances = row_accessor<const Float>(infer_result.get_distances()).pull();
+        const auto reference = naive_distances(train_data, infer_data, degree);
+        const std::int64_t train_count = train_data.get_row_count();
+        const std::int64_t infer_count = infer_data.get_row_count();
+
+        std::int64_t true_neighbor_count = 0;
+        for (std::int64_t i = 0; i < infer_count; ++i) {
+            std::vector<double> expected(reference.begin() + i * train_count,
+                                         reference.begin() + (i + 1) * train_count);
+            std::nth_element(expected.begin(),
+                             expected.begin() + neighbor_count - 1,
+                             expected.end());
+            const double kth_distance = expected[neighbor_count - 1];
+
+            for (std::int64_t j = 0; j < neighbor_count; ++j) {
+                const std::int64_t index = indices[i * neighbor_count + j];
+                CAPTURE(i, j, index);
+                REQUIRE(index >= 0);
+                REQUIRE(index < train_count);
+
+                const double actual = distances[i * neighbor_count + j];
+                const double exact = reference[i * train_count + index];
+                REQUIRE(std::abs(actual - exact) <= get_tolerance() * std::max(1.0, exact));
+                if (j > 0) {
+                    REQUIRE(distances[i * neighbor_count + j - 1] <= actual);
+                }
+                if (exact <= kth_distance + get_tolerance() * std::max(1.0, kth_distance)) {
+                    ++true_neighbor_count;
+                }
+            }
+        }
+
+        const double recall = double(true_neighbor_count) / double(infer_count * neighbor_count);
+        CAPTURE(recall);
+        REQUIRE(recall >= min_recall);
+    }
+
+    template <typename Distance>
+    void check_radius_search(const table& train_data,
+                             const table& infer_data,
+                             double radius,
+                             const Distance& distance,
+                             double degree) {
+        const auto desc = this->get_descriptor(1, distance).set_radius(radius);
+        const auto train_result = this->train(desc, train_data);
+        const auto infer_result = this->infer(desc, infer_data, train_result.get_model());
+
+        const table& indices_table = infer_result.get_indices();
+        const table& distances_table = infer_result.get_distances();
+        REQUIRE(indices_table.get_kind() == de::csr_table::kind());
+        REQUIRE(distances_table.get_kind() == de::csr_table::kind());
+
+        const auto indices_block =
+            de::csr_accessor<const std::int32_t>(static_cast<const de::csr_table&>(indices_table))
+                .pull();
+        const auto distances_block =
+            de::csr_accessor<const Float>(static_cast<const de::csr_table&>(distances_table))
+                .pull();
+
+        const auto reference = naive_distances(train_data, infer_data, degree);
+        const std::int64_t train_count = train_data.get_row_count();
+        const double tolerance = get_tolerance() * std::max(1.0, radius);
+
+        const std::int64_t* row_indices = distances_block.row_indices.get_data();
+        const std::int64_t* column_indices = distances_block.column_indices.get_data();
+        const Float* distances = distances_block.data.get_data();
+        const std::int32_t* indices = indices_block.data.get_data();
+
+        for (std::int64_t i = 0; i < infer_data.get_row_count(); ++i) {
+            std::vector<bool> is_found(train_count, false);
+            for (std::int64_t k = row_indices[i] - 1; k < row_indices[i + 1] - 1; ++k) {
+                const std::int64_t index = column_indices[k] - 1;
+                CAPTURE(i, k, index, distances[k]);
+                REQUIRE(indices[k] == index);
+                REQUIRE(distances[k] <= radius + tolerance);
+                REQUIRE(std::abs(distances[k] - reference[i * train_count + index]) <= tolerance);
+                if (k > row_indices[i] - 1) {
+                    REQUIRE(distances[k - 1] <= distances[k]);
+                }
+                is_found[index] = true;
+            }
+
+            for (std::int64_t j = 0; j < train_count; ++j) {
+                if (reference[i * train_count + j] < radius - tolerance) {
+                    CAPTURE(i, j, reference[i * train_count + j]);
+                    REQUIRE(is_found[j]);
+                }
+            }
+        }
+    }
+};
+
+using knn_search_types = COMBINE_TYPES((float, double),
+                                       (knn::method::kd_tree,
+                                        knn::method::ball_tree,
+                                        knn::method::hnsw));
+
+#define KNN_SEARCH_TEST(name)                                 \
+    TEMPLATE_LIST_TEST_M(knn_search_test,                     \
+                         name,                                \
+                         "[knn][search][integration][batch]", \
+                         knn_search_types)
+
+KNN_SEARCH_TEST("knn tree search with Minkowski and Chebyshev distances") {
+    SKIP_IF(this->is_hnsw);
+    SKIP_IF(this->not_available_on_device());
+    SKIP_IF(this->not_float64_friendly());
+
+    constexpr std::int64_t train_row_count = 500;
+    constexpr std::int64_t infer_row_count = 100;
+    constexpr std::int64_t column_count = 5;
+    constexpr std::int64_t neighbor_count = 7;
+
+    const auto train_dataframe = GENERATE_DATAFRAME(
+        te::dataframe_builder{ train_row_count, column_count }.fill_uniform(-1.0, 1.0));
+    const table x_train_table = train_dataframe.get_table(this->get_homogen_table_id());
+    const auto infer_dataframe = GENERATE_DATAFRAME(
+        te::dataframe_builder{ infer_row_count, column_count }.fill_uniform(-1.2, 1.2, 3333));
+    const table x_infer_table = infer_dataframe.get_table(this->get_homogen_table_id());
+
+    using float_t = std::tuple_element_t<0, TestType>;
+
+    SECTION("Euclidean distance") {
+        this->check_nearest_distances(x_train_table,
+                                      x_infer_table,
+                                      neighbor_count,
+                                      minkowski_distance::descriptor<float_t>(2.0),
+                                      2.0);
+    }
+
+    SECTION("Manhattan distance") {
+        this->check_nearest_distances(x_train_table,
+                                      x_infer_table,
+                                      neighbor_count,
+                                      minkowski_distance::descriptor<float_t>(1.0),
+                                      1.0);
+    }
+
+    SECTION("Minkowski distance (p = 3)") {
+        this->check_nearest_distances(x_train_table,
+                                      x_infer_table,
+                                      neighbor_count,
+                                      minkowski_distance::descriptor<float_t>(3.0),
+                                      3.0);
+    }
+
+    SECTION("Chebyshev distance") {
+        this->check_nearest_distances(x_train_table,
+                                      x_infer_table,
+                                      neighbor_count,
+                                      chebyshev_distance::descriptor<float_t>{},
+                                      0.0);
+    }
+}
+
+KNN_SEARCH_TEST("knn hnsw search recall") {
+    SKIP_IF(!this->is_hnsw);
+    SKIP_IF(this->not_available_on_device());
+    SKIP_IF(this->not_float64_friendly());
+
+    constexpr std::int64_t train_row_count = 2000;
+    constexpr std::int64_t infer_row_count = 100;
+    constexpr std::int64_t column_count = 8;
+    constexpr std::int64_t neighbor_count = 10;
+    constexpr double min_recall = 0.9;
+
+    const auto train_dataframe = GENERATE_DATAFRAME(
+        te::dataframe_builder{ train_row_count, column_count }.fill_uniform(-1.0, 1.0));
+    const table x_train_table = train_dataframe.get_table(this->get_homogen_table_id());
+    const auto infer_dataframe = GENERATE_DATAFRAME(
+        te::dataframe_builder{ infer_row_count, column_count }.fill_uniform(-1.0, 1.0, 3333));
+    const table x_infer_table = infer_dataframe.get_table(this->get_homogen_table_id());
+
+    using float_t = std::tuple_element_t<0, TestType>;
+
+    SECTION("Euclidean distance") {
+        this->check_recall(x_train_table,
+                           x_infer_table,
+                           neighbor_count,
+                           minkowski_distance::descriptor<float_t>(2.0),
+                           2.0,
+                           min_recall);
+    }
+
+    SECTION("Manhattan distance") {
+        this->check_recall(x_train_table,
+                           x_infer_table,
+                           neighbor_count,
+                           minkowski_distance::descriptor<float_t>(1.0),
+                           1.0,
+                           min_recall);
+    }
+
+    SECTION("Chebyshev distance") {
+        this->check_recall(x_train_table,
+                           x_infer_table,
+                           neighbor_count,
+                           chebyshev_distance::descriptor<float_t>{},
+                           0.0,
+                           min_recall);
+    }
+}
+
+KNN_SEARCH_TEST("knn kd_tree radius search") {
+    SKIP_IF(!this->is_kd_tree);
+    SKIP_IF(this->not_available_on_device());
+    SKIP_IF(this->not_float64_friendly());
+
+    constexpr std::int64_t train_row_count = 400;
+    constexpr std::int64_t infer_row_count = 50;
+    constexpr std::int64_t column_count = 3;
+
+    const auto train_dataframe = GENERATE_DATAFRAME(
+        te::dataframe_builder{ train_row_count, column_count }.fill_uniform(-1.0, 1.0));
+    const table x_train_table = train_dataframe.get_table(this->get_homogen_table_id());
+    const auto infer_dataframe = GENERATE_DATAFRAME(
+        te::dataframe_builder{ infer_row_count, column_count }.fill_uniform(-1.0, 1.0, 3333));
+    const table x_infer_table = infer_dataframe.get_table(this->get_homogen_table_id());
+
+    using float_t = std::tuple_element_t<0, TestType>;
+    const double radius = GENERATE(0.0, 0.1, 0.4);
+
+    SECTION("Euclidean distance") {
+        this->check_radius_search(x_train_table,
+                                  x_infer_table,
+                                  radius,
+                                  minkowski_distance::descriptor<float_t>(2.0),
+                                  2.0);
+    }
+
+    SECTION("Manhattan distance") {
+        this->check_radius_search(x_train_table,
+                                  x_infer_table,
+                                  radius,
+                                  minkowski_distance::descriptor<float_t>(1.0),
+                                  1.0);
+    }
+
+    SECTION("Chebyshev distance") {
+        this->check_radius_search(x_train_table,
+                                  x_infer_table,
+                                  radius,
+                                  chebyshev_distance::descriptor<float_t>{},
+                                  0.0);
+    }
+}
+
+KNN_SEARCH_TEST("knn radius search is not implemented for brute force") {
+    SKIP_IF(!this->is_kd_tree);
+    SKIP_IF(this->not_available_on_device());
+    SKIP_IF(this->not_float64_friendly());
+
+    const auto train_dataframe =
+        GENERATE_DATAFRAME(te::dataframe_builder{ 10, 2 }.fill_uniform(-1.0, 1.0));
+    const table x_train_table = train_dataframe.get_table(this->get_homogen_table_id());
+
+    using float_t = std::tuple_element_t<0, TestType>;
+    const auto desc = knn::descriptor<float_t, knn::method::brute_force, knn::task::search>(
+                          3,
+                          minkowski_distance::descriptor<float_t>(2.0))
+                          .set_radius(0.5);
+
+    const auto train_result = this->train(desc, x_train_table);
+    REQUIRE_THROWS_AS(this->infer(desc, x_train_table, train_result.get_model()), unimplemented);
+}
+
+KNN_SEARCH_TEST("knn negative radius is rejected") {
+    SKIP_IF(!this->is_kd_tree);
+    using float_t = std::tuple_element_t<0, TestType>;
+    auto desc = knn::descriptor<float_t, knn::method::kd_tree, knn::task::search>(
+        3,
+        minkowski_distance::descriptor<float_t>(2.0));
+    REQUIRE_THROWS_AS(desc.set_radius(-1.0), domain_error);
+}
+
+} // namespace oneapi::dal::knn::test
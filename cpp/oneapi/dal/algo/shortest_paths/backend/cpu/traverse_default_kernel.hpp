@@ -14,15 +14,23 @@
 * See the License for the specific language governing permissions and
 * limitations under the License.
 *******************************************************************************/
-
 #pragma once
 
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <immintrin.h>
+#include <memory>
+#include <vector>
+
 #include "oneapi/dal/algo/shortest_paths/common.hpp"
 #include "oneapi/dal/algo/shortest_paths/traverse_types.hpp"
 #include "oneapi/dal/backend/common.hpp"
 #include "oneapi/dal/backend/memory.hpp"
 #include "oneapi/dal/backend/interop/common.hpp"
 #include "oneapi/dal/backend/interop/table_conversion.hpp"
+#include "oneapi/dal/detail/threading.hpp"
+#include "oneapi/dal/table/detail/csr.hpp"
 #include "oneapi/dal/table/detail/table_builder.hpp"
 #include "oneapi/dal/graph/detail/container.hpp"
 
@@ -30,17 +38,37 @@ namespace oneapi::dal::preview::shortest_paths::backend {
 using namespace oneapi::dal::preview::detail;
 using namespace oneapi::dal::preview::backend;
 
-template <typename Vertex, typename EdgeValue, typename BinsVector>
-inline void update_bins(const Vertex& v,
-                        const EdgeValue& new_dist,
-                        const EdgeValue& delta,
-                        BinsVector& local_bins) {
-    ONEDAL_ASSERT(new_dist > 0);
+/// The number of frontier vertices relaxed by a single task
+constexpr std::int64_t frontier_block_size = 64;
+
+/// Thread-local bins smaller than this are drained by the owning thread right away
+/// instead of being merged into the shared frontier (bucket fusion)
+constexpr std::int64_t max_elements_in_bin = 1000;
+
+constexpr std::int64_t max_bin_count = std::numeric_limits<std::int64_t>::max() / 2;
+
+template <typename EdgeValue>
+inline bool atomic_min(std::atomic<EdgeValue>& target, const EdgeValue& value) {
+    EdgeValue current = target.load(std::memory_order_relaxed);
+    while (value < current) {
+        if (target.compare_exchange_weak(current, value, std::memory_order_relaxed)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+template <typename EdgeValue>
+inline std::int64_t get_bin_index(const EdgeValue& dist, const EdgeValue& delta) {
+    ONEDAL_ASSERT(dist >= 0);
     ONEDAL_ASSERT(delta > 0);
-    ONEDAL_ASSERT(new_dist / delta <= std::numeric_limits<EdgeValue>::max());
-    ONEDAL_ASSERT(new_dist / delta <=
-                  static_cast<EdgeValue>(std::numeric_limits<std::int64_t>::max()));
-    const std::int64_t dest_bin = static_cast<std::int64_t>(new_dist / delta);
+    ONEDAL_ASSERT(dist / delta <= std::numeric_limits<EdgeValue>::max());
+    ONEDAL_ASSERT(dist / delta <= static_cast<EdgeValue>(max_bin_count));
+    return static_cast<std::int64_t>(dist / delta);
+}
+
+template <typename Vertex, typename BinsVector>
+inline void update_bins(const Vertex& v, std::int64_t dest_bin, BinsVector& local_bins) {
     ONEDAL_ASSERT(dest_bin >= 0);
     if (dest_bin >= local_bins.size()) {
         local_bins.resize(dest_bin + 1);
@@ -48,308 +76,782 @@ inline void update_bins(const Vertex& v,
     local_bins[dest_bin].push_back(v);
 }
 
-template <typename Topology, typename EdgeValue, typename BinsVector>
-inline void relax_edges(const Topology& t,
-                        const EdgeValue* vals,
-                        typename Topology::vertex_type u,
-                        EdgeValue delta,
-                        EdgeValue* dist,
-                        BinsVector& local_bins) {
-    for (std::int64_t v_ = t._rows_ptr[u]; v_ < t._rows_ptr[u + 1]; v_++) {
-        const auto v = t._cols_ptr[v_];
-        const auto v_w = vals[v_];
-        EdgeValue old_dist = dist[v];
-        const EdgeValue new_dist = dist[u] + v_w;
-        if (new_dist < old_dist) {
-            dist[v] = new_dist;
-            update_bins(v, new_dist, delta, local_bins);
+/// Returns the bucket width. If the descriptor holds zero delta, the width is chosen as
+/// max_weight / average_degree, which follows the Meyer and Sanders bound of
+/// Theta(1 / degree) for the uniformly distributed weights.
+template <typename EdgeValue>
+inline EdgeValue get_delta(const dal::preview::detail::topology<std::int32_t>& t,
+                           const EdgeValue* vals,
+                           double requested_delta) {
+    double delta = requested_delta;
+    if (delta == 0) {
+        const std::int64_t edge_count = t.get_edge_count();
+        const std::int64_t block_count =
+            (edge_count + frontier_block_size - 1) / frontier_block_size;
+        const std::int32_t thread_cnt = dal::detail::threader_get_max_threads();
+        vector_container<EdgeValue> local_max(thread_cnt,
+                                              EdgeValue(0),
+                                              std::allocator<EdgeValue>{});
+        dal::detail::threader_for_int64(block_count, [&](std::int64_t block) {
+            const std::int64_t begin = block * frontier_block_size;
+            const std::int64_t end = std::min(begin + frontier_block_size, edge_count);
+            EdgeValue& max_weight = local_max[dal::detail::threader_get_current_thread_index()];
+            for (std::int64_t i = begin; i < end; ++i) {
+                max_weight = std::max(max_weight, vals[i]);
+            }
+        });
+        EdgeValue max_weight = 0;
+        for (std::int32_t i = 0; i < thread_cnt; ++i) {
+            max_weight = std::max(max_weight, local_max[i]);
         }
+        const double average_degree =
+            std::max(1.0, static_cast<double>(edge_count) / t.get_vertex_count());
+        delta = static_cast<double>(max_weight) / average_degree;
+    }
+    if constexpr (std::is_integral_v<EdgeValue>) {
+        delta = std::floor(delta);
+    }
+    if (!(delta > 0)) {
+        return EdgeValue(1);
     }
+    return static_cast<EdgeValue>(
+        std::min(delta, static_cast<double>(std::numeric_limits<EdgeValue>::max())));
 }
 
-template <typename EV, typename VT>
-struct dist_pred {
-    dist_pred(const EV& dist_, const VT& pred_) : dist(dist_), pred(pred_) {}
-    EV dist = 0;
-    VT pred = 0;
-};
-
-template <class T1, class T2>
-bool operator==(const dist_pred<T1, T2>& lhs, const dist_pred<T1, T2>& rhs) {
-    return lhs.first == rhs.first && lhs.second == rhs.second;
+template <typename EdgeValue>
+inline EdgeValue get_max_distance(double max_distance) {
+    const double limit = static_cast<double>(std::numeric_limits<EdgeValue>::max());
+    return static_cast<EdgeValue>(std::min(max_distance, limit));
 }
 
-template <class T1, class T2>
-bool operator!=(const dist_pred<T1, T2>& lhs, const dist_pred<T1, T2>& rhs) {
-    return !(lhs == rhs);
-}
+/// CSR adjacency with the light edges (weight <= delta) of every vertex placed in front of
+/// its heavy edges. It is built once and shared by all the solvers traversing the graph.
+template <typename EdgeValue>
+class split_adjacency {
+public:
+    using value_type = EdgeValue;
+    using vertex_type = std::int32_t;
+    using edge_type = std::int64_t;
+
+    split_adjacency(const dal::preview::detail::topology<std::int32_t>& t,
+                    const value_type* vals,
+                    value_type delta,
+                    byte_alloc_iface* alloc_ptr)
+            : t_(t),
+              vals_(vals),
+              delta_(delta),
+              vertex_count_(t.get_vertex_count()),
+              edge_capacity_(std::max<std::int64_t>(t.get_edge_count(), 1)),
+              value_allocator_(alloc_ptr),
+              vertex_allocator_(alloc_ptr),
+              edge_allocator_(alloc_ptr) {
+        light_end_ = allocate(edge_allocator_, vertex_count_);
+        cols_ = allocate(vertex_allocator_, edge_capacity_);
+        weights_ = allocate(value_allocator_, edge_capacity_);
+        dal::detail::threader_for(vertex_count_, vertex_count_, [&](std::int32_t u) {
+            edge_type light = t_._rows_ptr[u];
+            edge_type heavy = t_._rows_ptr[u + 1];
+            for (edge_type e = t_._rows_ptr[u]; e < t_._rows_ptr[u + 1]; ++e) {
+                const edge_type dest = (vals_[e] <= delta_) ? light++ : --heavy;
+                cols_[dest] = t_._cols_ptr[e];
+                weights_[dest] = vals_[e];
+            }
+            light_end_[u] = light;
+        });
+    }
 
-template <typename Topology, typename EdgeValue, typename DP, typename BinsVector>
-inline void relax_edges_with_pred(const Topology& t,
-                                  const EdgeValue* vals,
-                                  typename Topology::vertex_type u,
-                                  EdgeValue delta,
-                                  DP* dp,
-                                  BinsVector& local_bins) {
-    for (std::int64_t v_ = t._rows_ptr[u]; v_ < t._rows_ptr[u + 1]; v_++) {
-        const auto v = t._cols_ptr[v_];
-        const auto v_w = vals[v_];
-        auto old_dp = dp[v];
-        const EdgeValue new_dist = dp[u].dist + v_w;
-        if (new_dist < old_dp.dist) {
-            dp[v] = dist_pred(new_dist, u);
-            update_bins(v, new_dist, delta, local_bins);
-        }
+    split_adjacency(const split_adjacency&) = delete;
+    split_adjacency& operator=(const split_adjacency&) = delete;
+
+    ~split_adjacency() {
+        deallocate(edge_allocator_, light_end_, vertex_count_);
+        deallocate(vertex_allocator_, cols_, edge_capacity_);
+        deallocate(value_allocator_, weights_, edge_capacity_);
     }
-}
 
-template <typename BinsVector>
-inline bool find_next_bin_index_seq(std::int64_t& curr_bin_index, const BinsVector& local_bins) {
-    const std::int64_t max_bin_count = std::numeric_limits<std::int64_t>::max() / 2;
-    bool is_queue_empty = true;
-    for (std::int64_t i = curr_bin_index; i < local_bins[0].size(); i++) {
-        if (!local_bins[0][i].empty()) {
-            if (i < max_bin_count) {
-                curr_bin_index = i;
-            }
-            else {
-                curr_bin_index = max_bin_count;
+    const dal::preview::detail::topology<std::int32_t>& get_topology() const {
+        return t_;
+    }
+
+    const value_type* get_original_values() const {
+        return vals_;
+    }
+
+    value_type get_delta() const {
+        return delta_;
+    }
+
+    std::int64_t get_vertex_count() const {
+        return vertex_count_;
+    }
+
+    edge_type get_light_begin(vertex_type u) const {
+        return t_._rows_ptr[u];
+    }
+
+    edge_type get_light_end(vertex_type u) const {
+        return light_end_[u];
+    }
+
+    edge_type get_heavy_end(vertex_type u) const {
+        return t_._rows_ptr[u + 1];
+    }
+
+    vertex_type get_neighbor(edge_type e) const {
+        return cols_[e];
+    }
+
+    value_type get_weight(edge_type e) const {
+        return weights_[e];
+    }
+
+private:
+    const dal::preview::detail::topology<std::int32_t>& t_;
+    const value_type* vals_;
+    const value_type delta_;
+    const std::int64_t vertex_count_;
+    const std::int64_t edge_capacity_;
+
+    inner_alloc<value_type> value_allocator_;
+    inner_alloc<vertex_type> vertex_allocator_;
+    inner_alloc<edge_type> edge_allocator_;
+
+    edge_type* light_end_ = nullptr;
+    vertex_type* cols_ = nullptr;
+    value_type* weights_ = nullptr;
+};
+
+/// Delta-stepping solver.
+///
+/// A bucket is settled in two phases: light edges of the frontier are relaxed repeatedly
+/// while the bucket keeps getting new vertices, then heavy edges of all vertices removed
+/// from the bucket are relaxed once, as they can only reach the following buckets.
+/// In the parallel mode the frontier is split into small blocks that are distributed across
+/// threads by the threading layer, so idle threads steal the remaining blocks. Every thread
+/// collects the vertices it reaches in its own bins and drains small bins of the current
+/// bucket itself. In the sequential mode the solver makes no threading calls, so several
+/// solvers can traverse the graph concurrently from different sources.
+///
+/// The solver keeps its buffers between runs and resets only the vertices reached by
+/// the previous run.
+template <typename Cpu, typename EdgeValue>
+class delta_stepping_solver {
+public:
+    using value_type = EdgeValue;
+    using vertex_type = std::int32_t;
+    using edge_type = std::int64_t;
+    using atomic_value_type = std::atomic<value_type>;
+    using atomic_vertex_type = std::atomic<vertex_type>;
+    using atomic_flag_type = std::atomic<std::uint8_t>;
+
+    using vertex_allocator_type = inner_alloc<vertex_type>;
+    using atomic_value_allocator_type = inner_alloc<atomic_value_type>;
+    using atomic_vertex_allocator_type = inner_alloc<atomic_vertex_type>;
+    using atomic_flag_allocator_type = inner_alloc<atomic_flag_type>;
+
+    using v1v_t = vector_container<vertex_type, vertex_allocator_type>;
+    using v1a_t = inner_alloc<v1v_t>;
+    using v2v_t = vector_container<v1v_t, v1a_t>;
+    using v2a_t = inner_alloc<v2v_t>;
+    using v3v_t = vector_container<v2v_t, v2a_t>;
+
+    static constexpr vertex_type no_pred = std::numeric_limits<vertex_type>::max();
+
+    delta_stepping_solver(const split_adjacency<value_type>& adj,
+                          value_type max_distance,
+                          bool is_parallel,
+                          bool with_predecessors,
+                          byte_alloc_iface* alloc_ptr)
+            : adj_(adj),
+              delta_(adj.get_delta()),
+              max_distance_(max_distance),
+              vertex_count_(adj.get_vertex_count()),
+              thread_cnt_(is_parallel ? dal::detail::threader_get_max_threads() : 1),
+              vertex_allocator_(alloc_ptr),
+              atomic_value_allocator_(alloc_ptr),
+              atomic_vertex_allocator_(alloc_ptr),
+              atomic_flag_allocator_(alloc_ptr),
+              frontier_(vertex_allocator_),
+              settled_frontier_(vertex_allocator_),
+              visited_(vertex_allocator_),
+              local_bins_(thread_cnt_, v2a_t(alloc_ptr)),
+              local_settled_(thread_cnt_, v1a_t(alloc_ptr)),
+              fused_bins_(thread_cnt_, v1a_t(alloc_ptr)) {
+        ONEDAL_ASSERT(delta_ > 0);
+        dist_ = allocate(atomic_value_allocator_, vertex_count_);
+        settled_ = allocate(atomic_flag_allocator_, vertex_count_);
+        if (with_predecessors) {
+            pred_ = allocate(atomic_vertex_allocator_, vertex_count_);
+            locks_ = allocate(atomic_flag_allocator_, vertex_count_);
+        }
+
+        const value_type max_dist = std::numeric_limits<value_type>::max();
+        for_each_vertex([&](vertex_type u) {
+            new (dist_ + u) atomic_value_type(max_dist);
+            new (settled_ + u) atomic_flag_type(0);
+            if (pred_) {
+                new (pred_ + u) atomic_vertex_type(no_pred);
+                new (locks_ + u) atomic_flag_type(0);
             }
-            is_queue_empty = false;
-            break;
+        });
+    }
+
+    delta_stepping_solver(const delta_stepping_solver&) = delete;
+    delta_stepping_solver& operator=(const delta_stepping_solver&) = delete;
+
+    ~delta_stepping_solver() {
+        deallocate(atomic_value_allocator_, dist_, vertex_count_);
+        deallocate(atomic_flag_allocator_, settled_, vertex_count_);
+        if (pred_) {
+            deallocate(atomic_vertex_allocator_, pred_, vertex_count_);
+            deallocate(atomic_flag_allocator_, locks_, vertex_count_);
         }
     }
-    return is_queue_empty;
-}
 
-template <typename SharedBinContainer, typename BinsVector>
-inline std::int64_t reduce_to_common_bin_seq(const std::int64_t& curr_bin_index,
-                                             BinsVector& local_bins,
-                                             SharedBinContainer& shared_bin) {
-    std::int64_t curr_shared_bin_tail = 0;
-
-    if (curr_bin_index < local_bins[0].size()) {
-        std::int64_t copy_start = curr_shared_bin_tail;
-        curr_shared_bin_tail += local_bins[0][curr_bin_index].size();
-        copy(local_bins[0][curr_bin_index].begin(),
-             local_bins[0][curr_bin_index].end(),
-             shared_bin.get_mutable_data() + copy_start);
-        local_bins[0][curr_bin_index].resize(0);
-    }
-    return curr_shared_bin_tail;
-}
+    void run(vertex_type source) {
+        reset();
 
-template <typename Cpu, typename EdgeValue>
-struct delta_stepping {
-    traverse_result<task::one_to_all> operator()(
-        const detail::descriptor_base<task::one_to_all>& desc,
-        const dal::preview::detail::topology<std::int32_t>& t,
-        const EdgeValue* vals,
-        byte_alloc_iface* alloc_ptr) {
-        {
-            using value_type = EdgeValue;
-            using vertex_type = std::int32_t;
-            using value_allocator_type = inner_alloc<value_type>;
-            using vertex_allocator_type = inner_alloc<vertex_type>;
-
-            vertex_allocator_type vertex_allocator(alloc_ptr);
-            value_allocator_type value_allocator(alloc_ptr);
-
-            const auto source = dal::detail::integral_cast<std::int32_t>(desc.get_source());
-            const value_type delta = desc.get_delta();
-
-            const std::int64_t max_bin_count = std::numeric_limits<std::int64_t>::max() / 2;
-            const std::int64_t max_elements_in_bin = 1000;
-            const auto vertex_count = t.get_vertex_count();
-            const value_type max_dist = std::numeric_limits<value_type>::max();
-
-            value_type* dist = allocate(value_allocator, vertex_count);
-            for (std::int64_t i = 0; i < vertex_count; ++i) {
-                dist[i] = max_dist;
+        dist_[source].store(0, std::memory_order_relaxed);
+        frontier_.resize(1);
+        frontier_[0] = source;
+
+        std::int64_t curr_bin_index = 0;
+        while (curr_bin_index != max_bin_count) {
+            while (!frontier_.empty()) {
+                relax_frontier(curr_bin_index);
+                gather_bins(curr_bin_index, frontier_);
             }
 
-            dist[source] = 0;
+            gather_settled();
+            relax_settled();
+
+            curr_bin_index = find_next_bin_index(curr_bin_index);
+            gather_bins(curr_bin_index, frontier_);
+        }
+
+    }
 
-            vector_container<vertex_type, vertex_allocator_type> shared_bin(t.get_edge_count(),
-                                                                            vertex_allocator);
+    value_type get_distance(vertex_type v) const {
+        return dist_[v].load(std::memory_order_relaxed);
+    }
 
-            shared_bin[0] = source;
-            std::int64_t curr_bin_index = 0;
-            std::int64_t curr_shared_bin_tail = 1;
-            bool empty_queue = false;
+    /// Returns the vertex preceding v on a shortest path or -1 if there is no such vertex.
+    /// The predecessor is the vertex whose relaxation set the final distance of v, so the
+    /// predecessors form a tree even if the graph has zero-weight edges. If there are
+    /// several shortest paths, the selected one depends on the order of the relaxations.
+    vertex_type get_predecessor(vertex_type v) const {
+        ONEDAL_ASSERT(pred_);
+        const vertex_type pred = pred_[v].load(std::memory_order_relaxed);
+        return (pred == no_pred) ? -1 : pred;
+    }
 
-            using v1v_t = vector_container<vertex_type, vertex_allocator_type>;
-            using v1a_t = inner_alloc<v1v_t>;
-            using v2v_t = vector_container<v1v_t, v1a_t>;
-            using v2a_t = inner_alloc<v2v_t>;
-            using v3v_t = vector_container<v2v_t, v2a_t>;
-            v2a_t v2a(alloc_ptr);
-            v3v_t local_bins(1, v2a);
+    /// Returns the number of vertices reached by the last run
+    std::int64_t get_visited_count() const {
+        return visited_.size();
+    }
 
-            std::int64_t iter = 0;
+    /// Returns the vertices reached by the last run in the order they were settled
+    const vertex_type* get_visited() const {
+        return visited_.get_data();
+    }
 
-            while (curr_bin_index != max_bin_count && iter != max_bin_count && !empty_queue) {
-                for (std::int64_t i = 0; i < curr_shared_bin_tail; ++i) {
-                    vertex_type u = shared_bin[i];
-                    if (dist[u] >= delta * static_cast<value_type>(curr_bin_index)) {
-                        relax_edges(t, vals, u, delta, dist, local_bins[0]);
-                    }
-                }
+private:
+    template <typename Body>
+    void for_each_vertex(Body&& body) {
+        if (thread_cnt_ > 1) {
+            dal::detail::threader_for(vertex_count_, vertex_count_, [&](std::int32_t u) {
+                body(u);
+            });
+        }
+        else {
+            for (vertex_type u = 0; u < vertex_count_; ++u) {
+                body(u);
+            }
+        }
+    }
 
-                while (curr_bin_index < local_bins[0].size() &&
-                       !local_bins[0][curr_bin_index].empty() &&
-                       local_bins[0][curr_bin_index].size() < max_elements_in_bin) {
-                    vector_container<vertex_type> curr_bin_copy(
-                        local_bins[0][curr_bin_index].size());
-                    copy(local_bins[0][curr_bin_index].begin(),
-                         local_bins[0][curr_bin_index].end(),
-                         curr_bin_copy.begin());
-
-                    local_bins[0][curr_bin_index].resize(0);
-                    for (std::int64_t j = 0; j < curr_bin_copy.size(); ++j) {
-                        relax_edges(t, vals, curr_bin_copy[j], delta, dist, local_bins[0]);
-                    }
+    /// Calls body(thread_id, begin, end) for the blocks of [0, count)
+    template <typename Body>
+    void for_each_block(std::int64_t count, Body&& body) {
+        const std::int64_t block_count = (count + frontier_block_size - 1) / frontier_block_size;
+        auto process_block = [&](std::int32_t thread_id, std::int64_t block) {
+            const std::int64_t begin = block * frontier_block_size;
+            const std::int64_t end = std::min(begin + frontier_block_size, count);
+            body(thread_id, begin, end);
+        };
+        if (thread_cnt_ > 1) {
+            dal::detail::threader_for_int64(block_count, [&](std::int64_t block) {
+                process_block(dal::detail::threader_get_current_thread_index(), block);
+            });
+        }
+        else {
+            for (std::int64_t block = 0; block < block_count; ++block) {
+                process_block(0, block);
+            }
+        }
+    }
+
+    void reset() {
+        const value_type max_dist = std::numeric_limits<value_type>::max();
+        const vertex_type* visited = visited_.get_data();
+        for_each_block(visited_.size(), [&](std::int32_t, std::int64_t begin, std::int64_t end) {
+            for (std::int64_t i = begin; i < end; ++i) {
+                dist_[visited[i]].store(max_dist, std::memory_order_relaxed);
+                if (pred_) {
+                    pred_[visited[i]].store(no_pred, std::memory_order_relaxed);
                 }
+            }
+        });
+        visited_.resize(0);
+    }
+
+    /// Sets the distance and the predecessor of v together under the vertex lock, so the
+    /// predecessor always belongs to the relaxation that set the current distance
+    bool update_distance_and_predecessor(vertex_type v, value_type new_dist, vertex_type u) {
+        if (!(new_dist < get_distance(v))) {
+            return false;
+        }
+        while (locks_[v].exchange(1, std::memory_order_acquire)) {
+            while (locks_[v].load(std::memory_order_relaxed)) {
+                _mm_pause();
+            }
+        }
+        const bool is_updated = new_dist < get_distance(v);
+        if (is_updated) {
+            dist_[v].store(new_dist, std::memory_order_relaxed);
+            pred_[v].store(u, std::memory_order_relaxed);
+        }
+        locks_[v].store(0, std::memory_order_release);
+        return is_updated;
+    }
 
-                empty_queue = find_next_bin_index_seq(curr_bin_index, local_bins);
+    void relax_edges(vertex_type u, edge_type begin, edge_type end, v2v_t& local_bins) {
+        const value_type dist_u = get_distance(u);
+        for (edge_type e = begin; e < end; ++e) {
+            const vertex_type v = adj_.get_neighbor(e);
+            const value_type new_dist = dist_u + adj_.get_weight(e);
+            if (new_dist > max_distance_) {
+                continue;
+            }
+            const bool is_updated = pred_ ? update_distance_and_predecessor(v, new_dist, u)
+                                          : atomic_min(dist_[v], new_dist);
+            if (is_updated) {
+                update_bins(v, get_bin_index(new_dist, delta_), local_bins);
+            }
+        }
+    }
+
+    void relax_light_edges(vertex_type u, std::int64_t curr_bin_index, std::int32_t thread_id) {
+        // The vertex was moved to an earlier bucket after it had been put into this one
+        if (get_bin_index(get_distance(u), delta_) != curr_bin_index) {
+            return;
+        }
+        if (settled_[u].exchange(1, std::memory_order_relaxed) == 0) {
+            local_settled_[thread_id].push_back(u);
+        }
+        relax_edges(u, adj_.get_light_begin(u), adj_.get_light_end(u), local_bins_[thread_id]);
+    }
 
-                curr_shared_bin_tail =
-                    reduce_to_common_bin_seq(curr_bin_index, local_bins, shared_bin);
+    void relax_frontier(std::int64_t curr_bin_index) {
+        const vertex_type* frontier = frontier_.get_data();
+        for_each_block(frontier_.size(),
+                       [&](std::int32_t thread_id, std::int64_t begin, std::int64_t end) {
+                           for (std::int64_t i = begin; i < end; ++i) {
+                               relax_light_edges(frontier[i], curr_bin_index, thread_id);
+                           }
+                           drain_small_bin(curr_bin_index, thread_id);
+                       });
+    }
 
-                iter++;
+    void drain_small_bin(std::int64_t curr_bin_index, std::int32_t thread_id) {
+        v2v_t& bins = local_bins_[thread_id];
+        v1v_t& fused_bin = fused_bins_[thread_id];
+        while (curr_bin_index < bins.size() && !bins[curr_bin_index].empty() &&
+               bins[curr_bin_index].size() < max_elements_in_bin) {
+            fused_bin.resize(bins[curr_bin_index].size());
+            copy(bins[curr_bin_index].begin(), bins[curr_bin_index].end(), fused_bin.begin());
+            bins[curr_bin_index].resize(0);
+            for (std::int64_t j = 0; j < fused_bin.size(); ++j) {
+                relax_light_edges(fused_bin[j], curr_bin_index, thread_id);
             }
+        }
+    }
+
+    void relax_settled() {
+        const vertex_type* settled = settled_frontier_.get_data();
+        for_each_block(settled_frontier_.size(),
+                       [&](std::int32_t thread_id, std::int64_t begin, std::int64_t end) {
+                           for (std::int64_t i = begin; i < end; ++i) {
+                               const vertex_type u = settled[i];
+                               relax_edges(u,
+                                           adj_.get_light_end(u),
+                                           adj_.get_heavy_end(u),
+                                           local_bins_[thread_id]);
+                               settled_[u].store(0, std::memory_order_relaxed);
+                           }
+                       });
+    }
 
-            auto dist_arr = array<value_type>::empty(vertex_count);
-            value_type* dist_ = dist_arr.get_mutable_data();
-            for (std::int64_t i = 0; i < vertex_count; ++i) {
-                dist_[i] = dist[i];
+    std::int64_t find_next_bin_index(std::int64_t curr_bin_index) const {
+        std::int64_t next_bin_index = max_bin_count;
+        for (std::int32_t thread_id = 0; thread_id < thread_cnt_; ++thread_id) {
+            const v2v_t& bins = local_bins_[thread_id];
+            for (std::int64_t i = curr_bin_index + 1; i < std::min(bins.size(), next_bin_index);
+                 ++i) {
+                if (!bins[i].empty()) {
+                    next_bin_index = i;
+                    break;
+                }
             }
+        }
+        return next_bin_index;
+    }
 
-            deallocate(value_allocator, dist, vertex_count);
-            return traverse_result<task::one_to_all>().set_distances(
-                dal::detail::homogen_table_builder{}
-                    .reset(dist_arr, t.get_vertex_count(), 1)
-                    .build());
+    /// Moves the content of the thread-local lists into the shared one
+    template <typename GetList>
+    void gather(v1v_t& shared, GetList&& get_list) {
+        if (thread_cnt_ == 1) {
+            v1v_t* list = get_list(0);
+            shared.resize(list ? list->size() : 0);
+            if (list) {
+                copy(list->begin(), list->end(), shared.begin());
+                list->resize(0);
+            }
+            return;
+        }
+        vector_container<std::int64_t> offsets(thread_cnt_ + 1);
+        offsets[0] = 0;
+        for (std::int32_t thread_id = 0; thread_id < thread_cnt_; ++thread_id) {
+            v1v_t* list = get_list(thread_id);
+            offsets[thread_id + 1] = offsets[thread_id] + (list ? list->size() : 0);
         }
+        shared.resize(offsets[thread_cnt_]);
+        dal::detail::threader_for(thread_cnt_, thread_cnt_, [&](std::int32_t thread_id) {
+            v1v_t* list = get_list(thread_id);
+            if (list) {
+                copy(list->begin(), list->end(), shared.begin() + offsets[thread_id]);
+                list->resize(0);
+            }
+        });
+    }
+
+    void gather_bins(std::int64_t bin_index, v1v_t& shared) {
+        gather(shared, [&](std::int32_t thread_id) -> v1v_t* {
+            v2v_t& bins = local_bins_[thread_id];
+            return bin_index < bins.size() ? &bins[bin_index] : nullptr;
+        });
     }
+
+    void gather_settled() {
+        gather(settled_frontier_, [&](std::int32_t thread_id) -> v1v_t* {
+            return &local_settled_[thread_id];
+        });
+        const std::int64_t visited_count = visited_.size();
+        visited_.resize(visited_count + settled_frontier_.size());
+        copy(settled_frontier_.begin(), settled_frontier_.end(), visited_.begin() + visited_count);
+    }
+
+    const split_adjacency<value_type>& adj_;
+    const value_type delta_;
+    const value_type max_distance_;
+    const std::int64_t vertex_count_;
+    const std::int32_t thread_cnt_;
+
+    vertex_allocator_type vertex_allocator_;
+    atomic_value_allocator_type atomic_value_allocator_;
+    atomic_vertex_allocator_type atomic_vertex_allocator_;
+    atomic_flag_allocator_type atomic_flag_allocator_;
+
+    atomic_value_type* dist_ = nullptr;
+    atomic_vertex_type* pred_ = nullptr;
+    atomic_flag_type* settled_ = nullptr;
+    atomic_flag_type* locks_ = nullptr;
+
+    v1v_t frontier_;
+    v1v_t settled_frontier_;
+    v1v_t visited_;
+    v3v_t local_bins_;
+    v2v_t local_settled_;
+    v2v_t fused_bins_;
 };
 
 template <typename Cpu, typename EdgeValue>
-struct delta_stepping_with_pred {
+struct delta_stepping {
     traverse_result<task::one_to_all> operator()(
         const detail::descriptor_base<task::one_to_all>& desc,
         const dal::preview::detail::topology<std::int32_t>& t,
         const EdgeValue* vals,
         byte_alloc_iface* alloc_ptr) {
         using value_type = EdgeValue;
-        using vertex_type = std::int32_t;
-        using vp_type = dist_pred<value_type, vertex_type>;
-        using vp_allocator_type = inner_alloc<vp_type>;
-        using vertex_allocator_type = inner_alloc<vertex_type>;
-
-        vertex_allocator_type vertex_allocator(alloc_ptr);
-        vp_allocator_type vp_allocator(alloc_ptr);
 
         const auto source = dal::detail::integral_cast<std::int32_t>(desc.get_source());
-
-        const value_type delta = desc.get_delta();
-
-        const std::int64_t max_bin_count = std::numeric_limits<std::int64_t>::max() / 2;
-        const std::int64_t max_elements_in_bin = 1000;
+        const value_type delta = get_delta(t, vals, desc.get_delta());
+        const value_type max_distance = get_max_distance<value_type>(desc.get_max_distance());
         const auto vertex_count = t.get_vertex_count();
-        const value_type max_dist = std::numeric_limits<value_type>::max();
 
-        vp_type* dp = allocate(vp_allocator, vertex_count);
-        for (std::int64_t i = 0; i < vertex_count; ++i) {
-            new (dp + i) dist_pred<value_type, vertex_type>(max_dist, -1);
-        }
+        split_adjacency<value_type> adj(t, vals, delta, alloc_ptr);
+        delta_stepping_solver<Cpu, value_type> solver(adj, max_distance, true, false, alloc_ptr);
+        solver.run(source);
 
-        dp[source] = dist_pred<value_type, vertex_type>(0, -1);
+        auto dist_arr = array<value_type>::empty(vertex_count);
+        value_type* dist_ = dist_arr.get_mutable_data();
+        dal::detail::threader_for(vertex_count, vertex_count, [&](std::int32_t i) {
+            dist_[i] = solver.get_distance(i);
+        });
 
-        vector_container<vertex_type, vertex_allocator_type> shared_bin(t.get_edge_count(),
-                                                                        vertex_allocator);
+        return traverse_result<task::one_to_all>().set_distances(
+            dal::detail::homogen_table_builder{}.reset(dist_arr, vertex_count, 1).build());
+    }
+};
 
-        shared_bin[0] = source;
-        std::int64_t curr_bin_index = 0;
-        std::int64_t curr_shared_bin_tail = 1;
-        bool empty_queue = false;
+template <typename Cpu, typename EdgeValue>
+struct delta_stepping_with_pred {
+    traverse_result<task::one_to_all> operator()(
+        const detail::descriptor_base<task::one_to_all>& desc,
+        const dal::preview::detail::topology<std::int32_t>& t,
+        const EdgeValue* vals,
+        byte_alloc_iface* alloc_ptr) {
+        using value_type = EdgeValue;
+        using vertex_type = std::int32_t;
 
-        using v1v_t = vector_container<vertex_type, vertex_allocator_type>;
-        using v1a_t = inner_alloc<v1v_t>;
+        const auto source = dal::detail::integral_cast<std::int32_t>(desc.get_source());
+        const value_type delta = get_delta(t, vals, desc.get_delta());
+        const value_type max_distance = get_max_distance<value_type>(desc.get_max_distance());
+        const auto vertex_count = t.get_vertex_count();
 
-        using v2v_t = vector_container<v1v_t, v1a_t>;
-        using v2a_t = inner_alloc<v2v_t>;
-        using v3v_t = vector_container<v2v_t, v2a_t>;
+        split_adjacency<value_type> adj(t, vals, delta, alloc_ptr);
+        delta_stepping_solver<Cpu, value_type> solver(adj, max_distance, true, true, alloc_ptr);
+        solver.run(source);
+
+        const bool with_distances = desc.get_optional_results() & optional_results::distances;
+        auto dist_arr =
+            with_distances ? array<value_type>::empty(vertex_count) : array<value_type>{};
+        auto pred_arr = array<vertex_type>::empty(vertex_count);
+        value_type* dist_ = with_distances ? dist_arr.get_mutable_data() : nullptr;
+        vertex_type* pred_ = pred_arr.get_mutable_data();
+        dal::detail::threader_for(vertex_count, vertex_count, [&](std::int32_t i) {
+            if (dist_) {
+                dist_[i] = solver.get_distance(i);
+            }
+            pred_[i] = solver.get_predecessor(i);
+        });
+
+        auto result = traverse_result<task::one_to_all>().set_predecessors(
+            dal::detail::homogen_table_builder{}.reset(pred_arr, vertex_count, 1).build());
+        if (with_distances) {
+            result.set_distances(
+                dal::detail::homogen_table_builder{}.reset(dist_arr, vertex_count, 1).build());
+        }
+        return result;
+    }
+};
 
-        v2a_t v2a(alloc_ptr);
-        v3v_t local_bins(1, v2a);
+/// Shortest paths from a batch of sources. If there are enough sources to occupy all
+/// the threads, every thread traverses its share of sources with its own sequential solver,
+/// otherwise the sources are traversed one by one with the parallel solver. In both cases
+/// the solvers and the light/heavy split of the graph are reused across the sources.
+template <typename Cpu, typename EdgeValue>
+struct delta_stepping_batch {
+    using value_type = EdgeValue;
+    using vertex_type = std::int32_t;
+    using solver_type = delta_stepping_solver<Cpu, value_type>;
 
-        std::int64_t iter = 0;
+    traverse_result<task::many_to_all> operator()(
+        const detail::descriptor_base<task::many_to_all>& desc,
+        const dal::preview::detail::topology<std::int32_t>& t,
+        const EdgeValue* vals,
+        byte_alloc_iface* alloc_ptr) {
+        const auto& sources = desc.get_sources();
+        const std::int64_t source_count = sources.get_count();
+        const std::int64_t* sources_ptr = sources.get_data();
+        const value_type delta = get_delta(t, vals, desc.get_delta());
+        const value_type max_distance = get_max_distance<value_type>(desc.get_max_distance());
+        const bool with_distances = desc.get_optional_results() & optional_results::distances;
+        const bool with_predecessors =
+            desc.get_optional_results() & optional_results::predecessors;
+        const bool is_sparse = desc.get_result_format() == result_format::sparse;
+        const std::int32_t thread_cnt = dal::detail::threader_get_max_threads();
+
+        split_adjacency<value_type> adj(t, vals, delta, alloc_ptr);
+        batch_results results(t.get_vertex_count(),
+                              source_count,
+                              with_distances,
+                              with_predecessors,
+                              is_sparse);
+
+        if (thread_cnt > 1 && source_count >= thread_cnt) {
+            std::vector<std::unique_ptr<solver_type>> solvers(thread_cnt);
+            for (auto& solver : solvers) {
+                solver.reset(
+                    new solver_type(adj, max_distance, false, with_predecessors, alloc_ptr));
+            }
+            dal::detail::threader_for(source_count, source_count, [&](std::int32_t i) {
+                solver_type& solver = *solvers[dal::detail::threader_get_current_thread_index()];
+                solver.run(dal::detail::integral_cast<vertex_type>(sources_ptr[i]));
+                results.store(i, solver);
+            });
+        }
+        else {
+            solver_type solver(adj, max_distance, true, with_predecessors, alloc_ptr);
+            for (std::int64_t i = 0; i < source_count; ++i) {
+                solver.run(dal::detail::integral_cast<vertex_type>(sources_ptr[i]));
+                results.store(i, solver);
+            }
+        }
+        return results.finalize();
+    }
 
-        while (curr_bin_index != max_bin_count && iter != max_bin_count && !empty_queue) {
-            for (std::int64_t i = 0; i < curr_shared_bin_tail; ++i) {
-                vertex_type u = shared_bin[i];
-                if (dp[u].dist >= delta * static_cast<value_type>(curr_bin_index)) {
-                    relax_edges_with_pred(t, vals, u, delta, dp, local_bins[0]);
-                }
+private:
+    /// Accumulates the per-source results into a dense matrix or CSR rows
+    class batch_results {
+    public:
+        batch_results(std::int64_t vertex_count,
+                      std::int64_t source_count,
+                      bool with_distances,
+                      bool with_predecessors,
+                      bool is_sparse)
+                : vertex_count_(vertex_count),
+                  source_count_(source_count),
+                  with_distances_(with_distances),
+                  with_predecessors_(with_predecessors),
+                  is_sparse_(is_sparse) {
+            if (is_sparse_) {
+                row_dist_.resize(source_count_);
+                row_pred_.resize(source_count_);
+                row_cols_.resize(source_count_);
+                return;
+            }
+            const std::int64_t element_count =
+                dal::detail::check_mul_overflow(vertex_count_, source_count_);
+            if (with_distances_) {
+                dist_ = array<value_type>::empty(element_count);
             }
+            if (with_predecessors_) {
+                pred_ = array<vertex_type>::empty(element_count);
+            }
+        }
 
-            while (curr_bin_index < local_bins[0].size() &&
-                   !local_bins[0][curr_bin_index].empty() &&
-                   local_bins[0][curr_bin_index].size() < max_elements_in_bin) {
-                vector_container<vertex_type> curr_bin_copy(local_bins[0][curr_bin_index].size());
-                copy(local_bins[0][curr_bin_index].begin(),
-                     local_bins[0][curr_bin_index].end(),
-                     curr_bin_copy.begin());
-
-                local_bins[0][curr_bin_index].resize(0);
-                for (std::int64_t j = 0; j < curr_bin_copy.size(); ++j) {
-                    relax_edges_with_pred(t, vals, curr_bin_copy[j], delta, dp, local_bins[0]);
+        void store(std::int64_t i, const solver_type& solver) {
+            if (is_sparse_) {
+                store_sparse(i, solver);
+                return;
+            }
+            value_type* dist = with_distances_ ? dist_.get_mutable_data() + i * vertex_count_
+                                               : nullptr;
+            vertex_type* pred = with_predecessors_
+                                    ? pred_.get_mutable_data() + i * vertex_count_
+                                    : nullptr;
+            for (vertex_type v = 0; v < vertex_count_; ++v) {
+                if (dist) {
+                    dist[v] = solver.get_distance(v);
+                }
+                if (pred) {
+                    pred[v] = solver.get_predecessor(v);
                 }
             }
+        }
 
-            empty_queue = find_next_bin_index_seq(curr_bin_index, local_bins);
-
-            curr_shared_bin_tail = reduce_to_common_bin_seq(curr_bin_index, local_bins, shared_bin);
-
-            iter++;
+        traverse_result<task::many_to_all> finalize() {
+            if (is_sparse_) {
+                return finalize_sparse();
+            }
+            traverse_result<task::many_to_all> result;
+            if (with_distances_) {
+                result.set_distances(dal::detail::homogen_table_builder{}
+                                         .reset(dist_, source_count_, vertex_count_)
+                                         .build());
+            }
+            if (with_predecessors_) {
+                result.set_predecessors(dal::detail::homogen_table_builder{}
+                                            .reset(pred_, source_count_, vertex_count_)
+                                            .build());
+            }
+            return result;
         }
 
-        if (desc.get_optional_results() & optional_results::distances) {
-            auto dist_arr = array<value_type>::empty(vertex_count);
-            auto pred_arr = array<vertex_type>::empty(vertex_count);
-            value_type* dist_ = dist_arr.get_mutable_data();
-            vertex_type* pred_ = pred_arr.get_mutable_data();
-            for (std::int64_t i = 0; i < vertex_count; ++i) {
-                const auto dp_i = dp[i];
-                dist_[i] = dp_i.dist;
-                pred_[i] = dp_i.pred;
+    private:
+        void store_sparse(std::int64_t i, const solver_type& solver) {
+            const std::int64_t visited_count = solver.get_visited_count();
+            auto visited = array<vertex_type>::empty(visited_count);
+            vertex_type* visited_ptr = visited.get_mutable_data();
+            copy(solver.get_visited(), solver.get_visited() + visited_count, visited_ptr);
+            std::sort(visited_ptr, visited_ptr + visited_count);
+            row_cols_[i] = visited;
+            if (with_distances_) {
+                row_dist_[i] = array<value_type>::empty(visited_count);
+                value_type* dist = row_dist_[i].get_mutable_data();
+                for (std::int64_t j = 0; j < visited_count; ++j) {
+                    dist[j] = solver.get_distance(visited_ptr[j]);
+                }
             }
+            if (with_predecessors_) {
+                row_pred_[i] = array<vertex_type>::empty(visited_count);
+                vertex_type* pred = row_pred_[i].get_mutable_data();
+                for (std::int64_t j = 0; j < visited_count; ++j) {
+                    pred[j] = solver.get_predecessor(visited_ptr[j]);
+                }
+            }
+        }
 
-            deallocate(vp_allocator, dp, vertex_count);
-            return traverse_result<task::one_to_all>()
-                .set_distances(dal::detail::homogen_table_builder{}
-                                   .reset(dist_arr, t.get_vertex_count(), 1)
-                                   .build())
-                .set_predecessors(dal::detail::homogen_table_builder{}
-                                      .reset(pred_arr, t.get_vertex_count(), 1)
-                                      .build());
+        template <typename Value>
+        table build_csr(const std::vector<array<Value>>& rows,
+                        const array<std::int64_t>& column_indices,
+                        const array<std::int64_t>& row_indices) const {
+            const std::int64_t* row_indices_ptr = row_indices.get_data();
+            auto data = array<Value>::empty(row_indices_ptr[source_count_] - 1);
+            Value* data_ptr = data.get_mutable_data();
+            dal::detail::threader_for(source_count_, source_count_, [&](std::int32_t i) {
+                copy(rows[i].get_data(),
+                     rows[i].get_data() + rows[i].get_count(),
+                     data_ptr + row_indices_ptr[i] - 1);
+            });
+            return dal::detail::csr_table(data,
+                                          column_indices,
+                                          row_indices,
+                                          source_count_,
+                                          vertex_count_);
         }
-        else {
-            auto pred_arr = array<vertex_type>::empty(vertex_count);
-            vertex_type* pred_ = pred_arr.get_mutable_data();
-            for (std::int64_t i = 0; i < vertex_count; ++i) {
-                const auto dp_i = dp[i];
-                pred_[i] = dp_i.pred;
+
+        traverse_result<task::many_to_all> finalize_sparse() {
+            auto row_indices = array<std::int64_t>::empty(source_count_ + 1);
+            std::int64_t* row_indices_ptr = row_indices.get_mutable_data();
+            row_indices_ptr[0] = 1;
+            for (std::int64_t i = 0; i < source_count_; ++i) {
+                row_indices_ptr[i + 1] = row_indices_ptr[i] + row_cols_[i].get_count();
             }
 
-            deallocate(vp_allocator, dp, vertex_count);
-            return traverse_result<task::one_to_all>().set_predecessors(
-                dal::detail::homogen_table_builder{}
-                    .reset(pred_arr, t.get_vertex_count(), 1)
-                    .build());
+            auto column_indices = array<std::int64_t>::empty(row_indices_ptr[source_count_] - 1);
+            std::int64_t* column_indices_ptr = column_indices.get_mutable_data();
+            dal::detail::threader_for(source_count_, source_count_, [&](std::int32_t i) {
+                const vertex_type* cols = row_cols_[i].get_data();
+                std::int64_t* dest = column_indices_ptr + row_indices_ptr[i] - 1;
+                for (std::int64_t j = 0; j < row_cols_[i].get_count(); ++j) {
+                    dest[j] = std::int64_t(cols[j]) + 1;
+                }
+            });
+
+            traverse_result<task::many_to_all> result;
+            if (with_distances_) {
+                result.set_distances(build_csr(row_dist_, column_indices, row_indices));
+            }
+            if (with_predecessors_) {
+                result.set_predecessors(build_csr(row_pred_, column_indices, row_indices));
+            }
+            return result;
         }
-    }
+
+        const std::int64_t vertex_count_;
+        const std::int64_t source_count_;
+        const bool with_distances_;
+        const bool with_predecessors_;
+        const bool is_sparse_;
+
+        array<value_type> dist_;
+        array<vertex_type> pred_;
+        std::vector<array<value_type>> row_dist_;
+        std::vector<array<vertex_type>> row_pred_;
+        std::vector<array<vertex_type>> row_cols_;
+    };
 };
 
 } // namespace oneapi::dal::preview::shortest_paths::backend
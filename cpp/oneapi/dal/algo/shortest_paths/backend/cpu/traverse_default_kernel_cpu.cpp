@@ -26,4 +26,8 @@ template struct delta_stepping_with_pred<__CPU_TAG__, std::int32_t>;
 
 template struct delta_stepping_with_pred<__CPU_TAG__, double>;
 
+template struct delta_stepping_batch<__CPU_TAG__, std::int32_t>;
+
+template struct delta_stepping_batch<__CPU_TAG__, double>;
+
 } // namespace oneapi::dal::preview::shortest_paths::backend
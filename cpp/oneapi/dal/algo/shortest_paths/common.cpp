@@ -31,13 +31,16 @@ template <typename Task>
 class descriptor_impl : public base {
 public:
     explicit descriptor_impl() {
-        if constexpr (!std::is_same_v<Task, task::one_to_all>) {
+        if constexpr (!is_valid_task<Task>) {
             static_assert("Unsupported task");
         }
     }
 
     std::int64_t _source = 0;
+    array<std::int64_t> _sources;
     double _delta = 1;
+    double _max_distance = std::numeric_limits<double>::max();
+    result_format _result_format = result_format::dense;
     optional_result_id optional_results = optional_results::distances;
 };
 
@@ -49,21 +52,51 @@ std::int64_t descriptor_base<Task>::get_source() const {
     return impl_->_source;
 }
 
+template <typename Task>
+const array<std::int64_t>& descriptor_base<Task>::get_sources() const {
+    return impl_->_sources;
+}
+
 template <typename Task>
 double descriptor_base<Task>::get_delta() const {
     return impl_->_delta;
 }
 
+template <typename Task>
+double descriptor_base<Task>::get_max_distance() const {
+    return impl_->_max_distance;
+}
+
+template <typename Task>
+result_format descriptor_base<Task>::get_result_format() const {
+    return impl_->_result_format;
+}
+
 template <typename Task>
 void descriptor_base<Task>::set_source(std::int64_t source) {
     impl_->_source = source;
 }
 
+template <typename Task>
+void descriptor_base<Task>::set_sources(const array<std::int64_t>& sources) {
+    impl_->_sources = sources;
+}
+
 template <typename Task>
 void descriptor_base<Task>::set_delta(double delta) {
     impl_->_delta = delta;
 }
 
+template <typename Task>
+void descriptor_base<Task>::set_max_distance(double max_distance) {
+    impl_->_max_distance = max_distance;
+}
+
+template <typename Task>
+void descriptor_base<Task>::set_result_format(result_format format) {
+    impl_->_result_format = format;
+}
+
 template <typename Task>
 optional_result_id& descriptor_base<Task>::get_optional_results() const {
     return impl_->optional_results;
@@ -75,5 +108,6 @@ void descriptor_base<Task>::set_optional_results(const optional_result_id& value
 }
 
 template class ONEDAL_EXPORT descriptor_base<task::one_to_all>;
+template class ONEDAL_EXPORT descriptor_base<task::many_to_all>;
 
 } // namespace oneapi::dal::preview::shortest_paths::detail
@@ -24,6 +24,7 @@ namespace oneapi::dal::preview::shortest_paths {
 
 namespace task {
 struct one_to_all {}; // one vertex to all paths
+struct many_to_all {}; // several vertices to all paths, processed as a batch
 using by_default = one_to_all;
 } // namespace task
 
@@ -77,6 +78,14 @@ inline optional_result_id operator!=(const optional_result_id& lhs, const option
     return optional_result_id{ lhs.get_mask() != rhs.get_mask() };
 }
 
+/// Layout of the results computed for multiple source vertices
+enum class result_format {
+    /// Homogen table with a row per source and a column per vertex
+    dense,
+    /// CSR table with a row per source holding the reached vertices only
+    sparse
+};
+
 namespace detail {
 ONEDAL_EXPORT optional_result_id get_predecessors_id();
 ONEDAL_EXPORT optional_result_id get_distances_id();
@@ -96,11 +105,20 @@ class descriptor_impl;
 template <typename T>
 using enable_if_single_source_t = std::enable_if_t<dal::detail::is_one_of_v<T, task::one_to_all>>;
 
+template <typename T>
+using enable_if_multiple_sources_t =
+    std::enable_if_t<dal::detail::is_one_of_v<T, task::many_to_all>>;
+
 template <typename T, typename M>
 using enable_if_delta_stepping_single_source_t =
     std::enable_if_t<dal::detail::is_one_of_v<T, task::one_to_all> &
                      dal::detail::is_one_of_v<M, method::delta_stepping>>;
 
+template <typename T, typename M>
+using enable_if_delta_stepping_multiple_sources_t =
+    std::enable_if_t<dal::detail::is_one_of_v<T, task::many_to_all> &
+                     dal::detail::is_one_of_v<M, method::delta_stepping>>;
+
 template <typename M>
 using enable_if_delta_stepping_t =
     std::enable_if_t<dal::detail::is_one_of_v<M, method::delta_stepping>>;
@@ -109,7 +127,7 @@ template <typename Method>
 constexpr bool is_valid_method = dal::detail::is_one_of_v<Method, method::delta_stepping>;
 
 template <typename Task>
-constexpr bool is_valid_task = dal::detail::is_one_of_v<Task, task::one_to_all>;
+constexpr bool is_valid_task = dal::detail::is_one_of_v<Task, task::one_to_all, task::many_to_all>;
 
 /// The base class for the Shortest Paths algorithm descriptor
 template <typename Task = task::by_default>
@@ -125,12 +143,18 @@ public:
     descriptor_base();
 
     std::int64_t get_source() const;
+    const array<std::int64_t>& get_sources() const;
     double get_delta() const;
+    double get_max_distance() const;
+    result_format get_result_format() const;
     optional_result_id& get_optional_results() const;
 
 protected:
     void set_source(std::int64_t source_vertex);
+    void set_sources(const array<std::int64_t>& sources);
     void set_delta(double delta);
+    void set_max_distance(double max_distance);
+    void set_result_format(result_format format);
     void set_optional_results(const optional_result_id& optional_results);
 
     dal::detail::pimpl<descriptor_impl<Task>> impl_;
@@ -173,6 +197,47 @@ public:
         _alloc = allocator;
     }
 
+    /// Creates a descriptor with the bucket width chosen automatically from the graph
+    template <typename T = Task,
+              typename M = Method,
+              typename = detail::enable_if_delta_stepping_single_source_t<T, M>>
+    descriptor(std::int64_t source_vertex,
+               optional_result_id optional_results = optional_results::distances,
+               Allocator allocator = std::allocator<char>()) {
+        base_t::set_source(source_vertex);
+        base_t::set_delta(0);
+        base_t::set_optional_results(optional_results);
+        _alloc = allocator;
+    }
+
+    /// Creates a descriptor for the batch of source vertices traversed over the same graph
+    template <typename T = Task,
+              typename M = Method,
+              typename = detail::enable_if_delta_stepping_multiple_sources_t<T, M>>
+    descriptor(const array<std::int64_t>& sources,
+               double delta,
+               optional_result_id optional_results = optional_results::distances,
+               Allocator allocator = std::allocator<char>()) {
+        base_t::set_sources(sources);
+        base_t::set_delta(delta);
+        base_t::set_optional_results(optional_results);
+        _alloc = allocator;
+    }
+
+    /// Creates a descriptor for the batch of source vertices with the bucket width chosen
+    /// automatically from the graph
+    template <typename T = Task,
+              typename M = Method,
+              typename = detail::enable_if_delta_stepping_multiple_sources_t<T, M>>
+    descriptor(const array<std::int64_t>& sources,
+               optional_result_id optional_results = optional_results::distances,
+               Allocator allocator = std::allocator<char>()) {
+        base_t::set_sources(sources);
+        base_t::set_delta(0);
+        base_t::set_optional_results(optional_results);
+        _alloc = allocator;
+    }
+
     template <typename T = Task, typename = detail::enable_if_single_source_t<T>>
     auto& set_source(std::int64_t source_vertex) {
         base_t::set_source(source_vertex);
@@ -184,6 +249,8 @@ public:
         return base_t::get_source();
     }
 
+    /// Sets the bucket width. The default value is 1. Zero delta makes the algorithm
+    /// choose the width from the edge weights and the average vertex degree.
     template <typename M = Method, typename = detail::enable_if_delta_stepping_t<M>>
     auto& set_delta(double delta) {
         base_t::set_delta(delta);
@@ -195,6 +262,40 @@ public:
         return base_t::get_delta();
     }
 
+    template <typename T = Task, typename = detail::enable_if_multiple_sources_t<T>>
+    auto& set_sources(const array<std::int64_t>& sources) {
+        base_t::set_sources(sources);
+        return *this;
+    }
+
+    template <typename T = Task, typename = detail::enable_if_multiple_sources_t<T>>
+    const array<std::int64_t>& get_sources() const {
+        return base_t::get_sources();
+    }
+
+    /// Sets the distance the search is bounded by. The vertices which are farther from
+    /// the source are reported as unreachable.
+    auto& set_max_distance(double max_distance) {
+        base_t::set_max_distance(max_distance);
+        return *this;
+    }
+
+    double get_max_distance() const {
+        return base_t::get_max_distance();
+    }
+
+    /// Sets the layout of the distances and predecessors computed for multiple sources
+    template <typename T = Task, typename = detail::enable_if_multiple_sources_t<T>>
+    auto& set_result_format(result_format format) {
+        base_t::set_result_format(format);
+        return *this;
+    }
+
+    template <typename T = Task, typename = detail::enable_if_multiple_sources_t<T>>
+    result_format get_result_format() const {
+        return base_t::get_result_format();
+    }
+
     auto& set_optional_results(const optional_result_id& optional_results) {
         base_t::set_optional_results(optional_results);
         return *this;
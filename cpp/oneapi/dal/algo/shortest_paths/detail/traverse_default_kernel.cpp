@@ -33,6 +33,19 @@ operator()(const dal::detail::host_policy& policy,
     });
 }
 
+template <typename Float, typename EdgeValue>
+traverse_result<task::many_to_all>
+delta_stepping<Float, task::many_to_all, dal::preview::detail::topology<std::int32_t>, EdgeValue>::
+operator()(const dal::detail::host_policy& policy,
+           const detail::descriptor_base<task::many_to_all>& desc,
+           const dal::preview::detail::topology<std::int32_t>& t,
+           const EdgeValue* vals,
+           byte_alloc_iface* alloc_ptr) const {
+    return dal::backend::dispatch_by_cpu(dal::backend::context_cpu{ policy }, [&](auto cpu) {
+        return backend::delta_stepping_batch<decltype(cpu), EdgeValue>{}(desc, t, vals, alloc_ptr);
+    });
+}
+
 template <typename Float, typename EdgeValue>
 traverse_result<task::one_to_all> delta_stepping_with_pred<
     Float,
@@ -59,6 +72,14 @@ template struct ONEDAL_EXPORT delta_stepping<float,
 template struct ONEDAL_EXPORT
     delta_stepping<float, task::one_to_all, dal::preview::detail::topology<std::int32_t>, double>;
 
+template struct ONEDAL_EXPORT delta_stepping<float,
+                                             task::many_to_all,
+                                             dal::preview::detail::topology<std::int32_t>,
+                                             std::int32_t>;
+
+template struct ONEDAL_EXPORT
+    delta_stepping<float, task::many_to_all, dal::preview::detail::topology<std::int32_t>, double>;
+
 template struct ONEDAL_EXPORT delta_stepping_with_pred<float,
                                                        task::one_to_all,
                                                        dal::preview::detail::topology<std::int32_t>,
@@ -58,6 +58,19 @@ struct delta_stepping<Float,
         byte_alloc_iface* alloc) const;
 };
 
+template <typename Float, typename EdgeValue>
+struct delta_stepping<Float,
+                      task::many_to_all,
+                      dal::preview::detail::topology<std::int32_t>,
+                      EdgeValue> {
+    traverse_result<task::many_to_all> operator()(
+        const dal::detail::host_policy& ctx,
+        const detail::descriptor_base<task::many_to_all>& desc,
+        const dal::preview::detail::topology<std::int32_t>& t,
+        const EdgeValue* vals,
+        byte_alloc_iface* alloc) const;
+};
+
 template <typename Float, typename Task, typename Topology, typename EdgeValue, typename... Param>
 struct delta_stepping_with_pred {
     traverse_result<Task> operator()(const dal::detail::host_policy& ctx,
@@ -110,4 +123,24 @@ struct traverse_kernel_cpu<method::delta_stepping, task::one_to_all, Allocator,
     }
 };
 
+template <typename Allocator, typename Graph>
+struct traverse_kernel_cpu<method::delta_stepping, task::many_to_all, Allocator, Graph> {
+    inline traverse_result<task::many_to_all> operator()(
+        const dal::detail::host_policy& ctx,
+        const detail::descriptor_base<task::many_to_all>& desc,
+        const Allocator& alloc,
+        const Graph& g) const {
+        using topology_type = typename graph_traits<Graph>::impl_type::topology_type;
+        using value_type = edge_user_value_type<Graph>;
+        const auto& t = dal::preview::detail::csr_topology_builder<Graph>()(g);
+        const auto vals = dal::detail::get_impl(g).get_edge_values().get_data();
+        alloc_connector<Allocator> alloc_con(alloc);
+        return delta_stepping<float, task::many_to_all, topology_type, value_type>{}(ctx,
+                                                                                     desc,
+                                                                                     t,
+                                                                                     vals,
+                                                                                     &alloc_con);
+    }
+};
+
 } // namespace oneapi::dal::preview::shortest_paths::detail
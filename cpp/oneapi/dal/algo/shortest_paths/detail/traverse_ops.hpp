@@ -47,22 +47,39 @@ struct traverse_ops {
     using result_t = traverse_result<task_t>;
     using descriptor_base_t = descriptor_base<task_t>;
 
-    template <typename T = task_t,
-              typename M = method_t,
-              typename = enable_if_delta_stepping_single_source_t<T, M>>
-    void check_preconditions(const Descriptor &desc, input_t &input) const {
+    void check_source(std::int64_t source, std::int64_t vertex_count) const {
         using msg = dal::detail::error_messages;
-        if (desc.get_source() < 0) {
+        if (source < 0) {
             throw invalid_argument(msg::negative_source());
         }
+        if (source >= vertex_count) {
+            throw invalid_argument(msg::source_gte_vertex_count());
+        }
+    }
+
+    void check_preconditions(const Descriptor &desc, input_t &input) const {
+        using msg = dal::detail::error_messages;
         const std::int64_t vertex_count =
             dal::detail::get_impl(input.get_graph()).get_topology()._vertex_count;
-        if (desc.get_source() >= vertex_count) {
-            throw invalid_argument(msg::source_gte_vertex_count());
+        if constexpr (std::is_same_v<task_t, task::many_to_all>) {
+            const auto &sources = desc.get_sources();
+            if (sources.get_count() == 0) {
+                throw invalid_argument(msg::sources_are_empty());
+            }
+            const std::int64_t *sources_ptr = sources.get_data();
+            for (std::int64_t i = 0; i < sources.get_count(); ++i) {
+                check_source(sources_ptr[i], vertex_count);
+            }
+        }
+        else {
+            check_source(desc.get_source(), vertex_count);
         }
         if (desc.get_delta() < 0) {
             throw invalid_argument(msg::negative_delta());
         }
+        if (desc.get_max_distance() < 0) {
+            throw invalid_argument(msg::negative_max_distance());
+        }
         if (!(desc.get_optional_results() &
               (optional_results::predecessors | optional_results::distances))) {
             throw invalid_argument(msg::nothing_to_compute());
@@ -93,7 +93,10 @@ public:
 class shortest_paths_badargs_test {
 public:
     template <typename GraphType>
-    void check_shortest_paths(double delta, std::int64_t source, bool nothing_to_compute = false) {
+    void check_shortest_paths(double delta,
+                              std::int64_t source,
+                              bool nothing_to_compute = false,
+                              double max_distance = std::numeric_limits<double>::max()) {
         using namespace dal::preview::shortest_paths;
         GraphType graph_data;
 
@@ -115,7 +118,32 @@ public:
                                : optional_results::distances | optional_results::predecessors;
         std::allocator<char> alloc;
 
-        const auto shortest_paths_desc = descriptor<>(source, delta, result_type);
+        const auto shortest_paths_desc =
+            descriptor<>(source, delta, result_type).set_max_distance(max_distance);
+
+        const auto result_shortest_paths = dal::preview::traverse(shortest_paths_desc, graph);
+    }
+
+    template <typename GraphType>
+    void check_shortest_paths_batch(const dal::array<std::int64_t>& sources) {
+        using namespace dal::preview::shortest_paths;
+        GraphType graph_data;
+
+        const auto graph_builder = dal::preview::detail::directed_adjacency_vector_graph_builder<
+            int,
+            double,
+            oneapi::dal::preview::empty_value,
+            int,
+            std::allocator<char>>(graph_data.get_vertex_count(),
+                                  graph_data.get_edge_count(),
+                                  graph_data.rows.data(),
+                                  graph_data.cols.data(),
+                                  graph_data.edge_weights.data());
+
+        const auto& graph = graph_builder.get_graph();
+
+        const auto shortest_paths_desc =
+            descriptor<float, method::delta_stepping, task::many_to_all>(sources, 5);
 
         const auto result_shortest_paths = dal::preview::traverse(shortest_paths_desc, graph);
     }
@@ -136,6 +164,20 @@ SHORTEST_PATHS_BADARG_TEST("Check source is in graph ") {
     REQUIRE_THROWS_AS((this->check_shortest_paths<example_graph_type>(5, 100)), invalid_argument);
 }
 
+SHORTEST_PATHS_BADARG_TEST("Check max distance is >= 0") {
+    REQUIRE_THROWS_AS((this->check_shortest_paths<example_graph_type>(5, 0, false, -1)),
+                      invalid_argument);
+}
+
+SHORTEST_PATHS_BADARG_TEST("Check sources are in graph") {
+    REQUIRE_THROWS_AS((this->check_shortest_paths_batch<example_graph_type>(
+                          dal::array<std::int64_t>::full(2, std::int64_t(100)))),
+                      invalid_argument);
+    REQUIRE_THROWS_AS(
+        (this->check_shortest_paths_batch<example_graph_type>(dal::array<std::int64_t>{})),
+        invalid_argument);
+}
+
 SHORTEST_PATHS_BADARG_TEST("Check empty graph") {
     REQUIRE_THROWS_AS((this->check_shortest_paths<empty_graph_type>(5, 0)), invalid_argument);
 }
@@ -14,11 +14,14 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <algorithm>
 #include <array>
+#include <numeric>
 
 #include "oneapi/dal/algo/shortest_paths/traverse.hpp"
 #include "oneapi/dal/graph/detail/directed_adjacency_vector_graph_builder.hpp"
 #include "oneapi/dal/table/row_accessor.hpp"
+#include "oneapi/dal/table/detail/csr.hpp"
 #include "oneapi/dal/graph/service_functions.hpp"
 #include "oneapi/dal/test/engine/common.hpp"
 #include "oneapi/dal/test/engine/math.hpp"
@@ -583,6 +586,36 @@ public:
                                         unreachable_double_distance };
 };
 
+class d_zero_weight_cycle_graph_type : public graph_base_data {
+public:
+    d_zero_weight_cycle_graph_type() {
+        vertex_count = 3;
+        edge_count = 3;
+        cols_count = 3;
+        rows_count = 4;
+        source = 2;
+    }
+    std::array<std::int64_t, 4> rows = { 0, 1, 2, 3 };
+    std::array<std::int32_t, 3> cols = { 1, 0, 0 };
+    std::array<double, 3> edge_weights = { 0, 0, 1 };
+    std::array<double, 3> distances = { 1, 1, 0 };
+};
+
+class d_zero_weight_cycle_int_graph_type : public graph_base_data {
+public:
+    d_zero_weight_cycle_int_graph_type() {
+        vertex_count = 3;
+        edge_count = 3;
+        cols_count = 3;
+        rows_count = 4;
+        source = 2;
+    }
+    std::array<std::int64_t, 4> rows = { 0, 1, 2, 3 };
+    std::array<std::int32_t, 3> cols = { 1, 0, 0 };
+    std::array<std::int32_t, 3> edge_weights = { 0, 0, 1 };
+    std::array<std::int32_t, 3> distances = { 1, 1, 0 };
+};
+
 class d_k_15_double_edges_source_5_graph_type : public graph_base_data {
 public:
     d_k_15_double_edges_source_5_graph_type() {
@@ -732,6 +765,20 @@ public:
                 }
             }
         }
+        // Every reachable vertex must lead back to the source, so the predecessors
+        // cannot form a cycle even if the distances along it are consistent
+        for (size_t index = 0; index < predecessors.size(); ++index) {
+            int32_t vertex = static_cast<int32_t>(index);
+            size_t step_count = 0;
+            while (vertex != source && predecessors[vertex] != -1 &&
+                   step_count < predecessors.size()) {
+                vertex = predecessors[vertex];
+                ++step_count;
+            }
+            if (predecessors[index] != -1 && vertex != source) {
+                return false;
+            }
+        }
         return true;
     }
 
@@ -835,6 +882,178 @@ public:
                                      graph_data.distances,
                                      alloc);
     }
+
+    template <typename DirectedGraphType, typename EdgeValueType>
+    void batch_shortest_paths_check(double delta, std::int64_t source_count) {
+        using namespace dal::preview::shortest_paths;
+        DirectedGraphType graph_data;
+        const auto graph_builder = dal::preview::detail::directed_adjacency_vector_graph_builder<
+            int32_t,
+            EdgeValueType,
+            oneapi::dal::preview::empty_value,
+            int,
+            std::allocator<char>>(graph_data.get_vertex_count(),
+                                  graph_data.get_edge_count(),
+                                  graph_data.rows.data(),
+                                  graph_data.cols.data(),
+                                  graph_data.edge_weights.data());
+        const auto& graph = graph_builder.get_graph();
+        const auto sources =
+            dal::array<std::int64_t>::full(source_count, graph_data.get_source());
+        const auto shortest_paths_desc =
+            descriptor<float, method::delta_stepping, task::many_to_all>(
+                sources,
+                delta,
+                optional_results::distances | optional_results::predecessors);
+        const auto result = dal::preview::traverse(shortest_paths_desc, graph);
+
+        const auto& distances = result.get_distances();
+        const auto& predecessors = result.get_predecessors();
+        REQUIRE(distances.get_row_count() == source_count);
+        REQUIRE(distances.get_column_count() == graph_data.get_vertex_count());
+        REQUIRE(predecessors.get_row_count() == source_count);
+        for (std::int64_t i = 0; i < source_count; ++i) {
+            const auto distances_row =
+                row_accessor<const EdgeValueType>(distances).pull({ i, i + 1 });
+            const auto predecessors_row =
+                row_accessor<const int32_t>(predecessors).pull({ i, i + 1 });
+            REQUIRE(check_distances(graph_data.distances,
+                                    std::vector<EdgeValueType>(distances_row.get_data(),
+                                                               distances_row.get_data() +
+                                                                   distances_row.get_count())));
+            REQUIRE(check_predecessors(graph,
+                                       std::vector<int32_t>(predecessors_row.get_data(),
+                                                            predecessors_row.get_data() +
+                                                                predecessors_row.get_count()),
+                                       graph_data.distances,
+                                       graph_data.get_source()));
+        }
+    }
+
+    /// Reference distances from the source computed by the Bellman-Ford algorithm.
+    /// The vertices farther than max_distance are reported as unreachable.
+    template <typename DirectedGraphType, typename EdgeValueType>
+    auto get_reference_distances(const DirectedGraphType& graph_data,
+                                 std::int64_t source,
+                                 double max_distance) {
+        const EdgeValueType unreachable_distance = std::numeric_limits<EdgeValueType>::max();
+        auto distances = graph_data.distances;
+        distances.fill(unreachable_distance);
+        distances[source] = 0;
+        const std::int64_t vertex_count = graph_data.get_vertex_count();
+        for (std::int64_t iteration = 0; iteration < vertex_count; ++iteration) {
+            for (std::int64_t u = 0; u < vertex_count; ++u) {
+                if (distances[u] == unreachable_distance) {
+                    continue;
+                }
+                for (std::int64_t e = graph_data.rows[u]; e < graph_data.rows[u + 1]; ++e) {
+                    const EdgeValueType new_distance = distances[u] + graph_data.edge_weights[e];
+                    if (new_distance < distances[graph_data.cols[e]]) {
+                        distances[graph_data.cols[e]] = new_distance;
+                    }
+                }
+            }
+        }
+        for (auto& distance : distances) {
+            if (static_cast<double>(distance) > max_distance) {
+                distance = unreachable_distance;
+            }
+        }
+        return distances;
+    }
+
+    /// Checks the shortest paths from several different sources against the reference
+    /// computed for every source separately, for both the dense and the sparse layouts
+    template <typename DirectedGraphType, typename EdgeValueType>
+    void multiple_sources_check(double delta,
+                                const std::vector<std::int64_t>& sources,
+                                double max_distance,
+                                dal::preview::shortest_paths::result_format format) {
+        using namespace dal::preview::shortest_paths;
+        namespace de = dal::detail;
+        DirectedGraphType graph_data;
+        const auto graph_builder = dal::preview::detail::directed_adjacency_vector_graph_builder<
+            int32_t,
+            EdgeValueType,
+            oneapi::dal::preview::empty_value,
+            int,
+            std::allocator<char>>(graph_data.get_vertex_count(),
+                                  graph_data.get_edge_count(),
+                                  graph_data.rows.data(),
+                                  graph_data.cols.data(),
+                                  graph_data.edge_weights.data());
+        const auto& graph = graph_builder.get_graph();
+        const std::int64_t source_count = sources.size();
+        const std::int64_t vertex_count = graph_data.get_vertex_count();
+        const auto shortest_paths_desc =
+            descriptor<float, method::delta_stepping, task::many_to_all>(
+                dal::array<std::int64_t>::wrap(sources.data(), source_count),
+                delta,
+                optional_results::distances | optional_results::predecessors)
+                .set_max_distance(max_distance)
+                .set_result_format(format);
+        const auto result = dal::preview::traverse(shortest_paths_desc, graph);
+
+        const auto& distances = result.get_distances();
+        const auto& predecessors = result.get_predecessors();
+        REQUIRE(distances.get_row_count() == source_count);
+        REQUIRE(distances.get_column_count() == vertex_count);
+        REQUIRE(predecessors.get_row_count() == source_count);
+        REQUIRE(predecessors.get_column_count() == vertex_count);
+
+        const bool is_sparse = format == result_format::sparse;
+        if (is_sparse) {
+            REQUIRE(distances.get_kind() == de::csr_table::kind());
+            REQUIRE(predecessors.get_kind() == de::csr_table::kind());
+        }
+        for (std::int64_t i = 0; i < source_count; ++i) {
+            const auto true_distances =
+                get_reference_distances<DirectedGraphType, EdgeValueType>(graph_data,
+                                                                          sources[i],
+                                                                          max_distance);
+            std::vector<EdgeValueType> distances_row(vertex_count,
+                                                     std::numeric_limits<EdgeValueType>::max());
+            std::vector<int32_t> predecessors_row(vertex_count, -1);
+            if (is_sparse) {
+                const auto& distances_csr = static_cast<const de::csr_table&>(distances);
+                const auto& predecessors_csr = static_cast<const de::csr_table&>(predecessors);
+                const std::int64_t* row_indices = distances_csr.get_row_indices();
+                const std::int64_t* column_indices = distances_csr.get_column_indices();
+                const std::int64_t reachable_count =
+                    std::count_if(true_distances.begin(),
+                                  true_distances.end(),
+                                  [](EdgeValueType distance) {
+                                      return distance != std::numeric_limits<EdgeValueType>::max();
+                                  });
+                REQUIRE(row_indices[i + 1] - row_indices[i] == reachable_count);
+                for (std::int64_t j = row_indices[i] - 1; j < row_indices[i + 1] - 1; ++j) {
+                    const std::int64_t column = column_indices[j] - 1;
+                    REQUIRE(column >= 0);
+                    REQUIRE(column < vertex_count);
+                    if (j > row_indices[i] - 1) {
+                        REQUIRE(column_indices[j - 1] < column_indices[j]);
+                    }
+                    REQUIRE(predecessors_csr.get_column_indices()[j] == column_indices[j]);
+                    distances_row[column] = distances_csr.get_data<EdgeValueType>()[j];
+                    predecessors_row[column] = predecessors_csr.get_data<int32_t>()[j];
+                }
+            }
+            else {
+                const auto distances_block =
+                    row_accessor<const EdgeValueType>(distances).pull({ i, i + 1 });
+                const auto predecessors_block =
+                    row_accessor<const int32_t>(predecessors).pull({ i, i + 1 });
+                std::copy(distances_block.get_data(),
+                          distances_block.get_data() + vertex_count,
+                          distances_row.begin());
+                std::copy(predecessors_block.get_data(),
+                          predecessors_block.get_data() + vertex_count,
+                          predecessors_row.begin());
+            }
+            REQUIRE(check_distances(true_distances, distances_row));
+            REQUIRE(check_predecessors(graph, predecessors_row, true_distances, sources[i]));
+        }
+    }
 };
 
 #define SHORTEST_PATHS_TEST(name) TEST_M(shortest_paths_test, name, "[shortest_paths]")
@@ -943,4 +1162,101 @@ SHORTEST_PATHS_TEST("Non-zero source vertex, predecessors") {
     this->shortest_paths_check<d_k_15_double_edges_source_5_graph_type, double>(50, false, true);
 }
 
+SHORTEST_PATHS_TEST("Automatic delta, double edge weights") {
+    this->shortest_paths_check<d_net_10_10_double_edges_graph_type, double>(0, true, true);
+}
+
+SHORTEST_PATHS_TEST("Automatic delta, int32_t edge weights") {
+    this->shortest_paths_check<d_net_10_10_int_edges_graph_type, int32_t>(0, true, true);
+}
+
+SHORTEST_PATHS_TEST("Zero-weight cycle, double edge weights") {
+    this->shortest_paths_check<d_zero_weight_cycle_graph_type, double>(1, true, true);
+    this->shortest_paths_check<d_zero_weight_cycle_graph_type, double>(0.5, false, true);
+    this->shortest_paths_check<d_zero_weight_cycle_graph_type, double>(0, true, true);
+}
+
+SHORTEST_PATHS_TEST("Zero-weight cycle, int32_t edge weights") {
+    this->shortest_paths_check<d_zero_weight_cycle_int_graph_type, int32_t>(1, true, true);
+    this->shortest_paths_check<d_zero_weight_cycle_int_graph_type, int32_t>(2, false, true);
+}
+
+SHORTEST_PATHS_TEST("Default delta is one") {
+    using namespace dal::preview::shortest_paths;
+    const dal::preview::shortest_paths::detail::descriptor_base<task::one_to_all> desc;
+    REQUIRE(desc.get_delta() == 1.0);
+    const auto auto_delta_desc = descriptor<float, method::delta_stepping, task::one_to_all>(0);
+    REQUIRE(auto_delta_desc.get_delta() == 0.0);
+}
+
+SHORTEST_PATHS_TEST("Multiple sources, double edge weights") {
+    this->batch_shortest_paths_check<d_k_15_double_edges_source_5_graph_type, double>(50, 3);
+}
+
+SHORTEST_PATHS_TEST("Multiple sources, int32_t edge weights") {
+    this->batch_shortest_paths_check<d_net_10_10_int_edges_graph_type, int32_t>(0, 70);
+}
+
+SHORTEST_PATHS_TEST("Multiple different sources, dense result") {
+    using namespace dal::preview::shortest_paths;
+    const double no_limit = std::numeric_limits<double>::max();
+    this->multiple_sources_check<d_k_15_double_edges_source_5_graph_type, double>(
+        50,
+        { 5, 0, 14, 7, 5 },
+        no_limit,
+        result_format::dense);
+    this->multiple_sources_check<d_multiple_connectivity_components_graph_type, double>(
+        1.5,
+        { 0, 4, 7, 1 },
+        no_limit,
+        result_format::dense);
+}
+
+SHORTEST_PATHS_TEST("Multiple different sources, sparse result") {
+    using namespace dal::preview::shortest_paths;
+    const double no_limit = std::numeric_limits<double>::max();
+    this->multiple_sources_check<d_k_15_double_edges_source_5_graph_type, double>(
+        50,
+        { 5, 0, 14, 7, 5 },
+        no_limit,
+        result_format::sparse);
+    this->multiple_sources_check<d_multiple_connectivity_components_graph_type, double>(
+        1.5,
+        { 0, 4, 7, 1 },
+        no_limit,
+        result_format::sparse);
+}
+
+SHORTEST_PATHS_TEST("Multiple different sources, one source per thread") {
+    using namespace dal::preview::shortest_paths;
+    const double no_limit = std::numeric_limits<double>::max();
+    std::vector<std::int64_t> sources(100);
+    std::iota(sources.begin(), sources.end(), 0);
+    std::reverse(sources.begin(), sources.end());
+    this->multiple_sources_check<d_net_10_10_int_edges_graph_type, int32_t>(0,
+                                                                            sources,
+                                                                            no_limit,
+                                                                            result_format::dense);
+    this->multiple_sources_check<d_net_10_10_double_edges_graph_type, double>(
+        40,
+        sources,
+        no_limit,
+        result_format::sparse);
+}
+
+SHORTEST_PATHS_TEST("Multiple different sources, bounded distance") {
+    using namespace dal::preview::shortest_paths;
+    for (auto format : { result_format::dense, result_format::sparse }) {
+        this->multiple_sources_check<d_k_15_double_edges_source_5_graph_type, double>(
+            50,
+            { 5, 0, 14 },
+            30,
+            format);
+        this->multiple_sources_check<d_net_10_10_int_edges_graph_type, int32_t>(40,
+                                                                                { 0, 55, 99 },
+                                                                                150,
+                                                                                format);
+    }
+}
+
 } // namespace oneapi::dal::algo::shortest_paths::test
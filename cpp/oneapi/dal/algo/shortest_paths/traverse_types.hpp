@@ -63,7 +63,9 @@ public:
     traverse_result();
 
     /// Returns the table with computed distances from the source to each vertex
-    /// represented as the type of weights of the graph (std::int32_t or double)
+    /// represented as the type of weights of the graph (std::int32_t or double).
+    /// For multiple sources, the table holds a row per source laid out according to
+    /// the result format of the descriptor.
     const table& get_distances() const {
         return get_distances_impl();
     }
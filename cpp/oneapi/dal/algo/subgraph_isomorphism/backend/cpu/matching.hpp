@@ -46,10 +46,8 @@ public:
     virtual ~matching_engine();
 
     void run_and_wait(global_stack<Cpu>& gstack,
-                      std::int64_t& busy_engine_count,
-                      std::int64_t& current_match_count,
-                      std::int64_t target_match_count,
-                      bool main_engine);
+                      std::int64_t& cumulative_match_count,
+                      std::int64_t target_match_count);
     solution<Cpu> get_solution();
     std::int64_t get_match_count() const;
 
@@ -61,8 +59,6 @@ public:
                                           std::int64_t delta,
                                           std::int64_t target_match_count);
 
-    std::int64_t first_states_generator(dfs_stack<Cpu>& stack);
-
     void push_into_stack(const std::int64_t vertex_id);
     bool match_vertex(const std::int64_t pattern_vertex, const std::int64_t target_vertex) const;
 
@@ -75,6 +71,7 @@ public:
     const sconsistent_conditions<Cpu>* pconsistent_conditions;
 
     std::int64_t solution_length;
+    std::int64_t solution_limit;
     bit_vector<Cpu> vertex_candidates;
 
     std::int64_t temporary_list_size;
@@ -90,7 +87,6 @@ public:
 
     std::int64_t extract_candidates(bool check_solution);
     bool check_vertex_candidate(bool check_solution, std::int64_t candidate);
-    void set_not_busy(bool& is_busy_engine, std::int64_t& busy_engine_count);
 };
 
 template <typename Cpu>
@@ -161,8 +157,7 @@ matching_engine<Cpu>::matching_engine(const graph<Cpu>* ppattern,
     pconsistent_conditions = pcconditions;
 
     solution_length = pattern->get_vertex_count();
-
-    std::int64_t target_vertex_count = target->get_vertex_count();
+    solution_limit = 0;
 
     pstart_byte = vertex_candidates.get_vector_pointer();
 
@@ -172,7 +167,9 @@ matching_engine<Cpu>::matching_engine(const graph<Cpu>* ppattern,
         max_neighbours_size = max_degree;
     }
 
-    hlocal_stack.init(solution_length - 1, target_vertex_count);
+    // The levels grow on demand, so a level sized by the maximal degree is enough to start
+    // with instead of reserving the whole target vertex range for every level of every engine
+    hlocal_stack.init(solution_length - 1, static_cast<std::uint64_t>(max_degree + 1));
 
     if (target->bit_representation) {
         temporary_list = nullptr;
@@ -267,6 +264,9 @@ bool matching_engine<Cpu>::check_vertex_candidate(bool check_solution, std::int6
     std::uint64_t solution_length_unsigned = solution_length;
     if (match_vertex(sorted_pattern_vertex[hlocal_stack.get_current_level()], candidate)) {
         if (check_solution && hlocal_stack.get_current_level() + 1 == solution_length_unsigned) {
+            if (solution_limit > 0 && engine_solutions.get_solution_count() >= solution_limit) {
+                return false;
+            }
             std::int64_t* solution_core = allocator.allocate<std::int64_t>(solution_length);
             if (solution_core != nullptr) {
                 hlocal_stack.fill_solution(solution_core, candidate);
@@ -323,20 +323,6 @@ void matching_engine<Cpu>::push_into_stack(const std::int64_t vertex_id) {
     hlocal_stack.push_into_current_level(vertex_id);
 }
 
-template <typename Cpu>
-std::int64_t matching_engine<Cpu>::first_states_generator(dfs_stack<Cpu>& stack) {
-    std::int64_t degree = pattern->get_vertex_degree(sorted_pattern_vertex[0]);
-    for (std::int64_t i = 0; i < target->get_vertex_count(); i++) {
-        if (degree <= target->get_vertex_degree(i) &&
-            pattern->get_vertex_attribute(sorted_pattern_vertex[0]) ==
-                target->get_vertex_attribute(i)) {
-            stack.push_into_current_level(i);
-        }
-    }
-
-    return stack.get_current_level_fill_size();
-}
-
 template <typename Cpu>
 bool matching_engine<Cpu>::match_vertex(const std::int64_t pattern_vertex,
                                         const std::int64_t target_vertex) const {
@@ -383,63 +369,44 @@ bool matching_engine<Cpu>::check_if_max_match_count_reached(std::int64_t& cumula
     return is_reached;
 }
 
-template <typename Cpu>
-void matching_engine<Cpu>::set_not_busy(bool& is_busy_engine, std::int64_t& busy_engine_count) {
-    if (is_busy_engine) {
-        is_busy_engine = false;
-        dal::detail::atomic_decrement(busy_engine_count);
-    }
-}
-
 template <typename Cpu>
 void matching_engine<Cpu>::run_and_wait(global_stack<Cpu>& gstack,
-                                        std::int64_t& busy_engine_count,
                                         std::int64_t& cumulative_match_count,
-                                        std::int64_t target_match_count,
-                                        bool main_engine) {
-    if (main_engine) {
-        first_states_generator(hlocal_stack);
-    }
-    bool is_busy_engine = true;
-    std::int64_t current_match_count = 0;
+                                        std::int64_t target_match_count) {
     ONEDAL_ASSERT(pattern != nullptr);
+    // No engine needs more solutions than requested in total
+    solution_limit = target_match_count;
+    bool is_busy_engine = false;
+    idle_backoff backoff;
     for (;;) {
         if (target_match_count > 0 &&
             dal::detail::atomic_load(cumulative_match_count) >= target_match_count) {
-            set_not_busy(is_busy_engine, busy_engine_count);
             break;
         }
         if (hlocal_stack.states_in_stack() > 0) {
-            while ((hlocal_stack.states_in_stack() > 5) && gstack.push(hlocal_stack))
-                ;
+            if (hlocal_stack.states_in_stack() > 1 && gstack.has_waiting_engines()) {
+                gstack.push(hlocal_stack);
+            }
             ONEDAL_ASSERT(hlocal_stack.states_in_stack() > 0);
             const auto delta = state_exploration();
-            current_match_count += delta;
             if (target_match_count > 0 && check_if_max_match_count_reached(cumulative_match_count,
                                                                            delta,
                                                                            target_match_count)) {
-                set_not_busy(is_busy_engine, busy_engine_count);
                 break;
             }
         }
+        else if (!gstack.pop(hlocal_stack, is_busy_engine)) {
+            break;
+        }
+        else if (hlocal_stack.states_in_stack() == 0) {
+            // A busy engine is still running and may donate a state later
+            backoff.wait();
+        }
         else {
-            gstack.pop(hlocal_stack);
-            if (hlocal_stack.empty()) {
-                set_not_busy(is_busy_engine, busy_engine_count);
-                if (target_match_count > 0 &&
-                    dal::detail::atomic_load(cumulative_match_count) >= target_match_count) {
-                    break;
-                }
-                if (dal::detail::atomic_load(busy_engine_count) == 0)
-                    break;
-            }
-            else if (!is_busy_engine) {
-                is_busy_engine = true;
-                dal::detail::atomic_increment(busy_engine_count);
-            }
+            backoff.reset();
         }
     }
-    return;
+    gstack.release(is_busy_engine);
 }
 
 template <typename Cpu>
@@ -506,30 +473,29 @@ solution<Cpu> engine_bundle<Cpu>::combine_solutions(matching_engine<Cpu>* engine
 
 template <typename Cpu>
 solution<Cpu> engine_bundle<Cpu>::run(std::int64_t max_match_count) {
-    std::int64_t degree = pattern->get_vertex_degree(sorted_pattern_vertex[0]);
-
-    std::uint64_t first_states_count =
-        pattern_vertex_probability[0] * target->get_vertex_count() + 1;
-    std::uint64_t max_threads_count = dal::detail::threader_get_max_threads();
-    std::uint64_t possible_first_states_count_per_thread = first_states_count / max_threads_count;
-    if (possible_first_states_count_per_thread < 1) {
-        possible_first_states_count_per_thread = 1;
-    }
-    else {
-        possible_first_states_count_per_thread +=
-            static_cast<bool>(first_states_count % max_threads_count);
+    const std::int64_t degree = pattern->get_vertex_degree(sorted_pattern_vertex[0]);
+    const std::int64_t target_vertex_count = target->get_vertex_count();
+
+    auto first_states_ptr = allocator.make_shared_memory<std::int64_t>(
+        (target_vertex_count > 0) ? target_vertex_count : 1);
+    std::int64_t* first_states = first_states_ptr.get();
+    std::int64_t first_state_count = 0;
+    for (std::int64_t i = 0; i < target_vertex_count; ++i) {
+        if (degree <= target->get_vertex_degree(i) &&
+            pattern->get_vertex_attribute(sorted_pattern_vertex[0]) ==
+                target->get_vertex_attribute(i)) {
+            first_states[first_state_count++] = i;
+        }
     }
 
-    const std::uint64_t array_size =
-        (max_threads_count >= 64)
-            ? max_threads_count * 2 / 10
-            : (max_threads_count >= 24)
-                  ? max_threads_count * 4 / 10
-                  : (max_threads_count >= 8) ? 4 : (max_threads_count >= 4) ? 2 : 1;
+    // Idle engines never block the others, so every thread gets its own engine
+    const std::int64_t max_threads_count = dal::detail::threader_get_max_threads();
+    const std::int64_t array_size =
+        std::max<std::int64_t>(1, std::min(max_threads_count, first_state_count));
     auto engine_array_ptr = allocator.make_shared_memory<matching_engine<Cpu>>(array_size);
     matching_engine<Cpu>* engine_array = engine_array_ptr.get();
 
-    for (std::uint64_t i = 0; i < array_size; ++i) {
+    for (std::int64_t i = 0; i < array_size; ++i) {
         new (engine_array + i) matching_engine<Cpu>(pattern,
                                                     target,
                                                     sorted_pattern_vertex,
@@ -540,36 +506,22 @@ solution<Cpu> engine_bundle<Cpu>::run(std::int64_t max_match_count) {
                                                     allocator);
     }
 
-    state<Cpu> null_state(allocator);
-    std::uint64_t task_counter = 0, index = 0;
-    for (std::int64_t i = 0; i < target->get_vertex_count(); ++i) {
-        if (degree <= target->get_vertex_degree(i) &&
-            pattern->get_vertex_attribute(sorted_pattern_vertex[0]) ==
-                target->get_vertex_attribute(i)) {
-            index = task_counter % array_size;
-            engine_array[index].push_into_stack(i);
-
-            if ((engine_array[index].hlocal_stack.states_in_stack() /
-                 possible_first_states_count_per_thread) > 0) {
-                task_counter++;
-            }
-        }
-    }
+    // The root level is split into several chunks per engine; deeper levels are split
+    // later by donations to the engines that run out of work
+    const std::int64_t first_state_chunks_per_engine = 16;
+    global_stack<Cpu> gstack(pattern->get_vertex_count(), array_size, allocator);
+    gstack.set_first_states(first_states,
+                            first_state_count,
+                            first_state_count / (array_size * first_state_chunks_per_engine) + 1);
 
-    global_stack<Cpu> gstack(pattern->get_vertex_count(), allocator);
-    std::int64_t busy_engine_count(array_size);
     std::int64_t cumulative_match_count(0);
     dal::detail::threader_for(array_size, array_size, [&](const int index) {
-        engine_array[index].run_and_wait(gstack,
-                                         busy_engine_count,
-                                         cumulative_match_count,
-                                         max_match_count,
-                                         false);
+        engine_array[index].run_and_wait(gstack, cumulative_match_count, max_match_count);
     });
 
     auto aggregated_solution = combine_solutions(engine_array, array_size, max_match_count);
 
-    for (std::uint64_t i = 0; i < array_size; i++) {
+    for (std::int64_t i = 0; i < array_size; i++) {
         engine_array[i].~matching_engine();
     }
     return aggregated_solution;
@@ -16,6 +16,10 @@
 
 #pragma once
 
+#include <algorithm>
+#include <immintrin.h>
+#include <thread>
+
 #include "oneapi/dal/algo/subgraph_isomorphism/backend/cpu/inner_alloc.hpp"
 #include "oneapi/dal/algo/subgraph_isomorphism/backend/cpu/solution.hpp"
 #include "oneapi/dal/algo/subgraph_isomorphism/backend/cpu/compiler_adapt.hpp"
@@ -83,12 +87,43 @@ private:
 template <typename Cpu>
 class dfs_stack;
 
+/// Wait policy of an engine that has no state to explore: the pause between two attempts to
+/// take a state from the global stack doubles up to max_spin_count pause instructions, after
+/// that the engine yields its thread on every attempt.
+class idle_backoff {
+public:
+    void wait() {
+        if (spin_count_ > max_spin_count) {
+            std::this_thread::yield();
+            return;
+        }
+        for (std::int32_t i = 0; i < spin_count_; ++i) {
+            _mm_pause();
+        }
+        spin_count_ *= 2;
+    }
+
+    void reset() {
+        spin_count_ = 1;
+    }
+
+private:
+    static constexpr std::int32_t max_spin_count = 1024;
+    std::int32_t spin_count_ = 1;
+};
+
+/// Pool of search states shared by the matching engines. The first level of the search
+/// tree is handed out in chunks, deeper states are donated by the busy engines on demand:
+/// an engine that runs out of work becomes waiting, and the busy engines give away the
+/// shallowest unexplored sibling from their DFS stacks while there are waiting engines.
+/// Every engine starts as waiting and calls release() when it leaves the search.
 template <typename Cpu>
 class global_stack {
 public:
-    global_stack(std::int64_t vertex_count, inner_alloc alloc)
+    global_stack(std::int64_t vertex_count, std::int64_t engine_count, inner_alloc alloc)
             : allocator(alloc),
-              vertex_count_(vertex_count) {}
+              vertex_count_(vertex_count),
+              waiting_count_(engine_count) {}
 
     global_stack(const global_stack&) = delete;
     global_stack(global_stack&&) = delete;
@@ -100,11 +135,24 @@ public:
     global_stack& operator=(const global_stack&) = delete;
     global_stack& operator=(global_stack&&) = delete;
 
+    void set_first_states(const std::int64_t* states, std::int64_t count, std::int64_t chunk_size);
+
+    bool has_waiting_engines() {
+        return dal::detail::atomic_load(waiting_count_) > 0;
+    }
+
     bool push(dfs_stack<Cpu>& s);
-    void pop(dfs_stack<Cpu>& s);
+
+    /// Moves a state into the empty stack s and marks the engine busy. If there is no state,
+    /// marks the engine waiting and returns whether a busy engine is left to donate one.
+    bool pop(dfs_stack<Cpu>& s, bool& is_busy);
+
+    /// Removes the engine from the search: it is neither busy nor waiting afterwards, so
+    /// the busy engines stop donating states to it.
+    void release(bool& is_busy);
 
 private:
-    void internal_push(dfs_stack<Cpu>& s, std::uint64_t level);
+    bool internal_push(dfs_stack<Cpu>& s, std::uint64_t level);
     void clear();
     void grow();
 
@@ -126,6 +174,14 @@ private:
     std::uint64_t* bottom_{ nullptr };
     std::uint64_t* top_{ nullptr };
     std::int64_t capacity_{ 0 };
+
+    const std::int64_t* first_states_{ nullptr };
+    std::int64_t first_state_count_{ 0 };
+    std::int64_t first_state_chunk_size_{ 1 };
+    std::int64_t next_first_state_{ 0 };
+
+    std::int64_t busy_count_{ 0 };
+    std::int64_t waiting_count_;
 };
 
 template <typename Cpu>
@@ -397,29 +453,33 @@ void vertex_stack<Cpu>::increase_stack_size() {
     ONEDAL_ASSERT(ptop <= stack_data + stack_size);
 }
 
+template <typename Cpu>
+void global_stack<Cpu>::set_first_states(const std::int64_t* states,
+                                         std::int64_t count,
+                                         std::int64_t chunk_size) {
+    const dal::detail::scoped_lock lock(mutex_);
+    first_states_ = states;
+    first_state_count_ = count;
+    first_state_chunk_size_ = (chunk_size > 0) ? chunk_size : 1;
+    next_first_state_ = 0;
+}
+
 template <typename Cpu>
 bool global_stack<Cpu>::push(dfs_stack<Cpu>& s) {
-    for (auto level = s.get_current_level_index(); level > 0; --level) {
+    // The shallowest state roots the largest subtree, so it is the cheapest one to share
+    for (std::uint64_t level = 0; level <= s.get_current_level_index(); ++level) {
         if (s.data_by_levels[level].size() > 1) {
-            internal_push(s, level);
-            return true;
+            return internal_push(s, level);
         }
     }
-
-    if (s.data_by_levels[0].size() > 1) {
-        internal_push(s, 0);
-        return true;
-    }
-
     return false;
 }
 
 template <typename Cpu>
-void global_stack<Cpu>::pop(dfs_stack<Cpu>& s) {
+bool global_stack<Cpu>::pop(dfs_stack<Cpu>& s, bool& is_busy) {
     ONEDAL_ASSERT(s.empty());
     const dal::detail::scoped_lock lock(mutex_);
     if (!empty()) {
-        // const auto& v = data_.top();
         const auto v = top_ - vertex_count_;
         ONEDAL_ASSERT(v >= bottom_);
         for (std::int64_t i = 0; i < vertex_count_ && v[i] != null_vertex(); ++i) {
@@ -431,15 +491,57 @@ void global_stack<Cpu>::pop(dfs_stack<Cpu>& s) {
         }
         top_ = v;
     }
+    else if (next_first_state_ < first_state_count_) {
+        const std::int64_t last_first_state =
+            std::min(next_first_state_ + first_state_chunk_size_, first_state_count_);
+        for (; next_first_state_ < last_first_state; ++next_first_state_) {
+            s.push_into_current_level(first_states_[next_first_state_]);
+        }
+    }
+    else {
+        if (is_busy) {
+            is_busy = false;
+            --busy_count_;
+            dal::detail::atomic_increment(waiting_count_);
+        }
+        // Busy engines may still donate states, the search is over only when all are idle
+        return busy_count_ > 0;
+    }
+
+    if (!is_busy) {
+        is_busy = true;
+        ++busy_count_;
+        dal::detail::atomic_decrement(waiting_count_);
+    }
+    return true;
 }
 
 template <typename Cpu>
-void global_stack<Cpu>::internal_push(dfs_stack<Cpu>& s, std::uint64_t level) {
+void global_stack<Cpu>::release(bool& is_busy) {
+    const dal::detail::scoped_lock lock(mutex_);
+    if (is_busy) {
+        is_busy = false;
+        --busy_count_;
+    }
+    else {
+        dal::detail::atomic_decrement(waiting_count_);
+    }
+}
+
+template <typename Cpu>
+bool global_stack<Cpu>::internal_push(dfs_stack<Cpu>& s, std::uint64_t level) {
     ONEDAL_ASSERT(vertex_count_ >= 0);
     // Collect state and push back
     {
-        const auto v = allocator.allocate<std::uint64_t>(level + 1);
+        const dal::detail::scoped_lock lock(mutex_);
+        if (size() >= dal::detail::atomic_load(waiting_count_)) {
+            return false;
+        }
+        if (size() >= capacity_) {
+            grow();
+        }
 
+        ONEDAL_ASSERT(top_ + vertex_count_ <= bottom_ + capacity_ * vertex_count_);
         for (std::uint64_t i = 0; i < level; ++i) {
             ONEDAL_ASSERT(i < s.max_level_size);
             ONEDAL_ASSERT(s.data_by_levels[i].ptop != nullptr);
@@ -447,7 +549,7 @@ void global_stack<Cpu>::internal_push(dfs_stack<Cpu>& s, std::uint64_t level) {
             ONEDAL_ASSERT(s.data_by_levels[i].ptop >= s.data_by_levels[i].bottom_);
             ONEDAL_ASSERT(s.data_by_levels[i].ptop <=
                           s.data_by_levels[i].stack_data + s.data_by_levels[i].stack_size);
-            v[i] = s.data_by_levels[i].ptop[-1];
+            *(top_++) = s.data_by_levels[i].ptop[-1];
         }
 
         ONEDAL_ASSERT(level < s.max_level_size);
@@ -457,27 +559,16 @@ void global_stack<Cpu>::internal_push(dfs_stack<Cpu>& s, std::uint64_t level) {
         ONEDAL_ASSERT(s.data_by_levels[level].ptop >= s.data_by_levels[level].bottom_);
         ONEDAL_ASSERT(s.data_by_levels[level].ptop <=
                       s.data_by_levels[level].stack_data + s.data_by_levels[level].stack_size);
-        v[level] = *(s.data_by_levels[level].bottom_);
+        *(top_++) = *(s.data_by_levels[level].bottom_);
 
-        const dal::detail::scoped_lock lock(mutex_);
-        if (size() >= capacity_) {
-            grow();
-        }
-
-        ONEDAL_ASSERT(top_ + vertex_count_ <= bottom_ + capacity_ * vertex_count_);
-        std::uint64_t j = 0;
-        for (; j <= level; ++j) {
-            *(top_++) = v[j];
-        }
-        for (; j < static_cast<std::uint64_t>(vertex_count_); ++j) {
+        for (std::uint64_t j = level + 1; j < static_cast<std::uint64_t>(vertex_count_); ++j) {
             *(top_++) = null_vertex();
         }
-
-        allocator.deallocate(v, level + 1);
     }
 
     // Remove state
     ++(s.data_by_levels[level].bottom_);
+    return true;
 }
 
 template <typename Cpu>
@@ -0,0 +1,115 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "oneapi/dal/algo/subgraph_isomorphism/backend/cpu/stack.hpp"
+#include "oneapi/dal/backend/dispatcher.hpp"
+#include "oneapi/dal/test/engine/common.hpp"
+
+namespace oneapi::dal::algo::subgraph_isomorphism::test {
+
+namespace si = dal::preview::subgraph_isomorphism;
+
+class global_stack_test {
+public:
+    using cpu_t = dal::backend::cpu_dispatch_default;
+    using global_stack_t = si::backend::global_stack<cpu_t>;
+    using dfs_stack_t = si::backend::dfs_stack<cpu_t>;
+
+    static constexpr std::int64_t level_count = 3;
+
+    global_stack_test() : connector_(std::allocator<char>()), allocator_(&connector_) {}
+
+    si::backend::inner_alloc get_allocator() {
+        return allocator_;
+    }
+
+    void init_stack(dfs_stack_t& s) {
+        s.init(level_count, 8);
+    }
+
+private:
+    si::detail::alloc_connector<std::allocator<char>> connector_;
+    si::backend::inner_alloc allocator_;
+};
+
+#define GLOBAL_STACK_TEST(name) \
+    TEST_M(global_stack_test, name, "[subgraph_isomorphism][global_stack]")
+
+GLOBAL_STACK_TEST("Engines that leave the search are not waiting") {
+    const std::int64_t first_states[] = { 0, 1, 2, 3 };
+    global_stack_t gstack(level_count, 2, get_allocator());
+    gstack.set_first_states(first_states, 4, 4);
+    REQUIRE(gstack.has_waiting_engines());
+
+    dfs_stack_t first(get_allocator());
+    init_stack(first);
+    bool is_first_busy = false;
+    REQUIRE(gstack.pop(first, is_first_busy));
+    REQUIRE(is_first_busy);
+    REQUIRE(first.states_in_stack() == 4);
+    REQUIRE(gstack.has_waiting_engines());
+
+    // The second engine leaves without taking a state
+    bool is_second_busy = false;
+    gstack.release(is_second_busy);
+    REQUIRE_FALSE(gstack.has_waiting_engines());
+    REQUIRE_FALSE(gstack.push(first));
+    REQUIRE(first.states_in_stack() == 4);
+
+    gstack.release(is_first_busy);
+    REQUIRE_FALSE(is_first_busy);
+    REQUIRE_FALSE(gstack.has_waiting_engines());
+}
+
+GLOBAL_STACK_TEST("Idle engines wait while a busy engine can donate") {
+    const std::int64_t first_states[] = { 0, 1 };
+    global_stack_t gstack(level_count, 2, get_allocator());
+    gstack.set_first_states(first_states, 2, 2);
+
+    dfs_stack_t first(get_allocator());
+    dfs_stack_t second(get_allocator());
+    init_stack(first);
+    init_stack(second);
+    bool is_first_busy = false;
+    bool is_second_busy = false;
+    REQUIRE(gstack.pop(first, is_first_busy));
+    REQUIRE(first.states_in_stack() == 2);
+
+    // Nothing to take yet, but the first engine is busy
+    REQUIRE(gstack.pop(second, is_second_busy));
+    REQUIRE_FALSE(is_second_busy);
+    REQUIRE(second.states_in_stack() == 0);
+    REQUIRE(gstack.has_waiting_engines());
+
+    // Only one state is donated for the single waiting engine
+    REQUIRE(gstack.push(first));
+    REQUIRE_FALSE(gstack.push(first));
+    REQUIRE(first.states_in_stack() == 1);
+
+    REQUIRE(gstack.pop(second, is_second_busy));
+    REQUIRE(is_second_busy);
+    REQUIRE(second.states_in_stack() == 1);
+    REQUIRE_FALSE(gstack.has_waiting_engines());
+
+    gstack.release(is_first_busy);
+    second.delete_current_state();
+    REQUIRE(second.empty());
+    REQUIRE_FALSE(gstack.pop(second, is_second_busy));
+    gstack.release(is_second_busy);
+    REQUIRE_FALSE(gstack.has_waiting_engines());
+}
+
+} // namespace oneapi::dal::algo::subgraph_isomorphism::test
@@ -2448,6 +2448,25 @@ SUBGRAPH_ISOMORPHISM_NON_INDUCED_TEST(
                                                                   true);
 }
 
+SUBGRAPH_ISOMORPHISM_NON_INDUCED_TEST("Non-induced: repeated runs over shared search states") {
+    // The engines exchange states in a different order on every run
+    for (std::int32_t run = 0; run < 20; ++run) {
+        this->check_subgraph_isomorphism<difficult_graph_labeled_type,
+                                         triangles_edge_link_labeled_type>(
+            false,
+            isomorphism_kind::non_induced,
+            0,
+            336,
+            false);
+        this->check_subgraph_isomorphism<k_6_labeled_type, k_5_without_edge_labeled_type>(
+            false,
+            isomorphism_kind::non_induced,
+            50,
+            50,
+            false);
+    }
+}
+
 SUBGRAPH_ISOMORPHISM_ALLOCATOR_TEST("Custom allocator, positive case") {
     this->check_subgraph_isomorphism<lolipop_5_100_type, paths_1_2_5_type>(
         false,
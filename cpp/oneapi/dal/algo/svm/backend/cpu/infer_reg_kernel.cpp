@@ -68,6 +68,12 @@ static infer_result<Task> call_daal_kernel(const context_cpu& ctx,
 
     daal_svm::Parameter daal_parameter(daal_kernel);
 
+    // The sum of the weighted support vectors precomputed on training with the linear kernel
+    const auto& sv_weighted_sum = dal::detail::get_impl(trained_model).sv_weighted_sum;
+    const auto daal_sv_weighted_sum = sv_weighted_sum.has_data()
+                                          ? interop::convert_to_daal_table<Float>(sv_weighted_sum)
+                                          : daal::data_management::NumericTablePtr();
+
     auto arr_decision_function = array<Float>::empty(row_count * 1);
     const auto daal_decision_function =
         interop::convert_to_daal_homogen_table(arr_decision_function, row_count, 1);
@@ -77,7 +83,8 @@ static infer_result<Task> call_daal_kernel(const context_cpu& ctx,
                                                                     daal_data,
                                                                     &daal_model,
                                                                     *daal_decision_function,
-                                                                    &daal_parameter));
+                                                                    &daal_parameter,
+                                                                    daal_sv_weighted_sum));
 
     return infer_result<Task>().set_responses(
         dal::detail::homogen_table_builder{}.reset(arr_decision_function, row_count, 1).build());
@@ -16,6 +16,7 @@
 
 #include <daal/src/algorithms/svm/svm_train_boser_kernel.h>
 #include <daal/src/algorithms/svm/svm_train_thunder_kernel.h>
+#include <daal/src/algorithms/svm/svm_train_cache.h>
 #include <daal/src/algorithms/multiclassclassifier/multiclassclassifier_train_kernel.h>
 #include <daal/src/algorithms/multiclassclassifier/multiclassclassifier_svm_model.h>
 
@@ -71,6 +72,9 @@ static auto create_daal_parameter(const detail::descriptor_base<Task>& desc, con
     daal_svm_parameter.maxIterations =
         dal::detail::integral_cast<std::size_t>(desc.get_max_iteration_count());
     daal_svm_parameter.doShrinking = desc.get_shrinking();
+    daal_svm_parameter.doThunderShrinking = desc.get_thunder_shrinking();
+    daal_svm_parameter.thunderShrinkingStep =
+        dal::detail::integral_cast<std::size_t>(desc.get_thunder_shrinking_interval());
     daal_svm_parameter.cacheSize = cache_byte;
 
     if constexpr (std::is_same_v<Task, task::nu_classification>) {
@@ -101,10 +105,15 @@ static train_result<Task> call_multiclass_daal_kernel(const context_cpu& ctx,
     daal_svm::training::internal::KernelParameter daal_svm_parameter =
         create_daal_parameter<Task>(desc, is_dense);
 
+    // The two-class models provide their cache statistics, the multi-class kernel sums them up
+    daal_svm_parameter.resultsToCompute |= daal_svm::training::computeCacheStatistics;
+
     const auto daal_responses = interop::convert_to_daal_table<Float>(responses);
 
+    daal_svm::training::internal::SVMCacheStatistics cache_statistics;
     daal_multiclass::training::internal::KernelParameter daal_multiclass_parameter;
     daal_multiclass_parameter.nClasses = class_count;
+    daal_multiclass_parameter.svmCacheStatistics = &cache_statistics;
 
     daal_multiclass::Parameter daal_multiclass_parameter_public(class_count);
 
@@ -128,9 +137,12 @@ static train_result<Task> call_multiclass_daal_kernel(const context_cpu& ctx,
                                                                    daal_model.get(),
                                                                    daal_svm_model.get(),
                                                                    daal_multiclass_parameter));
+    train_result<Task> result;
+    set_cache_statistics(result, cache_statistics);
+
     const std::int64_t n_sv = daal_svm_model->getSupportIndices()->getNumberOfRows();
     if (n_sv == 0) {
-        return train_result<Task>{};
+        return result;
     }
     auto table_support_indices =
         interop::convert_from_daal_homogen_table<Float>(daal_svm_model->getSupportIndices());
@@ -145,7 +157,7 @@ static train_result<Task> call_multiclass_daal_kernel(const context_cpu& ctx,
 
     auto m = dal::detail::make_private<model<Task>>(trained_model);
 
-    return train_result<Task>().set_model(m).set_support_indices(table_support_indices);
+    return result.set_model(m).set_support_indices(table_support_indices);
 }
 
 template <typename Float, typename Method, typename Task>
@@ -168,6 +180,9 @@ static train_result<Task> call_binary_daal_kernel(const context_cpu& ctx,
         convert_binary_responses(responses, { Float(-1.0), Float(1.0) }, old_unique_responses);
     const auto daal_responses = interop::convert_to_daal_table<Float>(new_responses);
 
+    daal_svm::training::internal::SVMCacheStatistics cache_statistics;
+    daal_svm_parameter.cacheStatistics = &cache_statistics;
+
     const auto daal_layout = daal_data->getDataLayout();
     auto daal_model = daal_svm::Model::create<Float>(column_count, daal_layout);
     interop::status_to_exception(dal::backend::dispatch_by_cpu(ctx, [&](auto cpu) {
@@ -182,9 +197,12 @@ static train_result<Task> call_binary_daal_kernel(const context_cpu& ctx,
                      daal_svm_parameter);
     }));
 
+    train_result<Task> result;
+    set_cache_statistics(result, cache_statistics);
+
     const std::int64_t n_sv = daal_model->getSupportIndices()->getNumberOfRows();
     if (n_sv == 0) {
-        return train_result<Task>{};
+        return result;
     }
 
     auto table_support_indices =
@@ -193,8 +211,12 @@ static train_result<Task> call_binary_daal_kernel(const context_cpu& ctx,
     auto trained_model = convert_from_daal_model<Task, Float>(*daal_model)
                              .set_first_class_response(old_unique_responses.first)
                              .set_second_class_response(old_unique_responses.second);
+    if (is_linear_kernel(daal_svm_parameter.kernel)) {
+        dal::detail::get_impl(trained_model).sv_weighted_sum =
+            compute_sv_weighted_sum<Float>(ctx, *daal_model);
+    }
 
-    return train_result<Task>().set_model(trained_model).set_support_indices(table_support_indices);
+    return result.set_model(trained_model).set_support_indices(table_support_indices);
 }
 
 template <typename Float, typename Method, typename Task, typename ModelImpl>
@@ -16,6 +16,7 @@
 
 #include <daal/src/algorithms/svm/svm_train_boser_kernel.h>
 #include <daal/src/algorithms/svm/svm_train_thunder_kernel.h>
+#include <daal/src/algorithms/svm/svm_train_cache.h>
 
 #include "algorithms/svm/svm_train.h"
 
@@ -64,6 +65,9 @@ static auto create_daal_parameter(const detail::descriptor_base<Task>& desc, con
     daal_svm_parameter.maxIterations =
         dal::detail::integral_cast<std::size_t>(desc.get_max_iteration_count());
     daal_svm_parameter.doShrinking = desc.get_shrinking();
+    daal_svm_parameter.doThunderShrinking = desc.get_thunder_shrinking();
+    daal_svm_parameter.thunderShrinkingStep =
+        dal::detail::integral_cast<std::size_t>(desc.get_thunder_shrinking_interval());
     daal_svm_parameter.cacheSize = cache_byte;
 
     if constexpr (std::is_same_v<Task, task::nu_regression>) {
@@ -96,6 +100,9 @@ static train_result<Task> call_daal_kernel(const context_cpu& ctx,
     daal_svm::training::internal::KernelParameter daal_svm_parameter =
         create_daal_parameter<Task>(desc, is_dense);
 
+    daal_svm::training::internal::SVMCacheStatistics cache_statistics;
+    daal_svm_parameter.cacheStatistics = &cache_statistics;
+
     const auto daal_layout = daal_data->getDataLayout();
     auto daal_model = daal_svm::Model::create<Float>(column_count, daal_layout);
     interop::status_to_exception(dal::backend::dispatch_by_cpu(ctx, [&](auto cpu) {
@@ -109,15 +116,22 @@ static train_result<Task> call_daal_kernel(const context_cpu& ctx,
                      daal_model.get(),
                      daal_svm_parameter);
     }));
+    train_result<Task> result;
+    set_cache_statistics(result, cache_statistics);
+
     const std::int64_t n_sv = daal_model->getSupportIndices()->getNumberOfRows();
     if (n_sv == 0) {
-        return train_result<Task>{};
+        return result;
     }
     auto table_support_indices =
         interop::convert_from_daal_homogen_table<Float>(daal_model->getSupportIndices());
 
     auto trained_model = convert_from_daal_model<Task, Float>(*daal_model);
-    return train_result<Task>().set_model(trained_model).set_support_indices(table_support_indices);
+    if (is_linear_kernel(daal_svm_parameter.kernel)) {
+        dal::detail::get_impl(trained_model).sv_weighted_sum =
+            compute_sv_weighted_sum<Float>(ctx, *daal_model);
+    }
+    return result.set_model(trained_model).set_support_indices(table_support_indices);
 }
 
 template <typename Float, typename Method, typename Task>
@@ -19,6 +19,8 @@
 #include <daal/include/algorithms/svm/svm_model.h>
 #include <daal/include/algorithms/multi_class_classifier/multi_class_classifier_model.h>
 #include <daal/src/algorithms/multiclassclassifier/multiclassclassifier_svm_model.h>
+#include <daal/src/algorithms/svm/svm_predict_kernel.h>
+#include <daal/include/algorithms/kernel_function/kernel_function_types_linear.h>
 
 #include "oneapi/dal/backend/interop/common.hpp"
 #include "oneapi/dal/algo/svm/backend/model_impl.hpp"
@@ -69,6 +71,37 @@ inline auto convert_from_daal_model(daal_svm::Model& daal_model) {
     return model;
 }
 
+template <typename Float, daal::CpuType Cpu>
+using daal_sv_weighted_sum_kernel_t =
+    daal_svm::prediction::internal::SVWeightedSumKernel<Float, Cpu>;
+
+/// With the linear kernel the decision function is the dot product with the sum of
+/// the support vectors weighted with the coefficients
+inline bool is_linear_kernel(const daal::algorithms::kernel_function::KernelIfacePtr& kernel) {
+    namespace daal_linear_kernel = daal::algorithms::kernel_function::linear;
+    return dynamic_cast<const daal_linear_kernel::Parameter*>(kernel->getParameter()) != nullptr;
+}
+
+/// Computes the sum of the support vectors weighted with the coefficients of the binary model
+template <typename Float>
+inline table compute_sv_weighted_sum(const dal::backend::context_cpu& ctx,
+                                     daal_svm::Model& daal_model) {
+    const auto daal_support_vectors = daal_model.getSupportVectors();
+    const std::int64_t column_count = daal_support_vectors->getNumberOfColumns();
+
+    auto arr_sv_weighted_sum = array<Float>::empty(column_count);
+    const auto daal_sv_weighted_sum =
+        interop::convert_to_daal_homogen_table(arr_sv_weighted_sum, 1, column_count);
+    interop::status_to_exception(
+        interop::call_daal_kernel<Float, daal_sv_weighted_sum_kernel_t>(
+            ctx,
+            daal_support_vectors,
+            daal_model.getClassificationCoefficients(),
+            *daal_sv_weighted_sum));
+
+    return dal::detail::homogen_table_builder{}.reset(arr_sv_weighted_sum, 1, column_count).build();
+}
+
 template <typename T>
 inline array<T> convert_from_daal_table_to_array(const daal::data_management::NumericTablePtr& nt) {
     daal::data_management::BlockDescriptor<T> block;
@@ -44,6 +44,11 @@ public:
     double second_class_response;
     std::int64_t class_count = 2;
 
+    /// Sum of the support vectors weighted with the coefficients of the binary model, computed
+    /// on training with the linear kernel and used by the inference with the linear kernel.
+    /// It is not serialized and is reset when the support vectors or the coefficients change
+    table sv_weighted_sum;
+
     model_impl() = default;
     model_impl(const model_impl&) = delete;
     model_impl& operator=(const model_impl&) = delete;
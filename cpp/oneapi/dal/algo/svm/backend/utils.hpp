@@ -16,6 +16,7 @@
 
 #include <daal/include/algorithms/svm/svm_train_types.h>
 
+#include "oneapi/dal/algo/svm/train_types.hpp"
 #include "oneapi/dal/table/row_accessor.hpp"
 #include "oneapi/dal/detail/error_messages.hpp"
 #include "oneapi/dal/backend/transfer.hpp"
@@ -37,6 +38,15 @@ struct to_daal_method<method::smo> : daal_method_constant<daal_svm::training::bo
 template <>
 struct to_daal_method<method::thunder> : daal_method_constant<daal_svm::training::thunder> {};
 
+/// Copies the kernel matrix cache statistics of the DAAL training kernel into the result
+template <typename Task, typename Statistics>
+inline train_result<Task>& set_cache_statistics(train_result<Task>& result,
+                                                const Statistics& statistics) {
+    return result.set_cache_hit_count(dal::detail::integral_cast<std::int64_t>(statistics.nHits))
+        .set_cache_miss_count(dal::detail::integral_cast<std::int64_t>(statistics.nMisses))
+        .set_cache_eviction_count(dal::detail::integral_cast<std::int64_t>(statistics.nEvictions));
+}
+
 template <typename Float>
 struct binary_response_t {
     Float first;
@@ -36,6 +36,8 @@ public:
     double cache_size = 200.0;
     double tau = 1e-6;
     bool shrinking = true;
+    bool thunder_shrinking = false;
+    std::int64_t thunder_shrinking_interval = 1000;
     std::int64_t class_count = 2;
     double epsilon = 0.1;
     double nu = 0.5;
@@ -75,6 +77,16 @@ bool descriptor_base<Task>::get_shrinking() const {
     return impl_->shrinking;
 }
 
+template <typename Task>
+bool descriptor_base<Task>::get_thunder_shrinking() const {
+    return impl_->thunder_shrinking;
+}
+
+template <typename Task>
+std::int64_t descriptor_base<Task>::get_thunder_shrinking_interval() const {
+    return impl_->thunder_shrinking_interval;
+}
+
 template <typename Task>
 void descriptor_base<Task>::set_c_impl(double value) {
     if (value <= 0.0) {
@@ -120,6 +132,19 @@ void descriptor_base<Task>::set_shrinking_impl(bool value) {
     impl_->shrinking = value;
 }
 
+template <typename Task>
+void descriptor_base<Task>::set_thunder_shrinking_impl(bool value) {
+    impl_->thunder_shrinking = value;
+}
+
+template <typename Task>
+void descriptor_base<Task>::set_thunder_shrinking_interval_impl(std::int64_t value) {
+    if (value <= 0) {
+        throw domain_error(dal::detail::error_messages::thunder_shrinking_interval_leq_zero());
+    }
+    impl_->thunder_shrinking_interval = value;
+}
+
 template <typename Task>
 void descriptor_base<Task>::set_kernel_impl(const detail::kernel_function_ptr& kernel) {
     impl_->kernel = kernel;
@@ -228,11 +253,13 @@ std::int64_t model<Task>::get_second_class_response() const {
 template <typename Task>
 void model<Task>::set_support_vectors_impl(const table& value) {
     impl_->support_vectors = value;
+    impl_->sv_weighted_sum = table{};
 }
 
 template <typename Task>
 void model<Task>::set_coeffs_impl(const table& value) {
     impl_->coeffs = value;
+    impl_->sv_weighted_sum = table{};
 }
 
 template <typename Task>
@@ -152,6 +152,8 @@ public:
     double get_cache_size() const;
     double get_tau() const;
     bool get_shrinking() const;
+    bool get_thunder_shrinking() const;
+    std::int64_t get_thunder_shrinking_interval() const;
 
     std::int64_t get_class_count() const {
         return get_class_count_impl();
@@ -174,6 +176,8 @@ protected:
     void set_cache_size_impl(double);
     void set_tau_impl(double);
     void set_shrinking_impl(bool);
+    void set_thunder_shrinking_impl(bool);
+    void set_thunder_shrinking_interval_impl(std::int64_t);
     void set_kernel_impl(const detail::kernel_function_ptr &);
     void set_class_count_impl(std::int64_t);
     void set_epsilon_impl(double);
@@ -345,6 +349,31 @@ public:
         return *this;
     }
 
+    /// A flag that enables shrinking of the working set between the inner
+    /// solver runs. Used with :expr:`method::thunder` split-finding method only.
+    /// @remark default = false
+    bool get_thunder_shrinking() const {
+        return base_t::get_thunder_shrinking();
+    }
+
+    auto &set_thunder_shrinking(bool value) {
+        base_t::set_thunder_shrinking_impl(value);
+        return *this;
+    }
+
+    /// The number of iterations between the shrinking steps.
+    /// Used with :expr:`method::thunder` split-finding method only.
+    /// @invariant :expr:`thunder_shrinking_interval > 0`
+    /// @remark default = 1000
+    std::int64_t get_thunder_shrinking_interval() const {
+        return base_t::get_thunder_shrinking_interval();
+    }
+
+    auto &set_thunder_shrinking_interval(std::int64_t value) {
+        base_t::set_thunder_shrinking_interval_impl(value);
+        return *this;
+    }
+
     template <typename T = Task, typename = detail::enable_if_classification_t<T>>
     /// The number of classes. Used with :expr:`task::classification`
     /// and :expr:`task::nu_classification`.
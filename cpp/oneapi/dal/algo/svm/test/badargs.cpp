@@ -188,6 +188,20 @@ private:
         REQUIRE_THROWS_AS(this->get_descriptor().set_nu(0), domain_error); \
     }
 
+#define TEST_POSITIVE_THUNDER_SHRINKING_INTERVAL                                    \
+    {                                                                               \
+        SKIP_IF(this->not_available_on_device());                                   \
+        REQUIRE_NOTHROW(this->get_descriptor().set_thunder_shrinking_interval(10)); \
+    }
+
+#define TEST_NON_POSITIVE_THUNDER_SHRINKING_INTERVAL                                   \
+    {                                                                                  \
+        SKIP_IF(this->not_available_on_device());                                      \
+        auto svm_desc = this->get_descriptor();                                        \
+        REQUIRE_THROWS_AS(svm_desc.set_thunder_shrinking_interval(0), domain_error);   \
+        REQUIRE_THROWS_AS(svm_desc.set_thunder_shrinking_interval(-10), domain_error); \
+    }
+
 #define TEST_NU_GREATER_THAN_ONE                                             \
     {                                                                        \
         SKIP_IF(this->not_available_on_device());                            \
@@ -312,6 +326,12 @@ TEST_NON_NEGATIVE_CACHE_SIZE
 THUNDER_SVM_BADARG_TEST("throws if cache_size is negative")
 TEST_NEGATIVE_CACHE_SIZE
 
+THUNDER_SVM_BADARG_TEST("accepts positive thunder_shrinking_interval")
+TEST_POSITIVE_THUNDER_SHRINKING_INTERVAL
+
+THUNDER_SVM_BADARG_TEST("throws if thunder_shrinking_interval is not positive")
+TEST_NON_POSITIVE_THUNDER_SHRINKING_INTERVAL
+
 THUNDER_SVM_BADARG_TEST("accepts positive tau")
 TEST_NON_NEGATIVE_TAU
 
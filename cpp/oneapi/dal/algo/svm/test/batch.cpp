@@ -14,6 +14,8 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <random>
+
 #include "oneapi/dal/algo/svm/infer.hpp"
 #include "oneapi/dal/algo/svm/train.hpp"
 
@@ -269,6 +271,7 @@ private:
 
 using svm_types = COMBINE_TYPES((float, double), (svm::method::thunder, svm::method::smo));
 using svm_nightly_types = COMBINE_TYPES((float, double), (svm::method::thunder));
+using svm_thunder_types = COMBINE_TYPES((float, double), (svm::method::thunder));
 
 TEMPLATE_LIST_TEST_M(svm_batch_test,
                      "svm polynomial manual dataset",
@@ -960,6 +963,157 @@ TEMPLATE_LIST_TEST_M(svm_batch_test,
     this->check_kernel_accuracy(x_train, y_train, x_test, y_test, svm_desc, ref_accuracy);
 }
 
+TEMPLATE_LIST_TEST_M(svm_batch_test,
+                     "svm thunder reports kernel matrix cache statistics",
+                     "[svm][integration][batch][cache]",
+                     svm_thunder_types) {
+    // The statistics are collected by the CPU kernel only
+    SKIP_IF(this->get_policy().is_gpu());
+    SKIP_IF(this->not_float64_friendly());
+
+    using float_t = std::tuple_element_t<0, TestType>;
+    using method_t = std::tuple_element_t<1, TestType>;
+
+    constexpr std::int64_t row_count = 2000;
+    constexpr std::int64_t column_count = 4;
+    constexpr std::int64_t class_count = 3;
+
+    // The classes overlap, so many vectors are support vectors
+    std::mt19937 rng(7777);
+    std::normal_distribution<float_t> normal(0.0, 1.0);
+    std::vector<float_t> x_data(row_count * column_count);
+    std::vector<float_t> y_data(row_count);
+    for (std::int64_t i = 0; i < row_count; ++i) {
+        y_data[i] = float_t(i % class_count);
+        for (std::int64_t j = 0; j < column_count; ++j) {
+            x_data[i * column_count + j] = normal(rng) + float_t(0.5) * y_data[i];
+        }
+    }
+    const auto x_train = homogen_table::wrap(x_data.data(), row_count, column_count);
+
+    // The two-class problem keeps the first two classes
+    std::vector<float_t> x_binary;
+    std::vector<float_t> y_binary;
+    for (std::int64_t i = 0; i < row_count; ++i) {
+        if (y_data[i] < 2) {
+            x_binary.insert(x_binary.end(),
+                            x_data.begin() + i * column_count,
+                            x_data.begin() + (i + 1) * column_count);
+            y_binary.push_back(y_data[i]);
+        }
+    }
+    const std::int64_t binary_count = y_binary.size();
+    const auto x_train_binary = homogen_table::wrap(x_binary.data(), binary_count, column_count);
+    const auto y_train_binary = homogen_table::wrap(y_binary.data(), binary_count, 1);
+
+    using kernel_t = linear::descriptor<float_t, linear::method::dense>;
+    using descriptor_t = svm::descriptor<float_t, method_t, svm::task::classification, kernel_t>;
+
+    const auto large_cache_result =
+        this->train(descriptor_t{}.set_c(1.0), x_train_binary, y_train_binary);
+
+    // Only the rows of one working set fit into the cache
+    const auto small_cache_result =
+        this->train(descriptor_t{}.set_c(1.0).set_cache_size(0.0), x_train_binary, y_train_binary);
+
+    SECTION("all the rows fit into the large cache") {
+        REQUIRE(large_cache_result.get_cache_hit_count() > 0);
+        REQUIRE(large_cache_result.get_cache_miss_count() > 0);
+        REQUIRE(large_cache_result.get_cache_miss_count() <= binary_count);
+        REQUIRE(large_cache_result.get_cache_eviction_count() == 0);
+    }
+
+    SECTION("the small cache computes evicted rows again") {
+        REQUIRE(small_cache_result.get_cache_eviction_count() > 0);
+        REQUIRE(small_cache_result.get_cache_miss_count() >
+                large_cache_result.get_cache_miss_count());
+    }
+
+    SECTION("the same rows are requested with both caches") {
+        REQUIRE(small_cache_result.get_cache_hit_count() +
+                    small_cache_result.get_cache_miss_count() ==
+                large_cache_result.get_cache_hit_count() +
+                    large_cache_result.get_cache_miss_count());
+    }
+
+    SECTION("the multi-class result provides the statistics of the two-class models") {
+        const auto y_train = homogen_table::wrap(y_data.data(), row_count, 1);
+        const auto multiclass_result =
+            this->train(descriptor_t{}.set_c(1.0).set_class_count(class_count), x_train, y_train);
+        REQUIRE(multiclass_result.get_cache_hit_count() > 0);
+        REQUIRE(multiclass_result.get_cache_miss_count() > 0);
+        REQUIRE(multiclass_result.get_cache_eviction_count() == 0);
+    }
+}
+
+TEMPLATE_LIST_TEST_M(svm_batch_test,
+                     "svm thunder with shrinking matches the model without shrinking",
+                     "[svm][integration][batch][shrinking]",
+                     svm_thunder_types) {
+    // The working set is shrunk by the CPU kernel only
+    SKIP_IF(this->get_policy().is_gpu());
+    SKIP_IF(this->not_float64_friendly());
+
+    using float_t = std::tuple_element_t<0, TestType>;
+    using method_t = std::tuple_element_t<1, TestType>;
+
+    constexpr std::int64_t row_count = 2000;
+    constexpr std::int64_t column_count = 4;
+
+    // The classes overlap, so a part of the vectors stays bounded and is shrunk
+    std::mt19937 rng(7777);
+    std::normal_distribution<float_t> normal(0.0, 1.0);
+    std::vector<float_t> x_data(row_count * column_count);
+    std::vector<float_t> y_data(row_count);
+    for (std::int64_t i = 0; i < row_count; ++i) {
+        y_data[i] = float_t(i % 2);
+        for (std::int64_t j = 0; j < column_count; ++j) {
+            x_data[i * column_count + j] = normal(rng) + y_data[i];
+        }
+    }
+    const auto x_train = homogen_table::wrap(x_data.data(), row_count, column_count);
+    const auto y_train = homogen_table::wrap(y_data.data(), row_count, 1);
+
+    using kernel_t = rbf::descriptor<float_t, rbf::method::dense>;
+    using descriptor_t = svm::descriptor<float_t, method_t, svm::task::classification, kernel_t>;
+
+    const auto svm_desc = descriptor_t{}.set_c(1.0).set_accuracy_threshold(1e-4);
+    REQUIRE_FALSE(svm_desc.get_thunder_shrinking());
+
+    // The short interval makes the shrinking steps happen on this small data set
+    const auto shrinking_desc = descriptor_t{}
+                                    .set_c(1.0)
+                                    .set_accuracy_threshold(1e-4)
+                                    .set_thunder_shrinking(true)
+                                    .set_thunder_shrinking_interval(10);
+
+    const auto model = this->train(svm_desc, x_train, y_train).get_model();
+    const auto shrinking_model = this->train(shrinking_desc, x_train, y_train).get_model();
+
+    const auto decision_function = this->infer(svm_desc, model, x_train).get_decision_function();
+    const auto shrinking_decision_function =
+        this->infer(shrinking_desc, shrinking_model, x_train).get_decision_function();
+
+    const auto values = row_accessor<const float_t>(decision_function).pull();
+    const auto shrinking_values = row_accessor<const float_t>(shrinking_decision_function).pull();
+    REQUIRE(values.get_count() == row_count);
+    REQUIRE(shrinking_values.get_count() == row_count);
+
+    double max_value = 0.0;
+    double max_diff = 0.0;
+    std::int64_t sign_mismatch_count = 0;
+    for (std::int64_t i = 0; i < row_count; ++i) {
+        max_value = std::max(max_value, double(std::abs(values[i])));
+        max_diff = std::max(max_diff, double(std::abs(values[i] - shrinking_values[i])));
+        sign_mismatch_count += (values[i] > 0) != (shrinking_values[i] > 0);
+    }
+
+    // Both solvers stop at the same accuracy, so the models differ within it
+    CAPTURE(max_diff, max_value, sign_mismatch_count);
+    REQUIRE(max_diff <= 5e-2 * (1.0 + max_value));
+    REQUIRE(sign_mismatch_count <= row_count / 100);
+}
+
 TEMPLATE_LIST_TEST_M(svm_batch_test,
                      "svm rbf cifar 50k x 3072",
                      "[svm][integration][batch][rbf][weekly][external-dataset]",
@@ -0,0 +1,222 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include <daal/src/algorithms/svm/svm_predict_kernel.h>
+
+#include "algorithms/kernel_function/kernel_function_linear.h"
+#include "daal/src/algorithms/kernel_function/polynomial/kernel_function_polynomial.h"
+
+#include "oneapi/dal/algo/svm/backend/model_conversion.hpp"
+#include "oneapi/dal/backend/dispatcher.hpp"
+#include "oneapi/dal/backend/interop/common.hpp"
+#include "oneapi/dal/backend/interop/error_converter.hpp"
+
+#include "oneapi/dal/test/engine/common.hpp"
+
+namespace oneapi::dal::svm::test {
+
+namespace daal_dm = daal::data_management;
+namespace daal_kf = daal::algorithms::kernel_function;
+namespace daal_svm = daal::algorithms::svm;
+namespace interop = dal::backend::interop;
+
+/// Row-major matrix with about a half of zero values, stored both as a dense array and as
+/// one-based CSR arrays
+struct sparse_matrix {
+    sparse_matrix(std::mt19937& rng, std::int64_t row_count, std::int64_t column_count)
+            : row_count(row_count),
+              column_count(column_count),
+              dense(row_count * column_count, 0.0f),
+              row_offsets(row_count + 1, 1) {
+        std::normal_distribution<float> normal(0.0f, 1.0f);
+        std::bernoulli_distribution is_nonzero(0.5);
+        for (std::int64_t i = 0; i < row_count; ++i) {
+            for (std::int64_t j = 0; j < column_count; ++j) {
+                if (is_nonzero(rng)) {
+                    dense[i * column_count + j] = normal(rng);
+                    values.push_back(dense[i * column_count + j]);
+                    column_indices.push_back(j + 1);
+                }
+            }
+            row_offsets[i + 1] = values.size() + 1;
+        }
+    }
+
+    daal_dm::NumericTablePtr get_dense_table() {
+        return daal_dm::HomogenNumericTable<float>::create(dense.data(), column_count, row_count);
+    }
+
+    daal_dm::NumericTablePtr get_csr_table() {
+        return daal_dm::CSRNumericTable::create(values.data(),
+                                                column_indices.data(),
+                                                row_offsets.data(),
+                                                column_count,
+                                                row_count);
+    }
+
+    std::int64_t row_count;
+    std::int64_t column_count;
+    std::vector<float> dense;
+    std::vector<float> values;
+    std::vector<std::size_t> column_indices;
+    std::vector<std::size_t> row_offsets;
+};
+
+/// Compares the prediction with the linear kernel, which uses the sum of the support vectors
+/// weighted with the coefficients, with the prediction with the polynomial kernel of degree 1,
+/// which evaluates the kernel function for every support vector
+class linear_predict_test {
+public:
+    linear_predict_test()
+            : rng_(2021),
+              x_(rng_, row_count_, column_count_),
+              sv_(rng_, sv_count_, column_count_),
+              coeffs_(sv_count_) {
+        std::uniform_real_distribution<float> uniform(-1.0f, 1.0f);
+        for (auto& c : coeffs_) {
+            c = uniform(rng_);
+        }
+    }
+
+    /// Predicts with the sum of the weighted support vectors computed beforehand as on
+    /// training with the linear kernel if `precompute_sv_weighted_sum` is set
+    std::vector<float> predict(bool is_dense,
+                               const daal_kf::KernelIfacePtr& kernel,
+                               bool precompute_sv_weighted_sum = false) {
+        const auto x = is_dense ? x_.get_dense_table() : x_.get_csr_table();
+        auto model = backend::daal_model_builder{}
+                         .set_support_vectors(is_dense ? sv_.get_dense_table()
+                                                       : sv_.get_csr_table())
+                         .set_coeffs(daal_dm::HomogenNumericTable<float>::create(coeffs_.data(),
+                                                                                 1,
+                                                                                 sv_count_))
+                         .set_bias(bias_);
+
+        std::vector<float> f(row_count_);
+        const auto f_table = daal_dm::HomogenNumericTable<float>::create(f.data(), 1, row_count_);
+        const daal_svm::Parameter parameter(kernel);
+
+        const dal::backend::context_cpu ctx;
+        const auto sv_weighted_sum =
+            precompute_sv_weighted_sum
+                ? interop::convert_to_daal_table<float>(
+                      backend::compute_sv_weighted_sum<float>(ctx, model))
+                : daal_dm::NumericTablePtr();
+        interop::status_to_exception(dal::backend::dispatch_by_cpu(ctx, [&](auto cpu) {
+            constexpr auto daal_cpu = interop::to_daal_cpu_type<decltype(cpu)>::value;
+            return daal_svm::prediction::internal::
+                SVMPredictImpl<daal_svm::prediction::defaultDense, float, daal_cpu>()
+                    .compute(x, &model, *f_table, &parameter, sv_weighted_sum);
+        }));
+        return f;
+    }
+
+    daal_kf::KernelIfacePtr get_linear_kernel(bool is_dense) const {
+        if (is_dense) {
+            auto kernel = new daal_kf::linear::Batch<float, daal_kf::linear::defaultDense>();
+            kernel->parameter.k = scale_;
+            kernel->parameter.b = shift_;
+            return daal_kf::KernelIfacePtr(kernel);
+        }
+        auto kernel = new daal_kf::linear::Batch<float, daal_kf::linear::fastCSR>();
+        kernel->parameter.k = scale_;
+        kernel->parameter.b = shift_;
+        return daal_kf::KernelIfacePtr(kernel);
+    }
+
+    daal_kf::KernelIfacePtr get_polynomial_kernel(bool is_dense) const {
+        using namespace daal_kf::polynomial::internal;
+        if (is_dense) {
+            auto kernel = new Batch<float, defaultDense>();
+            kernel->parameter.scale = scale_;
+            kernel->parameter.shift = shift_;
+            kernel->parameter.degree = 1;
+            return daal_kf::KernelIfacePtr(kernel);
+        }
+        auto kernel = new Batch<float, fastCSR>();
+        kernel->parameter.scale = scale_;
+        kernel->parameter.shift = shift_;
+        kernel->parameter.degree = 1;
+        return daal_kf::KernelIfacePtr(kernel);
+    }
+
+    /// Decision function computed in double precision
+    std::vector<double> get_reference() const {
+        std::vector<double> f(row_count_, bias_);
+        for (std::int64_t i = 0; i < row_count_; ++i) {
+            for (std::int64_t k = 0; k < sv_count_; ++k) {
+                double dot = 0.0;
+                for (std::int64_t j = 0; j < column_count_; ++j) {
+                    dot += double(x_.dense[i * column_count_ + j]) *
+                           sv_.dense[k * column_count_ + j];
+                }
+                f[i] += coeffs_[k] * (scale_ * dot + shift_);
+            }
+        }
+        return f;
+    }
+
+    void check_close(const std::vector<float>& actual, const std::vector<double>& expected) const {
+        REQUIRE(std::int64_t(actual.size()) == row_count_);
+        for (std::int64_t i = 0; i < row_count_; ++i) {
+            CAPTURE(i, actual[i], expected[i]);
+            REQUIRE(std::abs(actual[i] - expected[i]) <= 1e-4 * (1.0 + std::abs(expected[i])));
+        }
+    }
+
+private:
+    static constexpr std::int64_t row_count_ = 300;
+    static constexpr std::int64_t column_count_ = 7;
+    static constexpr std::int64_t sv_count_ = 50;
+    static constexpr double scale_ = 0.5;
+    static constexpr double shift_ = 1.5;
+    static constexpr double bias_ = -0.25;
+
+    std::mt19937 rng_;
+    sparse_matrix x_;
+    sparse_matrix sv_;
+    std::vector<float> coeffs_;
+};
+
+TEST("svm prediction with the linear kernel matches the kernel function path",
+     "[svm][predict][linear]") {
+    linear_predict_test t;
+    const auto reference = t.get_reference();
+
+    SECTION("dense") {
+        const auto f_linear = t.predict(true, t.get_linear_kernel(true));
+        const auto f_precomputed = t.predict(true, t.get_linear_kernel(true), true);
+        const auto f_polynomial = t.predict(true, t.get_polynomial_kernel(true));
+        t.check_close(f_polynomial, reference);
+        t.check_close(f_linear, reference);
+        t.check_close(f_precomputed, reference);
+    }
+
+    SECTION("csr") {
+        const auto f_linear = t.predict(false, t.get_linear_kernel(false));
+        const auto f_precomputed = t.predict(false, t.get_linear_kernel(false), true);
+        const auto f_polynomial = t.predict(false, t.get_polynomial_kernel(false));
+        t.check_close(f_polynomial, reference);
+        t.check_close(f_linear, reference);
+        t.check_close(f_precomputed, reference);
+    }
+}
+
+} // namespace oneapi::dal::svm::test
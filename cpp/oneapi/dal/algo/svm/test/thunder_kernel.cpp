@@ -0,0 +1,191 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include <daal/src/algorithms/svm/svm_train_boser_kernel.h>
+#include <daal/src/algorithms/svm/svm_train_thunder_kernel.h>
+
+#include "algorithms/kernel_function/kernel_function_linear.h"
+#include "algorithms/svm/svm_model.h"
+
+#include "oneapi/dal/backend/dispatcher.hpp"
+#include "oneapi/dal/backend/interop/common.hpp"
+#include "oneapi/dal/backend/interop/error_converter.hpp"
+
+#include "oneapi/dal/test/engine/common.hpp"
+
+namespace oneapi::dal::svm::test {
+
+namespace daal_dm = daal::data_management;
+namespace daal_kf = daal::algorithms::kernel_function;
+namespace daal_svm = daal::algorithms::svm;
+namespace daal_svm_internal = daal_svm::training::internal;
+namespace interop = dal::backend::interop;
+
+/// Calls the CPU kernel of the thunder method directly, so the internal parameters of the
+/// kernel that are not exposed by the public API can be set
+class thunder_kernel_test {
+public:
+    thunder_kernel_test(std::int64_t row_count, std::int64_t column_count)
+            : row_count_(row_count),
+              column_count_(column_count) {
+        std::mt19937 rng(7777);
+        std::normal_distribution<float> normal(0.0f, 1.0f);
+        x_.resize(row_count * column_count);
+        y_.resize(row_count);
+        for (std::int64_t i = 0; i < row_count; ++i) {
+            // The classes overlap, so many vectors are support vectors
+            y_[i] = (i % 2 == 0) ? 1.0f : -1.0f;
+            for (std::int64_t j = 0; j < column_count; ++j) {
+                x_[i * column_count + j] = normal(rng) + 0.5f * y_[i];
+            }
+        }
+    }
+
+    daal_svm_internal::KernelParameter get_default_parameter() const {
+        daal_svm_internal::KernelParameter parameter;
+        parameter.kernel.reset(new daal_kf::linear::Batch<float>());
+        parameter.C = 1.0;
+        parameter.accuracyThreshold = 1e-3;
+        return parameter;
+    }
+
+    daal_svm::ModelPtr train(const daal_svm_internal::KernelParameter& parameter) {
+        const auto x = daal_dm::HomogenNumericTable<float>::create(x_.data(),
+                                                                   column_count_,
+                                                                   row_count_);
+        const auto y = daal_dm::HomogenNumericTable<float>::create(y_.data(), 1, row_count_);
+        auto model = daal_svm::Model::create<float>(column_count_);
+
+        const dal::backend::context_cpu ctx;
+        interop::status_to_exception(dal::backend::dispatch_by_cpu(ctx, [&](auto cpu) {
+            constexpr auto daal_cpu = interop::to_daal_cpu_type<decltype(cpu)>::value;
+            return daal_svm_internal::
+                SVMTrainImpl<daal_svm::training::thunder, float, daal_cpu>()
+                    .compute(x, daal_dm::NumericTablePtr(), *y, model.get(), parameter);
+        }));
+        return model;
+    }
+
+    /// Decision function of the linear model on the training data
+    std::vector<double> decision_function(const daal_svm::ModelPtr& model) const {
+        const auto sv_table = model->getSupportVectors();
+        const auto coeff_table = model->getClassificationCoefficients();
+        const std::int64_t sv_count = sv_table->getNumberOfRows();
+
+        daal_dm::BlockDescriptor<float> sv_block;
+        daal_dm::BlockDescriptor<float> coeff_block;
+        sv_table->getBlockOfRows(0, sv_count, daal_dm::readOnly, sv_block);
+        coeff_table->getBlockOfRows(0, sv_count, daal_dm::readOnly, coeff_block);
+        const float* sv = sv_block.getBlockPtr();
+        const float* coeff = coeff_block.getBlockPtr();
+
+        std::vector<double> w(column_count_, 0.0);
+        for (std::int64_t k = 0; k < sv_count; ++k) {
+            for (std::int64_t j = 0; j < column_count_; ++j) {
+                w[j] += double(coeff[k]) * sv[k * column_count_ + j];
+            }
+        }
+        sv_table->releaseBlockOfRows(sv_block);
+        coeff_table->releaseBlockOfRows(coeff_block);
+
+        std::vector<double> f(row_count_, model->getBias());
+        for (std::int64_t i = 0; i < row_count_; ++i) {
+            for (std::int64_t j = 0; j < column_count_; ++j) {
+                f[i] += w[j] * x_[i * column_count_ + j];
+            }
+        }
+        return f;
+    }
+
+private:
+    std::int64_t row_count_;
+    std::int64_t column_count_;
+    std::vector<float> x_;
+    std::vector<float> y_;
+};
+
+TEST("thunder cache statistics do not depend on the cache size", "[svm][thunder][cache]") {
+    constexpr std::int64_t row_count = 2000;
+    thunder_kernel_test t{ row_count, 4 };
+
+    daal_svm_internal::SVMCacheStatistics large_cache_statistics;
+    auto parameter = t.get_default_parameter();
+    parameter.cacheStatistics = &large_cache_statistics;
+    const auto large_cache_model = t.train(parameter);
+
+    // Only the rows of one working set fit into the cache
+    daal_svm_internal::SVMCacheStatistics small_cache_statistics;
+    parameter.cacheSize = 1;
+    parameter.cacheStatistics = &small_cache_statistics;
+    const auto small_cache_model = t.train(parameter);
+
+    SECTION("all the rows fit into the large cache") {
+        REQUIRE(large_cache_statistics.nHits > 0);
+        REQUIRE(large_cache_statistics.nMisses <= std::size_t(row_count));
+        REQUIRE(large_cache_statistics.nEvictions == 0);
+    }
+
+    SECTION("the small cache computes evicted rows again") {
+        REQUIRE(small_cache_statistics.nEvictions > 0);
+        REQUIRE(small_cache_statistics.nMisses > large_cache_statistics.nMisses);
+        REQUIRE(small_cache_statistics.nMisses - small_cache_statistics.nEvictions <=
+                std::size_t(row_count));
+    }
+
+    SECTION("the same rows are requested with both caches") {
+        REQUIRE(small_cache_statistics.nHits + small_cache_statistics.nMisses ==
+                large_cache_statistics.nHits + large_cache_statistics.nMisses);
+    }
+
+    SECTION("the cache size does not change the model") {
+        REQUIRE(small_cache_model->getBias() == large_cache_model->getBias());
+        REQUIRE(t.decision_function(small_cache_model) == t.decision_function(large_cache_model));
+    }
+}
+
+TEST("thunder shrinking converges to the same solution", "[svm][thunder][shrinking]") {
+    constexpr std::int64_t row_count = 2000;
+    thunder_kernel_test t{ row_count, 4 };
+
+    auto parameter = t.get_default_parameter();
+    REQUIRE_FALSE(parameter.doThunderShrinking);
+    const auto f_off = t.decision_function(t.train(parameter));
+
+    // A small step makes the shrinking engage several times before the convergence
+    parameter.doThunderShrinking = true;
+    parameter.thunderShrinkingStep = 10;
+    const auto f_on = t.decision_function(t.train(parameter));
+
+    double max_abs_f = 0.0;
+    double max_abs_diff = 0.0;
+    std::int64_t sign_mismatch_count = 0;
+    for (std::int64_t i = 0; i < row_count; ++i) {
+        max_abs_f = std::max(max_abs_f, std::abs(f_off[i]));
+        max_abs_diff = std::max(max_abs_diff, std::abs(f_on[i] - f_off[i]));
+        sign_mismatch_count += std::int64_t((f_on[i] > 0.0) != (f_off[i] > 0.0));
+    }
+    CAPTURE(max_abs_f, max_abs_diff, sign_mismatch_count);
+
+    REQUIRE(max_abs_diff <= 5e-2 * (1.0 + max_abs_f));
+    REQUIRE(sign_mismatch_count <= row_count / 100);
+}
+
+} // namespace oneapi::dal::svm::test
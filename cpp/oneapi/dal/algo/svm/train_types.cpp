@@ -37,6 +37,9 @@ class detail::v1::train_result_impl : public base {
 public:
     model<Task> trained_model;
     table support_indices;
+    std::int64_t cache_hit_count = 0;
+    std::int64_t cache_miss_count = 0;
+    std::int64_t cache_eviction_count = 0;
 };
 
 using detail::v1::train_input_impl;
@@ -116,6 +119,21 @@ std::int64_t train_result<Task>::get_support_vector_count() const {
     return impl_->trained_model.get_support_vector_count();
 }
 
+template <typename Task>
+std::int64_t train_result<Task>::get_cache_hit_count() const {
+    return impl_->cache_hit_count;
+}
+
+template <typename Task>
+std::int64_t train_result<Task>::get_cache_miss_count() const {
+    return impl_->cache_miss_count;
+}
+
+template <typename Task>
+std::int64_t train_result<Task>::get_cache_eviction_count() const {
+    return impl_->cache_eviction_count;
+}
+
 template <typename Task>
 void train_result<Task>::set_model_impl(const model<Task>& value) {
     impl_->trained_model = value;
@@ -146,6 +164,21 @@ void train_result<Task>::set_biases_impl(const table& value) {
     impl_->trained_model.set_biases(value);
 }
 
+template <typename Task>
+void train_result<Task>::set_cache_hit_count_impl(std::int64_t value) {
+    impl_->cache_hit_count = value;
+}
+
+template <typename Task>
+void train_result<Task>::set_cache_miss_count_impl(std::int64_t value) {
+    impl_->cache_miss_count = value;
+}
+
+template <typename Task>
+void train_result<Task>::set_cache_eviction_count_impl(std::int64_t value) {
+    impl_->cache_eviction_count = value;
+}
+
 template class ONEDAL_EXPORT train_input<task::classification>;
 template class ONEDAL_EXPORT train_result<task::classification>;
 template class ONEDAL_EXPORT train_input<task::nu_classification>;
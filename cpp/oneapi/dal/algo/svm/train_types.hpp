@@ -182,6 +182,38 @@ public:
         return *this;
     }
 
+    /// The number of the kernel matrix rows that :expr:`method::thunder` found
+    /// in the cache during the training on CPU
+    /// @remark default = 0
+    std::int64_t get_cache_hit_count() const;
+
+    auto &set_cache_hit_count(std::int64_t value) {
+        set_cache_hit_count_impl(value);
+        return *this;
+    }
+
+    /// The number of the kernel matrix rows that :expr:`method::thunder`
+    /// computed on request during the training on CPU
+    /// @remark default = 0
+    std::int64_t get_cache_miss_count() const;
+
+    auto &set_cache_miss_count(std::int64_t value) {
+        set_cache_miss_count_impl(value);
+        return *this;
+    }
+
+    /// The number of the kernel matrix rows that :expr:`method::thunder`
+    /// excluded from the cache during the training on CPU. The rows are
+    /// computed again on the next request, a larger :literal:`cache_size`
+    /// reduces this number
+    /// @remark default = 0
+    std::int64_t get_cache_eviction_count() const;
+
+    auto &set_cache_eviction_count(std::int64_t value) {
+        set_cache_eviction_count_impl(value);
+        return *this;
+    }
+
 protected:
     void set_model_impl(const model<Task> &);
     void set_support_vectors_impl(const table &);
@@ -189,6 +221,9 @@ protected:
     void set_coeffs_impl(const table &);
     void set_bias_impl(double);
     void set_biases_impl(const table &);
+    void set_cache_hit_count_impl(std::int64_t);
+    void set_cache_miss_count_impl(std::int64_t);
+    void set_cache_eviction_count_impl(std::int64_t);
 
 private:
     dal::detail::pimpl<detail::train_result_impl<Task>> impl_;
@@ -0,0 +1,210 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <vector>
+
+#include "oneapi/dal/algo/triangle_counting/detail/partition_kernel.hpp"
+#include "oneapi/dal/backend/common.hpp"
+#include "oneapi/dal/backend/dispatcher.hpp"
+#include "oneapi/dal/backend/primitives/intersection/intersection.hpp"
+#include "oneapi/dal/detail/threading.hpp"
+
+namespace oneapi::dal::preview::triangle_counting::backend {
+
+using detail::adjacency_block;
+
+/// Turns the counts stored in offsets[1] ... offsets[count] into offsets with offsets[0] = 0.
+/// The values are summed in blocks in parallel, then the block sums are propagated.
+template <typename Cpu>
+void counts_to_offsets(std::int64_t* offsets, std::int64_t count) {
+    offsets[0] = 0;
+    const std::int64_t block_size = 1 << 16;
+    const std::int64_t block_count = (count + block_size - 1) / block_size;
+    const auto get_block_end = [&](std::int64_t b) {
+        return std::min((b + 1) * block_size, count);
+    };
+
+    dal::detail::threader_for(block_count, block_count, [&](std::int32_t b) {
+        for (std::int64_t i = b * block_size + 2; i <= get_block_end(b); ++i) {
+            offsets[i] += offsets[i - 1];
+        }
+    });
+    for (std::int64_t b = 1; b < block_count; ++b) {
+        offsets[get_block_end(b)] += offsets[get_block_end(b - 1)];
+    }
+    dal::detail::threader_for(block_count, block_count, [&](std::int32_t b) {
+        if (b == 0) {
+            return;
+        }
+        const std::int64_t carry = offsets[get_block_end(b - 1)];
+        for (std::int64_t i = b * block_size + 1; i < get_block_end(b); ++i) {
+            offsets[i] += carry;
+        }
+    });
+}
+
+template <typename Cpu>
+adjacency_block build_adjacency_block(const std::int32_t* vertex_neighbors,
+                                      const std::int64_t* edge_offsets,
+                                      std::int64_t row_begin,
+                                      std::int64_t row_end,
+                                      std::int64_t column_begin,
+                                      std::int64_t column_end) {
+    const std::int64_t row_count = row_end - row_begin;
+    const auto get_row = [&](std::int64_t i) {
+        const std::int32_t* neigh_begin = vertex_neighbors + edge_offsets[i];
+        const std::int32_t* neigh_end = vertex_neighbors + edge_offsets[i + 1];
+        const std::int32_t* begin = std::lower_bound(neigh_begin, neigh_end, column_begin);
+        const std::int32_t* end =
+            std::lower_bound(begin, neigh_end, std::min(column_end, row_begin + i));
+        return std::make_pair(begin, end);
+    };
+
+    adjacency_block block;
+    block.row_begin = row_begin;
+    block.row_end = row_end;
+    block.column_begin = column_begin;
+    block.column_end = column_end;
+    block.offsets = array<std::int64_t>::empty(row_count + 1);
+    std::int64_t* offsets = block.offsets.get_mutable_data();
+
+    dal::detail::threader_for(row_count, row_count, [&](std::int32_t i) {
+        const auto [begin, end] = get_row(i);
+        offsets[i + 1] = end - begin;
+    });
+    counts_to_offsets<Cpu>(offsets, row_count);
+
+    block.neighbors = array<std::int32_t>::empty(offsets[row_count]);
+    std::int32_t* neighbors = block.neighbors.get_mutable_data();
+    dal::detail::threader_for(row_count, row_count, [&](std::int32_t i) {
+        const auto [begin, end] = get_row(i);
+        std::copy(begin, end, neighbors + offsets[i]);
+    });
+    return block;
+}
+
+template <typename Cpu>
+std::int64_t count_block_triangles(const adjacency_block& block_uv,
+                                   const adjacency_block& block_uw,
+                                   const adjacency_block& block_vw) {
+    const std::int64_t row_count = block_uv.row_end - block_uv.row_begin;
+    const std::int64_t* uv_offsets = block_uv.offsets.get_data();
+    const std::int64_t* uw_offsets = block_uw.offsets.get_data();
+    const std::int64_t* vw_offsets = block_vw.offsets.get_data();
+    const std::int32_t* uv_neighbors = block_uv.neighbors.get_data();
+    const std::int32_t* uw_neighbors = block_uw.neighbors.get_data();
+    const std::int32_t* vw_neighbors = block_vw.neighbors.get_data();
+    const std::int64_t v_begin = block_vw.row_begin;
+
+    return oneapi::dal::detail::parallel_reduce_int32_int64_t_simple(
+        row_count,
+        (std::int64_t)0,
+        [&](std::int32_t begin, std::int32_t end, std::int64_t tc) -> std::int64_t {
+            for (std::int64_t i = begin; i < end; ++i) {
+                const std::int64_t uw_degree = uw_offsets[i + 1] - uw_offsets[i];
+                if (uw_degree == 0) {
+                    continue;
+                }
+                const std::int32_t* out_uw = uw_neighbors + uw_offsets[i];
+                for (std::int64_t e = uv_offsets[i]; e < uv_offsets[i + 1]; ++e) {
+                    const std::int64_t j = uv_neighbors[e] - v_begin;
+                    tc += preview::backend::intersection<Cpu>(out_uw,
+                                                              vw_neighbors + vw_offsets[j],
+                                                              uw_degree,
+                                                              vw_offsets[j + 1] - vw_offsets[j]);
+                }
+            }
+            return tc;
+        },
+        [&](std::int64_t x, std::int64_t y) -> std::int64_t {
+            return x + y;
+        });
+}
+
+/// Splits the vertices into partition_count ranges holding roughly equal numbers of oriented
+/// edges, builds the blocks (I, J) with J <= I and sums the triangle counts of all the range
+/// triples (I, J, K) with K <= J <= I. The triples are processed in parallel, and every
+/// triple only reads its three blocks.
+template <typename Cpu>
+std::int64_t triangle_counting_global_partitioned(const std::int32_t* vertex_neighbors,
+                                                  const std::int64_t* edge_offsets,
+                                                  const std::int64_t* oriented_offsets,
+                                                  std::int64_t vertex_count,
+                                                  std::int64_t partition_count) {
+    partition_count = std::min(partition_count, vertex_count);
+    const std::int64_t oriented_edge_count = oriented_offsets[vertex_count];
+
+    std::vector<std::int64_t> bounds(partition_count + 1);
+    bounds[0] = 0;
+    for (std::int64_t p = 1; p < partition_count; ++p) {
+        const std::int64_t edge = oriented_edge_count * p / partition_count;
+        const std::int64_t bound = std::lower_bound(oriented_offsets,
+                                                    oriented_offsets + vertex_count + 1,
+                                                    edge) -
+                                   oriented_offsets;
+        bounds[p] = std::max(bounds[p - 1], std::min(bound, vertex_count));
+    }
+    bounds[partition_count] = vertex_count;
+
+    // The block (I, J) with J <= I is stored at I * (I + 1) / 2 + J
+    const auto get_block_index = [](std::int64_t i, std::int64_t j) {
+        return i * (i + 1) / 2 + j;
+    };
+    std::vector<std::array<std::int64_t, 2>> block_ids;
+    std::vector<std::array<std::int64_t, 3>> triples;
+    for (std::int64_t i = 0; i < partition_count; ++i) {
+        for (std::int64_t j = 0; j <= i; ++j) {
+            block_ids.push_back({ i, j });
+            for (std::int64_t k = 0; k <= j; ++k) {
+                triples.push_back({ i, j, k });
+            }
+        }
+    }
+
+    const std::int64_t block_count = block_ids.size();
+    std::vector<adjacency_block> blocks(block_count);
+    dal::detail::threader_for(block_count, block_count, [&](std::int32_t b) {
+        const auto [i, j] = block_ids[b];
+        blocks[b] = build_adjacency_block<Cpu>(vertex_neighbors,
+                                               edge_offsets + bounds[i],
+                                               bounds[i],
+                                               bounds[i + 1],
+                                               bounds[j],
+                                               bounds[j + 1]);
+    });
+
+    return oneapi::dal::detail::parallel_reduce_int32_int64_t_simple(
+        triples.size(),
+        (std::int64_t)0,
+        [&](std::int32_t begin, std::int32_t end, std::int64_t tc) -> std::int64_t {
+            for (std::int32_t t = begin; t < end; ++t) {
+                const auto [i, j, k] = triples[t];
+                tc += count_block_triangles<Cpu>(blocks[get_block_index(i, j)],
+                                                 blocks[get_block_index(i, k)],
+                                                 blocks[get_block_index(j, k)]);
+            }
+            return tc;
+        },
+        [&](std::int64_t x, std::int64_t y) -> std::int64_t {
+            return x + y;
+        });
+}
+
+} // namespace oneapi::dal::preview::triangle_counting::backend
@@ -0,0 +1,39 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "oneapi/dal/algo/triangle_counting/backend/cpu/partition_kernel.hpp"
+
+namespace oneapi::dal::preview::triangle_counting::backend {
+
+template adjacency_block build_adjacency_block<__CPU_TAG__>(const std::int32_t* vertex_neighbors,
+                                                            const std::int64_t* edge_offsets,
+                                                            std::int64_t row_begin,
+                                                            std::int64_t row_end,
+                                                            std::int64_t column_begin,
+                                                            std::int64_t column_end);
+
+template std::int64_t count_block_triangles<__CPU_TAG__>(const adjacency_block& block_uv,
+                                                         const adjacency_block& block_uw,
+                                                         const adjacency_block& block_vw);
+
+template std::int64_t triangle_counting_global_partitioned<__CPU_TAG__>(
+    const std::int32_t* vertex_neighbors,
+    const std::int64_t* edge_offsets,
+    const std::int64_t* oriented_offsets,
+    std::int64_t vertex_count,
+    std::int64_t partition_count);
+
+} // namespace oneapi::dal::preview::triangle_counting::backend
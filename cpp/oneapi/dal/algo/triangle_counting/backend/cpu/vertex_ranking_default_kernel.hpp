@@ -16,6 +16,8 @@
 
 #pragma once
 
+#include <algorithm>
+
 #include "oneapi/dal/algo/triangle_counting/common.hpp"
 #include "oneapi/dal/algo/triangle_counting/vertex_ranking_types.hpp"
 #include "oneapi/dal/backend/common.hpp"
@@ -24,6 +26,7 @@
 #include "oneapi/dal/detail/threading.hpp"
 #include "oneapi/dal/table/detail/table_builder.hpp"
 #include "oneapi/dal/algo/triangle_counting/backend/cpu/intersection_tc.hpp"
+#include "oneapi/dal/algo/triangle_counting/backend/cpu/partition_kernel.hpp"
 #include "oneapi/dal/backend/primitives/intersection/intersection.hpp"
 
 namespace oneapi::dal::preview::triangle_counting::backend {
@@ -219,48 +222,115 @@ std::int64_t triangle_counting_global_vector(
     return total_s;
 }
 
+/// Oriented edges of the vertex u are the neighbors with smaller ids, i.e. a prefix of its
+/// sorted neighbor list. After relabeling by greater degree they point from the vertex to the
+/// neighbors of higher degree, so even the hubs of power-law graphs have short oriented lists.
 template <typename Cpu>
-std::int64_t triangle_counting_global_vector_relabel(const std::int32_t* vertex_neighbors,
-                                                     const std::int64_t* edge_offsets,
-                                                     const std::int32_t* degrees,
-                                                     std::int64_t vertex_count,
-                                                     std::int64_t edge_count) {
+void compute_oriented_offsets(const std::int32_t* vertex_neighbors,
+                              const std::int64_t* edge_offsets,
+                              std::int64_t vertex_count,
+                              std::int64_t* oriented_offsets) {
+    dal::detail::threader_for(vertex_count, vertex_count, [&](std::int32_t u) {
+        const std::int32_t* neigh_begin = vertex_neighbors + edge_offsets[u];
+        const std::int32_t* neigh_end = vertex_neighbors + edge_offsets[u + 1];
+        oriented_offsets[u + 1] = std::lower_bound(neigh_begin, neigh_end, u) - neigh_begin;
+    });
+
+    counts_to_offsets<Cpu>(oriented_offsets, vertex_count);
+}
+
+/// Counts triangles w < v < u as |out(u) & out(v)| over all oriented edges (u, v).
+/// The work is split into blocks of oriented edges instead of vertices, so the edges of a
+/// single heavy vertex are shared between threads. The oriented neighbors of the vertices with
+/// long lists are loaded into a per-thread bitmap, and the lists of their neighbors are probed
+/// against it; short lists are intersected by merging.
+template <typename Cpu>
+std::int64_t triangle_counting_global_hybrid(const std::int32_t* vertex_neighbors,
+                                             const std::int64_t* edge_offsets,
+                                             const std::int64_t* oriented_offsets,
+                                             std::int64_t vertex_count,
+                                             std::uint64_t* bitmaps) {
+    const std::int64_t oriented_edge_count = oriented_offsets[vertex_count];
+    if (oriented_edge_count == 0) {
+        return 0;
+    }
+
+    const std::int64_t bitmap_degree_boundary = 64;
+    const std::int64_t bitmap_size = (vertex_count + 63) / 64;
+    const std::int64_t thread_cnt = dal::detail::threader_get_max_threads();
+
+    dal::detail::threader_for(thread_cnt, thread_cnt, [&](std::int32_t i) {
+        std::fill(bitmaps + i * bitmap_size, bitmaps + (i + 1) * bitmap_size, 0);
+    });
+    auto loaded_vertices_arr = array<std::int32_t>::full(thread_cnt, -1);
+    std::int32_t* loaded_vertices = loaded_vertices_arr.get_mutable_data();
+
+    const std::int64_t max_block_count = dal::detail::limits<std::int32_t>::max();
+    const std::int64_t block_size =
+        std::max<std::int64_t>(1024, (oriented_edge_count + max_block_count - 1) / max_block_count);
+    const std::int64_t block_count = (oriented_edge_count + block_size - 1) / block_size;
+
     std::int64_t total_s = oneapi::dal::detail::parallel_reduce_int32_int64_t_simple(
-        vertex_count,
+        block_count,
         (std::int64_t)0,
-        [&](std::int64_t begin_u, std::int64_t end_u, std::int64_t tc_u) -> std::int64_t {
-            for (auto u = begin_u; u != end_u; ++u) {
-                if (degrees[u] < 2) {
+        [&](std::int32_t begin_block, std::int32_t end_block, std::int64_t tc) -> std::int64_t {
+            const std::int64_t thread_id = dal::detail::threader_get_current_thread_index();
+            std::uint64_t* bitmap = bitmaps + thread_id * bitmap_size;
+            std::int32_t& loaded_u = loaded_vertices[thread_id];
+
+            const std::int64_t begin_edge = begin_block * block_size;
+            const std::int64_t end_edge = std::min(end_block * block_size, oriented_edge_count);
+
+            std::int64_t u = std::upper_bound(oriented_offsets,
+                                              oriented_offsets + vertex_count + 1,
+                                              begin_edge) -
+                             oriented_offsets - 1;
+            for (std::int64_t edge = begin_edge; edge < end_edge; edge = oriented_offsets[++u]) {
+                const std::int32_t* out_u = vertex_neighbors + edge_offsets[u];
+                const std::int64_t out_degree_u = oriented_offsets[u + 1] - oriented_offsets[u];
+                if (out_degree_u < 2) {
                     continue;
                 }
-                const std::int32_t* neigh_u = vertex_neighbors + edge_offsets[u];
-                std::int32_t size_neigh_u = vertex_neighbors + edge_offsets[u + 1] - neigh_u;
+                const std::int64_t first = edge - oriented_offsets[u];
+                const std::int64_t last = std::min(end_edge, oriented_offsets[u + 1]) -
+                                          oriented_offsets[u];
 
-                for (auto v_ = vertex_neighbors + edge_offsets[u];
-                     v_ != vertex_neighbors + edge_offsets[u + 1];
-                     ++v_) {
-                    std::int32_t v = *v_;
-
-                    if (v > u) {
-                        break;
+                if (out_degree_u < bitmap_degree_boundary) {
+                    for (std::int64_t i = first; i < last; ++i) {
+                        const std::int32_t v = out_u[i];
+                        tc += preview::backend::intersection<Cpu>(
+                            out_u,
+                            vertex_neighbors + edge_offsets[v],
+                            out_degree_u,
+                            oriented_offsets[v + 1] - oriented_offsets[v]);
                     }
+                    continue;
+                }
 
-                    const std::int32_t* neigh_v = vertex_neighbors + edge_offsets[v];
-                    std::int32_t size_neigh_v = vertex_neighbors + edge_offsets[v + 1] - neigh_v;
-
-                    std::int32_t new_v_degree = 0;
-                    for (new_v_degree = 0;
-                         (new_v_degree < size_neigh_v) && (neigh_v[new_v_degree] <= v);
-                         new_v_degree++)
-                        ;
-
-                    tc_u += preview::backend::intersection<Cpu>(neigh_u,
-                                                                neigh_v,
-                                                                size_neigh_u,
-                                                                new_v_degree);
+                if (loaded_u != u) {
+                    if (loaded_u >= 0) {
+                        const std::int32_t* out_loaded = vertex_neighbors + edge_offsets[loaded_u];
+                        const std::int64_t out_degree_loaded =
+                            oriented_offsets[loaded_u + 1] - oriented_offsets[loaded_u];
+                        for (std::int64_t i = 0; i < out_degree_loaded; ++i) {
+                            bitmap[out_loaded[i] >> 6] = 0;
+                        }
+                    }
+                    for (std::int64_t i = 0; i < out_degree_u; ++i) {
+                        bitmap[out_u[i] >> 6] |= std::uint64_t(1) << (out_u[i] & 63);
+                    }
+                    loaded_u = u;
+                }
+                for (std::int64_t i = first; i < last; ++i) {
+                    const std::int32_t v = out_u[i];
+                    const std::int32_t* out_v = vertex_neighbors + edge_offsets[v];
+                    const std::int64_t out_degree_v = oriented_offsets[v + 1] - oriented_offsets[v];
+                    for (std::int64_t j = 0; j < out_degree_v; ++j) {
+                        tc += (bitmap[out_v[j] >> 6] >> (out_v[j] & 63)) & 1;
+                    }
                 }
             }
-            return tc_u;
+            return tc;
         },
         [&](std::int64_t x, std::int64_t y) -> std::int64_t {
             return x + y;
@@ -28,12 +28,17 @@ template std::int64_t triangle_counting_global_scalar<__CPU_TAG__>(
 template std::int64_t triangle_counting_global_vector<__CPU_TAG__>(
     const dal::preview::detail::topology<std::int32_t>& t);
 
-template std::int64_t triangle_counting_global_vector_relabel<__CPU_TAG__>(
+template void compute_oriented_offsets<__CPU_TAG__>(const std::int32_t* vertex_neighbors,
+                                                    const std::int64_t* edge_offsets,
+                                                    std::int64_t vertex_count,
+                                                    std::int64_t* oriented_offsets);
+
+template std::int64_t triangle_counting_global_hybrid<__CPU_TAG__>(
     const std::int32_t* vertex_neighbors,
     const std::int64_t* edge_offsets,
-    const std::int32_t* degrees,
+    const std::int64_t* oriented_offsets,
     std::int64_t vertex_count,
-    std::int64_t edge_count);
+    std::uint64_t* bitmaps);
 
 template std::int64_t compute_global_triangles<__CPU_TAG__>(
     const array<std::int64_t>& local_triangles,
@@ -25,6 +25,7 @@ public:
     explicit descriptor_impl() {
         _kind = kind::undirected_clique;
         _relabel = relabel::yes;
+        _partition_count = 1;
         global = false;
         local = false;
 
@@ -44,6 +45,7 @@ public:
 
     kind _kind;
     relabel _relabel;
+    std::int64_t _partition_count;
 };
 
 template <typename Task>
@@ -59,6 +61,11 @@ relabel descriptor_base<Task>::get_relabel() const {
     return impl_->_relabel;
 }
 
+template <typename Task>
+std::int64_t descriptor_base<Task>::get_partition_count() const {
+    return impl_->_partition_count;
+}
+
 template <typename Task>
 void descriptor_base<Task>::set_kind(kind kind) {
     impl_->_kind = kind;
@@ -69,6 +76,14 @@ void descriptor_base<Task>::set_relabel(relabel relabel) {
     impl_->_relabel = relabel;
 }
 
+template <typename Task>
+void descriptor_base<Task>::set_partition_count(std::int64_t value) {
+    if (value <= 0) {
+        throw domain_error(dal::detail::error_messages::partition_count_leq_zero());
+    }
+    impl_->_partition_count = value;
+}
+
 template class ONEDAL_EXPORT descriptor_base<task::local>;
 template class ONEDAL_EXPORT descriptor_base<task::global>;
 template class ONEDAL_EXPORT descriptor_base<task::local_and_global>;
@@ -75,10 +75,12 @@ public:
 
     kind get_kind() const;
     relabel get_relabel() const;
+    std::int64_t get_partition_count() const;
 
 protected:
     void set_kind(kind value);
     void set_relabel(relabel value);
+    void set_partition_count(std::int64_t value);
 
     dal::detail::pimpl<descriptor_impl<Task>> impl_;
 };
@@ -129,6 +131,25 @@ public:
         return *this;
     }
 
+    /// The number of vertex ranges the graph is split into for the global task.
+    /// When greater than one, the oriented adjacency matrix is copied into blocks of
+    /// the vertex ranges, the triangles are counted in parallel over every triple of
+    /// ranges and the partial counts are summed. Each triple reads only three blocks.
+    /// The whole graph is still loaded; to count the triangles of a graph stored in
+    /// parts, build the blocks with detail::build_adjacency_block where the rows are
+    /// stored and count the triples with detail::count_block_triangles.
+    /// @remark default = 1
+    template <typename T = Task, typename = detail::enable_if_global_t<T>>
+    std::int64_t get_partition_count() const {
+        return base_t::get_partition_count();
+    }
+
+    template <typename T = Task, typename = detail::enable_if_global_t<T>>
+    auto& set_partition_count(std::int64_t value) {
+        base_t::set_partition_count(value);
+        return *this;
+    }
+
     Allocator get_allocator() const {
         return _alloc;
     }
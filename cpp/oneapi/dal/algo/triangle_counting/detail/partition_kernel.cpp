@@ -0,0 +1,62 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "oneapi/dal/algo/triangle_counting/detail/partition_kernel.hpp"
+#include "oneapi/dal/algo/triangle_counting/backend/cpu/partition_kernel.hpp"
+#include "oneapi/dal/backend/dispatcher.hpp"
+#include "oneapi/dal/exceptions.hpp"
+
+namespace oneapi::dal::preview::triangle_counting::detail {
+
+adjacency_block build_adjacency_block(const dal::detail::host_policy& policy,
+                                      const std::int32_t* vertex_neighbors,
+                                      const std::int64_t* edge_offsets,
+                                      std::int64_t row_begin,
+                                      std::int64_t row_end,
+                                      std::int64_t column_begin,
+                                      std::int64_t column_end) {
+    if (row_begin < 0 || row_end < row_begin || column_begin < 0 || column_end < column_begin) {
+        throw invalid_argument(dal::detail::error_messages::adjacency_block_ranges_mismatch());
+    }
+    return dal::backend::dispatch_by_cpu(dal::backend::context_cpu{ policy }, [&](auto cpu) {
+        return backend::build_adjacency_block<decltype(cpu)>(vertex_neighbors,
+                                                             edge_offsets,
+                                                             row_begin,
+                                                             row_end,
+                                                             column_begin,
+                                                             column_end);
+    });
+}
+
+std::int64_t count_block_triangles(const dal::detail::host_policy& policy,
+                                   const adjacency_block& block_uv,
+                                   const adjacency_block& block_uw,
+                                   const adjacency_block& block_vw) {
+    const bool is_triple = block_uv.row_begin == block_uw.row_begin &&
+                           block_uv.row_end == block_uw.row_end &&
+                           block_uv.column_begin == block_vw.row_begin &&
+                           block_uv.column_end == block_vw.row_end &&
+                           block_uw.column_begin == block_vw.column_begin &&
+                           block_uw.column_end == block_vw.column_end;
+    if (!is_triple) {
+        throw invalid_argument(dal::detail::error_messages::adjacency_block_ranges_mismatch());
+    }
+    return dal::backend::dispatch_by_cpu(dal::backend::context_cpu{ policy }, [&](auto cpu) {
+        return backend::count_block_triangles<decltype(cpu)>(block_uv, block_uw, block_vw);
+    });
+}
+
+} // namespace oneapi::dal::preview::triangle_counting::detail
@@ -0,0 +1,61 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include "oneapi/dal/array.hpp"
+#include "oneapi/dal/detail/policy.hpp"
+
+namespace oneapi::dal::preview::triangle_counting::detail {
+
+/// Block (I, J) of the oriented adjacency matrix: the edges u -> v with v < u, where u is in
+/// the row range [row_begin, row_end) and v is in the column range [column_begin, column_end).
+/// The block is self-contained, so it can be built where the rows of I are stored and sent
+/// to the place where the triangles are counted.
+struct adjacency_block {
+    std::int64_t row_begin = 0;
+    std::int64_t row_end = 0;
+    std::int64_t column_begin = 0;
+    std::int64_t column_end = 0;
+
+    /// Offsets of the rows in neighbors, row_end - row_begin + 1 values starting with zero
+    array<std::int64_t> offsets;
+
+    /// Global ids of the neighbors, sorted within every row
+    array<std::int32_t> neighbors;
+};
+
+/// Builds the block (I, J) from the rows of the range I. The sorted neighbors of the vertex u
+/// are stored in vertex_neighbors between edge_offsets[u - row_begin] and
+/// edge_offsets[u - row_begin + 1]. Only the rows of I are read, so edge_offsets may point
+/// into the offsets of the whole graph as well as into the offsets of a local part of it.
+ONEDAL_EXPORT adjacency_block build_adjacency_block(const dal::detail::host_policy& policy,
+                                                    const std::int32_t* vertex_neighbors,
+                                                    const std::int64_t* edge_offsets,
+                                                    std::int64_t row_begin,
+                                                    std::int64_t row_end,
+                                                    std::int64_t column_begin,
+                                                    std::int64_t column_end);
+
+/// Counts the triangles w < v < u with u in I, v in J and w in K, reading only the blocks
+/// (I, J), (I, K) and (J, K). Summing the counts over all the triples K <= J <= I of the vertex
+/// ranges gives the number of triangles in the graph.
+ONEDAL_EXPORT std::int64_t count_block_triangles(const dal::detail::host_policy& policy,
+                                                 const adjacency_block& block_uv,
+                                                 const adjacency_block& block_uw,
+                                                 const adjacency_block& block_vw);
+
+} // namespace oneapi::dal::preview::triangle_counting::detail
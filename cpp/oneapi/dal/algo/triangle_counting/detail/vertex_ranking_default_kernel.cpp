@@ -52,22 +52,46 @@ operator()(const dal::detail::host_policy& policy,
 }
 
 template <typename Float>
-std::int64_t triangle_counting<Float,
-                               task::global,
-                               dal::preview::detail::topology<std::int32_t>,
-                               vector,
-                               relabeled>::operator()(const dal::detail::host_policy& policy,
-                                                      const std::int32_t* vertex_neighbors,
-                                                      const std::int64_t* edge_offsets,
-                                                      const std::int32_t* degrees,
-                                                      std::int64_t vertex_count,
-                                                      std::int64_t edge_count) const {
+std::int64_t
+triangle_counting<Float, task::global, dal::preview::detail::topology<std::int32_t>, hybrid>::
+operator()(const dal::detail::host_policy& policy,
+           const std::int32_t* vertex_neighbors,
+           const std::int64_t* edge_offsets,
+           std::int64_t vertex_count,
+           std::int64_t* oriented_offsets,
+           std::uint64_t* bitmaps) const {
     return dal::backend::dispatch_by_cpu(dal::backend::context_cpu{ policy }, [&](auto cpu) {
-        return backend::triangle_counting_global_vector_relabel<decltype(cpu)>(vertex_neighbors,
-                                                                               edge_offsets,
-                                                                               degrees,
-                                                                               vertex_count,
-                                                                               edge_count);
+        backend::compute_oriented_offsets<decltype(cpu)>(vertex_neighbors,
+                                                         edge_offsets,
+                                                         vertex_count,
+                                                         oriented_offsets);
+        return backend::triangle_counting_global_hybrid<decltype(cpu)>(vertex_neighbors,
+                                                                       edge_offsets,
+                                                                       oriented_offsets,
+                                                                       vertex_count,
+                                                                       bitmaps);
+    });
+}
+
+template <typename Float>
+std::int64_t
+triangle_counting<Float, task::global, dal::preview::detail::topology<std::int32_t>, partitioned>::
+operator()(const dal::detail::host_policy& policy,
+           const std::int32_t* vertex_neighbors,
+           const std::int64_t* edge_offsets,
+           std::int64_t vertex_count,
+           std::int64_t* oriented_offsets,
+           std::int64_t partition_count) const {
+    return dal::backend::dispatch_by_cpu(dal::backend::context_cpu{ policy }, [&](auto cpu) {
+        backend::compute_oriented_offsets<decltype(cpu)>(vertex_neighbors,
+                                                         edge_offsets,
+                                                         vertex_count,
+                                                         oriented_offsets);
+        return backend::triangle_counting_global_partitioned<decltype(cpu)>(vertex_neighbors,
+                                                                            edge_offsets,
+                                                                            oriented_offsets,
+                                                                            vertex_count,
+                                                                            partition_count);
     });
 }
 
@@ -88,10 +112,12 @@ template struct ONEDAL_EXPORT
 template struct ONEDAL_EXPORT
     triangle_counting<float, task::global, dal::preview::detail::topology<std::int32_t>, vector>;
 
+template struct ONEDAL_EXPORT
+    triangle_counting<float, task::global, dal::preview::detail::topology<std::int32_t>, hybrid>;
+
 template struct ONEDAL_EXPORT triangle_counting<float,
                                                 task::global,
                                                 dal::preview::detail::topology<std::int32_t>,
-                                                vector,
-                                                relabeled>;
+                                                partitioned>;
 
 } // namespace oneapi::dal::preview::triangle_counting::detail
@@ -37,8 +37,8 @@ struct vertex_ranking_kernel_cpu {
 struct scalar {};
 struct vector {};
 struct automatic {};
-
-struct relabeled {};
+struct hybrid {};
+struct partitioned {};
 
 template <typename Float, typename Task, typename Topology, typename... Param>
 struct triangle_counting {
@@ -79,14 +79,26 @@ template <typename Float>
 struct triangle_counting<Float,
                          task::global,
                          dal::preview::detail::topology<std::int32_t>,
-                         vector,
-                         relabeled> {
+                         hybrid> {
     std::int64_t operator()(const dal::detail::host_policy& ctx,
                             const std::int32_t* vertex_neighbors,
                             const std::int64_t* edge_offsets,
-                            const std::int32_t* degrees,
                             std::int64_t vertex_count,
-                            std::int64_t edge_count) const;
+                            std::int64_t* oriented_offsets,
+                            std::uint64_t* bitmaps) const;
+};
+
+template <typename Float>
+struct triangle_counting<Float,
+                         task::global,
+                         dal::preview::detail::topology<std::int32_t>,
+                         partitioned> {
+    std::int64_t operator()(const dal::detail::host_policy& ctx,
+                            const std::int32_t* vertex_neighbors,
+                            const std::int64_t* edge_offsets,
+                            std::int64_t vertex_count,
+                            std::int64_t* oriented_offsets,
+                            std::int64_t partition_count) const;
 };
 
 ONEDAL_EXPORT std::int64_t compute_global_triangles(const dal::detail::host_policy& policy,
@@ -135,11 +147,12 @@ struct vertex_ranking_kernel_cpu<method::ordered_count, task::global, Allocator,
         }
         const auto edge_count = t.get_edge_count();
         const auto relabel = desc.get_relabel();
+        const auto partition_count = desc.get_partition_count();
         std::int64_t triangles = 0;
         if (relabel == relabel::yes) {
             const std::int32_t average_degree = edge_count / vertex_count;
             const std::int32_t average_degree_sparsity_boundary = 4;
-            if (average_degree < average_degree_sparsity_boundary) {
+            if (average_degree < average_degree_sparsity_boundary && partition_count == 1) {
                 triangles = triangle_counting<float, task::global, Topology, scalar>()(ctx, t);
             }
             else {
@@ -170,13 +183,12 @@ struct vertex_ranking_kernel_cpu<method::ordered_count, task::global, Allocator,
                                                        g_degrees_relabel,
                                                        alloc);
 
-                triangles = triangle_counting<float, task::global, Topology, vector, relabeled>()(
-                    ctx,
-                    g_vertex_neighbors_relabel,
-                    g_edge_offsets_relabel,
-                    g_degrees_relabel,
-                    vertex_count,
-                    edge_count);
+                triangles = count_oriented(ctx,
+                                           alloc,
+                                           g_vertex_neighbors_relabel,
+                                           g_edge_offsets_relabel,
+                                           vertex_count,
+                                           partition_count);
 
                 oneapi::dal::preview::detail::deallocate(int32_allocator,
                                                          g_vertex_neighbors_relabel,
@@ -193,7 +205,15 @@ struct vertex_ranking_kernel_cpu<method::ordered_count, task::global, Allocator,
         else {
             const std::int32_t average_degree = edge_count / vertex_count;
             const std::int32_t average_degree_sparsity_boundary = 4;
-            if (average_degree < average_degree_sparsity_boundary) {
+            if (partition_count > 1) {
+                triangles = count_oriented(ctx,
+                                           alloc,
+                                           t._cols_ptr,
+                                           t._rows_ptr,
+                                           vertex_count,
+                                           partition_count);
+            }
+            else if (average_degree < average_degree_sparsity_boundary) {
                 triangles = triangle_counting<float, task::global, Topology, scalar>()(ctx, t);
             }
             else {
@@ -205,6 +225,56 @@ struct vertex_ranking_kernel_cpu<method::ordered_count, task::global, Allocator,
         res.set_global_rank(triangles);
         return res;
     }
+
+private:
+    static std::int64_t count_oriented(const dal::detail::host_policy& ctx,
+                                       const Allocator& alloc,
+                                       const std::int32_t* vertex_neighbors,
+                                       const std::int64_t* edge_offsets,
+                                       std::int64_t vertex_count,
+                                       std::int64_t partition_count) {
+        using int64_allocator_type =
+            typename std::allocator_traits<Allocator>::template rebind_alloc<std::int64_t>;
+        using uint64_allocator_type =
+            typename std::allocator_traits<Allocator>::template rebind_alloc<std::uint64_t>;
+
+        int64_allocator_type int64_allocator(alloc);
+        uint64_allocator_type uint64_allocator(alloc);
+
+        std::int64_t* oriented_offsets =
+            oneapi::dal::preview::detail::allocate(int64_allocator, vertex_count + 1);
+
+        std::int64_t triangles = 0;
+        if (partition_count > 1) {
+            triangles = triangle_counting<float, task::global, Topology, partitioned>()(
+                ctx,
+                vertex_neighbors,
+                edge_offsets,
+                vertex_count,
+                oriented_offsets,
+                partition_count);
+        }
+        else {
+            const std::int64_t thread_cnt = dal::detail::threader_get_max_threads();
+            const std::int64_t bitmaps_size = thread_cnt * ((vertex_count + 63) / 64);
+            std::uint64_t* bitmaps =
+                oneapi::dal::preview::detail::allocate(uint64_allocator, bitmaps_size);
+
+            triangles = triangle_counting<float, task::global, Topology, hybrid>()(ctx,
+                                                                                 vertex_neighbors,
+                                                                                 edge_offsets,
+                                                                                 vertex_count,
+                                                                                 oriented_offsets,
+                                                                                 bitmaps);
+
+            oneapi::dal::preview::detail::deallocate(uint64_allocator, bitmaps, bitmaps_size);
+        }
+
+        oneapi::dal::preview::detail::deallocate(int64_allocator,
+                                                 oriented_offsets,
+                                                 vertex_count + 1);
+        return triangles;
+    }
 };
 
 template <typename Allocator, typename Topology>
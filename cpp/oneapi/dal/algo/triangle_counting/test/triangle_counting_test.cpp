@@ -14,9 +14,12 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <algorithm>
 #include <array>
+#include <vector>
 
 #include "oneapi/dal/algo/triangle_counting/vertex_ranking.hpp"
+#include "oneapi/dal/algo/triangle_counting/detail/partition_kernel.hpp"
 
 #include "oneapi/dal/test/engine/common.hpp"
 
@@ -210,6 +213,46 @@ public:
     std::array<std::int64_t, 11> local_triangles = { 36, 36, 36, 36, 36, 0, 36, 36, 36, 36, 36 };
 };
 
+/// The complete graph on 70 vertices with 30 pendant vertices, each of them adjacent to two
+/// neighboring core vertices. The oriented lists of the core vertices are long enough for
+/// the bitmap intersections.
+class dense_core_graph_100_type : public graph_base_data {
+public:
+    dense_core_graph_100_type() {
+        const std::int32_t core_count = 70;
+        vertex_count = 100;
+        std::vector<std::vector<std::int32_t>> neighbors(vertex_count);
+        for (std::int32_t u = 0; u < core_count; ++u) {
+            for (std::int32_t v = 0; v < core_count; ++v) {
+                if (u != v) {
+                    neighbors[u].push_back(v);
+                }
+            }
+        }
+        for (std::int32_t p = core_count; p < vertex_count; ++p) {
+            const std::int32_t a = p - core_count;
+            neighbors[p] = { a, a + 1 };
+            neighbors[a].push_back(p);
+            neighbors[a + 1].push_back(p);
+        }
+        rows.push_back(0);
+        for (auto &list : neighbors) {
+            std::sort(list.begin(), list.end());
+            degrees.push_back(list.size());
+            cols.insert(cols.end(), list.begin(), list.end());
+            rows.push_back(cols.size());
+        }
+        edge_count = cols.size() / 2;
+        cols_count = cols.size();
+        rows_count = vertex_count + 1;
+        global_triangle_count = core_count * (core_count - 1) * (core_count - 2) / 6 + 30;
+    }
+
+    std::vector<std::int32_t> degrees;
+    std::vector<std::int32_t> cols;
+    std::vector<std::int64_t> rows;
+};
+
 class triangle_counting_test {
 public:
     template <typename GraphType>
@@ -348,6 +391,82 @@ public:
         const auto result_vertex_ranking = dal::preview::vertex_ranking(tc_desc, g);
         REQUIRE(result_vertex_ranking.get_global_rank() == global_triangle_count);
     }
+
+    template <typename GraphType>
+    void check_block_triangles(std::int64_t partition_count) {
+        namespace tc_detail = dal::preview::triangle_counting::detail;
+        GraphType graph_data;
+        const auto g = create_graph<GraphType>();
+        const auto &t = oneapi::dal::detail::get_impl(g).get_topology();
+        const std::int64_t vertex_count = graph_data.get_vertex_count();
+        const dal::detail::host_policy policy = dal::detail::host_policy::get_default();
+
+        std::vector<std::int64_t> bounds(partition_count + 1);
+        for (std::int64_t p = 0; p <= partition_count; ++p) {
+            bounds[p] = vertex_count * p / partition_count;
+        }
+
+        // Every block is built from the rows of its range only
+        std::vector<std::vector<tc_detail::adjacency_block>> blocks(partition_count);
+        for (std::int64_t i = 0; i < partition_count; ++i) {
+            std::vector<std::int64_t> local_offsets(t._rows_ptr + bounds[i],
+                                                    t._rows_ptr + bounds[i + 1] + 1);
+            std::vector<std::int32_t> local_neighbors(t._cols_ptr + local_offsets.front(),
+                                                      t._cols_ptr + local_offsets.back());
+            for (auto &offset : local_offsets) {
+                offset -= t._rows_ptr[bounds[i]];
+            }
+            for (std::int64_t j = 0; j <= i; ++j) {
+                blocks[i].push_back(tc_detail::build_adjacency_block(policy,
+                                                                     local_neighbors.data(),
+                                                                     local_offsets.data(),
+                                                                     bounds[i],
+                                                                     bounds[i + 1],
+                                                                     bounds[j],
+                                                                     bounds[j + 1]));
+            }
+        }
+
+        std::int64_t triangle_count = 0;
+        for (std::int64_t i = 0; i < partition_count; ++i) {
+            for (std::int64_t j = 0; j <= i; ++j) {
+                for (std::int64_t k = 0; k <= j; ++k) {
+                    triangle_count += tc_detail::count_block_triangles(policy,
+                                                                       blocks[i][j],
+                                                                       blocks[i][k],
+                                                                       blocks[j][k]);
+                }
+            }
+        }
+        REQUIRE(triangle_count == graph_data.get_global_triangle_count());
+
+        if (partition_count > 1) {
+            REQUIRE_THROWS_AS(
+                tc_detail::count_block_triangles(policy, blocks[1][0], blocks[1][1], blocks[1][0]),
+                invalid_argument);
+        }
+    }
+
+    template <typename GraphType>
+    void check_global_task_partitioned(dal::preview::triangle_counting::relabel relabel) {
+        GraphType graph_data;
+        const auto g = create_graph<GraphType>();
+        std::int64_t global_triangle_count = graph_data.get_global_triangle_count();
+
+        std::allocator<char> alloc;
+        for (std::int64_t partition_count : { 2, 3, 16 }) {
+            const auto tc_desc = dal::preview::triangle_counting::descriptor<
+                                     float,
+                                     dal::preview::triangle_counting::method::ordered_count,
+                                     dal::preview::triangle_counting::task::global,
+                                     std::allocator<char>>(alloc)
+                                     .set_relabel(relabel)
+                                     .set_partition_count(partition_count);
+
+            const auto result_vertex_ranking = dal::preview::vertex_ranking(tc_desc, g);
+            REQUIRE(result_vertex_ranking.get_global_rank() == global_triangle_count);
+        }
+    }
 };
 
 TEST_M(triangle_counting_test, "Local task: graph with average_degree < 4") {
@@ -400,6 +519,45 @@ TEST_M(triangle_counting_test, "Global task: not relabeled graph with average_de
     this->check_global_task_not_relabeled<graph_with_isolated_vertex_11_type>();
 }
 
+TEST_M(triangle_counting_test, "Global task: partitioned graph") {
+    const auto relabel = GENERATE(dal::preview::triangle_counting::relabel::yes,
+                                  dal::preview::triangle_counting::relabel::no);
+    this->check_global_task_partitioned<complete_graph_5_type>(relabel);
+    this->check_global_task_partitioned<complete_graph_9_type>(relabel);
+    this->check_global_task_partitioned<acyclic_graph_8_type>(relabel);
+    this->check_global_task_partitioned<wheel_graph_6_type>(relabel);
+    this->check_global_task_partitioned<graph_with_isolated_vertices_10_type>(relabel);
+    this->check_global_task_partitioned<graph_with_isolated_vertex_11_type>(relabel);
+}
+
+TEST_M(triangle_counting_test, "Global task: graph with long oriented lists") {
+    this->check_global_task_relabeled<dense_core_graph_100_type>();
+    this->check_global_task_not_relabeled<dense_core_graph_100_type>();
+    this->check_global_task_partitioned<dense_core_graph_100_type>(
+        dal::preview::triangle_counting::relabel::yes);
+    this->check_global_task_partitioned<dense_core_graph_100_type>(
+        dal::preview::triangle_counting::relabel::no);
+}
+
+TEST_M(triangle_counting_test, "Global task: triangles summed over adjacency blocks") {
+    const std::int64_t partition_count = GENERATE(1, 2, 3, 7);
+    this->check_block_triangles<complete_graph_9_type>(partition_count);
+    this->check_block_triangles<wheel_graph_6_type>(partition_count);
+    this->check_block_triangles<graph_with_isolated_vertices_10_type>(partition_count);
+    this->check_block_triangles<dense_core_graph_100_type>(partition_count);
+}
+
+TEST_M(triangle_counting_test, "Global task: partition count is lower than or equal to zero") {
+    std::allocator<char> alloc;
+    auto tc_desc = dal::preview::triangle_counting::descriptor<
+        float,
+        dal::preview::triangle_counting::method::ordered_count,
+        dal::preview::triangle_counting::task::global,
+        std::allocator<char>>(alloc);
+    REQUIRE_THROWS_AS(tc_desc.set_partition_count(0), domain_error);
+    REQUIRE_THROWS_AS(tc_desc.set_partition_count(-1), domain_error);
+}
+
 TEST_M(triangle_counting_test, "Local task: null graph") {
     dal::preview::undirected_adjacency_vector_graph<> null_graph;
     std::allocator<char> alloc;
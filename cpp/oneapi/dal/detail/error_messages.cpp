@@ -106,6 +106,20 @@ MSG(unimplemented_sorting_procedure, "Unimplemented sorting procedure")
 
 /* IO */
 MSG(file_not_found, "File not found")
+MSG(graph_snapshot_is_corrupted, "Graph snapshot file is corrupted")
+MSG(graph_snapshot_type_mismatch,
+    "Graph snapshot was saved for a graph of different type than requested")
+MSG(unsupported_graph_snapshot_version, "Unsupported version of graph snapshot file")
+MSG(failed_to_write_graph_snapshot, "Failed to write graph snapshot file")
+MSG(invalid_libsvm_format, "Input file does not follow the libsvm format")
+MSG(invalid_matrix_market_format, "Input file does not follow the MatrixMarket coordinate format")
+MSG(unsupported_matrix_market_format,
+    "Only real, integer and pattern MatrixMarket coordinate matrices are supported")
+MSG(column_index_gt_column_count, "Column index in the input file is greater than column count")
+MSG(negative_column_count, "Column count is lower than zero")
+MSG(invalid_edge_list_format,
+    "Input file does not follow the edge list format: every line must contain two vertex ids and an optional weight")
+MSG(edge_list_value_out_of_range, "Vertex id or edge weight in the input file is out of range")
 
 /* Serialization */
 MSG(object_is_not_serializable, "Object is not serializable")
@@ -164,6 +178,19 @@ MSG(unknown_distance_type,
 MSG(distance_is_not_supported_for_gpu, "Only Euclidean distances for k-NN is supported for GPU")
 MSG(incompatible_knn_model,
     "The provided model is incompatible with the selected k-NN task or method")
+MSG(radius_lt_zero, "Radius is lower than zero")
+MSG(knn_radius_search_is_implemented_for_kd_tree_only,
+    "k-NN radius search is implemented for k-d tree method only")
+MSG(knn_ball_tree_method_is_not_implemented_for_gpu,
+    "k-NN ball tree method is not implemented for GPU")
+MSG(knn_ball_tree_minkowski_degree_lt_one,
+    "k-NN ball tree method requires Minkowski degree greater than or equal to one")
+MSG(input_model_data_cc_neq_input_data_cc,
+    "Input data column count is not equal to the column count of the training data in the model")
+MSG(knn_hnsw_method_is_not_implemented_for_gpu, "k-NN HNSW method is not implemented for GPU")
+MSG(max_degree_lt_two, "Max degree is lower than two")
+MSG(ef_construction_lt_one, "Construction candidate count is lower than one")
+MSG(ef_search_lt_one, "Search candidate count is lower than one")
 
 /* Minkowski distance */
 MSG(invalid_minkowski_degree, "Minkowski degree should be greater than zero")
@@ -173,6 +200,7 @@ MSG(column_begin_gt_column_end, "Column begin is greater than column end")
 MSG(empty_edge_list, "Empty edge list")
 MSG(interval_gt_vertex_count, "Interval is greater than vertex count")
 MSG(negative_interval, "Negative interval")
+MSG(negative_top_k, "Top-k parameter is lower than zero")
 MSG(row_begin_gt_row_end, "Row begin is greater than row end")
 MSG(range_idx_gt_max_int32, "Range indexes are greater than max of int32")
 
@@ -203,6 +231,8 @@ MSG(pca_svd_based_method_is_not_implemented_for_gpu,
 MSG(negative_source, "Source vertex is lower than zero")
 MSG(source_gte_vertex_count, "Source vertex is out of range")
 MSG(negative_delta, "Delta parameter is lower than zero")
+MSG(negative_max_distance, "Max distance parameter is lower than zero")
+MSG(sources_are_empty, "Source vertices array is empty")
 MSG(nothing_to_compute, "Invalid combination of optional results: nothing to compute")
 MSG(distances_are_uninitialized, "Distances are not set as an optional result")
 MSG(predecessors_are_uninitialized, "Predecessors are not set as an optional result")
@@ -237,9 +267,16 @@ MSG(svm_nu_regression_task_is_not_implemented_for_gpu,
 MSG(svm_regression_task_is_not_implemented_for_gpu, "Regression SVM is not implemented for GPU")
 MSG(svm_smo_method_is_not_implemented_for_gpu, "SVM SMO method is not implemented for GPU")
 MSG(tau_leq_zero, "Tau is lower than or equal to zero")
+MSG(thunder_shrinking_interval_leq_zero,
+    "Thunder shrinking interval is lower than or equal to zero")
 MSG(epsilon_lt_zero, "Epsilon is lower than zero")
 MSG(unknown_kernel_function_type, "Unknown kernel function type")
 
+/* Triangle Counting */
+MSG(partition_count_leq_zero, "Partition count is lower than or equal to zero")
+MSG(adjacency_block_ranges_mismatch,
+    "Vertex ranges of the adjacency blocks do not form a triple of partitions")
+
 /* Kernel Functions */
 MSG(input_x_cc_neq_y_cc, "Input x column count is not qual to y column count")
 MSG(input_x_is_empty, "Input x is empty")
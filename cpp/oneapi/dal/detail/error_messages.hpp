@@ -130,6 +130,17 @@ public:
 
     /* I/O */
     MSG(file_not_found);
+    MSG(graph_snapshot_is_corrupted);
+    MSG(graph_snapshot_type_mismatch);
+    MSG(unsupported_graph_snapshot_version);
+    MSG(failed_to_write_graph_snapshot);
+    MSG(invalid_libsvm_format);
+    MSG(invalid_matrix_market_format);
+    MSG(unsupported_matrix_market_format);
+    MSG(column_index_gt_column_count);
+    MSG(negative_column_count);
+    MSG(invalid_edge_list_format);
+    MSG(edge_list_value_out_of_range);
 
     /* Serialization */
     MSG(object_is_not_serializable);
@@ -165,6 +176,7 @@ public:
     MSG(empty_edge_list);
     MSG(interval_gt_vertex_count);
     MSG(negative_interval);
+    MSG(negative_top_k);
     MSG(row_begin_gt_row_end);
     MSG(range_idx_gt_max_int32);
 
@@ -200,6 +212,15 @@ public:
     MSG(unknown_distance_type);
     MSG(distance_is_not_supported_for_gpu);
     MSG(incompatible_knn_model);
+    MSG(radius_lt_zero);
+    MSG(knn_radius_search_is_implemented_for_kd_tree_only);
+    MSG(knn_ball_tree_method_is_not_implemented_for_gpu);
+    MSG(knn_ball_tree_minkowski_degree_lt_one);
+    MSG(input_model_data_cc_neq_input_data_cc);
+    MSG(knn_hnsw_method_is_not_implemented_for_gpu);
+    MSG(max_degree_lt_two);
+    MSG(ef_construction_lt_one);
+    MSG(ef_search_lt_one);
 
     /* Linear and RBF Kernels */
     MSG(input_x_cc_neq_y_cc);
@@ -221,6 +242,8 @@ public:
     MSG(negative_source);
     MSG(source_gte_vertex_count);
     MSG(negative_delta);
+    MSG(negative_max_distance);
+    MSG(sources_are_empty);
     MSG(nothing_to_compute);
     MSG(distances_are_uninitialized);
     MSG(predecessors_are_uninitialized);
@@ -248,8 +271,13 @@ public:
     MSG(svm_regression_task_is_not_implemented_for_gpu);
     MSG(svm_smo_method_is_not_implemented_for_gpu);
     MSG(tau_leq_zero);
+    MSG(thunder_shrinking_interval_leq_zero);
     MSG(epsilon_lt_zero);
     MSG(unknown_kernel_function_type);
+
+    /* Triangle Counting */
+    MSG(partition_count_leq_zero);
+    MSG(adjacency_block_ranges_mismatch);
 };
 
 #undef MSG
@@ -81,6 +81,21 @@ public:
         _degrees_ptr = _degrees.get_data();
     }
 
+    inline void set_topology(vertex_size_type vertex_count,
+                             edge_size_type edge_count,
+                             const edge_set& rows,
+                             const vertex_set& cols,
+                             const vertex_set& degrees) {
+        _vertex_count = vertex_count;
+        _edge_count = edge_count;
+        _rows = rows;
+        _degrees = degrees;
+        _cols = cols;
+        _rows_ptr = _rows.get_data();
+        _cols_ptr = _cols.get_data();
+        _degrees_ptr = _degrees.get_data();
+    }
+
     ONEDAL_FORCEINLINE std::int64_t get_vertex_count() const {
         return _vertex_count;
     }
@@ -22,11 +22,15 @@
 #include "oneapi/dal/common.hpp"
 #include "oneapi/dal/detail/policy.hpp"
 #include "oneapi/dal/io/common.hpp"
+#include "oneapi/dal/io/detail/load_graph.hpp"
 
 namespace oneapi::dal::preview::load_graph::backend {
 
 template <typename Cpu>
 std::int64_t get_vertex_count_from_edge_list(const edge_list<std::int32_t> &edges) {
+    if (edges.size() == 0) {
+        return 0;
+    }
     std::int32_t max_id = edges[0].first;
     for (std::int64_t i = 0; i < edges.size(); i++) {
         std::int32_t edge_max = std::max(edges[i].first, edges[i].second);
@@ -40,13 +44,7 @@ template <typename Cpu>
 std::int64_t compute_prefix_sum(const std::int32_t *degrees,
                                 std::int64_t degrees_count,
                                 std::int64_t *edge_offsets) {
-    std::int64_t total_sum_degrees = 0;
-    edge_offsets[0] = total_sum_degrees;
-    for (std::int64_t i = 0; i < degrees_count; ++i) {
-        total_sum_degrees += degrees[i];
-        edge_offsets[i + 1] = total_sum_degrees;
-    }
-    return total_sum_degrees;
+    return detail::parallel_prefix_sum<std::int64_t>(degrees, degrees_count, edge_offsets);
 }
 
 template <typename Cpu>
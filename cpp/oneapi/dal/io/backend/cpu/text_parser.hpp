@@ -0,0 +1,345 @@
+/*******************************************************************************
+* Copyright 2020-2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "oneapi/dal/array.hpp"
+#include "oneapi/dal/exceptions.hpp"
+#include "oneapi/dal/detail/error_messages.hpp"
+
+namespace oneapi::dal::io::backend {
+
+/// Size of the file block that is parsed in parallel. Rows are never split
+/// between blocks, the incomplete tail of a block is carried to the next one.
+constexpr std::int64_t read_block_size = 64 * 1024 * 1024;
+
+/// Number of chunks per thread a block is split into to balance rows of
+/// different length across threads
+constexpr std::int64_t chunks_per_thread = 4;
+
+class block_reader {
+public:
+    explicit block_reader(const std::string& file_name, std::int64_t block_size)
+            : file_(std::fopen(file_name.c_str(), "rb")),
+              buffer_(block_size) {
+        if (!file_) {
+            throw invalid_argument(dal::detail::error_messages::file_not_found());
+        }
+    }
+
+    block_reader(const block_reader&) = delete;
+    block_reader& operator=(const block_reader&) = delete;
+
+    ~block_reader() {
+        std::fclose(file_);
+    }
+
+    /// Reads the next block of complete lines into the internal buffer.
+    /// Returns false when the whole file has been consumed.
+    bool next(const char*& begin, const char*& end) {
+        if (tail_size_ > 0) {
+            std::memmove(buffer_.data(), buffer_.data() + tail_offset_, tail_size_);
+        }
+        std::int64_t size = tail_size_;
+        tail_size_ = 0;
+
+        for (;;) {
+            if (size == static_cast<std::int64_t>(buffer_.size())) {
+                // A single line does not fit into the buffer
+                buffer_.resize(buffer_.size() * 2);
+            }
+            const std::int64_t read_count =
+                std::fread(buffer_.data() + size, 1, buffer_.size() - size, file_);
+            size += read_count;
+
+            const bool is_eof = (read_count == 0);
+            if (is_eof) {
+                begin = buffer_.data();
+                end = buffer_.data() + size;
+                return size > 0;
+            }
+
+            const char* last_newline = find_last_newline(buffer_.data(), buffer_.data() + size);
+            if (last_newline) {
+                begin = buffer_.data();
+                end = last_newline + 1;
+                tail_offset_ = end - begin;
+                tail_size_ = size - tail_offset_;
+                return true;
+            }
+        }
+    }
+
+private:
+    static const char* find_last_newline(const char* begin, const char* end) {
+        for (const char* it = end; it != begin; --it) {
+            if (*(it - 1) == '\n') {
+                return it - 1;
+            }
+        }
+        return nullptr;
+    }
+
+    std::FILE* file_;
+    std::vector<char> buffer_;
+    std::int64_t tail_offset_ = 0;
+    std::int64_t tail_size_ = 0;
+};
+
+inline bool is_blank(char c) {
+    return c == ' ' || c == '\t';
+}
+
+inline const char* find_line_end(const char* it, const char* end) {
+    const void* found = std::memchr(it, '\n', end - it);
+    return found ? static_cast<const char*>(found) : end;
+}
+
+/// Returns the end of the line content excluding the trailing carriage return
+inline const char* trim_line_end(const char* begin, const char* line_end) {
+    return (line_end != begin && *(line_end - 1) == '\r') ? line_end - 1 : line_end;
+}
+
+inline bool is_empty_line(const char* begin, const char* end) {
+    for (const char* it = begin; it != end; ++it) {
+        if (!is_blank(*it) && *it != '\r') {
+            return false;
+        }
+    }
+    return true;
+}
+
+/// Splits [begin, end) into chunks, each of which starts at the beginning of a line
+inline std::vector<const char*> split_by_lines(const char* begin,
+                                               const char* end,
+                                               std::int64_t chunk_count) {
+    std::vector<const char*> bounds(chunk_count + 1, end);
+    bounds[0] = begin;
+    const std::int64_t size = end - begin;
+    for (std::int64_t i = 1; i < chunk_count; ++i) {
+        const char* nominal = begin + size * i / chunk_count;
+        nominal = std::max(nominal, bounds[i - 1]);
+        const char* line_end = find_line_end(nominal, end);
+        bounds[i] = (line_end == end) ? end : line_end + 1;
+    }
+    return bounds;
+}
+
+/// Exact powers of ten representable in double
+inline constexpr double pow10_table[] = { 1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,
+                                          1e8,  1e9,  1e10, 1e11, 1e12, 1e13, 1e14, 1e15,
+                                          1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22 };
+
+/// Limits of the exact conversion of `mantissa * 10^exponent`: the mantissa and
+/// the power of ten are both exact in the floating-point type, so a single
+/// multiplication or division rounds the result correctly (Clinger's fast path)
+template <typename Float>
+struct fast_path_limits;
+
+template <>
+struct fast_path_limits<float> {
+    static constexpr std::uint64_t max_mantissa = std::uint64_t(1) << 24;
+    static constexpr std::int64_t max_exponent = 10;
+};
+
+template <>
+struct fast_path_limits<double> {
+    static constexpr std::uint64_t max_mantissa = std::uint64_t(1) << 53;
+    static constexpr std::int64_t max_exponent = 22;
+};
+
+inline float convert_decimal(const char* str, char** end, float) {
+    return std::strtof(str, end);
+}
+
+inline double convert_decimal(const char* str, char** end, double) {
+    return std::strtod(str, end);
+}
+
+/// Correctly rounded conversion of the decimal number in [begin, end) by the C library,
+/// used for the values out of the fast path
+template <typename Float>
+inline Float parse_number_slow(const char* begin, const char* end) {
+    constexpr std::int64_t buffer_size = 64;
+    char buffer[buffer_size];
+    std::string long_number;
+    const std::int64_t length = end - begin;
+    const char* str = buffer;
+    if (length < buffer_size) {
+        std::memcpy(buffer, begin, length);
+        buffer[length] = '\0';
+    }
+    else {
+        long_number.assign(begin, end);
+        str = long_number.c_str();
+    }
+    return convert_decimal(str, nullptr, Float{});
+}
+
+/// Parses a decimal floating-point value of the form [+-]digits[.digits][(e|E)[+-]digits].
+/// Up to 19 significant digits are accumulated in an integer mantissa, so the
+/// loop has no floating-point operations per character. The result is correctly
+/// rounded: the values with a short mantissa and a small exponent are converted
+/// exactly, the others are passed to strtod/strtof.
+/// Returns the pointer past the parsed value or nullptr if the field is not numeric.
+template <typename Float>
+inline const char* parse_number(const char* it, const char* end, Float& value) {
+    using limits = fast_path_limits<Float>;
+    constexpr std::int64_t max_mantissa_digits = 19;
+
+    while (it != end && is_blank(*it)) {
+        ++it;
+    }
+    const char* number_begin = it;
+
+    bool is_negative = false;
+    if (it != end && (*it == '-' || *it == '+')) {
+        is_negative = (*it == '-');
+        ++it;
+    }
+
+    std::uint64_t mantissa = 0;
+    std::int64_t mantissa_digits = 0;
+    std::int64_t exponent = 0;
+    std::int64_t digit_count = 0;
+    bool is_truncated = false;
+
+    for (; it != end && static_cast<unsigned char>(*it - '0') < 10; ++it, ++digit_count) {
+        if (mantissa_digits < max_mantissa_digits) {
+            mantissa = mantissa * 10 + (*it - '0');
+            mantissa_digits += (mantissa != 0);
+        }
+        else {
+            is_truncated |= (*it != '0');
+            ++exponent;
+        }
+    }
+
+    if (it != end && *it == '.') {
+        ++it;
+        for (; it != end && static_cast<unsigned char>(*it - '0') < 10; ++it, ++digit_count) {
+            if (mantissa_digits < max_mantissa_digits) {
+                mantissa = mantissa * 10 + (*it - '0');
+                mantissa_digits += (mantissa != 0);
+                --exponent;
+            }
+            else {
+                is_truncated |= (*it != '0');
+            }
+        }
+    }
+
+    if (digit_count == 0) {
+        return nullptr;
+    }
+
+    if (it != end && (*it == 'e' || *it == 'E')) {
+        ++it;
+        bool is_negative_exponent = false;
+        if (it != end && (*it == '-' || *it == '+')) {
+            is_negative_exponent = (*it == '-');
+            ++it;
+        }
+        if (it == end || static_cast<unsigned char>(*it - '0') >= 10) {
+            return nullptr;
+        }
+        std::int64_t explicit_exponent = 0;
+        for (; it != end && static_cast<unsigned char>(*it - '0') < 10; ++it) {
+            if (explicit_exponent < 100000) {
+                explicit_exponent = explicit_exponent * 10 + (*it - '0');
+            }
+        }
+        exponent += is_negative_exponent ? -explicit_exponent : explicit_exponent;
+    }
+    const char* number_end = it;
+
+    while (it != end && is_blank(*it)) {
+        ++it;
+    }
+
+    if (mantissa == 0 && !is_truncated) {
+        value = is_negative ? -Float(0) : Float(0);
+    }
+    else if (!is_truncated && mantissa <= limits::max_mantissa &&
+             exponent >= -limits::max_exponent && exponent <= limits::max_exponent) {
+        const Float power = static_cast<Float>(pow10_table[exponent < 0 ? -exponent : exponent]);
+        const Float result = (exponent < 0) ? static_cast<Float>(mantissa) / power
+                                            : static_cast<Float>(mantissa) * power;
+        value = is_negative ? -result : result;
+    }
+    else {
+        value = parse_number_slow<Float>(number_begin, number_end);
+    }
+    return it;
+}
+
+/// Parses an unsigned decimal integer. Returns the pointer past the parsed value
+/// or nullptr if there are no digits at `it` or the value does not fit into std::int64_t.
+inline const char* parse_index(const char* it, const char* end, std::int64_t& value) {
+    constexpr std::int64_t max_value = std::numeric_limits<std::int64_t>::max();
+    const char* first = it;
+    std::int64_t result = 0;
+    for (; it != end && static_cast<unsigned char>(*it - '0') < 10; ++it) {
+        const std::int64_t digit = *it - '0';
+        if (result > (max_value - digit) / 10) {
+            return nullptr;
+        }
+        result = result * 10 + digit;
+    }
+    value = result;
+    return (it == first) ? nullptr : it;
+}
+
+/// Sorts the `count` entries of a CSR row by their column indices, the values are
+/// reordered along with the indices. Entries with equal indices are ordered by value,
+/// so the result does not depend on the order they were written in.
+template <typename Float>
+inline void sort_by_column_indices(std::int64_t* column_indices,
+                                   Float* values,
+                                   std::int64_t count) {
+    if (std::is_sorted(column_indices, column_indices + count)) {
+        return;
+    }
+    std::vector<std::pair<std::int64_t, Float>> entries(count);
+    for (std::int64_t i = 0; i < count; ++i) {
+        entries[i] = { column_indices[i], values[i] };
+    }
+    std::sort(entries.begin(), entries.end());
+    for (std::int64_t i = 0; i < count; ++i) {
+        column_indices[i] = entries[i].first;
+        values[i] = entries[i].second;
+    }
+}
+
+/// Moves the contents of `values` into an array without copying
+template <typename T>
+inline array<T> move_to_array(std::vector<T>&& values) {
+    auto holder = std::make_shared<std::vector<T>>(std::move(values));
+    return array<T>(holder->data(), holder->size(), [holder](T*) {});
+}
+
+} // namespace oneapi::dal::io::backend
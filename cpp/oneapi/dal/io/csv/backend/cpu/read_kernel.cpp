@@ -23,21 +23,204 @@
 
 #endif
 
+#include <atomic>
+#include <vector>
+
 #include "oneapi/dal/backend/interop/common.hpp"
 #include "oneapi/dal/backend/interop/error_converter.hpp"
 #include "oneapi/dal/backend/interop/table_conversion.hpp"
+#include "oneapi/dal/detail/threading.hpp"
+#include "oneapi/dal/io/backend/cpu/text_parser.hpp"
 #include "oneapi/dal/io/csv/backend/cpu/read_kernel.hpp"
 #include "oneapi/dal/table/common.hpp"
+#include "oneapi/dal/table/detail/table_builder.hpp"
 
 namespace oneapi::dal::csv::backend {
 
 namespace interop = dal::backend::interop;
 namespace daal_dm = daal::data_management;
 
-template <>
-table read_kernel_cpu<table>::operator()(const dal::backend::context_cpu& ctx,
-                                         const detail::data_source_base& ds,
-                                         const read_args<table>& args) const {
+using dal::io::backend::block_reader;
+using dal::io::backend::chunks_per_thread;
+using dal::io::backend::find_line_end;
+using dal::io::backend::is_empty_line;
+using dal::io::backend::parse_number;
+using dal::io::backend::read_block_size;
+using dal::io::backend::split_by_lines;
+using dal::io::backend::trim_line_end;
+
+static std::int64_t count_rows(const char* begin, const char* end) {
+    std::int64_t row_count = 0;
+    for (const char* it = begin; it < end;) {
+        const char* line_end = find_line_end(it, end);
+        row_count += !is_empty_line(it, line_end);
+        it = line_end + 1;
+    }
+    return row_count;
+}
+
+static std::int64_t count_fields(const char* begin, const char* end, char delimiter) {
+    std::int64_t field_count = 1;
+    for (const char* it = begin; it != end; ++it) {
+        field_count += (*it == delimiter);
+    }
+    return field_count;
+}
+
+/// Parses the non-empty rows in [begin, end) into the row-major `dst`.
+/// Returns false if any field is not numeric, a row has unexpected number of fields
+/// or the number of rows differs from `row_count`.
+template <typename Float>
+static bool parse_rows(const char* begin,
+                       const char* end,
+                       char delimiter,
+                       std::int64_t column_count,
+                       std::int64_t row_count,
+                       Float* dst) {
+    for (const char* it = begin; it < end;) {
+        const char* line_end = find_line_end(it, end);
+        const char* content_end = trim_line_end(it, line_end);
+        if (!is_empty_line(it, content_end)) {
+            if (row_count-- == 0) {
+                return false;
+            }
+            const char* field = it;
+            for (std::int64_t j = 0; j < column_count; ++j) {
+                field = parse_number(field, content_end, dst[j]);
+                if (!field) {
+                    return false;
+                }
+                const bool is_last = (j + 1 == column_count);
+                const bool is_delimited = (field != content_end && *field == delimiter);
+                if (is_last ? (field != content_end) : !is_delimited) {
+                    return false;
+                }
+                ++field;
+            }
+            dst += column_count;
+        }
+        it = line_end + 1;
+    }
+    return row_count == 0;
+}
+
+/// Moves `begin` past the header row while `skip_header` is set.
+/// The header is the first non-empty line of the file.
+static const char* skip_header_row(const char* begin, const char* end, bool& skip_header) {
+    while (skip_header && begin < end) {
+        const char* line_end = find_line_end(begin, end);
+        skip_header = is_empty_line(begin, trim_line_end(begin, line_end));
+        begin = line_end + 1;
+    }
+    return begin;
+}
+
+/// Reads a CSV file with numeric fields only, splitting each block between threads.
+/// Returns an empty table if the file cannot be parsed as numeric data; the caller
+/// is expected to fall back to the generic parser in that case.
+///
+/// The first pass detects the number of columns by the first data row and counts
+/// the rows of each chunk, so the table is allocated once. The first data row is
+/// checked before any parallel work, so files with categorical fields are rejected
+/// without reading them through. The second pass reads the same blocks, splits them
+/// into the same chunks and parses each chunk in parallel directly into its rows.
+template <typename Float>
+static table read_numeric_csv(const detail::data_source_base& ds) {
+    const char delimiter = ds.get_delimiter();
+    const std::int64_t chunk_count =
+        std::max<std::int64_t>(dal::detail::threader_get_max_threads() * chunks_per_thread, 1);
+
+    // Index of the first row of each chunk of each block followed by the row count
+    std::vector<std::int64_t> chunk_row_offsets(1, 0);
+    std::int64_t column_count = 0;
+    const char *begin, *end;
+    {
+        block_reader reader{ ds.get_file_name(), read_block_size };
+        bool skip_header = ds.get_parse_header();
+        std::vector<std::int64_t> chunk_row_counts(chunk_count);
+        while (reader.next(begin, end)) {
+            begin = skip_header_row(begin, end, skip_header);
+
+            // Detects the number of columns by the first data row
+            for (const char* it = begin; it < end && column_count == 0;) {
+                const char* line_end = find_line_end(it, end);
+                const char* content_end = trim_line_end(it, line_end);
+                if (!is_empty_line(it, content_end)) {
+                    column_count = count_fields(it, content_end, delimiter);
+                    std::vector<Float> first_row(column_count);
+                    if (!parse_rows(it, line_end, delimiter, column_count, 1, first_row.data())) {
+                        return table{};
+                    }
+                }
+                it = line_end + 1;
+            }
+            if (begin >= end) {
+                continue;
+            }
+
+            const auto bounds = split_by_lines(begin, end, chunk_count);
+            dal::detail::threader_for(chunk_count, chunk_count, [&](std::int32_t i) {
+                chunk_row_counts[i] = count_rows(bounds[i], bounds[i + 1]);
+            });
+            for (std::int64_t i = 0; i < chunk_count; ++i) {
+                chunk_row_offsets.push_back(chunk_row_offsets.back() + chunk_row_counts[i]);
+            }
+        }
+    }
+
+    const std::int64_t row_count = chunk_row_offsets.back();
+    if (row_count == 0 || column_count == 0) {
+        return table{};
+    }
+
+    auto data = array<Float>::empty(dal::detail::check_mul_overflow(row_count, column_count));
+    Float* data_ptr = data.get_mutable_data();
+
+    block_reader reader{ ds.get_file_name(), read_block_size };
+    bool skip_header = ds.get_parse_header();
+    std::int64_t block_index = 0;
+    while (reader.next(begin, end)) {
+        begin = skip_header_row(begin, end, skip_header);
+        if (begin >= end) {
+            continue;
+        }
+
+        const std::int64_t first_chunk = block_index * chunk_count;
+        if (first_chunk + chunk_count >= std::int64_t(chunk_row_offsets.size())) {
+            // The file has grown since the first pass
+            return table{};
+        }
+
+        const auto bounds = split_by_lines(begin, end, chunk_count);
+        std::atomic<bool> is_numeric{ true };
+        dal::detail::threader_for(chunk_count, chunk_count, [&](std::int32_t i) {
+            if (!is_numeric.load(std::memory_order_relaxed)) {
+                return;
+            }
+            const std::int64_t first_row = chunk_row_offsets[first_chunk + i];
+            const std::int64_t chunk_row_count = chunk_row_offsets[first_chunk + i + 1] - first_row;
+            if (!parse_rows(bounds[i],
+                            bounds[i + 1],
+                            delimiter,
+                            column_count,
+                            chunk_row_count,
+                            data_ptr + first_row * column_count)) {
+                is_numeric.store(false, std::memory_order_relaxed);
+            }
+        });
+        if (!is_numeric.load()) {
+            return table{};
+        }
+        ++block_index;
+    }
+    if ((block_index * chunk_count + 1) != std::int64_t(chunk_row_offsets.size())) {
+        return table{};
+    }
+
+    return dal::detail::homogen_table_builder{}.reset(data, row_count, column_count).build();
+}
+
+static table read_with_feature_manager(const detail::data_source_base& ds) {
     daal_dm::CsvDataSourceOptions csv_options(daal_dm::operator|(
         daal_dm::operator|(daal_dm::CsvDataSourceOptions::allocateNumericTable,
                            daal_dm::CsvDataSourceOptions::createDictionaryFromContext),
@@ -56,4 +239,17 @@ table read_kernel_cpu<table>::operator()(const dal::backend::context_cpu& ctx,
         daal_data_source.getNumericTable());
 }
 
+template <>
+table read_kernel_cpu<table>::operator()(const dal::backend::context_cpu& ctx,
+                                         const detail::data_source_base& ds,
+                                         const read_args<table>& args) const {
+    // Fast path for purely numeric files. Categorical fields require
+    // dictionary creation, which is handled by the DAAL feature manager.
+    auto result = read_numeric_csv<DAAL_DATA_TYPE>(ds);
+    if (result.has_data()) {
+        return result;
+    }
+    return read_with_feature_manager(ds);
+}
+
 } // namespace oneapi::dal::csv::backend
@@ -0,0 +1,111 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+#include "oneapi/dal/io/csv.hpp"
+#include "oneapi/dal/table/row_accessor.hpp"
+#include "oneapi/dal/test/engine/common.hpp"
+
+namespace oneapi::dal::csv::test {
+
+class temp_csv_file {
+public:
+    temp_csv_file(const std::string& name, const std::string& content) : name_(name) {
+        std::ofstream file(name_, std::ios::binary);
+        file << content;
+    }
+
+    ~temp_csv_file() {
+        std::remove(name_.c_str());
+    }
+
+    const std::string& get_name() const {
+        return name_;
+    }
+
+private:
+    std::string name_;
+};
+
+static std::vector<float> pull_all(const table& t) {
+    const auto arr = row_accessor<const float>{ t }.pull();
+    return std::vector<float>(arr.get_data(), arr.get_data() + arr.get_count());
+}
+
+TEST("read numeric csv with exponents and blank lines", "[csv]") {
+    const temp_csv_file file{ "csv_read_test_numeric.csv",
+                              "1.5,-2e3,0.25\r\n"
+                              "\n"
+                              "  3 , 4.5E-1 ,+6\n"
+                              "7,8,9" };
+
+    const auto t = read<table>(data_source{ file.get_name() });
+
+    REQUIRE(t.get_row_count() == 3);
+    REQUIRE(t.get_column_count() == 3);
+    const std::vector<float> expected = { 1.5f, -2e3f, 0.25f, 3.f, 4.5e-1f, 6.f, 7.f, 8.f, 9.f };
+    REQUIRE(pull_all(t) == expected);
+}
+
+TEST("read numeric csv skips header", "[csv]") {
+    const temp_csv_file file{ "csv_read_test_header.csv", "a,b\n1,2\n3,4\n" };
+
+    const auto t = read<table>(data_source{ file.get_name() }.set_parse_header(true));
+
+    REQUIRE(t.get_row_count() == 2);
+    REQUIRE(t.get_column_count() == 2);
+    const std::vector<float> expected = { 1, 2, 3, 4 };
+    REQUIRE(pull_all(t) == expected);
+}
+
+TEST("read numeric csv places chunks at their rows", "[csv]") {
+    constexpr std::int64_t row_count = 10000;
+    std::string content = "x,y\n";
+    std::vector<float> expected;
+    for (std::int64_t i = 0; i < row_count; ++i) {
+        content += std::to_string(i) + "," + std::to_string(-i) + (i % 7 == 0 ? "\n\n" : "\n");
+        expected.push_back(float(i));
+        expected.push_back(float(-i));
+    }
+    const temp_csv_file file{ "csv_read_test_many_rows.csv", content };
+
+    const auto t = read<table>(data_source{ file.get_name() }.set_parse_header(true));
+
+    REQUIRE(t.get_row_count() == row_count);
+    REQUIRE(t.get_column_count() == 2);
+    REQUIRE(pull_all(t) == expected);
+}
+
+TEST("read csv with categorical fields falls back to feature manager", "[csv]") {
+    const temp_csv_file file{ "csv_read_test_categorical.csv", "1,red\n2,green\n3,red\n" };
+
+    const auto t = read<table>(data_source{ file.get_name() });
+
+    REQUIRE(t.get_row_count() == 3);
+    REQUIRE(t.get_column_count() == 2);
+    const auto values = pull_all(t);
+    REQUIRE(values[0] == 1);
+    REQUIRE(values[2] == 2);
+    REQUIRE(values[4] == 3);
+    REQUIRE(values[1] == values[5]);
+    REQUIRE(values[1] != values[3]);
+}
+
+} // namespace oneapi::dal::csv::test
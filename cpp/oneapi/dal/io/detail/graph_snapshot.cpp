@@ -0,0 +1,111 @@
+/*******************************************************************************
+* Copyright 2020-2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#if defined(_WIN32) || defined(_WIN64)
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "oneapi/dal/io/detail/graph_snapshot.hpp"
+
+namespace oneapi::dal::preview::load_graph::detail {
+
+#if defined(_WIN32) || defined(_WIN64)
+
+mapped_graph_file::mapped_graph_file(const std::string &file_name) {
+    HANDLE file = CreateFileA(file_name.c_str(),
+                              GENERIC_READ,
+                              FILE_SHARE_READ,
+                              nullptr,
+                              OPEN_EXISTING,
+                              FILE_ATTRIBUTE_NORMAL,
+                              nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        throw invalid_argument(dal::detail::error_messages::file_not_found());
+    }
+
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(file, &size)) {
+        CloseHandle(file);
+        throw invalid_argument(dal::detail::error_messages::file_not_found());
+    }
+    _size = size.QuadPart;
+    if (_size == 0) {
+        CloseHandle(file);
+        return;
+    }
+
+    HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    CloseHandle(file);
+    if (!mapping) {
+        throw host_bad_alloc();
+    }
+
+    // The view keeps the mapping object alive after its handle is closed
+    _data = static_cast<const char *>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+    CloseHandle(mapping);
+    if (!_data) {
+        throw host_bad_alloc();
+    }
+}
+
+mapped_graph_file::~mapped_graph_file() {
+    if (_data) {
+        UnmapViewOfFile(_data);
+    }
+}
+
+#else
+
+mapped_graph_file::mapped_graph_file(const std::string &file_name) {
+    const int fd = open(file_name.c_str(), O_RDONLY);
+    if (fd < 0) {
+        throw invalid_argument(dal::detail::error_messages::file_not_found());
+    }
+
+    struct stat file_stat;
+    if (fstat(fd, &file_stat) != 0) {
+        close(fd);
+        throw invalid_argument(dal::detail::error_messages::file_not_found());
+    }
+    _size = file_stat.st_size;
+    if (_size == 0) {
+        close(fd);
+        return;
+    }
+
+    // The mapping stays valid after the file descriptor is closed
+    void *data = mmap(nullptr, _size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (data == MAP_FAILED) {
+        throw host_bad_alloc();
+    }
+    _data = static_cast<const char *>(data);
+}
+
+mapped_graph_file::~mapped_graph_file() {
+    if (_data) {
+        munmap(const_cast<char *>(_data), _size);
+    }
+}
+
+#endif
+
+} // namespace oneapi::dal::preview::load_graph::detail
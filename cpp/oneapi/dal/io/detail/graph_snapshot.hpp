@@ -0,0 +1,331 @@
+/*******************************************************************************
+* Copyright 2020-2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <atomic>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <type_traits>
+
+#include "oneapi/dal/detail/common.hpp"
+#include "oneapi/dal/detail/threading.hpp"
+#include "oneapi/dal/exceptions.hpp"
+#include "oneapi/dal/graph/common.hpp"
+#include "oneapi/dal/graph/detail/directed_adjacency_vector_graph_impl.hpp"
+#include "oneapi/dal/graph/detail/undirected_adjacency_vector_graph_impl.hpp"
+#include "oneapi/dal/graph/directed_adjacency_vector_graph.hpp"
+#include "oneapi/dal/graph/undirected_adjacency_vector_graph.hpp"
+
+namespace oneapi::dal::preview::load_graph::detail {
+
+/// Read-only memory mapping of the whole file
+class ONEDAL_EXPORT mapped_graph_file {
+public:
+    explicit mapped_graph_file(const std::string &file_name);
+    mapped_graph_file(const mapped_graph_file &) = delete;
+    mapped_graph_file &operator=(const mapped_graph_file &) = delete;
+    ~mapped_graph_file();
+
+    const char *get_data() const {
+        return _data;
+    }
+
+    std::int64_t get_size() const {
+        return _size;
+    }
+
+private:
+    const char *_data = nullptr;
+    std::int64_t _size = 0;
+};
+
+constexpr char graph_snapshot_magic[8] = { 'O', 'D', 'A', 'L', 'C', 'S', 'R', '\0' };
+constexpr std::uint32_t graph_snapshot_version = 1;
+
+/// Alignment of the arrays in the snapshot file, so the mapped arrays
+/// can be used by vectorized kernels directly
+constexpr std::int64_t graph_snapshot_alignment = 64;
+
+/// Header of the binary graph snapshot. All arrays are stored in the native
+/// byte order at the offsets specified in the header. Offset of the optional
+/// array is zero if the array is not stored.
+struct graph_snapshot_header {
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t is_directed;
+    std::uint32_t vertex_size;
+    std::uint32_t edge_value_type;
+    std::int64_t vertex_count;
+    std::int64_t edge_count;
+    std::int64_t neighbor_count;
+    std::int64_t edge_value_count;
+    std::int64_t rows_offset;
+    std::int64_t degrees_offset;
+    std::int64_t cols_offset;
+    std::int64_t rows_vertex_offset;
+    std::int64_t edge_values_offset;
+};
+
+template <typename EdgeValue>
+struct graph_snapshot_value_type;
+
+template <>
+struct graph_snapshot_value_type<empty_value> {
+    static constexpr std::uint32_t value = 0;
+};
+
+template <>
+struct graph_snapshot_value_type<std::int32_t> {
+    static constexpr std::uint32_t value = 1;
+};
+
+template <>
+struct graph_snapshot_value_type<double> {
+    static constexpr std::uint32_t value = 2;
+};
+
+inline std::int64_t align_snapshot_offset(std::int64_t offset) {
+    return (offset + graph_snapshot_alignment - 1) / graph_snapshot_alignment *
+           graph_snapshot_alignment;
+}
+
+inline void check_snapshot_write(const std::ofstream &file) {
+    if (!file.good()) {
+        throw internal_error(dal::detail::error_messages::failed_to_write_graph_snapshot());
+    }
+}
+
+/// Appends the array to the file at the next aligned offset and returns the offset
+template <typename T>
+inline std::int64_t write_snapshot_array(std::ofstream &file, const T *data, std::int64_t count) {
+    const std::int64_t position = file.tellp();
+    if (position < 0) {
+        throw internal_error(dal::detail::error_messages::failed_to_write_graph_snapshot());
+    }
+    const std::int64_t offset = align_snapshot_offset(position);
+    const char padding[graph_snapshot_alignment] = {};
+    file.write(padding, offset - position);
+    file.write(reinterpret_cast<const char *>(data), count * sizeof(T));
+    check_snapshot_write(file);
+    return offset;
+}
+
+template <typename Graph>
+void save_graph_snapshot(const std::string &name, const Graph &graph) {
+    using vertex_t = typename graph_traits<Graph>::vertex_type;
+    using edge_t = typename graph_traits<Graph>::edge_type;
+    using edge_value_t = typename graph_traits<Graph>::edge_user_value_type;
+    static_assert(std::is_same_v<edge_t, std::int64_t>, "Snapshot expects 64-bit edge offsets");
+
+    const auto &graph_impl = oneapi::dal::detail::get_impl(graph);
+    const auto topology = graph_impl.get_topology();
+    const auto edge_values = graph_impl.get_edge_values();
+
+    std::ofstream file(name, std::ios::binary | std::ios::trunc);
+    if (!file.is_open()) {
+        throw invalid_argument(dal::detail::error_messages::file_not_found());
+    }
+
+    graph_snapshot_header header = {};
+    std::memcpy(header.magic, graph_snapshot_magic, sizeof(header.magic));
+    header.version = graph_snapshot_version;
+    header.is_directed = is_directed<Graph>;
+    header.vertex_size = sizeof(vertex_t);
+    header.edge_value_type = graph_snapshot_value_type<edge_value_t>::value;
+    header.vertex_count = topology.get_vertex_count();
+    header.edge_count = topology.get_edge_count();
+    header.neighbor_count = topology._cols.get_count();
+    header.edge_value_count = edge_values.get_count();
+
+    // The header is rewritten after the offsets of the arrays are known
+    file.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    check_snapshot_write(file);
+
+    header.rows_offset = write_snapshot_array(file,
+                                              topology._rows.get_data(),
+                                              topology._rows.get_count());
+    header.degrees_offset = write_snapshot_array(file,
+                                                 topology._degrees.get_data(),
+                                                 topology._degrees.get_count());
+    header.cols_offset = write_snapshot_array(file,
+                                              topology._cols.get_data(),
+                                              topology._cols.get_count());
+    if (topology._rows_vertex.get_count() > 0) {
+        header.rows_vertex_offset = write_snapshot_array(file,
+                                                         topology._rows_vertex.get_data(),
+                                                         topology._rows_vertex.get_count());
+    }
+    if constexpr (!std::is_same_v<edge_value_t, empty_value>) {
+        if (header.edge_value_count > 0) {
+            header.edge_values_offset =
+                write_snapshot_array(file, edge_values.get_data(), header.edge_value_count);
+        }
+    }
+
+    file.seekp(0);
+    file.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    file.flush();
+    check_snapshot_write(file);
+    file.close();
+    if (file.fail()) {
+        throw internal_error(dal::detail::error_messages::failed_to_write_graph_snapshot());
+    }
+}
+
+/// Wraps the array stored in the mapped file. The array shares ownership of the
+/// mapping, so the file stays mapped while any array of the graph is alive.
+template <typename T>
+inline dal::array<T> wrap_snapshot_array(const std::shared_ptr<mapped_graph_file> &file,
+                                         std::int64_t offset,
+                                         std::int64_t count) {
+    if (offset < static_cast<std::int64_t>(sizeof(graph_snapshot_header)) || count < 0 ||
+        offset % graph_snapshot_alignment != 0 ||
+        (file->get_size() - offset) / static_cast<std::int64_t>(sizeof(T)) < count) {
+        throw invalid_argument(dal::detail::error_messages::graph_snapshot_is_corrupted());
+    }
+    const T *data = reinterpret_cast<const T *>(file->get_data() + offset);
+    return dal::array<T>(data, count, [file](const T *) {});
+}
+
+/// Checks that the header counts are consistent with each other before any
+/// array of the mapped file is accessed
+inline void validate_snapshot_header(const graph_snapshot_header &header) {
+    const bool has_edge_values = (header.edge_values_offset != 0);
+    const std::int64_t max_vertex_count = dal::detail::limits<std::int64_t>::max() - 1;
+    if (header.vertex_count < 0 || header.vertex_count > max_vertex_count ||
+        header.edge_count < 0 || header.neighbor_count < 0 || header.edge_value_count < 0 ||
+        header.edge_count > header.neighbor_count ||
+        (has_edge_values && header.edge_value_count != header.neighbor_count)) {
+        throw invalid_argument(dal::detail::error_messages::graph_snapshot_is_corrupted());
+    }
+}
+
+/// Checks the first and the last offsets of the CSR arrays. Only the pages
+/// that contain them are read, so the check does not depend on the graph size.
+template <typename Edge, typename VertexEdge>
+inline void validate_snapshot_offsets(const graph_snapshot_header &header,
+                                      const Edge *rows,
+                                      const VertexEdge *rows_vertex) {
+    const std::int64_t vertex_count = header.vertex_count;
+    if (rows[0] != 0 || rows[vertex_count] != header.neighbor_count ||
+        (rows_vertex && (rows_vertex[0] != 0 ||
+                         static_cast<Edge>(rows_vertex[vertex_count]) != rows[vertex_count]))) {
+        throw invalid_argument(dal::detail::error_messages::graph_snapshot_is_corrupted());
+    }
+}
+
+/// Checks that the CSR arrays are consistent: the offsets grow monotonically
+/// and agree with the degrees, and all neighbors are valid vertex ids.
+/// The check reads all the arrays, so it is done only on request.
+template <typename Vertex, typename Edge, typename VertexEdge>
+inline void validate_snapshot_topology(const graph_snapshot_header &header,
+                                       const Edge *rows,
+                                       const Vertex *degrees,
+                                       const Vertex *cols,
+                                       const VertexEdge *rows_vertex) {
+    const std::int64_t vertex_count = header.vertex_count;
+    std::atomic<bool> is_valid{ true };
+    dal::detail::threader_for_int64(vertex_count, [&](std::int64_t u) {
+        const Edge begin = rows[u];
+        const Edge end = rows[u + 1];
+        bool is_row_valid = (begin <= end) && (static_cast<Edge>(degrees[u]) == end - begin);
+        if (rows_vertex) {
+            is_row_valid &= (static_cast<Edge>(rows_vertex[u]) == begin);
+        }
+        for (Edge i = begin; is_row_valid && i < end; ++i) {
+            is_row_valid = (cols[i] >= 0 && cols[i] < vertex_count);
+        }
+        if (!is_row_valid) {
+            is_valid.store(false, std::memory_order_relaxed);
+        }
+    });
+    if (!is_valid.load()) {
+        throw invalid_argument(dal::detail::error_messages::graph_snapshot_is_corrupted());
+    }
+}
+
+/// Maps the snapshot file and wraps its arrays into the graph. The header and the
+/// bounds of the arrays are always checked, the whole topology is checked only
+/// if check_topology is set.
+template <typename Graph>
+void load_graph_snapshot(const std::string &name, Graph &graph, bool check_topology = false) {
+    using vertex_t = typename graph_traits<Graph>::vertex_type;
+    using edge_t = typename graph_traits<Graph>::edge_type;
+    using edge_value_t = typename graph_traits<Graph>::edge_user_value_type;
+    using vertex_edge_t = typename graph_traits<Graph>::impl_type::vertex_edge_type;
+
+    auto file = std::make_shared<mapped_graph_file>(name);
+
+    graph_snapshot_header header;
+    if (file->get_size() < static_cast<std::int64_t>(sizeof(header))) {
+        throw invalid_argument(dal::detail::error_messages::graph_snapshot_is_corrupted());
+    }
+    std::memcpy(&header, file->get_data(), sizeof(header));
+
+    if (std::memcmp(header.magic, graph_snapshot_magic, sizeof(header.magic)) != 0) {
+        throw invalid_argument(dal::detail::error_messages::graph_snapshot_is_corrupted());
+    }
+    if (header.version != graph_snapshot_version) {
+        throw invalid_argument(dal::detail::error_messages::unsupported_graph_snapshot_version());
+    }
+    if (header.is_directed != static_cast<std::uint32_t>(is_directed<Graph>) ||
+        header.vertex_size != sizeof(vertex_t) ||
+        header.edge_value_type != graph_snapshot_value_type<edge_value_t>::value) {
+        throw invalid_argument(dal::detail::error_messages::graph_snapshot_type_mismatch());
+    }
+    validate_snapshot_header(header);
+
+    auto rows = wrap_snapshot_array<edge_t>(file, header.rows_offset, header.vertex_count + 1);
+    auto degrees = wrap_snapshot_array<vertex_t>(file, header.degrees_offset, header.vertex_count);
+    auto cols = wrap_snapshot_array<vertex_t>(file, header.cols_offset, header.neighbor_count);
+    dal::array<vertex_edge_t> rows_vertex;
+    if (header.rows_vertex_offset != 0) {
+        rows_vertex = wrap_snapshot_array<vertex_edge_t>(file,
+                                                         header.rows_vertex_offset,
+                                                         header.vertex_count + 1);
+    }
+
+    const vertex_edge_t *rows_vertex_data =
+        rows_vertex.get_count() > 0 ? rows_vertex.get_data() : nullptr;
+    validate_snapshot_offsets(header, rows.get_data(), rows_vertex_data);
+    if (check_topology) {
+        validate_snapshot_topology(header,
+                                   rows.get_data(),
+                                   degrees.get_data(),
+                                   cols.get_data(),
+                                   rows_vertex_data);
+    }
+
+    auto &graph_impl = oneapi::dal::detail::get_impl(graph);
+    auto &topology = graph_impl.get_topology();
+    topology.set_topology(header.vertex_count, header.edge_count, rows, cols, degrees);
+
+    if (rows_vertex.get_count() > 0) {
+        topology._rows_vertex = rows_vertex;
+    }
+    if constexpr (!std::is_same_v<edge_value_t, empty_value>) {
+        if (header.edge_values_offset != 0) {
+            graph_impl.get_edge_values() = wrap_snapshot_array<edge_value_t>(
+                file,
+                header.edge_values_offset,
+                header.edge_value_count);
+        }
+    }
+}
+
+} // namespace oneapi::dal::preview::load_graph::detail
@@ -18,69 +18,336 @@
 
 #include <algorithm>
 #include <atomic>
+#include <cmath>
 #include <fstream>
+#include <limits>
+#include <tuple>
+#include <type_traits>
+#include <vector>
 
 #include "oneapi/dal/detail/threading.hpp"
 #include "oneapi/dal/exceptions.hpp"
 #include "oneapi/dal/graph/common.hpp"
 #include "oneapi/dal/graph/detail/undirected_adjacency_vector_graph_impl.hpp"
 #include "oneapi/dal/graph/undirected_adjacency_vector_graph.hpp"
+#include "oneapi/dal/io/backend/cpu/text_parser.hpp"
+#include "oneapi/dal/io/detail/graph_snapshot.hpp"
 #include "oneapi/dal/io/detail/load_graph_service.hpp"
 #include "oneapi/dal/io/common.hpp"
+#include "oneapi/dal/io/graph_binary_data_source.hpp"
 #include "oneapi/dal/io/graph_csv_data_source.hpp"
 #include "oneapi/dal/io/load_graph_descriptor.hpp"
 
 namespace oneapi::dal::preview::load_graph::detail {
 
-template <typename EdgeList>
-inline void load_edge_list(const std::string &name, EdgeList &elist);
+/// Number of chunks per thread a block is split into to balance the load
+constexpr std::int64_t edge_list_chunks_per_thread = 4;
 
-template <>
-inline void load_edge_list(const std::string &name, edge_list<std::int32_t> &elist) {
-    std::ifstream file(name);
-    if (!file.is_open()) {
-        throw invalid_argument(dal::detail::error_messages::file_not_found());
+/// Minimal number of elements processed in parallel by the prefix sum
+constexpr std::int64_t parallel_prefix_sum_threshold = 1 << 16;
+
+/// Result of parsing a line of the edge list
+enum class edge_line_status { ok, invalid_format, out_of_range };
+
+/// Finds the token that starts at or after `it` within the line [it, end).
+/// Returns false if there are no more tokens in the line.
+inline bool find_token(const char *&it, const char *end, const char *&token_end) {
+    using dal::io::backend::is_blank;
+    while (it != end && is_blank(*it)) {
+        ++it;
+    }
+    token_end = it;
+    while (token_end != end && !is_blank(*token_end)) {
+        ++token_end;
+    }
+    return it != end;
+}
+
+/// Parses the whole token [begin, end) into the value. Integral tokens are
+/// [+-]digits within the range of T, floating-point tokens are parsed by the
+/// text parser and must be finite.
+template <typename T>
+inline edge_line_status parse_token(const char *begin, const char *end, T &value) {
+    if constexpr (std::is_integral_v<T>) {
+        using unsigned_t = std::make_unsigned_t<T>;
+        const char *it = begin;
+        const bool is_negative = (*it == '-');
+        if (*it == '-' || *it == '+') {
+            ++it;
+        }
+        if (it == end) {
+            return edge_line_status::invalid_format;
+        }
+
+        // The largest magnitude of the value with the given sign
+        const unsigned_t limit =
+            is_negative ? unsigned_t(0) - static_cast<unsigned_t>(std::numeric_limits<T>::min())
+                        : static_cast<unsigned_t>(std::numeric_limits<T>::max());
+        unsigned_t magnitude = 0;
+        bool is_overflow = false;
+        for (; it != end; ++it) {
+            const unsigned digit = static_cast<unsigned char>(*it - '0');
+            if (digit >= 10) {
+                return edge_line_status::invalid_format;
+            }
+            is_overflow |= (magnitude > (limit - digit) / 10);
+            magnitude = magnitude * 10 + digit;
+        }
+        if (is_overflow) {
+            return edge_line_status::out_of_range;
+        }
+        value = static_cast<T>(is_negative ? unsigned_t(0) - magnitude : magnitude);
     }
+    else {
+        if (dal::io::backend::parse_number(begin, end, value) != end) {
+            return edge_line_status::invalid_format;
+        }
+        if (!std::isfinite(value)) {
+            return edge_line_status::out_of_range;
+        }
+    }
+    return edge_line_status::ok;
+}
 
-    elist.reserve(1024);
-    char source_vertex[32], destination_vertex[32];
-    while (file >> source_vertex >> destination_vertex) {
-        auto edge = std::make_pair(daal_string_to_int(&source_vertex[0], 0),
-                                   daal_string_to_int(&destination_vertex[0], 0));
-        elist.push_back(edge);
+/// Parses the next token of the line and moves the pointer past it
+template <typename T>
+inline edge_line_status parse_next_token(const char *&it, const char *end, T &value) {
+    const char *token_end;
+    if (!find_token(it, end, token_end)) {
+        return edge_line_status::invalid_format;
     }
+    const edge_line_status status = parse_token(it, token_end, value);
+    it = token_end;
+    return status;
+}
 
-    file.close();
+/// Vertex ids are the non-negative values of the vertex type
+template <typename Vertex>
+inline edge_line_status parse_vertex(const char *&it, const char *end, Vertex &vertex) {
+    const edge_line_status status = parse_next_token(it, end, vertex);
+    return (status == edge_line_status::ok && vertex < 0) ? edge_line_status::out_of_range
+                                                          : status;
 }
 
+/// Checks that there are no tokens left in the line
+inline edge_line_status check_line_end(const char *it, const char *end) {
+    const char *token_end;
+    return find_token(it, end, token_end) ? edge_line_status::invalid_format
+                                          : edge_line_status::ok;
+}
+
+/// Parses the line [it, end) that contains exactly two vertex ids
+template <typename Vertex>
+inline edge_line_status parse_edge(const char *it,
+                                   const char *end,
+                                   std::pair<Vertex, Vertex> &edge) {
+    edge_line_status status = parse_vertex(it, end, edge.first);
+    if (status == edge_line_status::ok) {
+        status = parse_vertex(it, end, edge.second);
+    }
+    return (status == edge_line_status::ok) ? check_line_end(it, end) : status;
+}
+
+/// Parses the line [it, end) that contains exactly two vertex ids and a weight
 template <typename Vertex, typename Weight>
-inline void load_edge_list(const std::string &name, weighted_edge_list<Vertex, Weight> &elist) {
-    std::ifstream file(name);
-    if (!file.is_open()) {
-        throw invalid_argument(dal::detail::error_messages::file_not_found());
+inline edge_line_status parse_edge(const char *it,
+                                   const char *end,
+                                   std::tuple<Vertex, Vertex, Weight> &edge) {
+    edge_line_status status = parse_vertex(it, end, std::get<0>(edge));
+    if (status == edge_line_status::ok) {
+        status = parse_vertex(it, end, std::get<1>(edge));
+    }
+    if (status == edge_line_status::ok) {
+        status = parse_next_token(it, end, std::get<2>(edge));
+    }
+    return (status == edge_line_status::ok) ? check_line_end(it, end) : status;
+}
+
+/// Calls `body(line_begin, line_end)` for every non-empty line in [begin, end).
+/// The line end excludes the newline and the trailing carriage return.
+/// Stops and returns false as soon as `body` returns false.
+template <typename Body>
+inline bool for_each_edge_line(const char *begin, const char *end, Body &&body) {
+    using dal::io::backend::find_line_end;
+    using dal::io::backend::is_empty_line;
+    using dal::io::backend::trim_line_end;
+
+    for (const char *it = begin; it != end;) {
+        const char *line_end = find_line_end(it, end);
+        const char *content_end = trim_line_end(it, line_end);
+        if (!is_empty_line(it, content_end) && !body(it, content_end)) {
+            return false;
+        }
+        it = (line_end == end) ? end : line_end + 1;
     }
+    return true;
+}
+
+/// Returns the number of non-empty lines in [begin, end), every line is one edge
+inline std::int64_t count_edge_lines(const char *begin, const char *end) {
+    std::int64_t line_count = 0;
+    for_each_edge_line(begin, end, [&](const char *, const char *) {
+        ++line_count;
+        return true;
+    });
+    return line_count;
+}
 
-    elist.reserve(1024);
-    char source_vertex[32], destination_vertex[32], edge_value[64];
-    while (file >> source_vertex >> destination_vertex >> edge_value) {
-        auto edge =
-            std::tuple<Vertex, Vertex, Weight>(daal_string_to<Vertex>(&source_vertex[0], 0),
-                                               daal_string_to<Vertex>(&destination_vertex[0], 0),
-                                               daal_string_to<Weight>(&edge_value[0], 0));
-        elist.push_back(edge);
+inline void throw_edge_line_error(edge_line_status status) {
+    if (status == edge_line_status::invalid_format) {
+        throw invalid_argument(dal::detail::error_messages::invalid_edge_list_format());
+    }
+    if (status == edge_line_status::out_of_range) {
+        throw invalid_argument(dal::detail::error_messages::edge_list_value_out_of_range());
+    }
+}
+
+/// Parses the edges of the chunks in parallel directly into the edge list
+/// preserving the order of the edges in the file. Every non-empty line is one
+/// edge, so the chunk offsets are known before parsing. A malformed line
+/// stops the parsing of its chunk, the first error in the file is thrown.
+template <typename Edge, typename Allocator>
+inline void append_edges(const std::vector<const char *> &bounds,
+                         dal::preview::detail::edge_list_container<Edge, Allocator> &elist) {
+    const std::int64_t chunk_count = bounds.size() - 1;
+    std::vector<std::int64_t> chunk_offsets(chunk_count + 1, elist.size());
+
+    dal::detail::threader_for(chunk_count, chunk_count, [&](std::int32_t i) {
+        chunk_offsets[i + 1] = count_edge_lines(bounds[i], bounds[i + 1]);
+    });
+    for (std::int64_t i = 0; i < chunk_count; ++i) {
+        chunk_offsets[i + 1] += chunk_offsets[i];
+    }
+    elist.resize(chunk_offsets[chunk_count]);
+
+    Edge *edges_data = elist.get_mutable_data();
+    std::vector<edge_line_status> chunk_status(chunk_count, edge_line_status::ok);
+    dal::detail::threader_for(chunk_count, chunk_count, [&](std::int32_t i) {
+        std::int64_t j = chunk_offsets[i];
+        for_each_edge_line(bounds[i], bounds[i + 1], [&](const char *begin, const char *end) {
+            chunk_status[i] = parse_edge(begin, end, edges_data[j++]);
+            return chunk_status[i] == edge_line_status::ok;
+        });
+    });
+    for (std::int64_t i = 0; i < chunk_count; ++i) {
+        throw_edge_line_error(chunk_status[i]);
+    }
+}
+
+/// Reads the file by large blocks, splits each block at line boundaries and
+/// parses the chunks in parallel. The edge list is reserved once by the file size
+/// and the density of lines in the first block, so that it is not reallocated
+/// and copied while growing.
+template <typename Edge, typename Allocator>
+inline void load_edges_parallel(const std::string &name,
+                                dal::preview::detail::edge_list_container<Edge, Allocator> &elist) {
+    using dal::io::backend::block_reader;
+    using dal::io::backend::read_block_size;
+    using dal::io::backend::split_by_lines;
+
+    block_reader reader{ name, read_block_size };
+
+    const std::int64_t chunk_count = std::max<std::int64_t>(
+        dal::detail::threader_get_max_threads() * edge_list_chunks_per_thread,
+        1);
+
+    const char *begin, *end;
+    bool is_first_block = true;
+    while (reader.next(begin, end)) {
+        const auto bounds = split_by_lines(begin, end, chunk_count);
+        if (is_first_block && end != begin) {
+            const std::int64_t file_size =
+                std::ifstream(name, std::ios::binary | std::ios::ate).tellg();
+            if (file_size > end - begin) {
+                const double edges_per_byte = double(count_edge_lines(begin, end)) / (end - begin);
+                elist.reserve(std::int64_t(edges_per_byte * file_size * 1.05) + 1);
+            }
+            is_first_block = false;
+        }
+        append_edges(bounds, elist);
     }
-    file.close();
+}
+
+template <typename EdgeList>
+inline void load_edge_list(const std::string &name, EdgeList &elist);
+
+template <>
+inline void load_edge_list(const std::string &name, edge_list<std::int32_t> &elist) {
+    load_edges_parallel(name, elist);
+}
+
+template <typename Vertex, typename Weight>
+inline void load_edge_list(const std::string &name, weighted_edge_list<Vertex, Weight> &elist) {
+    load_edges_parallel(name, elist);
+}
+
+/// Computes exclusive prefix sum of `count` values into `offsets[0..count]`.
+/// The values are summed by blocks in parallel, the block sums are scanned
+/// sequentially and then each block writes its offsets in parallel.
+template <typename Index, typename Value, typename Offset>
+Index parallel_prefix_sum(const Value *values, std::int64_t count, Offset *offsets) {
+    const std::int64_t block_count =
+        (count < parallel_prefix_sum_threshold)
+            ? 1
+            : std::min<std::int64_t>(dal::detail::threader_get_max_threads() *
+                                         edge_list_chunks_per_thread,
+                                     count);
+    const std::int64_t block_size = (count + block_count - 1) / block_count;
+
+    std::vector<Index> block_sums(block_count + 1, 0);
+    dal::detail::threader_for(block_count, block_count, [&](std::int32_t b) {
+        const std::int64_t first = b * block_size;
+        const std::int64_t last = std::min(first + block_size, count);
+        Index sum = 0;
+        for (std::int64_t i = first; i < last; ++i) {
+            sum += static_cast<Index>(values[i]);
+        }
+        block_sums[b + 1] = sum;
+    });
+
+    for (std::int64_t b = 0; b < block_count; ++b) {
+        block_sums[b + 1] += block_sums[b];
+    }
+
+    offsets[0] = 0;
+    dal::detail::threader_for(block_count, block_count, [&](std::int32_t b) {
+        const std::int64_t first = b * block_size;
+        const std::int64_t last = std::min(first + block_size, count);
+        Index sum = block_sums[b];
+        for (std::int64_t i = first; i < last; ++i) {
+            sum += static_cast<Index>(values[i]);
+            offsets[i + 1] = sum;
+        }
+    });
+
+    return block_sums[block_count];
 }
 
 template <typename EdgeList>
 std::int64_t get_vertex_count_from_edge_list(const EdgeList &edges) {
-    auto max_id = std::get<0>(edges[0]);
-    for (std::int64_t i = 0; i < edges.size(); i++) {
-        auto edge_max = std::max(std::get<0>(edges[i]), std::get<1>(edges[i]));
-        max_id = std::max(max_id, edge_max);
+    using vertex_t = std::decay_t<decltype(std::get<0>(edges[0]))>;
+
+    const std::int64_t edge_count = edges.size();
+    if (edge_count == 0) {
+        return 0;
     }
+    const std::int64_t block_count = std::min<std::int64_t>(
+        dal::detail::threader_get_max_threads() * edge_list_chunks_per_thread,
+        edge_count);
+    const std::int64_t block_size = (edge_count + block_count - 1) / block_count;
+
+    std::vector<vertex_t> block_max(block_count, std::get<0>(edges[0]));
+    dal::detail::threader_for(block_count, block_count, [&](std::int32_t b) {
+        const std::int64_t first = b * block_size;
+        const std::int64_t last = std::min(first + block_size, edge_count);
+        vertex_t max_id = std::get<0>(edges[0]);
+        for (std::int64_t i = first; i < last; ++i) {
+            max_id = std::max({ max_id, std::get<0>(edges[i]), std::get<1>(edges[i]) });
+        }
+        block_max[b] = max_id;
+    });
 
-    const std::int64_t vertex_count = max_id + 1;
+    const std::int64_t vertex_count = *std::max_element(block_max.begin(), block_max.end()) + 1;
     return vertex_count;
 }
 
@@ -131,26 +398,14 @@ template <typename EdgeIndex, typename AtomicVertex, typename AtomicEdge>
 EdgeIndex compute_prefix_sum_atomic(const AtomicVertex *degrees,
                                     std::int64_t degrees_count,
                                     AtomicEdge *edge_offsets_atomic) {
-    EdgeIndex total_sum_degrees = 0;
-    edge_offsets_atomic[0] = total_sum_degrees;
-    for (std::int64_t i = 0; i < degrees_count; ++i) {
-        total_sum_degrees += degrees[i].load();
-        edge_offsets_atomic[i + 1] = total_sum_degrees;
-    }
-    return total_sum_degrees;
+    return parallel_prefix_sum<EdgeIndex>(degrees, degrees_count, edge_offsets_atomic);
 }
 
 template <typename EdgeIndex, typename VertexIndex>
 EdgeIndex compute_prefix_sum(const VertexIndex *degrees,
                              std::int64_t degrees_count,
                              EdgeIndex *edge_offsets) {
-    EdgeIndex total_sum_degrees = 0;
-    edge_offsets[0] = total_sum_degrees;
-    for (std::int64_t i = 0; i < degrees_count; ++i) {
-        total_sum_degrees += degrees[i];
-        edge_offsets[i + 1] = total_sum_degrees;
-    }
-    return total_sum_degrees;
+    return parallel_prefix_sum<EdgeIndex>(degrees, degrees_count, edge_offsets);
 }
 
 template <>
@@ -571,4 +826,14 @@ output_type<Descriptor> load_impl(const Descriptor &desc, const DataSource &data
     convert_to_csr_impl(elist, graph);
     return graph;
 }
+
+template <typename Descriptor>
+output_type<Descriptor> load_impl(const Descriptor &desc,
+                                  const graph_binary_data_source &data_source) {
+    using graph_type = output_type<Descriptor>;
+
+    graph_type graph;
+    load_graph_snapshot(data_source.get_filename(), graph, data_source.get_check_topology());
+    return graph;
+}
 } // namespace oneapi::dal::preview::load_graph::detail
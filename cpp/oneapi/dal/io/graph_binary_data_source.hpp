@@ -0,0 +1,52 @@
+/*******************************************************************************
+* Copyright 2020-2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/// @file
+/// Contains the definition of the data source of binary graph snapshots
+
+#pragma once
+
+#include <string>
+
+namespace oneapi::dal::preview {
+
+/// Data source for the binary CSR graph snapshots produced by save_graph::save.
+/// Loading from this data source maps the file into memory and does not copy
+/// the topology arrays. The header and the bounds of the arrays are always
+/// checked on load, the arrays themselves are read only if check_topology is set.
+class ONEDAL_EXPORT graph_binary_data_source {
+public:
+    /// @param filename       The name of the snapshot file
+    /// @param check_topology Whether the offsets and the neighbors of all the vertices
+    ///                       are checked on load. The check reads the whole file.
+    graph_binary_data_source(std::string filename, bool check_topology = false)
+            : _file_name(filename),
+              _check_topology(check_topology) {}
+
+    std::string get_filename() const {
+        return _file_name;
+    }
+
+    bool get_check_topology() const {
+        return _check_topology;
+    }
+
+private:
+    std::string _file_name;
+    bool _check_topology;
+};
+
+} // namespace oneapi::dal::preview
@@ -0,0 +1,363 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <atomic>
+#include <cstring>
+
+#include "oneapi/dal/detail/threading.hpp"
+#include "oneapi/dal/io/libsvm/backend/cpu/read_kernel.hpp"
+#include "oneapi/dal/table/homogen.hpp"
+#include "oneapi/dal/table/detail/csr.hpp"
+
+namespace oneapi::dal::libsvm::backend {
+
+using dal::io::backend::block_reader;
+using dal::io::backend::chunks_per_thread;
+using dal::io::backend::find_line_end;
+using dal::io::backend::is_blank;
+using dal::io::backend::move_to_array;
+using dal::io::backend::parse_index;
+using dal::io::backend::parse_number;
+using dal::io::backend::read_block_size;
+using dal::io::backend::sort_by_column_indices;
+using dal::io::backend::split_by_lines;
+using dal::io::backend::trim_line_end;
+
+/// Returns true if the line has no data, i.e. it is empty or contains a comment only
+static inline bool is_skipped_line(const char* begin, const char* end) {
+    for (const char* it = begin; it != end; ++it) {
+        if (!is_blank(*it)) {
+            return *it == '#';
+        }
+    }
+    return true;
+}
+
+/// Calls `body` for every blank-separated token of the line until the comment starts.
+/// Stops and returns false as soon as `body` returns false.
+template <typename Body>
+static inline bool for_each_token(const char* it, const char* end, Body&& body) {
+    for (;;) {
+        while (it != end && is_blank(*it)) {
+            ++it;
+        }
+        if (it == end || *it == '#') {
+            return true;
+        }
+        const char* token_end = it;
+        while (token_end != end && !is_blank(*token_end)) {
+            ++token_end;
+        }
+        if (!body(it, token_end)) {
+            return false;
+        }
+        it = token_end;
+    }
+}
+
+static inline bool is_query_id(const char* begin, const char* end) {
+    return end - begin > 4 && std::memcmp(begin, "qid:", 4) == 0;
+}
+
+static std::int64_t get_chunk_count() {
+    return std::max<std::int64_t>(dal::detail::threader_get_max_threads() * chunks_per_thread, 1);
+}
+
+/// Counts the rows with data in [begin, end)
+static std::int64_t count_data_rows(const char* begin, const char* end) {
+    std::int64_t row_count = 0;
+    for (const char* it = begin; it < end;) {
+        const char* line_end = find_line_end(it, end);
+        row_count += !is_skipped_line(it, trim_line_end(it, line_end));
+        it = line_end + 1;
+    }
+    return row_count;
+}
+
+/// Returns the end of the first `row_count` rows with data in [begin, end). The rows of
+/// the chunks are counted in parallel, then only the chunk with the last row is scanned.
+static const char* find_rows_end(const char* begin, const char* end, std::int64_t row_count) {
+    const std::int64_t chunk_count = get_chunk_count();
+    const auto bounds = split_by_lines(begin, end, chunk_count);
+    std::vector<std::int64_t> chunk_row_counts(chunk_count);
+    dal::detail::threader_for(chunk_count, chunk_count, [&](std::int32_t i) {
+        chunk_row_counts[i] = count_data_rows(bounds[i], bounds[i + 1]);
+    });
+
+    std::int64_t i = 0;
+    for (; i < chunk_count && row_count > chunk_row_counts[i]; ++i) {
+        row_count -= chunk_row_counts[i];
+    }
+    if (i == chunk_count) {
+        return end;
+    }
+
+    const char* it = bounds[i];
+    while (it < bounds[i + 1] && row_count > 0) {
+        const char* line_end = find_line_end(it, end);
+        row_count -= !is_skipped_line(it, trim_line_end(it, line_end));
+        it = (line_end == end) ? end : line_end + 1;
+    }
+    return it;
+}
+
+/// Returns the largest feature index in the rows with data in [begin, end).
+/// Throws if a feature index is malformed.
+static std::int64_t find_max_column_index(const char* begin,
+                                          const char* end,
+                                          std::int64_t index_shift) {
+    std::int64_t max_column_index = 0;
+    for (const char* it = begin; it < end;) {
+        const char* line_end = find_line_end(it, end);
+        const char* content_end = trim_line_end(it, line_end);
+        if (!is_skipped_line(it, content_end)) {
+            bool is_label = true;
+            const bool is_valid =
+                for_each_token(it, content_end, [&](const char* token, const char* token_end) {
+                    if (is_label || is_query_id(token, token_end)) {
+                        is_label = false;
+                        return true;
+                    }
+                    std::int64_t index;
+                    const char* separator = parse_index(token, token_end, index);
+                    if (!separator || separator == token_end || *separator != ':') {
+                        return false;
+                    }
+                    max_column_index = std::max(max_column_index, index + index_shift);
+                    return true;
+                });
+            if (!is_valid) {
+                throw invalid_argument(dal::detail::error_messages::invalid_libsvm_format());
+            }
+        }
+        it = line_end + 1;
+    }
+    return max_column_index;
+}
+
+/// Counts the rows with data and their features in [begin, end)
+static void count_rows(const char* begin,
+                       const char* end,
+                       std::int64_t& row_count,
+                       std::int64_t& feature_count) {
+    row_count = 0;
+    feature_count = 0;
+    for (const char* it = begin; it < end;) {
+        const char* line_end = find_line_end(it, end);
+        const char* content_end = trim_line_end(it, line_end);
+        if (!is_skipped_line(it, content_end)) {
+            bool is_label = true;
+            for_each_token(it, content_end, [&](const char* token, const char* token_end) {
+                feature_count += !is_label && !is_query_id(token, token_end);
+                is_label = false;
+                return true;
+            });
+            ++row_count;
+        }
+        it = line_end + 1;
+    }
+}
+
+/// Parses the rows with data in [begin, end). The features of every row are written to
+/// `values` and `column_indices`, one-based end offsets of the rows to `row_ends`.
+/// Returns false if a row is not in the libsvm format.
+template <typename Float>
+static bool parse_rows(const char* begin,
+                       const char* end,
+                       std::int64_t index_shift,
+                       std::int64_t first_offset,
+                       Float* labels,
+                       std::int64_t* row_ends,
+                       Float* values,
+                       std::int64_t* column_indices,
+                       std::int64_t& max_column_index) {
+    std::int64_t offset = first_offset;
+    for (const char* it = begin; it < end;) {
+        const char* line_end = find_line_end(it, end);
+        const char* content_end = trim_line_end(it, line_end);
+        if (!is_skipped_line(it, content_end)) {
+            bool is_label = true;
+            std::int64_t feature_count = 0;
+            const bool is_valid =
+                for_each_token(it, content_end, [&](const char* token, const char* token_end) {
+                    if (is_label) {
+                        is_label = false;
+                        return parse_number(token, token_end, *labels) == token_end;
+                    }
+                    if (is_query_id(token, token_end)) {
+                        return true;
+                    }
+                    std::int64_t index;
+                    const char* separator = parse_index(token, token_end, index);
+                    if (!separator || separator == token_end || *separator != ':') {
+                        return false;
+                    }
+                    index += index_shift;
+                    if (index < 1) {
+                        return false;
+                    }
+                    max_column_index = std::max(max_column_index, index);
+                    column_indices[feature_count] = index;
+                    return parse_number(separator + 1, token_end, values[feature_count++]) ==
+                           token_end;
+                });
+            if (!is_valid) {
+                return false;
+            }
+            // The format does not require the features of a row to be ordered
+            sort_by_column_indices(column_indices, values, feature_count);
+            column_indices += feature_count;
+            values += feature_count;
+            offset += feature_count;
+            *row_ends++ = offset;
+            ++labels;
+        }
+        it = line_end + 1;
+    }
+    return true;
+}
+
+template <typename Float>
+row_reader<Float>::row_reader(const detail::data_source_base& ds)
+        : reader_(ds.get_file_name(), read_block_size),
+          column_count_(ds.get_column_count()),
+          index_shift_(ds.get_indexing() == dal::detail::csr_indexing::zero_based ? 1 : 0) {}
+
+template <typename Float>
+void row_reader<Float>::fix_column_count(const detail::data_source_base& ds) {
+    if (column_count_ > 0) {
+        return;
+    }
+    const std::int64_t chunk_count = get_chunk_count();
+    block_reader reader{ ds.get_file_name(), read_block_size };
+    const char *begin, *end;
+    while (reader.next(begin, end)) {
+        const auto bounds = split_by_lines(begin, end, chunk_count);
+        std::vector<std::int64_t> max_column_indices(chunk_count, 0);
+        dal::detail::threader_for(chunk_count, chunk_count, [&](std::int32_t i) {
+            max_column_indices[i] = find_max_column_index(bounds[i], bounds[i + 1], index_shift_);
+        });
+        for (std::int64_t i = 0; i < chunk_count; ++i) {
+            column_count_ = std::max(column_count_, max_column_indices[i]);
+        }
+    }
+    // The rows without features still form a table with a single zero column
+    column_count_ = std::max<std::int64_t>(column_count_, 1);
+}
+
+template <typename Float>
+void row_reader<Float>::append_rows(const char* begin, const char* end) {
+    const std::int64_t chunk_count = get_chunk_count();
+    const auto bounds = split_by_lines(begin, end, chunk_count);
+
+    // The first pass finds the positions of the chunks in the block,
+    // so the second one parses all chunks independently
+    std::vector<std::int64_t> row_offsets(chunk_count + 1, 0);
+    std::vector<std::int64_t> feature_offsets(chunk_count + 1, 0);
+    dal::detail::threader_for(chunk_count, chunk_count, [&](std::int32_t i) {
+        count_rows(bounds[i], bounds[i + 1], row_offsets[i + 1], feature_offsets[i + 1]);
+    });
+    for (std::int64_t i = 0; i < chunk_count; ++i) {
+        row_offsets[i + 1] += row_offsets[i];
+        feature_offsets[i + 1] += feature_offsets[i];
+    }
+
+    const std::int64_t first_row = labels_.size();
+    const std::int64_t first_feature = values_.size();
+    labels_.resize(first_row + row_offsets[chunk_count]);
+    row_indices_.resize(first_row + row_offsets[chunk_count] + 1);
+    values_.resize(first_feature + feature_offsets[chunk_count]);
+    column_indices_.resize(first_feature + feature_offsets[chunk_count]);
+
+    std::atomic<bool> is_valid{ true };
+    std::vector<std::int64_t> max_column_indices(chunk_count, 0);
+    dal::detail::threader_for(chunk_count, chunk_count, [&](std::int32_t i) {
+        const std::int64_t row = first_row + row_offsets[i];
+        const std::int64_t feature = first_feature + feature_offsets[i];
+        if (!parse_rows(bounds[i],
+                        bounds[i + 1],
+                        index_shift_,
+                        feature + 1,
+                        labels_.data() + row,
+                        row_indices_.data() + row + 1,
+                        values_.data() + feature,
+                        column_indices_.data() + feature,
+                        max_column_indices[i])) {
+            is_valid.store(false, std::memory_order_relaxed);
+        }
+    });
+
+    if (!is_valid.load()) {
+        throw invalid_argument(dal::detail::error_messages::invalid_libsvm_format());
+    }
+    for (std::int64_t i = 0; i < chunk_count; ++i) {
+        max_column_index_ = std::max(max_column_index_, max_column_indices[i]);
+    }
+}
+
+template <typename Float>
+read_result row_reader<Float>::read_next(std::int64_t row_count) {
+    labels_.clear();
+    values_.clear();
+    column_indices_.clear();
+    row_indices_.assign(1, 1);
+    max_column_index_ = 0;
+
+    std::int64_t rows_left = row_count;
+    while (rows_left > 0) {
+        if (position_ == end_ && !reader_.next(position_, end_)) {
+            break;
+        }
+        const char* rows_end = find_rows_end(position_, end_, rows_left);
+        append_rows(position_, rows_end);
+        position_ = rows_end;
+        rows_left = row_count - labels_.size();
+    }
+
+    const std::int64_t result_row_count = labels_.size();
+    if (result_row_count == 0) {
+        return read_result{};
+    }
+    if (column_count_ > 0 && max_column_index_ > column_count_) {
+        throw invalid_argument(dal::detail::error_messages::column_index_gt_column_count());
+    }
+    // The rows without features still form a table with a single zero column
+    const std::int64_t column_count =
+        column_count_ > 0 ? column_count_ : std::max<std::int64_t>(max_column_index_, 1);
+
+    const auto data = dal::detail::csr_table{ move_to_array(std::move(values_)),
+                                              move_to_array(std::move(column_indices_)),
+                                              move_to_array(std::move(row_indices_)),
+                                              result_row_count,
+                                              column_count };
+    const auto labels = homogen_table::wrap(move_to_array(std::move(labels_)), result_row_count, 1);
+    return read_result{}.set_data(data).set_labels(labels);
+}
+
+template <typename Object, typename Float>
+read_result read_kernel_cpu<Object, Float>::operator()(const dal::backend::context_cpu& ctx,
+                                                       const detail::data_source_base& ds,
+                                                       const read_args<Object>& args) const {
+    return row_reader<Float>{ ds }.read_next(dal::detail::limits<std::int64_t>::max());
+}
+
+template struct read_kernel_cpu<read_result, float>;
+template struct read_kernel_cpu<read_result, double>;
+
+template class row_reader<float>;
+template class row_reader<double>;
+
+} // namespace oneapi::dal::libsvm::backend
@@ -0,0 +1,62 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include "oneapi/dal/backend/dispatcher.hpp"
+#include "oneapi/dal/io/backend/cpu/text_parser.hpp"
+#include "oneapi/dal/io/libsvm/read_types.hpp"
+
+namespace oneapi::dal::libsvm::backend {
+
+template <typename Object, typename Float>
+struct read_kernel_cpu {
+    read_result operator()(const dal::backend::context_cpu& ctx,
+                           const detail::data_source_base& ds,
+                           const read_args<Object>& args) const;
+};
+
+/// Sequential reader of the file rows. Every call parses the next rows in parallel
+/// and builds the CSR table out of them.
+template <typename Float>
+class row_reader {
+public:
+    explicit row_reader(const detail::data_source_base& ds);
+
+    /// Scans the whole file for the largest feature index if the column count of the data
+    /// source is zero, so all the blocks read afterwards have the same number of columns
+    void fix_column_count(const detail::data_source_base& ds);
+
+    read_result read_next(std::int64_t row_count);
+
+private:
+    /// Parses all rows in [begin, end) and appends them to the current block
+    void append_rows(const char* begin, const char* end);
+
+    io::backend::block_reader reader_;
+    const char* position_ = nullptr;
+    const char* end_ = nullptr;
+    std::int64_t column_count_;
+    std::int64_t index_shift_;
+
+    std::vector<Float> labels_;
+    std::vector<Float> values_;
+    std::vector<std::int64_t> column_indices_;
+    std::vector<std::int64_t> row_indices_;
+    std::int64_t max_column_index_ = 0;
+};
+
+} // namespace oneapi::dal::libsvm::backend
@@ -0,0 +1,61 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <memory>
+
+#include "oneapi/dal/io/libsvm/chunked_reader.hpp"
+#include "oneapi/dal/io/libsvm/backend/cpu/read_kernel.hpp"
+#include "oneapi/dal/exceptions.hpp"
+
+namespace oneapi::dal::libsvm {
+
+class detail::v1::chunked_reader_impl : public base {
+public:
+    chunked_reader_impl(const data_source_base& ds, data_type dtype) {
+        if (dtype == data_type::float64) {
+            double_reader.reset(new backend::row_reader<double>{ ds });
+            double_reader->fix_column_count(ds);
+        }
+        else {
+            float_reader.reset(new backend::row_reader<float>{ ds });
+            float_reader->fix_column_count(ds);
+        }
+    }
+
+    read_result read_next(std::int64_t row_count) {
+        return double_reader ? double_reader->read_next(row_count)
+                             : float_reader->read_next(row_count);
+    }
+
+private:
+    std::unique_ptr<backend::row_reader<float>> float_reader;
+    std::unique_ptr<backend::row_reader<double>> double_reader;
+};
+
+namespace v1 {
+
+chunked_reader::chunked_reader(const detail::data_source_base& ds, data_type dtype)
+        : impl_(new detail::chunked_reader_impl{ ds, dtype }) {}
+
+read_result chunked_reader::read_next(std::int64_t row_count) {
+    if (row_count <= 0) {
+        throw invalid_argument(dal::detail::error_messages::rc_leq_zero());
+    }
+    return impl_->read_next(row_count);
+}
+
+} // namespace v1
+} // namespace oneapi::dal::libsvm
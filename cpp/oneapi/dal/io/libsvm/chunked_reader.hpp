@@ -0,0 +1,61 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include "oneapi/dal/io/libsvm/read_types.hpp"
+
+namespace oneapi::dal::libsvm {
+
+namespace detail {
+namespace v1 {
+class chunked_reader_impl;
+} // namespace v1
+
+using v1::chunked_reader_impl;
+
+} // namespace detail
+
+namespace v1 {
+
+/// Reads a libsvm file by blocks of rows, so the data can be consumed by online
+/// algorithms without loading the whole file. The file stays open while the reader exists.
+class ONEDAL_EXPORT chunked_reader : public base {
+public:
+    /// Opens the file of the data source. If the column count of the data source is zero,
+    /// the file is scanned once to find the largest feature index, so all the blocks
+    /// have the same number of columns.
+    template <typename Float>
+    explicit chunked_reader(const data_source<Float>& ds)
+            : chunked_reader(ds, dal::detail::make_data_type<Float>()) {}
+
+    /// Reads the next block of at most `row_count` rows. The block is parsed in parallel.
+    /// The result with empty tables is returned when the end of the file is reached.
+    ///
+    /// @param [in] row_count  The maximum number of rows in the block
+    read_result read_next(std::int64_t row_count);
+
+private:
+    chunked_reader(const detail::data_source_base& ds, data_type dtype);
+
+    dal::detail::pimpl<detail::chunked_reader_impl> impl_;
+};
+
+} // namespace v1
+
+using v1::chunked_reader;
+
+} // namespace oneapi::dal::libsvm
@@ -0,0 +1,62 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "oneapi/dal/io/libsvm/common.hpp"
+#include "oneapi/dal/exceptions.hpp"
+
+namespace oneapi::dal::libsvm::detail {
+namespace v1 {
+
+class data_source_impl : public base {
+public:
+    std::string file_name = "";
+    std::int64_t column_count = 0;
+    dal::detail::csr_indexing indexing = dal::detail::csr_indexing::one_based;
+};
+
+data_source_base::data_source_base(const char* file_name) : impl_(new data_source_impl{}) {
+    set_file_name_impl(file_name);
+}
+
+const char* data_source_base::get_file_name_impl() const {
+    return impl_->file_name.c_str();
+}
+
+std::int64_t data_source_base::get_column_count_impl() const {
+    return impl_->column_count;
+}
+
+dal::detail::csr_indexing data_source_base::get_indexing_impl() const {
+    return impl_->indexing;
+}
+
+void data_source_base::set_file_name_impl(const char* value) {
+    impl_->file_name = std::string(value);
+}
+
+void data_source_base::set_column_count_impl(std::int64_t value) {
+    if (value < 0) {
+        throw domain_error(dal::detail::error_messages::negative_column_count());
+    }
+    impl_->column_count = value;
+}
+
+void data_source_base::set_indexing_impl(dal::detail::csr_indexing value) {
+    impl_->indexing = value;
+}
+
+} // namespace v1
+} // namespace oneapi::dal::libsvm::detail
@@ -0,0 +1,121 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <string>
+
+#include "oneapi/dal/detail/common.hpp"
+#include "oneapi/dal/table/common.hpp"
+#include "oneapi/dal/table/detail/csr_block.hpp"
+
+namespace oneapi::dal::libsvm {
+
+namespace detail {
+namespace v1 {
+
+struct data_source_tag {};
+class data_source_impl;
+
+class ONEDAL_EXPORT data_source_base : public base {
+public:
+    using tag_t = data_source_tag;
+
+    explicit data_source_base(const char* file_name);
+
+    std::string get_file_name() const {
+        return std::string(get_file_name_impl());
+    }
+
+    std::int64_t get_column_count() const {
+        return get_column_count_impl();
+    }
+
+    dal::detail::csr_indexing get_indexing() const {
+        return get_indexing_impl();
+    }
+
+protected:
+    const char* get_file_name_impl() const;
+    std::int64_t get_column_count_impl() const;
+    dal::detail::csr_indexing get_indexing_impl() const;
+
+    void set_file_name_impl(const char*);
+    void set_column_count_impl(std::int64_t value);
+    void set_indexing_impl(dal::detail::csr_indexing value);
+
+    dal::detail::pimpl<data_source_impl> impl_;
+};
+
+} // namespace v1
+
+using v1::data_source_tag;
+using v1::data_source_impl;
+using v1::data_source_base;
+
+} // namespace detail
+
+namespace v1 {
+
+/// Data source for files in the libsvm format, where every line has the form
+/// ``label index:value index:value ...``. Only the non-zero features are stored in the file,
+/// so the features are read into a table in the CSR format.
+///
+/// @tparam Float The floating-point type of the features and the labels in the resulting
+///               tables. Can be :expr:`float` or :expr:`double`.
+template <typename Float = float>
+class data_source : public detail::data_source_base {
+    static_assert(dal::detail::is_one_of_v<Float, float, double>,
+                  "libsvm data source supports only float and double types");
+
+public:
+    using float_t = Float;
+
+    explicit data_source(const char* file_name) : data_source_base(file_name) {}
+
+    explicit data_source(const std::string& file_name) : data_source_base(file_name.c_str()) {}
+
+    auto& set_file_name(const char* value) {
+        set_file_name_impl(value);
+        return *this;
+    }
+
+    auto& set_file_name(const std::string& value) {
+        set_file_name_impl(value.c_str());
+        return *this;
+    }
+
+    /// The number of columns in the resulting table. If zero, the number of columns
+    /// is the largest feature index found in the data read.
+    /// @remark default = 0
+    auto& set_column_count(std::int64_t value) {
+        set_column_count_impl(value);
+        return *this;
+    }
+
+    /// The indexing of features in the file, the resulting table is always one-based
+    /// @remark default = dal::detail::csr_indexing::one_based
+    auto& set_indexing(dal::detail::csr_indexing value) {
+        set_indexing_impl(value);
+        return *this;
+    }
+};
+
+} // namespace v1
+
+using v1::data_source;
+
+} // namespace oneapi::dal::libsvm
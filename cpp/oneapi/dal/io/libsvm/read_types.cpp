@@ -0,0 +1,58 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "oneapi/dal/io/libsvm/read_types.hpp"
+#include "oneapi/dal/detail/common.hpp"
+#include "oneapi/dal/table/common.hpp"
+
+namespace oneapi::dal::libsvm {
+
+template <>
+class detail::v1::read_args_impl<read_result> : public base {
+public:
+    read_args_impl() {}
+};
+
+class detail::v1::read_result_impl : public base {
+public:
+    table data;
+    table labels;
+};
+
+namespace v1 {
+
+read_args<read_result>::read_args() : impl_(new detail::read_args_impl<read_result>()) {}
+
+read_result::read_result() : impl_(new detail::read_result_impl{}) {}
+
+const table& read_result::get_data() const {
+    return impl_->data;
+}
+
+const table& read_result::get_labels() const {
+    return impl_->labels;
+}
+
+void read_result::set_data_impl(const table& value) {
+    impl_->data = value;
+}
+
+void read_result::set_labels_impl(const table& value) {
+    impl_->labels = value;
+}
+
+} // namespace v1
+} // namespace oneapi::dal::libsvm
@@ -0,0 +1,84 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include "oneapi/dal/io/libsvm/common.hpp"
+
+namespace oneapi::dal::libsvm {
+
+namespace detail {
+namespace v1 {
+template <typename Object>
+class read_args_impl;
+class read_result_impl;
+} // namespace v1
+
+using v1::read_args_impl;
+using v1::read_result_impl;
+
+} // namespace detail
+
+namespace v1 {
+
+/// Contents of a libsvm file or of a block of its rows
+class ONEDAL_EXPORT read_result : public base {
+public:
+    /// Creates a new instance of the class with empty tables
+    read_result();
+
+    /// The table of size [row_count x column_count] with the features in the CSR format
+    const table& get_data() const;
+
+    auto& set_data(const table& value) {
+        set_data_impl(value);
+        return *this;
+    }
+
+    /// The table of size [row_count x 1] with the labels
+    const table& get_labels() const;
+
+    auto& set_labels(const table& value) {
+        set_labels_impl(value);
+        return *this;
+    }
+
+protected:
+    void set_data_impl(const table& value);
+    void set_labels_impl(const table& value);
+
+private:
+    dal::detail::pimpl<detail::read_result_impl> impl_;
+};
+
+template <typename Object = read_result>
+class read_args;
+
+template <>
+class ONEDAL_EXPORT read_args<read_result> : public base {
+public:
+    read_args();
+
+private:
+    dal::detail::pimpl<detail::read_args_impl<read_result>> impl_;
+};
+
+} // namespace v1
+
+using v1::read_result;
+using v1::read_args;
+
+} // namespace oneapi::dal::libsvm
@@ -0,0 +1,211 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "oneapi/dal/io/libsvm.hpp"
+#include "oneapi/dal/table/detail/csr.hpp"
+#include "oneapi/dal/table/row_accessor.hpp"
+#include "oneapi/dal/test/engine/common.hpp"
+
+namespace oneapi::dal::libsvm::test {
+
+namespace de = dal::detail;
+
+class temp_libsvm_file {
+public:
+    temp_libsvm_file(const std::string& name, const std::string& content) : name_(name) {
+        std::ofstream file(name_, std::ios::binary);
+        file << content;
+    }
+
+    ~temp_libsvm_file() {
+        std::remove(name_.c_str());
+    }
+
+    const std::string& get_name() const {
+        return name_;
+    }
+
+private:
+    std::string name_;
+};
+
+/// Rows of a CSR table with the zero-based column indices
+template <typename Float>
+struct csr_rows {
+    std::vector<std::int64_t> row_indices;
+    std::vector<std::int64_t> column_indices;
+    std::vector<Float> values;
+};
+
+template <typename Float>
+static csr_rows<Float> pull_csr(const table& t) {
+    REQUIRE(t.get_kind() == de::csr_table::kind());
+    REQUIRE(t.get_metadata().get_data_type(0) == de::make_data_type<Float>());
+    const auto& csr = static_cast<const de::csr_table&>(t);
+    const std::int64_t* row_indices = csr.get_row_indices();
+    const std::int64_t element_count = row_indices[t.get_row_count()] - 1;
+
+    csr_rows<Float> rows;
+    rows.row_indices.assign(row_indices, row_indices + t.get_row_count() + 1);
+    for (std::int64_t i = 0; i < element_count; ++i) {
+        rows.column_indices.push_back(csr.get_column_indices()[i] - 1);
+    }
+    rows.values.assign(csr.get_data<Float>(), csr.get_data<Float>() + element_count);
+    return rows;
+}
+
+template <typename Float>
+static std::vector<Float> pull_labels(const table& t) {
+    const auto arr = row_accessor<const Float>{ t }.pull();
+    return std::vector<Float>(arr.get_data(), arr.get_data() + arr.get_count());
+}
+
+/// Generates a file with `row_count` rows, the row `i` holds the features
+/// (i % 7 + 1):i and (i % 5 + 10):-i listed in the reverse order
+static std::string generate_rows(std::int64_t row_count) {
+    std::string content;
+    for (std::int64_t i = 0; i < row_count; ++i) {
+        content += std::to_string(i % 2) + " " + std::to_string(i % 5 + 10) + ":" +
+                   std::to_string(-i) + " " + std::to_string(i % 7 + 1) + ":" +
+                   std::to_string(i) + "\n";
+        if (i % 100 == 0) {
+            content += "# comment\n\n";
+        }
+    }
+    return content;
+}
+
+TEST("read libsvm file with comments and query ids", "[libsvm]") {
+    const temp_libsvm_file file{ "libsvm_read_test_basic.txt",
+                                 "# header comment\n"
+                                 "1 qid:3 1:0.5 4:-2 # trailing comment\r\n"
+                                 "\n"
+                                 "-1\n"
+                                 "0.25 2:1e2\n" };
+
+    const auto result = read<read_result>(data_source{ file.get_name() });
+
+    REQUIRE(result.get_data().get_row_count() == 3);
+    REQUIRE(result.get_data().get_column_count() == 4);
+    const auto rows = pull_csr<float>(result.get_data());
+    REQUIRE(rows.row_indices == std::vector<std::int64_t>{ 1, 3, 3, 4 });
+    REQUIRE(rows.column_indices == std::vector<std::int64_t>{ 0, 3, 1 });
+    REQUIRE(rows.values == std::vector<float>{ 0.5f, -2.f, 100.f });
+    REQUIRE(pull_labels<float>(result.get_labels()) == std::vector<float>{ 1.f, -1.f, 0.25f });
+}
+
+TEST("read libsvm file sorts features within rows", "[libsvm]") {
+    const temp_libsvm_file file{ "libsvm_read_test_unsorted.txt",
+                                 "1 5:5 1:1 3:3\n"
+                                 "2 2:2 1:1\n" };
+
+    const auto result = read<read_result>(data_source{ file.get_name() });
+
+    const auto rows = pull_csr<float>(result.get_data());
+    REQUIRE(rows.row_indices == std::vector<std::int64_t>{ 1, 4, 6 });
+    REQUIRE(rows.column_indices == std::vector<std::int64_t>{ 0, 2, 4, 0, 1 });
+    REQUIRE(rows.values == std::vector<float>{ 1.f, 3.f, 5.f, 1.f, 2.f });
+}
+
+TEST("read libsvm file in double precision", "[libsvm]") {
+    const temp_libsvm_file file{ "libsvm_read_test_double.txt", "0.1 1:0.1 2:1e-300\n" };
+
+    const auto result = read<read_result>(data_source<double>{ file.get_name() });
+
+    const auto rows = pull_csr<double>(result.get_data());
+    REQUIRE(rows.values == std::vector<double>{ 0.1, 1e-300 });
+    REQUIRE(result.get_labels().get_metadata().get_data_type(0) == data_type::float64);
+    REQUIRE(pull_labels<double>(result.get_labels()) == std::vector<double>{ 0.1 });
+}
+
+TEST("read libsvm file with zero-based indices and fixed column count", "[libsvm]") {
+    const temp_libsvm_file file{ "libsvm_read_test_zero_based.txt", "1 0:1 2:3\n0 1:2\n" };
+
+    const auto result =
+        read<read_result>(data_source{ file.get_name() }
+                              .set_indexing(de::csr_indexing::zero_based)
+                              .set_column_count(10));
+
+    REQUIRE(result.get_data().get_column_count() == 10);
+    const auto rows = pull_csr<float>(result.get_data());
+    REQUIRE(rows.column_indices == std::vector<std::int64_t>{ 0, 2, 1 });
+}
+
+TEST("read libsvm file rejects invalid rows", "[libsvm]") {
+    const std::string file_name = "libsvm_read_test_invalid.txt";
+    for (const std::string content : { "1 2\n",
+                                       "1 a:2\n",
+                                       "1 2:x\n",
+                                       "x 1:2\n",
+                                       "1 0:2\n",
+                                       "1 99999999999999999999:1\n" }) {
+        CAPTURE(content);
+        const temp_libsvm_file file{ file_name, content };
+        REQUIRE_THROWS_AS(read<read_result>(data_source{ file_name }), invalid_argument);
+    }
+
+    const temp_libsvm_file file{ file_name, "1 5:1\n" };
+    REQUIRE_THROWS_AS(read<read_result>(data_source{ file_name }.set_column_count(4)),
+                      invalid_argument);
+}
+
+TEST("chunked libsvm reader returns uneven blocks with the same column count", "[libsvm]") {
+    const std::int64_t row_count = 1000;
+    const std::int64_t block_size = 333;
+    // The largest index is in the last row only
+    const temp_libsvm_file file{ "libsvm_read_test_chunked.txt",
+                                 generate_rows(row_count) + "1 20:1\n" };
+
+    const auto full = read<read_result>(data_source{ file.get_name() });
+    const auto full_rows = pull_csr<float>(full.get_data());
+    const auto full_labels = pull_labels<float>(full.get_labels());
+    REQUIRE(full.get_data().get_row_count() == row_count + 1);
+    REQUIRE(full.get_data().get_column_count() == 20);
+
+    chunked_reader reader{ data_source{ file.get_name() } };
+    std::int64_t first_row = 0;
+    for (;;) {
+        const auto block = reader.read_next(block_size);
+        if (block.get_data().get_row_count() == 0) {
+            break;
+        }
+        const std::int64_t block_row_count = block.get_data().get_row_count();
+        REQUIRE(block_row_count == std::min(block_size, row_count + 1 - first_row));
+        REQUIRE(block.get_data().get_column_count() == 20);
+
+        const auto rows = pull_csr<float>(block.get_data());
+        const auto labels = pull_labels<float>(block.get_labels());
+        const std::int64_t first_element = full_rows.row_indices[first_row] - 1;
+        for (std::int64_t i = 0; i < block_row_count; ++i) {
+            REQUIRE(labels[i] == full_labels[first_row + i]);
+            REQUIRE(rows.row_indices[i + 1] - 1 ==
+                    full_rows.row_indices[first_row + i + 1] - 1 - first_element);
+        }
+        for (std::size_t k = 0; k < rows.values.size(); ++k) {
+            REQUIRE(rows.column_indices[k] == full_rows.column_indices[first_element + k]);
+            REQUIRE(rows.values[k] == full_rows.values[first_element + k]);
+        }
+        first_row += block_row_count;
+    }
+    REQUIRE(first_row == row_count + 1);
+}
+
+} // namespace oneapi::dal::libsvm::test
@@ -20,6 +20,7 @@
 #pragma once
 
 #include "oneapi/dal/io/detail/load_graph.hpp"
+#include "oneapi/dal/io/graph_binary_data_source.hpp"
 #include "oneapi/dal/io/graph_csv_data_source.hpp"
 #include "oneapi/dal/io/load_graph_descriptor.hpp"
 
@@ -0,0 +1,425 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <atomic>
+#include <cctype>
+#include <string>
+#include <vector>
+
+#include "oneapi/dal/detail/threading.hpp"
+#include "oneapi/dal/io/backend/cpu/text_parser.hpp"
+#include "oneapi/dal/io/matrix_market/backend/cpu/read_kernel.hpp"
+#include "oneapi/dal/table/detail/csr.hpp"
+
+namespace oneapi::dal::matrix_market::backend {
+
+using dal::io::backend::block_reader;
+using dal::io::backend::chunks_per_thread;
+using dal::io::backend::find_line_end;
+using dal::io::backend::is_blank;
+using dal::io::backend::move_to_array;
+using dal::io::backend::parse_index;
+using dal::io::backend::parse_number;
+using dal::io::backend::read_block_size;
+using dal::io::backend::sort_by_column_indices;
+using dal::io::backend::split_by_lines;
+using dal::io::backend::trim_line_end;
+
+using error_msg = dal::detail::error_messages;
+
+enum class field_kind { real, integer, pattern };
+enum class symmetry_kind { general, symmetric, skew_symmetric };
+
+struct matrix_header {
+    field_kind field = field_kind::real;
+    symmetry_kind symmetry = symmetry_kind::general;
+    std::int64_t row_count = 0;
+    std::int64_t column_count = 0;
+    std::int64_t entry_count = 0;
+};
+
+static inline const char* skip_blanks(const char* it, const char* end) {
+    while (it != end && is_blank(*it)) {
+        ++it;
+    }
+    return it;
+}
+
+/// Returns true if the line has no data, i.e. it is empty or contains a comment only
+static inline bool is_skipped_line(const char* begin, const char* end) {
+    const char* it = skip_blanks(begin, end);
+    return it == end || *it == '%';
+}
+
+/// Splits the line into blank-separated tokens converted to lower case
+static std::vector<std::string> split_lowercase(const char* it, const char* end) {
+    std::vector<std::string> tokens;
+    for (it = skip_blanks(it, end); it != end; it = skip_blanks(it, end)) {
+        std::string token;
+        for (; it != end && !is_blank(*it); ++it) {
+            token.push_back(static_cast<char>(std::tolower(static_cast<unsigned char>(*it))));
+        }
+        tokens.push_back(std::move(token));
+    }
+    return tokens;
+}
+
+static void parse_banner(const char* begin, const char* end, matrix_header& header) {
+    const auto tokens = split_lowercase(begin, end);
+    if (tokens.size() != 5 || tokens[0] != "%%matrixmarket" || tokens[1] != "matrix") {
+        throw invalid_argument(error_msg::invalid_matrix_market_format());
+    }
+
+    if (tokens[2] != "coordinate") {
+        throw invalid_argument(error_msg::unsupported_matrix_market_format());
+    }
+
+    if (tokens[3] == "real" || tokens[3] == "double") {
+        header.field = field_kind::real;
+    }
+    else if (tokens[3] == "integer") {
+        header.field = field_kind::integer;
+    }
+    else if (tokens[3] == "pattern") {
+        header.field = field_kind::pattern;
+    }
+    else {
+        throw invalid_argument(error_msg::unsupported_matrix_market_format());
+    }
+
+    if (tokens[4] == "general") {
+        header.symmetry = symmetry_kind::general;
+    }
+    else if (tokens[4] == "symmetric") {
+        header.symmetry = symmetry_kind::symmetric;
+    }
+    else if (tokens[4] == "skew-symmetric") {
+        header.symmetry = symmetry_kind::skew_symmetric;
+    }
+    else {
+        throw invalid_argument(error_msg::unsupported_matrix_market_format());
+    }
+}
+
+static void parse_size(const char* it, const char* end, matrix_header& header) {
+    std::int64_t* sizes[] = { &header.row_count, &header.column_count, &header.entry_count };
+    for (std::int64_t* size : sizes) {
+        it = parse_index(skip_blanks(it, end), end, *size);
+        if (!it) {
+            throw invalid_argument(error_msg::invalid_matrix_market_format());
+        }
+    }
+    if (skip_blanks(it, end) != end) {
+        throw invalid_argument(error_msg::invalid_matrix_market_format());
+    }
+}
+
+/// Parses the banner and the size line. On return [begin, end) holds the rest of the
+/// current file block.
+static matrix_header read_header(block_reader& reader, const char*& begin, const char*& end) {
+    matrix_header header;
+    bool has_banner = false;
+    for (;;) {
+        if (begin == end && !reader.next(begin, end)) {
+            throw invalid_argument(error_msg::invalid_matrix_market_format());
+        }
+        const char* line_end = find_line_end(begin, end);
+        const char* content_end = trim_line_end(begin, line_end);
+        const char* line = begin;
+        begin = (line_end == end) ? end : line_end + 1;
+
+        // The banner is the first line of the file, comments may follow it
+        if (!has_banner) {
+            parse_banner(line, content_end, header);
+            has_banner = true;
+        }
+        else if (!is_skipped_line(line, content_end)) {
+            parse_size(line, content_end, header);
+            return header;
+        }
+    }
+}
+
+static std::int64_t count_entries(const char* begin, const char* end) {
+    std::int64_t entry_count = 0;
+    for (const char* it = begin; it < end;) {
+        const char* line_end = find_line_end(it, end);
+        entry_count += !is_skipped_line(it, trim_line_end(it, line_end));
+        it = line_end + 1;
+    }
+    return entry_count;
+}
+
+/// Parses the entries of the form ``row column [value]`` in [begin, end).
+/// Returns false if an entry is malformed or its indices are out of the matrix.
+template <typename Float>
+static bool parse_entries(const char* begin,
+                          const char* end,
+                          const matrix_header& header,
+                          std::int64_t* rows,
+                          std::int64_t* columns,
+                          Float* values) {
+    for (const char* it = begin; it < end;) {
+        const char* line_end = find_line_end(it, end);
+        const char* content_end = trim_line_end(it, line_end);
+        if (!is_skipped_line(it, content_end)) {
+            const char* field = parse_index(skip_blanks(it, content_end), content_end, *rows);
+            if (!field || field == content_end || !is_blank(*field)) {
+                return false;
+            }
+            field = parse_index(skip_blanks(field, content_end), content_end, *columns);
+            if (!field) {
+                return false;
+            }
+            if (header.field == field_kind::pattern) {
+                *values = Float(1);
+                field = skip_blanks(field, content_end);
+            }
+            else if (field == content_end || !is_blank(*field)) {
+                return false;
+            }
+            else {
+                field = parse_number(field, content_end, *values);
+            }
+            if (field != content_end || *rows < 1 || *rows > header.row_count ||
+                *columns < 1 || *columns > header.column_count) {
+                return false;
+            }
+            ++rows;
+            ++columns;
+            ++values;
+        }
+        it = line_end + 1;
+    }
+    return true;
+}
+
+static std::int64_t get_chunk_count() {
+    return std::max<std::int64_t>(dal::detail::threader_get_max_threads() * chunks_per_thread, 1);
+}
+
+/// Checks that the entries fit into the matrix: every element is stored once at most,
+/// and the symmetric matrices are square
+static void check_header(const matrix_header& header) {
+    if (header.symmetry != symmetry_kind::general && header.row_count != header.column_count) {
+        throw invalid_argument(error_msg::invalid_matrix_market_format());
+    }
+    const bool is_size_overflow =
+        header.column_count > 0 &&
+        header.row_count > dal::detail::limits<std::int64_t>::max() / header.column_count;
+    if (!is_size_overflow && header.entry_count > header.row_count * header.column_count) {
+        throw invalid_argument(error_msg::invalid_matrix_market_format());
+    }
+}
+
+/// Calls `body(first, last)` for the ranges [first, last) that split [0, count)
+/// into the chunks processed in parallel
+template <typename Body>
+static void for_each_range(std::int64_t count, Body&& body) {
+    const std::int64_t chunk_count = get_chunk_count();
+    dal::detail::threader_for(chunk_count, chunk_count, [&](std::int32_t i) {
+        body(count * i / chunk_count, count * (i + 1) / chunk_count);
+    });
+}
+
+/// Returns true if the entries are ordered by rows, so they already form the CSR layout
+static bool is_sorted_by_rows(const std::vector<std::int64_t>& rows) {
+    std::atomic<bool> is_sorted{ true };
+    for_each_range(rows.size(), [&](std::int64_t first, std::int64_t last) {
+        for (std::int64_t k = std::max<std::int64_t>(first, 1); k < last; ++k) {
+            if (rows[k] < rows[k - 1]) {
+                is_sorted.store(false, std::memory_order_relaxed);
+                return;
+            }
+        }
+    });
+    return is_sorted.load();
+}
+
+/// Turns the counts stored in offsets[1] ... offsets[count] into one-based offsets.
+/// The counts are summed in chunks in parallel, then the chunk sums are propagated.
+static void counts_to_offsets(std::vector<std::int64_t>& offsets) {
+    const std::int64_t count = offsets.size() - 1;
+    const std::int64_t chunk_count = get_chunk_count();
+    std::vector<std::int64_t> chunk_sums(chunk_count + 1, 0);
+    dal::detail::threader_for(chunk_count, chunk_count, [&](std::int32_t i) {
+        const std::int64_t last = count * (i + 1) / chunk_count;
+        for (std::int64_t k = count * i / chunk_count + 1; k <= last; ++k) {
+            chunk_sums[i + 1] += offsets[k];
+        }
+    });
+    chunk_sums[0] = 1;
+    for (std::int64_t i = 0; i < chunk_count; ++i) {
+        chunk_sums[i + 1] += chunk_sums[i];
+    }
+    offsets[0] = 1;
+    dal::detail::threader_for(chunk_count, chunk_count, [&](std::int32_t i) {
+        const std::int64_t last = count * (i + 1) / chunk_count;
+        std::int64_t offset = chunk_sums[i];
+        for (std::int64_t k = count * i / chunk_count + 1; k <= last; ++k) {
+            offset += offsets[k];
+            offsets[k] = offset;
+        }
+    });
+}
+
+/// Sorts the elements of every row by columns
+template <typename Float>
+static void sort_rows(const std::vector<std::int64_t>& row_indices,
+                      std::int64_t* columns,
+                      Float* values) {
+    for_each_range(row_indices.size() - 1, [&](std::int64_t first, std::int64_t last) {
+        for (std::int64_t i = first; i < last; ++i) {
+            const std::int64_t offset = row_indices[i] - 1;
+            sort_by_column_indices(columns + offset,
+                                   values + offset,
+                                   row_indices[i + 1] - row_indices[i]);
+        }
+    });
+}
+
+template <typename Float>
+static table read_matrix_market(const detail::data_source_base& ds) {
+    block_reader reader{ ds.get_file_name(), read_block_size };
+    const char *begin = nullptr, *end = nullptr;
+    const matrix_header header = read_header(reader, begin, end);
+    check_header(header);
+
+    // The storage grows with the entries actually read, the header is not trusted
+    // for the allocation
+    std::vector<std::int64_t> rows;
+    std::vector<std::int64_t> columns;
+    std::vector<Float> values;
+
+    // Every file block is parsed in two passes: the first one counts the entries
+    // in the chunks of the block, the second one parses the chunks independently
+    const std::int64_t chunk_count = get_chunk_count();
+    std::vector<std::int64_t> entry_offsets(chunk_count + 1);
+    std::int64_t entry_count = 0;
+    do {
+        const auto bounds = split_by_lines(begin, end, chunk_count);
+        entry_offsets[0] = entry_count;
+        dal::detail::threader_for(chunk_count, chunk_count, [&](std::int32_t i) {
+            entry_offsets[i + 1] = count_entries(bounds[i], bounds[i + 1]);
+        });
+        for (std::int64_t i = 0; i < chunk_count; ++i) {
+            entry_offsets[i + 1] += entry_offsets[i];
+        }
+        if (entry_offsets[chunk_count] > header.entry_count) {
+            throw invalid_argument(error_msg::invalid_matrix_market_format());
+        }
+        rows.resize(entry_offsets[chunk_count]);
+        columns.resize(entry_offsets[chunk_count]);
+        values.resize(entry_offsets[chunk_count]);
+
+        std::atomic<bool> is_valid{ true };
+        dal::detail::threader_for(chunk_count, chunk_count, [&](std::int32_t i) {
+            const std::int64_t offset = entry_offsets[i];
+            if (!parse_entries(bounds[i],
+                               bounds[i + 1],
+                               header,
+                               rows.data() + offset,
+                               columns.data() + offset,
+                               values.data() + offset)) {
+                is_valid.store(false, std::memory_order_relaxed);
+            }
+        });
+        if (!is_valid.load()) {
+            throw invalid_argument(error_msg::invalid_matrix_market_format());
+        }
+        entry_count = entry_offsets[chunk_count];
+    } while (reader.next(begin, end));
+
+    if (entry_count != header.entry_count) {
+        throw invalid_argument(error_msg::invalid_matrix_market_format());
+    }
+    if (header.row_count == 0 || header.column_count == 0) {
+        return table{};
+    }
+
+    const bool is_general = (header.symmetry == symmetry_kind::general);
+    const auto is_mirrored = [&](std::int64_t k) {
+        return !is_general && rows[k] != columns[k];
+    };
+
+    // One-based offsets of the rows, the entries below the diagonal of symmetric
+    // matrices are mirrored above it
+    std::vector<std::int64_t> row_indices(header.row_count + 1, 0);
+    for_each_range(entry_count, [&](std::int64_t first, std::int64_t last) {
+        for (std::int64_t k = first; k < last; ++k) {
+            dal::detail::atomic_increment(row_indices[rows[k]]);
+            if (is_mirrored(k)) {
+                dal::detail::atomic_increment(row_indices[columns[k]]);
+            }
+        }
+    });
+    counts_to_offsets(row_indices);
+
+    if (is_general && is_sorted_by_rows(rows)) {
+        sort_rows(row_indices, columns.data(), values.data());
+        return dal::detail::csr_table{ move_to_array(std::move(values)),
+                                       move_to_array(std::move(columns)),
+                                       move_to_array(std::move(row_indices)),
+                                       header.row_count,
+                                       header.column_count };
+    }
+
+    // The entries are scattered to their rows in parallel, so the order of the elements
+    // within a row is arbitrary until the rows are sorted
+    const std::int64_t element_count = row_indices[header.row_count] - 1;
+    std::vector<Float> csr_values(element_count);
+    std::vector<std::int64_t> csr_columns(element_count);
+    std::vector<std::atomic<std::int64_t>> positions(header.row_count);
+    for_each_range(header.row_count, [&](std::int64_t first, std::int64_t last) {
+        for (std::int64_t i = first; i < last; ++i) {
+            positions[i].store(row_indices[i] - 1, std::memory_order_relaxed);
+        }
+    });
+    const Float mirror_sign = (header.symmetry == symmetry_kind::skew_symmetric) ? -1 : 1;
+    for_each_range(entry_count, [&](std::int64_t first, std::int64_t last) {
+        for (std::int64_t k = first; k < last; ++k) {
+            const std::int64_t position =
+                positions[rows[k] - 1].fetch_add(1, std::memory_order_relaxed);
+            csr_values[position] = values[k];
+            csr_columns[position] = columns[k];
+            if (is_mirrored(k)) {
+                const std::int64_t mirrored_position =
+                    positions[columns[k] - 1].fetch_add(1, std::memory_order_relaxed);
+                csr_values[mirrored_position] = mirror_sign * values[k];
+                csr_columns[mirrored_position] = rows[k];
+            }
+        }
+    });
+    sort_rows(row_indices, csr_columns.data(), csr_values.data());
+
+    return dal::detail::csr_table{ move_to_array(std::move(csr_values)),
+                                   move_to_array(std::move(csr_columns)),
+                                   move_to_array(std::move(row_indices)),
+                                   header.row_count,
+                                   header.column_count };
+}
+
+template <typename Object, typename Float>
+table read_kernel_cpu<Object, Float>::operator()(const dal::backend::context_cpu& ctx,
+                                                 const detail::data_source_base& ds,
+                                                 const read_args<Object>& args) const {
+    return read_matrix_market<Float>(ds);
+}
+
+template struct read_kernel_cpu<table, float>;
+template struct read_kernel_cpu<table, double>;
+
+} // namespace oneapi::dal::matrix_market::backend
@@ -0,0 +1,188 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "oneapi/dal/io/matrix_market.hpp"
+#include "oneapi/dal/table/detail/csr.hpp"
+#include "oneapi/dal/test/engine/common.hpp"
+
+namespace oneapi::dal::matrix_market::test {
+
+namespace de = dal::detail;
+
+class temp_matrix_file {
+public:
+    temp_matrix_file(const std::string& name, const std::string& content) : name_(name) {
+        std::ofstream file(name_, std::ios::binary);
+        file << content;
+    }
+
+    ~temp_matrix_file() {
+        std::remove(name_.c_str());
+    }
+
+    const std::string& get_name() const {
+        return name_;
+    }
+
+private:
+    std::string name_;
+};
+
+/// Rows of a CSR table with the zero-based column indices
+template <typename Float>
+struct csr_rows {
+    std::vector<std::int64_t> row_indices;
+    std::vector<std::int64_t> column_indices;
+    std::vector<Float> values;
+};
+
+template <typename Float>
+static csr_rows<Float> pull_csr(const table& t) {
+    REQUIRE(t.get_kind() == de::csr_table::kind());
+    REQUIRE(t.get_metadata().get_data_type(0) == de::make_data_type<Float>());
+    const auto& csr = static_cast<const de::csr_table&>(t);
+    const std::int64_t* row_indices = csr.get_row_indices();
+    const std::int64_t element_count = row_indices[t.get_row_count()] - 1;
+
+    csr_rows<Float> rows;
+    rows.row_indices.assign(row_indices, row_indices + t.get_row_count() + 1);
+    for (std::int64_t i = 0; i < element_count; ++i) {
+        rows.column_indices.push_back(csr.get_column_indices()[i] - 1);
+    }
+    rows.values.assign(csr.get_data<Float>(), csr.get_data<Float>() + element_count);
+    return rows;
+}
+
+TEST("read general matrix sorted by rows", "[matrix_market]") {
+    const temp_matrix_file file{ "matrix_market_read_test_general.mtx",
+                                 "%%MatrixMarket matrix coordinate real general\n"
+                                 "% comment\n"
+                                 "3 4 4\n"
+                                 "1 4 1.5\n"
+                                 "1 2 -2\n"
+                                 "3 1 3e1\r\n"
+                                 "3 3 4\n" };
+
+    const auto t = read<table>(data_source{ file.get_name() });
+
+    REQUIRE(t.get_row_count() == 3);
+    REQUIRE(t.get_column_count() == 4);
+    const auto rows = pull_csr<float>(t);
+    REQUIRE(rows.row_indices == std::vector<std::int64_t>{ 1, 3, 3, 5 });
+    REQUIRE(rows.column_indices == std::vector<std::int64_t>{ 1, 3, 0, 2 });
+    REQUIRE(rows.values == std::vector<float>{ -2.f, 1.5f, 30.f, 4.f });
+}
+
+TEST("read general matrix in any order", "[matrix_market]") {
+    // The row r has the columns 1 ... r % 4 + 1 with the values 10 * r + c, the rows and
+    // the columns within the rows come in the descending order
+    const std::int64_t row_count = 300;
+    const auto get_row_size = [](std::int64_t r) {
+        return r % 4 + 1;
+    };
+    std::string entries;
+    std::int64_t entry_count = 0;
+    for (std::int64_t r = row_count; r >= 1; --r) {
+        for (std::int64_t c = get_row_size(r); c >= 1; --c) {
+            entries += std::to_string(r) + " " + std::to_string(c) + " " +
+                       std::to_string(10 * r + c) + "\n";
+            ++entry_count;
+        }
+    }
+    const temp_matrix_file file{ "matrix_market_read_test_unsorted.mtx",
+                                 "%%MatrixMarket matrix coordinate integer general\n" +
+                                     std::to_string(row_count) + " 4 " +
+                                     std::to_string(entry_count) + "\n" + entries };
+
+    const auto rows = pull_csr<double>(read<table>(data_source<double>{ file.get_name() }));
+
+    csr_rows<double> expected;
+    expected.row_indices.push_back(1);
+    for (std::int64_t r = 1; r <= row_count; ++r) {
+        for (std::int64_t c = 1; c <= get_row_size(r); ++c) {
+            expected.column_indices.push_back(c - 1);
+            expected.values.push_back(10 * r + c);
+        }
+        expected.row_indices.push_back(expected.values.size() + 1);
+    }
+    REQUIRE(rows.row_indices == expected.row_indices);
+    REQUIRE(rows.column_indices == expected.column_indices);
+    REQUIRE(rows.values == expected.values);
+}
+
+TEST("read symmetric and skew-symmetric matrices", "[matrix_market]") {
+    const std::string entries = "3 3 3\n"
+                                "2 1 5\n"
+                                "3 3 7\n"
+                                "3 1 2\n";
+    {
+        const temp_matrix_file file{ "matrix_market_read_test_symmetric.mtx",
+                                     "%%MatrixMarket matrix coordinate real symmetric\n" +
+                                         entries };
+        const auto rows = pull_csr<float>(read<table>(data_source{ file.get_name() }));
+        REQUIRE(rows.row_indices == std::vector<std::int64_t>{ 1, 3, 4, 6 });
+        REQUIRE(rows.column_indices == std::vector<std::int64_t>{ 1, 2, 0, 0, 2 });
+        REQUIRE(rows.values == std::vector<float>{ 5.f, 2.f, 5.f, 2.f, 7.f });
+    }
+    {
+        const temp_matrix_file file{ "matrix_market_read_test_skew.mtx",
+                                     "%%MatrixMarket matrix coordinate real skew-symmetric\n"
+                                     "3 3 2\n"
+                                     "2 1 5\n"
+                                     "3 1 2\n" };
+        const auto rows = pull_csr<float>(read<table>(data_source{ file.get_name() }));
+        REQUIRE(rows.row_indices == std::vector<std::int64_t>{ 1, 3, 4, 5 });
+        REQUIRE(rows.column_indices == std::vector<std::int64_t>{ 1, 2, 0, 0 });
+        REQUIRE(rows.values == std::vector<float>{ -5.f, -2.f, 5.f, 2.f });
+    }
+}
+
+TEST("read pattern matrix in double precision", "[matrix_market]") {
+    const temp_matrix_file file{ "matrix_market_read_test_pattern.mtx",
+                                 "%%MatrixMarket matrix coordinate pattern general\n"
+                                 "2 2 2\n"
+                                 "2 2\n"
+                                 "1 1\n" };
+
+    const auto rows = pull_csr<double>(read<table>(data_source<double>{ file.get_name() }));
+    REQUIRE(rows.row_indices == std::vector<std::int64_t>{ 1, 2, 3 });
+    REQUIRE(rows.column_indices == std::vector<std::int64_t>{ 0, 1 });
+    REQUIRE(rows.values == std::vector<double>{ 1.0, 1.0 });
+}
+
+TEST("read matrix rejects invalid sizes and entries", "[matrix_market]") {
+    const std::string file_name = "matrix_market_read_test_invalid.mtx";
+    const std::string banner = "%%MatrixMarket matrix coordinate real general\n";
+    for (const std::string content :
+         { banner + "2 2 5\n1 1 1\n",
+           banner + "1000000000 1000000000 100000000000000000\n1 1 1\n",
+           banner + "2 2 1\n1 99999999999999999999 1\n",
+           banner + "99999999999999999999 2 1\n1 1 1\n",
+           banner + "2 2 1\n3 1 1\n",
+           banner + "2 2 2\n1 1 1\n",
+           std::string("%%MatrixMarket matrix coordinate real symmetric\n2 3 1\n1 1 1\n") }) {
+        CAPTURE(content);
+        const temp_matrix_file file{ file_name, content };
+        REQUIRE_THROWS_AS(read<table>(data_source{ file_name }), invalid_argument);
+    }
+}
+
+} // namespace oneapi::dal::matrix_market::test
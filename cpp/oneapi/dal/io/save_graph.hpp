@@ -0,0 +1,40 @@
+/*******************************************************************************
+* Copyright 2020-2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/// @file
+/// Contains the definition of the graph saving functionality
+
+#pragma once
+
+#include "oneapi/dal/io/detail/graph_snapshot.hpp"
+#include "oneapi/dal/io/graph_binary_data_source.hpp"
+
+namespace oneapi::dal::preview::save_graph {
+
+/// Writes the CSR topology and the edge values of the graph into the binary
+/// snapshot file specified in the data source. The snapshot can be loaded back
+/// with load_graph::load without rebuilding the topology.
+///
+/// @tparam Graph      Type of the graph
+/// @tparam DataSource Type of the data source
+/// @param [in] graph       The graph to save
+/// @param [in] data_source The data source
+template <typename Graph, typename DataSource = graph_binary_data_source>
+ONEDAL_EXPORT void save(const Graph &graph, const DataSource &data_source) {
+    load_graph::detail::save_graph_snapshot(data_source.get_filename(), graph);
+}
+
+} // namespace oneapi::dal::preview::save_graph
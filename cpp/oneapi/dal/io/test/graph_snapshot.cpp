@@ -0,0 +1,200 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+#include <cstdio>
+#include <fstream>
+#include <vector>
+
+#include "oneapi/dal/graph/service_functions.hpp"
+#include "oneapi/dal/graph/directed_adjacency_vector_graph.hpp"
+#include "oneapi/dal/graph/undirected_adjacency_vector_graph.hpp"
+#include "oneapi/dal/io/load_graph.hpp"
+#include "oneapi/dal/io/save_graph.hpp"
+#include "oneapi/dal/test/engine/common.hpp"
+
+namespace oneapi::dal::preview::load_graph::test {
+
+class temp_file {
+public:
+    temp_file(const std::string& name, const std::string& content = "") : name_(name) {
+        std::ofstream file(name_, std::ios::binary);
+        file << content;
+    }
+
+    ~temp_file() {
+        std::remove(name_.c_str());
+    }
+
+    const std::string& get_name() const {
+        return name_;
+    }
+
+private:
+    std::string name_;
+};
+
+template <typename T>
+static void patch_file(const std::string& name, std::int64_t offset, const T& value) {
+    std::fstream file(name, std::ios::binary | std::ios::in | std::ios::out);
+    file.seekp(offset);
+    file.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+static detail::graph_snapshot_header read_header(const std::string& name) {
+    detail::graph_snapshot_header header;
+    std::ifstream file(name, std::ios::binary);
+    file.read(reinterpret_cast<char*>(&header), sizeof(header));
+    return header;
+}
+
+template <typename Graph>
+static void check_same_topology(const Graph& expected, const Graph& actual) {
+    REQUIRE(get_vertex_count(actual) == get_vertex_count(expected));
+    REQUIRE(get_edge_count(actual) == get_edge_count(expected));
+
+    const auto& expected_topology = dal::detail::get_impl(expected).get_topology();
+    const auto& actual_topology = dal::detail::get_impl(actual).get_topology();
+    for (std::int64_t i = 0; i <= expected_topology.get_vertex_count(); ++i) {
+        REQUIRE(actual_topology._rows[i] == expected_topology._rows[i]);
+    }
+    for (std::int64_t i = 0; i < expected_topology._cols.get_count(); ++i) {
+        REQUIRE(actual_topology._cols[i] == expected_topology._cols[i]);
+    }
+}
+
+TEST("undirected graph snapshot round trip", "[graph_snapshot]") {
+    const temp_file csv{ "graph_snapshot_test.csv", "0 1\n1 2\n2 0\n2 3\n4 3\n" };
+    const temp_file snapshot{ "graph_snapshot_test.bin" };
+
+    const auto graph = load(descriptor<>{}, graph_csv_data_source{ csv.get_name() });
+    save_graph::save(graph, graph_binary_data_source{ snapshot.get_name() });
+    const auto loaded = load(descriptor<>{}, graph_binary_data_source{ snapshot.get_name() });
+
+    check_same_topology(graph, loaded);
+    REQUIRE(get_vertex_degree(loaded, 2) == 3);
+}
+
+TEST("weighted directed graph snapshot round trip", "[graph_snapshot]") {
+    using graph_t = directed_adjacency_vector_graph<std::int32_t, double>;
+    using descriptor_t = descriptor<weighted_edge_list<std::int32_t, double>, graph_t>;
+
+    const temp_file csv{ "graph_snapshot_weighted_test.csv", "0 1 0.5\n1 2 1.5\n2 0 -2\n0 2 4\n" };
+    const temp_file snapshot{ "graph_snapshot_weighted_test.bin" };
+
+    const auto graph = load(descriptor_t{}, graph_csv_data_source{ csv.get_name() });
+    save_graph::save(graph, graph_binary_data_source{ snapshot.get_name() });
+    const auto loaded = load(descriptor_t{}, graph_binary_data_source{ snapshot.get_name() });
+
+    check_same_topology(graph, loaded);
+    const auto& expected_values = dal::detail::get_impl(graph).get_edge_values();
+    const auto& actual_values = dal::detail::get_impl(loaded).get_edge_values();
+    REQUIRE(actual_values.get_count() == expected_values.get_count());
+    for (std::int64_t i = 0; i < expected_values.get_count(); ++i) {
+        REQUIRE(actual_values[i] == expected_values[i]);
+    }
+}
+
+TEST("corrupted graph snapshot is rejected", "[graph_snapshot]") {
+    const temp_file csv{ "graph_snapshot_corrupted_test.csv", "0 1\n1 2\n2 0\n" };
+    const temp_file snapshot{ "graph_snapshot_corrupted_test.bin" };
+    const graph_binary_data_source ds{ snapshot.get_name() };
+    const graph_binary_data_source checked_ds{ snapshot.get_name(), true };
+
+    const auto graph = load(descriptor<>{}, graph_csv_data_source{ csv.get_name() });
+
+    SECTION("neighbor out of range") {
+        save_graph::save(graph, ds);
+        const auto header = read_header(snapshot.get_name());
+        patch_file(snapshot.get_name(), header.cols_offset, std::int32_t(3));
+        REQUIRE_THROWS_AS(load(descriptor<>{}, checked_ds), invalid_argument);
+    }
+
+    SECTION("non-monotonic offsets") {
+        save_graph::save(graph, ds);
+        const auto header = read_header(snapshot.get_name());
+        patch_file(snapshot.get_name(),
+                   header.rows_offset + std::int64_t(sizeof(std::int64_t)),
+                   std::int64_t(5));
+        REQUIRE_THROWS_AS(load(descriptor<>{}, checked_ds), invalid_argument);
+    }
+
+    SECTION("last offset differs from neighbor count") {
+        save_graph::save(graph, ds);
+        const auto header = read_header(snapshot.get_name());
+        patch_file(snapshot.get_name(),
+                   header.rows_offset + header.vertex_count * std::int64_t(sizeof(std::int64_t)),
+                   std::int64_t(header.neighbor_count - 1));
+        REQUIRE_THROWS_AS(load(descriptor<>{}, ds), invalid_argument);
+    }
+
+    SECTION("misaligned array offset") {
+        save_graph::save(graph, ds);
+        auto header = read_header(snapshot.get_name());
+        header.cols_offset += sizeof(std::int32_t);
+        patch_file(snapshot.get_name(), 0, header);
+        REQUIRE_THROWS_AS(load(descriptor<>{}, ds), invalid_argument);
+    }
+
+    SECTION("array overlaps header") {
+        save_graph::save(graph, ds);
+        auto header = read_header(snapshot.get_name());
+        header.degrees_offset = detail::graph_snapshot_alignment;
+        patch_file(snapshot.get_name(), 0, header);
+        REQUIRE_THROWS_AS(load(descriptor<>{}, ds), invalid_argument);
+    }
+
+    SECTION("negative neighbor count") {
+        save_graph::save(graph, ds);
+        auto header = read_header(snapshot.get_name());
+        header.neighbor_count = -1;
+        patch_file(snapshot.get_name(), 0, header);
+        REQUIRE_THROWS_AS(load(descriptor<>{}, ds), invalid_argument);
+    }
+
+    SECTION("truncated file") {
+        save_graph::save(graph, ds);
+        const auto header = read_header(snapshot.get_name());
+        std::vector<char> content(header.cols_offset);
+        {
+            std::ifstream file(snapshot.get_name(), std::ios::binary);
+            file.read(content.data(), content.size());
+        }
+        std::ofstream(snapshot.get_name(), std::ios::binary | std::ios::trunc)
+            .write(content.data(), content.size());
+        REQUIRE_THROWS_AS(load(descriptor<>{}, ds), invalid_argument);
+    }
+}
+
+TEST("checked graph snapshot load accepts valid snapshot", "[graph_snapshot]") {
+    const temp_file csv{ "graph_snapshot_checked_test.csv", "0 1\n1 2\n2 0\n2 3\n4 3\n" };
+    const temp_file snapshot{ "graph_snapshot_checked_test.bin" };
+
+    const auto graph = load(descriptor<>{}, graph_csv_data_source{ csv.get_name() });
+    save_graph::save(graph, graph_binary_data_source{ snapshot.get_name() });
+    const auto loaded = load(descriptor<>{}, graph_binary_data_source{ snapshot.get_name(), true });
+
+    check_same_topology(graph, loaded);
+}
+
+TEST("saving graph snapshot to unwritable path throws", "[graph_snapshot]") {
+    const temp_file csv{ "graph_snapshot_unwritable_test.csv", "0 1\n" };
+    const auto graph = load(descriptor<>{}, graph_csv_data_source{ csv.get_name() });
+    const graph_binary_data_source ds{ "nonexistent_directory/graph_snapshot.bin" };
+    REQUIRE_THROWS_AS(save_graph::save(graph, ds), invalid_argument);
+}
+
+} // namespace oneapi::dal::preview::load_graph::test
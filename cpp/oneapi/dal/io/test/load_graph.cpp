@@ -0,0 +1,178 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+#include <cstdio>
+#include <fstream>
+
+#include "oneapi/dal/graph/service_functions.hpp"
+#include "oneapi/dal/graph/undirected_adjacency_vector_graph.hpp"
+#include "oneapi/dal/io/load_graph.hpp"
+#include "oneapi/dal/test/engine/common.hpp"
+
+namespace oneapi::dal::preview::load_graph::test {
+
+class temp_graph_file {
+public:
+    temp_graph_file(const std::string& name, const std::string& content) : name_(name) {
+        std::ofstream file(name_, std::ios::binary);
+        file << content;
+    }
+
+    ~temp_graph_file() {
+        std::remove(name_.c_str());
+    }
+
+    const std::string& get_name() const {
+        return name_;
+    }
+
+private:
+    std::string name_;
+};
+
+TEST("edge list chunks are parsed in file order", "[load_graph]") {
+    const std::string text = "0 1\n1 2\r\n\n2 3\n\t3 4 \n  4   5\n5 6\n";
+    const char* begin = text.data();
+    const char* end = begin + text.size();
+
+    for (std::int64_t chunk_count : { 1, 2, 3, 7, 64 }) {
+        edge_list<std::int32_t> edges;
+        const auto bounds = dal::io::backend::split_by_lines(begin, end, chunk_count);
+        detail::append_edges(bounds, edges);
+
+        CAPTURE(chunk_count);
+        REQUIRE(edges.size() == 6);
+        for (std::int32_t i = 0; i < 6; ++i) {
+            REQUIRE(edges[i].first == i);
+            REQUIRE(edges[i].second == i + 1);
+        }
+    }
+}
+
+TEST("weighted edge list is parsed with floating-point weights", "[load_graph]") {
+    const std::string text = "0 1 0.5\n1 2 -2e1\n2 0 3\n";
+    const char* begin = text.data();
+    // No terminating newline, the parser must not read past the end
+    const char* end = begin + text.size() - 1;
+
+    weighted_edge_list<std::int32_t, double> edges;
+    detail::append_edges(dal::io::backend::split_by_lines(begin, end, 2), edges);
+
+    REQUIRE(edges.size() == 3);
+    REQUIRE(std::get<2>(edges[0]) == 0.5);
+    REQUIRE(std::get<2>(edges[1]) == -20.0);
+    REQUIRE(std::get<2>(edges[2]) == 3.0);
+}
+
+TEST("malformed edge list lines throw", "[load_graph]") {
+    const auto parse = [](const std::string& text) {
+        edge_list<std::int32_t> edges;
+        const char* begin = text.data();
+        detail::append_edges(dal::io::backend::split_by_lines(begin, begin + text.size(), 2),
+                             edges);
+    };
+
+    SECTION("missing vertex") {
+        REQUIRE_THROWS_AS(parse("0 1\n2\n3 4\n"), invalid_argument);
+    }
+    SECTION("two edges in a line") {
+        REQUIRE_THROWS_AS(parse("0 1\n2 3 3 4\n"), invalid_argument);
+    }
+    SECTION("extra token in the last line") {
+        REQUIRE_THROWS_AS(parse("0 1\n1 2 3"), invalid_argument);
+    }
+    SECTION("non-numeric token") {
+        REQUIRE_THROWS_AS(parse("0 1\na 2\n"), invalid_argument);
+        REQUIRE_THROWS_AS(parse("0 1\n1 2x\n"), invalid_argument);
+        REQUIRE_THROWS_AS(parse("0 1\n1 2.5\n"), invalid_argument);
+        REQUIRE_THROWS_AS(parse("0 1\n1 -\n"), invalid_argument);
+    }
+    SECTION("vertex id out of range") {
+        REQUIRE_THROWS_AS(parse("0 1\n1 2147483648\n"), invalid_argument);
+        REQUIRE_THROWS_AS(parse("0 1\n99999999999999999999 2\n"), invalid_argument);
+    }
+    SECTION("negative vertex id") {
+        REQUIRE_THROWS_AS(parse("0 1\n-1 2\n"), invalid_argument);
+    }
+}
+
+TEST("edge list vertex ids are parsed up to the range limit", "[load_graph]") {
+    const std::string text = "+0 2147483647\n";
+    const char* begin = text.data();
+
+    edge_list<std::int32_t> edges;
+    detail::append_edges(dal::io::backend::split_by_lines(begin, begin + text.size(), 1), edges);
+
+    REQUIRE(edges.size() == 1);
+    REQUIRE(edges[0].first == 0);
+    REQUIRE(edges[0].second == 2147483647);
+}
+
+TEST("malformed weighted edge list lines throw", "[load_graph]") {
+    const auto parse = [](const std::string& text) {
+        weighted_edge_list<std::int32_t, double> edges;
+        const char* begin = text.data();
+        detail::append_edges(dal::io::backend::split_by_lines(begin, begin + text.size(), 2),
+                             edges);
+    };
+
+    SECTION("missing weight") {
+        REQUIRE_THROWS_AS(parse("0 1 0.5\n1 2\n"), invalid_argument);
+    }
+    SECTION("extra token") {
+        REQUIRE_THROWS_AS(parse("0 1 0.5\n1 2 1 2\n"), invalid_argument);
+    }
+    SECTION("non-numeric weight") {
+        REQUIRE_THROWS_AS(parse("0 1 0.5\n1 2 w\n"), invalid_argument);
+        REQUIRE_THROWS_AS(parse("0 1 0.5\n1 2 1e\n"), invalid_argument);
+    }
+    SECTION("weight out of range") {
+        REQUIRE_THROWS_AS(parse("0 1 0.5\n1 2 1e999\n"), invalid_argument);
+    }
+}
+
+TEST("load from malformed file throws", "[load_graph]") {
+    const temp_graph_file file{ "load_graph_test_malformed.csv", "0 1\n1 2\n2 x\n" };
+    const graph_csv_data_source ds{ file.get_name() };
+    REQUIRE_THROWS_AS(load(descriptor<>{}, ds), invalid_argument);
+}
+
+TEST("vertex count of empty edge list is zero", "[load_graph]") {
+    const edge_list<std::int32_t> edges;
+    REQUIRE(detail::get_vertex_count_from_edge_list(edges) == 0);
+}
+
+TEST("load from empty file throws", "[load_graph]") {
+    const temp_graph_file file{ "load_graph_test_empty.csv", "" };
+    const graph_csv_data_source ds{ file.get_name() };
+    REQUIRE_THROWS_AS(load(descriptor<>{}, ds), invalid_argument);
+}
+
+TEST("load builds deduplicated undirected graph", "[load_graph]") {
+    const temp_graph_file file{ "load_graph_test_graph.csv", "0 1\n1 2\n2 0\n1 0\n3 3\n2 3" };
+    const graph_csv_data_source ds{ file.get_name() };
+
+    const auto graph = load(descriptor<>{}, ds);
+
+    REQUIRE(get_vertex_count(graph) == 4);
+    REQUIRE(get_edge_count(graph) == 4);
+    REQUIRE(get_vertex_degree(graph, 0) == 2);
+    REQUIRE(get_vertex_degree(graph, 2) == 3);
+    REQUIRE(get_vertex_degree(graph, 3) == 1);
+}
+
+} // namespace oneapi::dal::preview::load_graph::test
@@ -0,0 +1,138 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include "oneapi/dal/io/backend/cpu/text_parser.hpp"
+#include "oneapi/dal/test/engine/common.hpp"
+
+namespace oneapi::dal::io::backend::test {
+
+template <typename Float>
+static const char* parse(const std::string& str, Float& value) {
+    return parse_number(str.data(), str.data() + str.size(), value);
+}
+
+template <typename Float>
+static Float reference(const std::string& str) {
+    return std::is_same_v<Float, float> ? Float(std::strtof(str.c_str(), nullptr))
+                                        : Float(std::strtod(str.c_str(), nullptr));
+}
+
+template <typename Float>
+static bool is_same_bits(Float a, Float b) {
+    return std::memcmp(&a, &b, sizeof(Float)) == 0;
+}
+
+template <typename Float>
+static void check_correctly_rounded(const std::string& str) {
+    Float value = 0;
+    const char* parsed_end = parse(str, value);
+    CAPTURE(str);
+    REQUIRE(parsed_end == str.data() + str.size());
+    REQUIRE(is_same_bits(value, reference<Float>(str)));
+}
+
+TEMPLATE_TEST_CASE("parse_number parses exponents", "[text_parser]", float, double) {
+    for (const std::string str : { "1e0",     "1E3",     "2.5e-3", "-7.25E+2", "+4e10",
+                                   "1e-10",   "3e22",    "1e23",   "5e-324",   "1.7e308",
+                                   "1e-45",   "3.4e38",  "0e100",  "-0.0",     ".5e1",
+                                   "5.e-1" }) {
+        check_correctly_rounded<TestType>(str);
+    }
+}
+
+TEMPLATE_TEST_CASE("parse_number is correctly rounded", "[text_parser]", float, double) {
+    for (const std::string str : { "0.1",
+                                   "0.3",
+                                   "1.1",
+                                   "123.456",
+                                   "9007199254740993",
+                                   "16777217",
+                                   "2.2250738585072011e-308",
+                                   "0.30000000000000004",
+                                   "1.00000005960464477550",
+                                   "3.14159265358979323846264338327950288",
+                                   "123456789012345678901234567890",
+                                   "0.000000000000000000000000123456789012345678901" }) {
+        check_correctly_rounded<TestType>(str);
+    }
+}
+
+TEMPLATE_TEST_CASE("parse_number falls back for long mantissas", "[text_parser]", float, double) {
+    // Halfway cases are decided by the digits beyond the 19th significant one
+    const std::string halfway_below = "9007199254740992.99999999999999999999";
+    const std::string halfway_above = "9007199254740993.00000000000000000001";
+    const std::string long_number = "0." + std::string(100, '3');
+
+    for (const auto& str : { halfway_below, halfway_above, long_number }) {
+        check_correctly_rounded<TestType>(str);
+    }
+}
+
+TEMPLATE_TEST_CASE("parse_number skips blanks around value", "[text_parser]", float, double) {
+    const std::string str = "  \t1.5 \t,2";
+    TestType value = 0;
+    const char* parsed_end = parse(str, value);
+    REQUIRE(parsed_end != nullptr);
+    REQUIRE(*parsed_end == ',');
+    REQUIRE(value == TestType(1.5));
+}
+
+TEMPLATE_TEST_CASE("parse_number rejects non-numeric fields", "[text_parser]", float, double) {
+    for (const std::string str : { "", "abc", "-", ".", "e5", "1e", "1e+" }) {
+        TestType value = 0;
+        CAPTURE(str);
+        REQUIRE(parse(str, value) == nullptr);
+    }
+}
+
+TEST("parse_number stops at non-numeric suffix", "[text_parser]") {
+    const std::string str = "12abc";
+    double value = 0;
+    const char* parsed_end = parse(str, value);
+    REQUIRE(parsed_end == str.data() + 2);
+    REQUIRE(value == 12.0);
+}
+
+TEST("parse_index rejects values out of std::int64_t", "[text_parser]") {
+    const std::string max_value = "9223372036854775807";
+    std::int64_t value = 0;
+    REQUIRE(parse_index(max_value.data(), max_value.data() + max_value.size(), value) ==
+            max_value.data() + max_value.size());
+    REQUIRE(value == std::numeric_limits<std::int64_t>::max());
+
+    for (const std::string str : { "9223372036854775808", "99999999999999999999" }) {
+        CAPTURE(str);
+        REQUIRE(parse_index(str.data(), str.data() + str.size(), value) == nullptr);
+    }
+}
+
+TEST("sort_by_column_indices moves values with indices", "[text_parser]") {
+    std::int64_t column_indices[] = { 4, 1, 3, 1 };
+    double values[] = { 4.0, 1.5, 3.0, 1.0 };
+    sort_by_column_indices(column_indices, values, 4);
+    REQUIRE(std::vector<std::int64_t>(column_indices, column_indices + 4) ==
+            std::vector<std::int64_t>{ 1, 1, 3, 4 });
+    REQUIRE(std::vector<double>(values, values + 4) == std::vector<double>{ 1.0, 1.5, 3.0, 4.0 });
+}
+
+} // namespace oneapi::dal::io::backend::test
@@ -0,0 +1,175 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+#include "oneapi/dal/test/engine/common.hpp"
+#include "src/externals/service_profiler.h"
+
+namespace oneapi::dal::test {
+
+using daal::internal::Profiler;
+using daal::internal::ProfilerTask;
+
+class profiler_report {
+public:
+    explicit profiler_report(Profiler::ReportFormat format) {
+        Profiler::dump(file_name_, format);
+        std::ifstream file(file_name_);
+        std::stringstream stream;
+        stream << file.rdbuf();
+        content_ = stream.str();
+        std::remove(file_name_);
+    }
+
+    bool contains(const std::string& str) const {
+        return content_.find(str) != std::string::npos;
+    }
+
+    const std::string& get_content() const {
+        return content_;
+    }
+
+private:
+    static constexpr const char* file_name_ = "profiler_test_report.txt";
+    std::string content_;
+};
+
+class profiler_guard {
+public:
+    profiler_guard() : was_enabled_(Profiler::isEnabled()) {
+        Profiler::reset();
+        Profiler::enable(true);
+    }
+
+    ~profiler_guard() {
+        Profiler::enable(was_enabled_);
+        Profiler::reset();
+    }
+
+private:
+    bool was_enabled_;
+};
+
+TEST("profiler collects nested tasks by path") {
+    profiler_guard guard;
+    {
+        ProfilerTask outer = Profiler::startTask("profiler_test_outer");
+        for (int i = 0; i < 3; ++i) {
+            ProfilerTask inner = Profiler::startTask("profiler_test_inner");
+        }
+    }
+
+    const profiler_report report{ Profiler::json };
+    CAPTURE(report.get_content());
+    REQUIRE(report.contains("\"path\": \"profiler_test_outer;profiler_test_inner\""));
+    REQUIRE(report.contains("\"name\": \"profiler_test_inner\", \"depth\": 1, \"calls\": 3"));
+    REQUIRE(report.contains("\"name\": \"profiler_test_outer\", \"depth\": 0, \"calls\": 1"));
+}
+
+TEST("profiler ignores end of task that is not running") {
+    profiler_guard guard;
+    {
+        ProfilerTask outer = Profiler::startTask("profiler_test_running");
+        Profiler::endTask("profiler_test_not_started");
+        ProfilerTask inner = Profiler::startTask("profiler_test_child");
+    }
+
+    const profiler_report report{ Profiler::json };
+    CAPTURE(report.get_content());
+    REQUIRE(!report.contains("profiler_test_not_started"));
+    REQUIRE(report.contains("\"path\": \"profiler_test_running;profiler_test_child\""));
+}
+
+TEST("profiler ends nested tasks with the enclosing one") {
+    profiler_guard guard;
+    ProfilerTask outer = Profiler::startTask("profiler_test_enclosing");
+    ProfilerTask inner = Profiler::startTask("profiler_test_nested");
+    Profiler::endTask("profiler_test_enclosing");
+
+    ProfilerTask next = Profiler::startTask("profiler_test_next");
+    Profiler::endTask("profiler_test_next");
+
+    const profiler_report report{ Profiler::json };
+    CAPTURE(report.get_content());
+    REQUIRE(report.contains("\"path\": \"profiler_test_enclosing;profiler_test_nested\""));
+    REQUIRE(report.contains("\"path\": \"profiler_test_next\""));
+}
+
+TEST("profiler ignores end of task when disabled") {
+    profiler_guard guard;
+    ProfilerTask outer = Profiler::startTask("profiler_test_outer_task");
+    Profiler::enable(false);
+    Profiler::endTask("profiler_test_outer_task");
+    Profiler::enable(true);
+    ProfilerTask inner = Profiler::startTask("profiler_test_inner_task");
+    Profiler::endTask("profiler_test_outer_task");
+
+    const profiler_report report{ Profiler::json };
+    CAPTURE(report.get_content());
+    REQUIRE(report.contains("\"path\": \"profiler_test_outer_task;profiler_test_inner_task\""));
+    REQUIRE(report.contains("\"name\": \"profiler_test_outer_task\", \"depth\": 0, \"calls\": 1"));
+}
+
+TEST("profiler ends task started before it was disabled") {
+    profiler_guard guard;
+    {
+        ProfilerTask task = Profiler::startTask("profiler_test_disabled_in_task");
+        Profiler::enable(false);
+    }
+    Profiler::enable(true);
+    {
+        ProfilerTask task = Profiler::startTask("profiler_test_after_disabled");
+    }
+
+    const profiler_report report{ Profiler::json };
+    CAPTURE(report.get_content());
+    REQUIRE(report.contains("\"path\": \"profiler_test_disabled_in_task\""));
+    REQUIRE(report.contains("\"path\": \"profiler_test_after_disabled\""));
+}
+
+TEST("profiler discards statistics on reset") {
+    profiler_guard guard;
+    {
+        ProfilerTask task = Profiler::startTask("profiler_test_before_reset");
+    }
+    Profiler::reset();
+    {
+        ProfilerTask task = Profiler::startTask("profiler_test_after_reset");
+    }
+
+    const profiler_report report{ Profiler::json };
+    CAPTURE(report.get_content());
+    REQUIRE(!report.contains("profiler_test_before_reset"));
+    REQUIRE(report.contains("\"name\": \"profiler_test_after_reset\", \"depth\": 0, \"calls\": 1"));
+}
+
+TEST("profiler escapes task names in json report") {
+    profiler_guard guard;
+    {
+        ProfilerTask task = Profiler::startTask("profiler \"test\" \\ name\n");
+    }
+
+    const profiler_report report{ Profiler::json };
+    CAPTURE(report.get_content());
+    REQUIRE(report.contains("\"name\": \"profiler \\\"test\\\" \\\\ name\\u000a\""));
+}
+
+} // namespace oneapi::dal::test
@@ -0,0 +1,171 @@
+/* file: dbscan_dense_batch_spatial_index.cpp */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of dense DBSCAN clustering with the spatial index method
+!    in the batch processing mode.
+!
+!    The program clusters the weighted observations with the default and
+!    the spatial index methods and checks that both methods produce the same
+!    number of clusters, assignments and indices of core observations.
+!    The spatial index method uses a grid for the data set with 2 features and
+!    a k-d tree for the generated data set with 5 features.
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-DBSCAN_BATCH_SPATIAL_INDEX"></a>
+ * \example dbscan_dense_batch_spatial_index.cpp
+ */
+
+#include "daal.h"
+#include "service.h"
+#include <vector>
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms;
+using namespace daal::data_management;
+
+/* Input data set parameters */
+string datasetFileName = "../data/batch/dbscan_dense.csv";
+
+/* DBSCAN algorithm parameters for the data set from the file */
+const float epsilon          = 0.04f;
+const size_t minObservations = 60;
+
+/* Parameters of the generated data set */
+const size_t nGeneratedRows     = 5000;
+const size_t nGeneratedFeatures = 5;
+const size_t nBlobs             = 4;
+const float generatedEpsilon    = 0.5f;
+const size_t generatedMinObs    = 20;
+
+/* Reads the rows of a numeric table */
+template <typename T>
+vector<T> readRows(const NumericTablePtr & table)
+{
+    const size_t nRows = table->getNumberOfRows();
+    const size_t nCols = table->getNumberOfColumns();
+    BlockDescriptor<T> block;
+    table->getBlockOfRows(0, nRows, readOnly, block);
+    vector<T> rows(block.getBlockPtr(), block.getBlockPtr() + nRows * nCols);
+    table->releaseBlockOfRows(block);
+    return rows;
+}
+
+/* Weights 1, 2 and 3 are repeated, so the weights change the core observations */
+NumericTablePtr createWeights(size_t nRows)
+{
+    NumericTablePtr weights = HomogenNumericTable<float>::create(1, nRows, NumericTable::doAllocate);
+    BlockDescriptor<float> block;
+    weights->getBlockOfRows(0, nRows, writeOnly, block);
+    float * const values = block.getBlockPtr();
+    for (size_t i = 0; i < nRows; i++)
+    {
+        values[i] = float(1 + i % 3);
+    }
+    weights->releaseBlockOfRows(block);
+    return weights;
+}
+
+/* Dense blobs around the points (2k, 2k, ..., 2k) and a sparse noise between them */
+NumericTablePtr generateData()
+{
+    NumericTablePtr data = HomogenNumericTable<float>::create(nGeneratedFeatures, nGeneratedRows, NumericTable::doAllocate);
+    BlockDescriptor<float> block;
+    data->getBlockOfRows(0, nGeneratedRows, writeOnly, block);
+    float * const values = block.getBlockPtr();
+    unsigned int seed    = 2021;
+    for (size_t i = 0; i < nGeneratedRows; i++)
+    {
+        const bool isNoise = (i % 10 == 0);
+        const float center = 2.0f * (i % nBlobs);
+        for (size_t j = 0; j < nGeneratedFeatures; j++)
+        {
+            seed                               = seed * 1103515245u + 12345u;
+            const float uniform                = float((seed >> 8) & 0xFFFF) / 0x10000;
+            values[i * nGeneratedFeatures + j] = isNoise ? 2.0f * nBlobs * uniform : center + uniform - 0.5f;
+        }
+    }
+    data->releaseBlockOfRows(block);
+    return data;
+}
+
+template <dbscan::Method method>
+dbscan::ResultPtr cluster(const NumericTablePtr & data, const NumericTablePtr & weights, float eps, size_t minObs)
+{
+    dbscan::Batch<float, method> algorithm(eps, minObs);
+    algorithm.input.set(dbscan::data, data);
+    algorithm.input.set(dbscan::weights, weights);
+    algorithm.parameter().resultsToCompute = dbscan::computeCoreIndices;
+    checkStatus(algorithm.compute());
+    return algorithm.getResult();
+}
+
+/* Compares the results of the default and the spatial index methods */
+bool checkResults(const string & name, const NumericTablePtr & data, float eps, size_t minObs)
+{
+    const NumericTablePtr weights = createWeights(data->getNumberOfRows());
+
+    dbscan::ResultPtr defaultResult      = cluster<dbscan::defaultDense>(data, weights, eps, minObs);
+    dbscan::ResultPtr spatialIndexResult = cluster<dbscan::spatialIndexDense>(data, weights, eps, minObs);
+
+    const int nClusters = readRows<int>(defaultResult->get(dbscan::nClusters))[0];
+    std::cout << name << ": " << nClusters << " clusters" << std::endl;
+    if (nClusters == 0)
+    {
+        std::cout << name << ": no clusters are found" << std::endl;
+        return false;
+    }
+    if (readRows<int>(spatialIndexResult->get(dbscan::nClusters))[0] != nClusters)
+    {
+        std::cout << name << ": the methods find different numbers of clusters" << std::endl;
+        return false;
+    }
+    if (readRows<int>(spatialIndexResult->get(dbscan::assignments)) != readRows<int>(defaultResult->get(dbscan::assignments)))
+    {
+        std::cout << name << ": the methods produce different assignments" << std::endl;
+        return false;
+    }
+    if (readRows<int>(spatialIndexResult->get(dbscan::coreIndices)) != readRows<int>(defaultResult->get(dbscan::coreIndices)))
+    {
+        std::cout << name << ": the methods find different core observations" << std::endl;
+        return false;
+    }
+    return true;
+}
+
+int main(int argc, char * argv[])
+{
+    checkArguments(argc, argv, 1, &datasetFileName);
+
+    /* Initialize FileDataSource to retrieve the input data from a .csv file */
+    FileDataSource<CSVFeatureManager> dataSource(datasetFileName, DataSource::doAllocateNumericTable, DataSource::doDictionaryFromContext);
+
+    /* Retrieve the data from the input file */
+    dataSource.loadDataBlock();
+
+    /* The data set with 2 features is indexed by a grid */
+    if (!checkResults("Grid", dataSource.getNumericTable(), epsilon, minObservations)) return 1;
+
+    /* The data set with 5 features is indexed by a k-d tree */
+    if (!checkResults("K-d tree", generateData(), generatedEpsilon, generatedMinObs)) return 1;
+
+    std::cout << "The spatial index method produces the same clusters as the default method" << std::endl;
+    return 0;
+}
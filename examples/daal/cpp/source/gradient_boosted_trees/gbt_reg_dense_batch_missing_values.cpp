@@ -0,0 +1,217 @@
+/* file: gbt_reg_dense_batch_missing_values.cpp */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of gradient boosted trees regression in the batch processing mode
+!    on the data with missing values.
+!
+!    The program trains the gradient boosted trees regression models on a data set
+!    where the missing values of a feature bring the information about the response.
+!    The example checks that:
+!      - the models trained with the exact and the inexact split methods learn
+!        the direction of the missing values and predict the same responses,
+!      - the directions of the missing values are kept by the serialization,
+!      - the archives of the versions older than 2021.4, which do not store
+!        the directions, are loaded with the missing values going to the left.
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-GBT_REG_DENSE_BATCH_MISSING_VALUES"></a>
+ * \example gbt_reg_dense_batch_missing_values.cpp
+ */
+
+#include "daal.h"
+#include "service.h"
+#include <cmath>
+#include <limits>
+#include <vector>
+
+using namespace std;
+using namespace daal;
+using namespace daal::data_management;
+using namespace daal::algorithms::gbt::regression;
+
+/* Data set parameters */
+const size_t nRows      = 2000;
+const size_t nFeatures  = 4;
+const size_t nLevels    = 10; /* Number of different values of a feature, less than the number of bins */
+const double missingY   = 10.0;
+const size_t missingCol = 0;
+
+/* Gradient boosted trees training parameters */
+const size_t maxIterations = 20;
+
+const double tolerance = 1e-3;
+
+/* Data archive that is created for the version 2021.3.0 of the library whatever its header says */
+class DataArchive2021u3 : public DataArchive
+{
+public:
+    DataArchive2021u3() {}
+    DataArchive2021u3(daal::byte * ptr, size_t size) : DataArchive(ptr, size) {}
+
+    void setMajorVersion(int) DAAL_C11_OVERRIDE { DataArchive::setMajorVersion(2021); }
+    void setMinorVersion(int) DAAL_C11_OVERRIDE { DataArchive::setMinorVersion(3); }
+    void setUpdateVersion(int) DAAL_C11_OVERRIDE { DataArchive::setUpdateVersion(0); }
+};
+
+/* The response is 10 if the first feature is missing and a linear function of the features otherwise */
+void generateData(vector<double> & x, vector<double> & y)
+{
+    x.resize(nRows * nFeatures);
+    y.resize(nRows);
+    unsigned int seed = 777;
+    for (size_t i = 0; i < nRows; i++)
+    {
+        y[i] = 0.0;
+        for (size_t j = 0; j < nFeatures; j++)
+        {
+            seed                 = seed * 1103515245u + 12345u;
+            x[i * nFeatures + j] = double((seed >> 16) % nLevels) / nLevels;
+            y[i] += (j + 1) * x[i * nFeatures + j];
+        }
+        if (i % 5 == 0)
+        {
+            x[i * nFeatures + missingCol] = numeric_limits<double>::quiet_NaN();
+            y[i]                          = missingY;
+        }
+    }
+}
+
+training::ResultPtr trainModel(const NumericTablePtr & data, const NumericTablePtr & dependentVariable, algorithms::gbt::training::SplitMethod splitMethod)
+{
+    training::Batch<double> algorithm;
+    algorithm.input.set(training::data, data);
+    algorithm.input.set(training::dependentVariable, dependentVariable);
+    algorithm.parameter().maxIterations = maxIterations;
+    algorithm.parameter().splitMethod   = splitMethod;
+    checkStatus(algorithm.compute());
+    return algorithm.getResult();
+}
+
+vector<double> predict(const training::ResultPtr & trainingResult, const NumericTablePtr & data)
+{
+    prediction::Batch<double> algorithm;
+    algorithm.input.set(prediction::data, data);
+    algorithm.input.set(prediction::model, trainingResult->get(training::model));
+    checkStatus(algorithm.compute());
+
+    NumericTablePtr predictionTable = algorithm.getResult()->get(prediction::prediction);
+    BlockDescriptor<double> block;
+    predictionTable->getBlockOfRows(0, nRows, readOnly, block);
+    vector<double> values(block.getBlockPtr(), block.getBlockPtr() + nRows);
+    predictionTable->releaseBlockOfRows(block);
+    return values;
+}
+
+/* Serializes the training result into an archive and restores it. The archives take the ownership of the data archives */
+training::ResultPtr serializeAndRestore(const training::ResultPtr & trainingResult, DataArchive * inputArchive, bool isOlderArchive)
+{
+    InputDataArchive inArch(inputArchive);
+    trainingResult->serialize(inArch);
+
+    const size_t length = inArch.getSizeOfArchive();
+    vector<daal::byte> buffer(length);
+    inArch.copyArchiveToArray(&buffer[0], length);
+
+    DataArchive * outputArchive = isOlderArchive ? new DataArchive2021u3(&buffer[0], length) : new DataArchive(&buffer[0], length);
+    OutputDataArchive outArch(outputArchive);
+    training::ResultPtr restored(new training::Result());
+    restored->deserialize(outArch);
+    return restored;
+}
+
+/* Mean absolute error on the rows with or without the missing values */
+double getMeanError(const vector<double> & prediction, const vector<double> & y, bool onMissingRows)
+{
+    double error  = 0.0;
+    size_t nTotal = 0;
+    for (size_t i = 0; i < nRows; i++)
+    {
+        if ((i % 5 == 0) == onMissingRows)
+        {
+            error += fabs(prediction[i] - y[i]);
+            nTotal++;
+        }
+    }
+    return error / nTotal;
+}
+
+int main(int argc, char * argv[])
+{
+    vector<double> x, y;
+    generateData(x, y);
+    NumericTablePtr data              = HomogenNumericTable<double>::create(&x[0], nFeatures, nRows);
+    NumericTablePtr dependentVariable = HomogenNumericTable<double>::create(&y[0], 1, nRows);
+
+    /* Train the models with both split methods */
+    training::ResultPtr exactResult   = trainModel(data, dependentVariable, algorithms::gbt::training::exact);
+    training::ResultPtr inexactResult = trainModel(data, dependentVariable, algorithms::gbt::training::inexact);
+
+    const vector<double> exactPrediction   = predict(exactResult, data);
+    const vector<double> inexactPrediction = predict(inexactResult, data);
+
+    const double exactError = getMeanError(exactPrediction, y, true);
+    std::cout << "Mean absolute error on the rows with missing values: " << exactError << std::endl;
+    if (exactError > 1.0 || getMeanError(inexactPrediction, y, true) > 1.0)
+    {
+        std::cout << "The direction of the missing values is not learned" << std::endl;
+        return 1;
+    }
+
+    /* All the values of the features fit into the bins, so both methods build the same trees */
+    for (size_t i = 0; i < nRows; i++)
+    {
+        if (fabs(exactPrediction[i] - inexactPrediction[i]) > tolerance * (1.0 + fabs(exactPrediction[i])))
+        {
+            std::cout << "The exact and the inexact split methods predict different responses for row " << i << std::endl;
+            return 1;
+        }
+    }
+
+    /* The directions of the missing values are serialized */
+    const vector<double> restoredPrediction = predict(serializeAndRestore(exactResult, new DataArchive(), false), data);
+    for (size_t i = 0; i < nRows; i++)
+    {
+        if (restoredPrediction[i] != exactPrediction[i])
+        {
+            std::cout << "The restored model predicts a different response for row " << i << std::endl;
+            return 1;
+        }
+    }
+
+    /* The older archives do not store the directions: the present values are predicted in the same way,
+       the missing values go to the left */
+    const vector<double> olderPrediction = predict(serializeAndRestore(exactResult, new DataArchive2021u3(), true), data);
+    for (size_t i = 0; i < nRows; i++)
+    {
+        if (i % 5 != 0 && olderPrediction[i] != exactPrediction[i])
+        {
+            std::cout << "The model restored from the older archive predicts a different response for row " << i << std::endl;
+            return 1;
+        }
+    }
+    if (getMeanError(olderPrediction, y, true) <= exactError)
+    {
+        std::cout << "The model restored from the older archive keeps the directions of the missing values" << std::endl;
+        return 1;
+    }
+
+    std::cout << "Missing values are handled consistently by training, prediction and serialization" << std::endl;
+    return 0;
+}
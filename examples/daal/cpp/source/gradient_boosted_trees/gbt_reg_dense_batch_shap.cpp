@@ -0,0 +1,205 @@
+/* file: gbt_reg_dense_batch_shap.cpp */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of the computation of the feature contributions (SHAP values)
+!    and the feature interactions (SHAP interaction values) of the gradient
+!    boosted trees regression in the batch processing mode.
+!
+!    The program trains the gradient boosted trees regression model on a data set
+!    with a categorical feature, replaces some values of the test data with NaN
+!    and checks that the contributions of every observation sum up to the predicted
+!    response and that the interactions of every feature sum up to its contribution.
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-GBT_REG_DENSE_BATCH_SHAP"></a>
+ * \example gbt_reg_dense_batch_shap.cpp
+ */
+
+#include "daal.h"
+#include "service.h"
+#include <cmath>
+#include <limits>
+#include <vector>
+
+using namespace std;
+using namespace daal;
+using namespace daal::data_management;
+using namespace daal::algorithms::gbt::regression;
+
+/* Input data set parameters */
+string trainDatasetFileName               = "../data/batch/df_regression_train.csv";
+string testDatasetFileName                = "../data/batch/df_regression_test.csv";
+const size_t categoricalFeaturesIndices[] = { 3 };
+const size_t nFeatures                    = 13; /* Number of features in training and testing data sets */
+
+/* Gradient boosted trees training parameters */
+const size_t maxIterations = 40;
+
+const double tolerance = 1e-3;
+
+training::ResultPtr trainModel();
+void loadData(const std::string & fileName, NumericTablePtr & pData, NumericTablePtr & pDependentVar);
+void addMissingValues(const NumericTablePtr & data);
+vector<float> predict(const training::ResultPtr & trainingResult, const NumericTablePtr & data, DAAL_UINT64 resultsToCompute);
+
+bool isClose(double x, double y)
+{
+    return fabs(x - y) <= tolerance * (1.0 + fabs(y));
+}
+
+int main(int argc, char * argv[])
+{
+    checkArguments(argc, argv, 2, &trainDatasetFileName, &testDatasetFileName);
+
+    training::ResultPtr trainingResult = trainModel();
+
+    NumericTablePtr testData;
+    NumericTablePtr testGroundTruth;
+    loadData(testDatasetFileName, testData, testGroundTruth);
+    addMissingValues(testData);
+
+    const size_t nRows          = testData->getNumberOfRows();
+    const size_t nContributions = nFeatures + 1;
+
+    /* Compute the predicted responses, the feature contributions and the feature interactions */
+    const vector<float> responses     = predict(trainingResult, testData, prediction::predictionResult);
+    const vector<float> contributions = predict(trainingResult, testData, prediction::predictionContributions);
+    const vector<float> interactions  = predict(trainingResult, testData, prediction::predictionInteractions);
+
+    printNumericTable(HomogenNumericTable<float>::create(const_cast<float *>(&contributions[0]), nContributions, nRows),
+                      "Feature contributions, the last column is the bias (first 5 rows):", 5);
+
+    for (size_t i = 0; i < nRows; i++)
+    {
+        /* The contributions and the bias sum up to the predicted response */
+        const float * rowContributions = &contributions[i * nContributions];
+        double sum                     = 0.0;
+        for (size_t j = 0; j < nContributions; j++)
+        {
+            sum += rowContributions[j];
+        }
+        if (!isClose(sum, responses[i]))
+        {
+            std::cout << "Contributions of row " << i << " sum up to " << sum << ", the predicted response is " << responses[i] << std::endl;
+            return 1;
+        }
+
+        /* The interactions of a feature with all the features and the bias sum up to its contribution */
+        const float * rowInteractions = &interactions[i * nContributions * nContributions];
+        for (size_t j = 0; j < nContributions; j++)
+        {
+            double interactionSum = 0.0;
+            for (size_t k = 0; k < nContributions; k++)
+            {
+                interactionSum += rowInteractions[j * nContributions + k];
+            }
+            if (!isClose(interactionSum, rowContributions[j]))
+            {
+                std::cout << "Interactions of feature " << j << " in row " << i << " sum up to " << interactionSum
+                          << ", the contribution is " << rowContributions[j] << std::endl;
+                return 1;
+            }
+        }
+    }
+
+    std::cout << "Feature contributions and interactions of " << nRows << " observations are consistent with the prediction" << std::endl;
+    return 0;
+}
+
+training::ResultPtr trainModel()
+{
+    /* Create Numeric Tables for training data and dependent variables */
+    NumericTablePtr trainData;
+    NumericTablePtr trainDependentVariable;
+
+    loadData(trainDatasetFileName, trainData, trainDependentVariable);
+
+    /* Create an algorithm object to train the gradient boosted trees regression model with the default method */
+    training::Batch<> algorithm;
+
+    /* Pass a training data set and dependent values to the algorithm */
+    algorithm.input.set(training::data, trainData);
+    algorithm.input.set(training::dependentVariable, trainDependentVariable);
+
+    algorithm.parameter().maxIterations = maxIterations;
+
+    /* Build the gradient boosted trees regression model */
+    checkStatus(algorithm.compute());
+
+    /* Retrieve the algorithm results */
+    return algorithm.getResult();
+}
+
+/* Replaces a value of every third observation with NaN, the categorical feature included */
+void addMissingValues(const NumericTablePtr & data)
+{
+    const size_t nRows = data->getNumberOfRows();
+    BlockDescriptor<float> block;
+    data->getBlockOfRows(0, nRows, readWrite, block);
+    float * values = block.getBlockPtr();
+    for (size_t i = 0; i < nRows; i += 3)
+    {
+        values[i * nFeatures + (i / 3) % nFeatures] = numeric_limits<float>::quiet_NaN();
+    }
+    data->releaseBlockOfRows(block);
+}
+
+vector<float> predict(const training::ResultPtr & trainingResult, const NumericTablePtr & data, DAAL_UINT64 resultsToCompute)
+{
+    /* Create an algorithm object to predict values of gradient boosted trees regression */
+    prediction::Batch<> algorithm;
+
+    /* Pass a testing data set and the trained model to the algorithm */
+    algorithm.input.set(prediction::data, data);
+    algorithm.input.set(prediction::model, trainingResult->get(training::model));
+    algorithm.parameter().resultsToCompute = resultsToCompute;
+
+    /* Predict values of gradient boosted trees regression */
+    checkStatus(algorithm.compute());
+
+    /* Retrieve the algorithm results */
+    NumericTablePtr predictionTable = algorithm.getResult()->get(prediction::prediction);
+    const size_t nRows              = predictionTable->getNumberOfRows();
+    const size_t nColumns           = predictionTable->getNumberOfColumns();
+
+    BlockDescriptor<float> block;
+    predictionTable->getBlockOfRows(0, nRows, readOnly, block);
+    vector<float> values(block.getBlockPtr(), block.getBlockPtr() + nRows * nColumns);
+    predictionTable->releaseBlockOfRows(block);
+    return values;
+}
+
+void loadData(const std::string & fileName, NumericTablePtr & pData, NumericTablePtr & pDependentVar)
+{
+    /* Initialize FileDataSource<CSVFeatureManager> to retrieve the input data from a .csv file */
+    FileDataSource<CSVFeatureManager> trainDataSource(fileName, DataSource::notAllocateNumericTable, DataSource::doDictionaryFromContext);
+
+    /* Create Numeric Tables for training data and dependent variables */
+    pData.reset(new HomogenNumericTable<>(nFeatures, 0, NumericTable::notAllocate));
+    pDependentVar.reset(new HomogenNumericTable<>(1, 0, NumericTable::notAllocate));
+    NumericTablePtr mergedData(new MergedNumericTable(pData, pDependentVar));
+
+    /* Retrieve the data from input file */
+    trainDataSource.loadDataBlock(mergedData.get());
+
+    NumericTableDictionaryPtr pDictionary = pData->getDictionarySharedPtr();
+    for (size_t i = 0, n = sizeof(categoricalFeaturesIndices) / sizeof(categoricalFeaturesIndices[0]); i < n; ++i)
+        (*pDictionary)[categoricalFeaturesIndices[i]].featureType = data_feature_utils::DAAL_CATEGORICAL;
+}
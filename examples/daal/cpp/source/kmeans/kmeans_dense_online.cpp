@@ -0,0 +1,83 @@
+/* file: kmeans_dense_online.cpp */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of dense mini-batch K-Means clustering in the online processing mode
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-KMEANS_DENSE_ONLINE"></a>
+ * \example kmeans_dense_online.cpp
+ */
+
+#include "daal.h"
+#include "service.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms;
+using namespace daal::data_management;
+
+/* Input data set parameters */
+string datasetFileName = "../data/batch/kmeans_dense.csv";
+
+const size_t nVectorsInBlock = 1000;
+
+/* K-Means algorithm parameters */
+const size_t nClusters = 20;
+
+int main(int argc, char * argv[])
+{
+    checkArguments(argc, argv, 1, &datasetFileName);
+
+    /* Initialize FileDataSource to retrieve the input data from a .csv file */
+    FileDataSource<CSVFeatureManager> dataSource(datasetFileName, DataSource::doAllocateNumericTable, DataSource::doDictionaryFromContext);
+
+    /* Create an algorithm object for the K-Means algorithm */
+    kmeans::Online<> algorithm(nClusters);
+
+    bool isInitialized = false;
+    /* The last block may be smaller than nVectorsInBlock */
+    while (dataSource.loadDataBlock(nVectorsInBlock) > 0)
+    {
+        /* Get initial clusters from the first block of data */
+        if (!isInitialized)
+        {
+            kmeans::init::Batch<float, kmeans::init::randomDense> init(nClusters);
+            init.input.set(kmeans::init::data, dataSource.getNumericTable());
+            init.compute();
+
+            algorithm.input.set(kmeans::inputCentroids, init.getResult()->get(kmeans::init::centroids));
+            isInitialized = true;
+        }
+
+        algorithm.input.set(kmeans::data, dataSource.getNumericTable());
+
+        /* Update the centroids with the new block of data */
+        algorithm.compute();
+    }
+
+    /* Get the current centroids */
+    algorithm.finalizeCompute();
+
+    /* Print the clusterization results */
+    printNumericTable(algorithm.getResult()->get(kmeans::centroids), "First 10 dimensions of centroids:", 20, 10);
+    printNumericTable(algorithm.getResult()->get(kmeans::objectiveFunction), "Objective function value:");
+
+    return 0;
+}
@@ -0,0 +1,229 @@
+/* file: kmeans_dense_online_uneven_blocks.cpp */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of dense mini-batch K-Means clustering in the online processing mode
+!    with blocks of data of different sizes. The example checks that the centroids are
+!    the means of all the observations assigned to them and that the objective function
+!    is accumulated over all the blocks
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-KMEANS_DENSE_ONLINE_UNEVEN_BLOCKS"></a>
+ * \example kmeans_dense_online_uneven_blocks.cpp
+ */
+
+#include "daal.h"
+#include "service.h"
+#include <cmath>
+#include <vector>
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms;
+using namespace daal::data_management;
+
+/* Input data set parameters */
+string datasetFileName = "../data/batch/kmeans_dense.csv";
+
+/* Sizes of the blocks of data, the sizes are repeated until the end of the file */
+const size_t blockSizes[] = { 1000, 37, 2500, 1, 999, 3 };
+const size_t nBlockSizes  = sizeof(blockSizes) / sizeof(blockSizes[0]);
+
+/* K-Means algorithm parameters */
+const size_t nClusters = 20;
+
+const double tolerance = 1e-3;
+
+bool isClose(double x, double y)
+{
+    return fabs(x - y) <= tolerance * (1.0 + fabs(y));
+}
+
+/* Reads the rows of a numeric table */
+vector<float> readRows(const NumericTablePtr & table)
+{
+    const size_t nRows = table->getNumberOfRows();
+    const size_t nCols = table->getNumberOfColumns();
+    BlockDescriptor<float> block;
+    table->getBlockOfRows(0, nRows, readOnly, block);
+    vector<float> rows(block.getBlockPtr(), block.getBlockPtr() + nRows * nCols);
+    table->releaseBlockOfRows(block);
+    return rows;
+}
+
+/* Sum of the squared distances from the observations to the nearest centroids */
+double computeObjective(const vector<float> & data, const vector<float> & centroids, size_t nFeatures)
+{
+    const size_t nRows = data.size() / nFeatures;
+    double objective   = 0.0;
+    for (size_t i = 0; i < nRows; i++)
+    {
+        double minDistance = -1.0;
+        for (size_t k = 0; k < nClusters; k++)
+        {
+            double distance = 0.0;
+            for (size_t j = 0; j < nFeatures; j++)
+            {
+                const double diff = data[i * nFeatures + j] - centroids[k * nFeatures + j];
+                distance += diff * diff;
+            }
+            if (minDistance < 0.0 || distance < minDistance)
+            {
+                minDistance = distance;
+            }
+        }
+        objective += minDistance;
+    }
+    return objective;
+}
+
+/* Current centroids computed from the partial results */
+vector<float> getCentroids(const kmeans::PartialResultPtr & partialResult, size_t nFeatures)
+{
+    const vector<float> counts = readRows(partialResult->get(kmeans::nObservations));
+    vector<float> centroids    = readRows(partialResult->get(kmeans::partialSums));
+    for (size_t k = 0; k < nClusters; k++)
+    {
+        for (size_t j = 0; j < nFeatures && counts[k] > 0; j++)
+        {
+            centroids[k * nFeatures + j] /= counts[k];
+        }
+    }
+    return centroids;
+}
+
+int main(int argc, char * argv[])
+{
+    checkArguments(argc, argv, 1, &datasetFileName);
+
+    /* Initialize FileDataSource to retrieve the input data from a .csv file */
+    FileDataSource<CSVFeatureManager> dataSource(datasetFileName, DataSource::doAllocateNumericTable, DataSource::doDictionaryFromContext);
+
+    /* Create an algorithm object for the K-Means algorithm that computes the assignments of every block */
+    kmeans::Online<> algorithm(nClusters);
+    algorithm.parameter().resultsToEvaluate = kmeans::computeCentroids | kmeans::computeAssignments | kmeans::computeExactObjectiveFunction;
+
+    size_t nFeatures = 0;
+    size_t nRowsRead = 0;
+    double objective = 0.0;
+    vector<double> expectedSums;
+    vector<size_t> expectedCounts(nClusters, 0);
+    vector<float> initialCentroids;
+    vector<float> centroids;
+
+    for (size_t iBlock = 0; dataSource.loadDataBlock(blockSizes[iBlock % nBlockSizes]) > 0; iBlock++)
+    {
+        const NumericTablePtr blockTable = dataSource.getNumericTable();
+        const size_t nRows               = blockTable->getNumberOfRows();
+        const vector<float> data         = readRows(blockTable);
+
+        if (iBlock == 0)
+        {
+            /* The last initial centroid is far from all the observations, so it is relocated after the first block */
+            nFeatures = blockTable->getNumberOfColumns();
+            initialCentroids.assign(data.begin(), data.begin() + nClusters * nFeatures);
+            for (size_t j = 0; j < nFeatures; j++)
+            {
+                initialCentroids[(nClusters - 1) * nFeatures + j] = 1e3f;
+            }
+            centroids = initialCentroids;
+            expectedSums.assign(nClusters * nFeatures, 0.0);
+            algorithm.input.set(kmeans::inputCentroids, HomogenNumericTable<float>::create(&initialCentroids[0], nFeatures, nClusters));
+        }
+        else
+        {
+            centroids = getCentroids(algorithm.getPartialResult(), nFeatures);
+        }
+        objective += computeObjective(data, centroids, nFeatures);
+
+        algorithm.input.set(kmeans::data, blockTable);
+
+        /* Update the centroids with the new block of data */
+        checkStatus(algorithm.compute());
+
+        NumericTablePtr assignmentsTable = algorithm.getPartialResult()->get(kmeans::partialAssignments);
+        if (assignmentsTable->getNumberOfRows() != nRows)
+        {
+            std::cout << "Assignments of block " << iBlock << " have a wrong number of rows" << std::endl;
+            return 1;
+        }
+
+        BlockDescriptor<int> assignmentsBlock;
+        assignmentsTable->getBlockOfRows(0, nRows, readOnly, assignmentsBlock);
+        const int * assignments = assignmentsBlock.getBlockPtr();
+        for (size_t i = 0; i < nRows; i++)
+        {
+            expectedCounts[assignments[i]]++;
+            for (size_t j = 0; j < nFeatures; j++)
+            {
+                expectedSums[assignments[i] * nFeatures + j] += data[i * nFeatures + j];
+            }
+        }
+        assignmentsTable->releaseBlockOfRows(assignmentsBlock);
+        nRowsRead += nRows;
+
+        /* Every observation is counted in exactly one cluster */
+        const vector<float> counts = readRows(algorithm.getPartialResult()->get(kmeans::nObservations));
+        for (size_t k = 0; k < nClusters; k++)
+        {
+            if (counts[k] != expectedCounts[k])
+            {
+                std::cout << "Cluster " << k << " has " << counts[k] << " observations after block " << iBlock << ", expected "
+                          << expectedCounts[k] << std::endl;
+                return 1;
+            }
+        }
+    }
+
+    /* Get the current centroids */
+    checkStatus(algorithm.finalizeCompute());
+    kmeans::ResultPtr result = algorithm.getResult();
+
+    printNumericTable(result->get(kmeans::centroids), "First 10 dimensions of centroids:", 20, 10);
+    printNumericTable(result->get(kmeans::objectiveFunction), "Objective function value:");
+
+    /* The centroids of non-empty clusters are the means of all the observations assigned to them */
+    const vector<float> finalCentroids = readRows(result->get(kmeans::centroids));
+    for (size_t k = 0; k < nClusters; k++)
+    {
+        for (size_t j = 0; j < nFeatures && expectedCounts[k] > 0; j++)
+        {
+            if (!isClose(finalCentroids[k * nFeatures + j], expectedSums[k * nFeatures + j] / expectedCounts[k]))
+            {
+                std::cout << "Centroid " << k << " is not the mean of its observations" << std::endl;
+                return 1;
+            }
+        }
+    }
+
+    if (expectedCounts[nClusters - 1] == 0)
+    {
+        std::cout << "The empty cluster was not relocated" << std::endl;
+        return 1;
+    }
+
+    if (!isClose(readRows(result->get(kmeans::objectiveFunction))[0], objective))
+    {
+        std::cout << "Objective function is not accumulated over " << nRowsRead << " observations" << std::endl;
+        return 1;
+    }
+
+    std::cout << "Processed " << nRowsRead << " observations in blocks of different sizes" << std::endl;
+    return 0;
+}
@@ -0,0 +1,230 @@
+/* file: log_reg_dense_batch_newton_cg.cpp */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of logistic regression training with the Newton conjugate
+!    gradient solver in the batch processing mode.
+!
+!    The program trains the binary and the multi-class logistic regression
+!    models with and without the intercept by the Newton conjugate gradient
+!    and the LBFGS solvers and checks that:
+!      - both solvers find the same coefficients of the models,
+!      - the Newton conjugate gradient solver does not change the objective
+!        function passed to it,
+!      - the Newton conjugate gradient solver rejects the objective function
+!        with the L1 penalty.
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-LOG_REG_DENSE_BATCH_NEWTON_CG"></a>
+ * \example log_reg_dense_batch_newton_cg.cpp
+ */
+
+#include "daal.h"
+#include "service.h"
+#include <cmath>
+#include <vector>
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms;
+using namespace daal::data_management;
+using namespace daal::algorithms::logistic_regression;
+
+/* Input data set parameters */
+const size_t nRows     = 2000;
+const size_t nFeatures = 4;
+
+/* Logistic regression training parameters */
+const float penaltyL2 = 0.01f;
+
+/* Optimization solvers parameters */
+const size_t nNewtonCGIterations = 100;
+const size_t nLBFGSIterations    = 1000;
+const double accuracyThreshold   = 1e-10;
+
+/* Maximal difference between the coefficients found by the solvers */
+const double tolerance = 1e-4;
+
+/* Features are uniform random values in [-1, 1], the class is the index of the largest noisy linear score */
+void generateData(size_t nClasses, vector<double> & x, vector<double> & y)
+{
+    x.resize(nRows * nFeatures);
+    y.resize(nRows);
+    unsigned int seed = 2021;
+    for (size_t i = 0; i < nRows; i++)
+    {
+        for (size_t j = 0; j < nFeatures; j++)
+        {
+            seed                 = seed * 1103515245u + 12345u;
+            x[i * nFeatures + j] = 2.0 * double((seed >> 8) & 0xFFFF) / 0x10000 - 1.0;
+        }
+
+        double maxScore = 0.0;
+        for (size_t c = 0; c < nClasses; c++)
+        {
+            seed         = seed * 1103515245u + 12345u;
+            double score = 2.0 * double((seed >> 8) & 0xFFFF) / 0x10000 - 1.0;
+            for (size_t j = 0; j < nFeatures; j++)
+            {
+                score += (double((c + j) % 3) - 1.0) * x[i * nFeatures + j];
+            }
+            if (c == 0 || score > maxScore)
+            {
+                maxScore = score;
+                y[i]     = double(c);
+            }
+        }
+    }
+}
+
+vector<double> train(const NumericTablePtr & data, const NumericTablePtr & labels, size_t nClasses, bool interceptFlag,
+                     const services::SharedPtr<optimization_solver::iterative_solver::Batch> & solver)
+{
+    training::Batch<double> algorithm(nClasses);
+    algorithm.input.set(classifier::training::data, data);
+    algorithm.input.set(classifier::training::labels, labels);
+    algorithm.parameter().interceptFlag      = interceptFlag;
+    algorithm.parameter().penaltyL2          = penaltyL2;
+    algorithm.parameter().optimizationSolver = solver;
+    checkStatus(algorithm.compute());
+
+    NumericTablePtr beta = algorithm.getResult()->get(classifier::training::model)->getBeta();
+    BlockDescriptor<double> block;
+    beta->getBlockOfRows(0, beta->getNumberOfRows(), readOnly, block);
+    vector<double> values(block.getBlockPtr(), block.getBlockPtr() + beta->getNumberOfRows() * beta->getNumberOfColumns());
+    beta->releaseBlockOfRows(block);
+
+    /* The multi-class model does not change if the same value is added to all the intercepts, so they are centered */
+    if (nClasses > 2 && interceptFlag)
+    {
+        double meanIntercept = 0.0;
+        for (size_t c = 0; c < nClasses; c++) meanIntercept += values[c * (nFeatures + 1)] / nClasses;
+        for (size_t c = 0; c < nClasses; c++) values[c * (nFeatures + 1)] -= meanIntercept;
+    }
+    return values;
+}
+
+bool checkSolvers(size_t nClasses, bool interceptFlag)
+{
+    vector<double> x, y;
+    generateData(nClasses, x, y);
+    NumericTablePtr data   = HomogenNumericTable<double>::create(&x[0], nFeatures, nRows);
+    NumericTablePtr labels = HomogenNumericTable<double>::create(&y[0], 1, nRows);
+
+    services::SharedPtr<optimization_solver::newton_cg::Batch<double> > newtonCG = optimization_solver::newton_cg::Batch<double>::create();
+    newtonCG->parameter().nIterations       = nNewtonCGIterations;
+    newtonCG->parameter().accuracyThreshold = accuracyThreshold;
+
+    /* The full batches and the curvature estimates on every iteration make LBFGS deterministic with the line search */
+    services::SharedPtr<optimization_solver::lbfgs::Batch<double> > lbfgs = optimization_solver::lbfgs::Batch<double>::create();
+    lbfgs->parameter.nIterations             = nLBFGSIterations;
+    lbfgs->parameter.accuracyThreshold       = accuracyThreshold;
+    lbfgs->parameter.batchSize               = nRows;
+    lbfgs->parameter.correctionPairBatchSize = nRows;
+    lbfgs->parameter.L                       = 1;
+
+    const vector<double> newtonCGBeta = train(data, labels, nClasses, interceptFlag, newtonCG);
+    const vector<double> lbfgsBeta    = train(data, labels, nClasses, interceptFlag, lbfgs);
+
+    double maxBeta = 0.0;
+    for (size_t i = 0; i < lbfgsBeta.size(); i++) maxBeta = fabs(lbfgsBeta[i]) > maxBeta ? fabs(lbfgsBeta[i]) : maxBeta;
+    for (size_t i = 0; i < lbfgsBeta.size(); i++)
+    {
+        if (fabs(newtonCGBeta[i] - lbfgsBeta[i]) > tolerance * (1.0 + maxBeta))
+        {
+            std::cout << "Coefficient " << i << " of the model with " << nClasses << " classes is " << newtonCGBeta[i]
+                      << " for the Newton conjugate gradient solver and " << lbfgsBeta[i] << " for the LBFGS solver" << std::endl;
+            return false;
+        }
+    }
+    return true;
+}
+
+/* The solver computes the full gradient at its own arguments, the settings of the objective function are kept */
+bool checkFunctionIsKept()
+{
+    vector<double> x, y;
+    generateData(2, x, y);
+
+    services::SharedPtr<optimization_solver::logistic_loss::Batch<double> > function =
+        optimization_solver::logistic_loss::Batch<double>::create(nRows);
+    function->input.set(optimization_solver::logistic_loss::data, HomogenNumericTable<double>::create(&x[0], nFeatures, nRows));
+    function->input.set(optimization_solver::logistic_loss::dependentVariables, HomogenNumericTable<double>::create(&y[0], 1, nRows));
+
+    int indices[]                          = { 0, 1, 2 };
+    NumericTablePtr batchIndices           = HomogenNumericTable<int>::create(indices, 3, 1);
+    NumericTablePtr argument               = HomogenNumericTable<double>::create(1, nFeatures + 1, NumericTable::doAllocate, 0.0);
+    function->parameter().batchIndices     = batchIndices;
+    function->parameter().resultsToCompute = optimization_solver::objective_function::value;
+    function->input.set(optimization_solver::logistic_loss::argument, argument);
+
+    optimization_solver::newton_cg::Batch<double> algorithm(function);
+    algorithm.input.set(optimization_solver::iterative_solver::inputArgument,
+                        HomogenNumericTable<double>::create(1, nFeatures + 1, NumericTable::doAllocate, 0.0));
+    checkStatus(algorithm.compute());
+
+    return function->parameter().batchIndices == batchIndices
+           && function->parameter().resultsToCompute == optimization_solver::objective_function::value
+           && function->input.get(optimization_solver::logistic_loss::argument) == argument;
+}
+
+/* The L1 penalty is not differentiable, the solver returns an error for it */
+bool checkPenaltyL1IsRejected()
+{
+    vector<double> x, y;
+    generateData(2, x, y);
+
+    services::SharedPtr<optimization_solver::logistic_loss::Batch<double> > function =
+        optimization_solver::logistic_loss::Batch<double>::create(nRows);
+    function->input.set(optimization_solver::logistic_loss::data, HomogenNumericTable<double>::create(&x[0], nFeatures, nRows));
+    function->input.set(optimization_solver::logistic_loss::dependentVariables, HomogenNumericTable<double>::create(&y[0], 1, nRows));
+    function->parameter().penaltyL1 = 0.1f;
+
+    optimization_solver::newton_cg::Batch<double> algorithm(function);
+    algorithm.input.set(optimization_solver::iterative_solver::inputArgument,
+                        HomogenNumericTable<double>::create(1, nFeatures + 1, NumericTable::doAllocate, 0.0));
+    return !algorithm.compute().ok();
+}
+
+int main(int argc, char * argv[])
+{
+    const size_t nClasses[] = { 2, 3 };
+    for (size_t iClasses = 0; iClasses < 2; iClasses++)
+    {
+        for (size_t iIntercept = 0; iIntercept < 2; iIntercept++)
+        {
+            if (!checkSolvers(nClasses[iClasses], iIntercept == 0)) return 1;
+        }
+    }
+
+    if (!checkFunctionIsKept())
+    {
+        std::cout << "The Newton conjugate gradient solver changes the objective function" << std::endl;
+        return 1;
+    }
+
+    if (!checkPenaltyL1IsRejected())
+    {
+        std::cout << "The Newton conjugate gradient solver accepts the objective function with the L1 penalty" << std::endl;
+        return 1;
+    }
+
+    std::cout << "The Newton conjugate gradient and the LBFGS solvers train the same logistic regression models" << std::endl;
+    return 0;
+}
@@ -0,0 +1,89 @@
+/* file: newton_cg_log_loss_dense_batch.cpp */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+/*
+!  Content:
+!    C++ example of the Newton conjugate gradient algorithm with logistic loss
+!    objective function
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-NEWTON_CG_LOG_LOSS_DENSE_BATCH"></a>
+ * \example newton_cg_log_loss_dense_batch.cpp
+ */
+
+#include "daal.h"
+#include "service.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms;
+using namespace daal::data_management;
+using namespace daal::algorithms::optimization_solver;
+
+string datasetFileName = "../data/batch/custom.csv";
+
+const size_t nIterations       = 100;
+const size_t nFeatures         = 4;
+const double accuracyThreshold = 1e-6;
+
+float initialPoint[nFeatures + 1] = { 1, 1, 1, 1, 1 };
+
+int main(int argc, char * argv[])
+{
+    checkArguments(argc, argv, 1, &datasetFileName);
+
+    /* Initialize FileDataSource<CSVFeatureManager> to retrieve the input data from a .csv file */
+    FileDataSource<CSVFeatureManager> dataSource(datasetFileName, DataSource::notAllocateNumericTable, DataSource::doDictionaryFromContext);
+
+    /* Create Numeric Tables for data and values for dependent variable */
+    daal::services::Status s;
+    NumericTablePtr data = HomogenNumericTable<>::create(nFeatures, 0, NumericTable::doNotAllocate, &s);
+    checkStatus(s);
+    NumericTablePtr dependentVariables = HomogenNumericTable<>::create(1, 0, NumericTable::doNotAllocate, &s);
+    checkStatus(s);
+    NumericTablePtr mergedData = MergedNumericTable::create(data, dependentVariables, &s);
+    checkStatus(s);
+
+    /* Retrieve the data from the input file */
+    dataSource.loadDataBlock(mergedData.get());
+    size_t nVectors = data.get() ? data->getNumberOfRows() : 1;
+    services::SharedPtr<logistic_loss::Batch<> > batch(new logistic_loss::Batch<>(nVectors));
+    batch->input.set(logistic_loss::data, data);
+    batch->input.set(logistic_loss::dependentVariables, dependentVariables);
+    batch->parameter().penaltyL2 = 0.1f;
+
+    /* Create objects to compute the Newton conjugate gradient result using the default method */
+    optimization_solver::newton_cg::Batch<> newtonCGAlgorithm(batch);
+
+    /* Set input objects for the Newton conjugate gradient algorithm */
+    newtonCGAlgorithm.input.set(optimization_solver::iterative_solver::inputArgument,
+                                HomogenNumericTable<>::create(initialPoint, 1, nFeatures + 1, &s));
+    checkStatus(s);
+    newtonCGAlgorithm.parameter().nIterations       = nIterations;
+    newtonCGAlgorithm.parameter().accuracyThreshold = accuracyThreshold;
+    newtonCGAlgorithm.parameter().globalization     = optimization_solver::newton_cg::trustRegion;
+
+    /* Compute the Newton conjugate gradient result */
+    s = newtonCGAlgorithm.compute();
+    checkStatus(s);
+
+    /* Print computed the Newton conjugate gradient result */
+    printNumericTable(newtonCGAlgorithm.getResult()->get(optimization_solver::iterative_solver::minimum), "Minimum:");
+    printNumericTable(newtonCGAlgorithm.getResult()->get(optimization_solver::iterative_solver::nIterations), "Number of iterations performed:");
+
+    return 0;
+}
@@ -0,0 +1,316 @@
+/* file: obj_func_csr_batch.cpp */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of the objective functions for the data sets in the CSR format
+!    in the batch processing mode.
+!
+!    The program computes the logistic loss, the cross-entropy loss and
+!    the mean squared error objective functions for the same data set stored
+!    in the CSR and in the dense formats and checks that:
+!      - the values, the gradients, the Hessians, the values of the non-smooth
+!        terms, the proximal projections and the Lipschitz constants agree
+!        for all the terms and for the batch of the terms, with and without
+!        the intercept, with and without the L1 and the L2 penalties,
+!      - the logistic regression models trained on the data set in the CSR and
+!        in the dense formats are the same.
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-OBJ_FUNC_CSR_BATCH"></a>
+ * \example obj_func_csr_batch.cpp
+ */
+
+#include "daal.h"
+#include "service.h"
+#include <cmath>
+#include <vector>
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms;
+using namespace daal::data_management;
+using namespace daal::algorithms::optimization_solver;
+
+/* Input data set parameters */
+const size_t nRows        = 1000;
+const size_t nFeatures    = 10;
+const size_t nClasses     = 3;
+const size_t nonZeroRatio = 3; /* About one value of three is not zero */
+const size_t batchStep    = 3; /* The batch contains every third term in the reversed order */
+
+/* Penalties of the objective functions */
+const float penaltyL1 = 0.05f;
+const float penaltyL2 = 0.1f;
+
+/* Maximal relative difference between the results for the CSR and the dense data sets */
+const double tolerance = 1e-9;
+
+const DAAL_UINT64 lossResults = objective_function::value | objective_function::gradient | objective_function::hessian
+                                | objective_function::nonSmoothTermValue | objective_function::proximalProjection
+                                | objective_function::lipschitzConstant;
+const DAAL_UINT64 resultFlags[] = { objective_function::value,
+                                    objective_function::gradient,
+                                    objective_function::hessian,
+                                    objective_function::nonSmoothTermValue,
+                                    objective_function::proximalProjection,
+                                    objective_function::lipschitzConstant };
+const objective_function::ResultId resultIds[] = { objective_function::valueIdx,
+                                                   objective_function::gradientIdx,
+                                                   objective_function::hessianIdx,
+                                                   objective_function::nonSmoothTermValueIdx,
+                                                   objective_function::proximalProjectionIdx,
+                                                   objective_function::lipschitzConstantIdx };
+const char * resultNames[] = { "value", "gradient", "Hessian", "non-smooth term value", "proximal projection", "Lipschitz constant" };
+const size_t nResults      = sizeof(resultIds) / sizeof(resultIds[0]);
+
+/* The data set in the CSR and in the dense formats with the dependent variables of the objective functions */
+struct DataSet
+{
+    vector<double> denseValues;
+    vector<double> csrValues;
+    vector<size_t> colIndices;
+    vector<size_t> rowOffsets;
+    vector<double> binaryLabels;
+    vector<double> labels;
+    vector<double> responses;
+
+    NumericTablePtr dense;
+    NumericTablePtr csr;
+};
+
+/* Features are uniform random values in [-1, 1], most of them are zeros. Every row has a non-zero value */
+void generateData(DataSet & dataSet)
+{
+    dataSet.denseValues.assign(nRows * nFeatures, 0.0);
+    dataSet.binaryLabels.resize(nRows);
+    dataSet.labels.resize(nRows);
+    dataSet.responses.resize(nRows);
+    dataSet.rowOffsets.push_back(1);
+
+    unsigned int seed = 2021;
+    for (size_t i = 0; i < nRows; i++)
+    {
+        double score = 0.0;
+        for (size_t j = 0; j < nFeatures; j++)
+        {
+            seed               = seed * 1103515245u + 12345u;
+            const bool isZero  = ((seed >> 16) % nonZeroRatio != 0) && (j != i % nFeatures);
+            seed               = seed * 1103515245u + 12345u;
+            const double value = 2.0 * double((seed >> 8) & 0xFFFF) / 0x10000 - 1.0;
+            if (isZero) continue;
+
+            dataSet.denseValues[i * nFeatures + j] = value;
+            dataSet.csrValues.push_back(value);
+            dataSet.colIndices.push_back(j + 1);
+            score += (double(j % 3) - 1.0) * value;
+        }
+        dataSet.rowOffsets.push_back(dataSet.csrValues.size() + 1);
+
+        seed                    = seed * 1103515245u + 12345u;
+        const double noise      = 2.0 * double((seed >> 8) & 0xFFFF) / 0x10000 - 1.0;
+        dataSet.binaryLabels[i] = (score + noise > 0.0) ? 1.0 : 0.0;
+        dataSet.labels[i]       = (score + noise > 0.5) ? 2.0 : ((score + noise > -0.5) ? 1.0 : 0.0);
+        dataSet.responses[i]    = score + 0.1 * noise;
+    }
+
+    dataSet.dense = HomogenNumericTable<double>::create(&dataSet.denseValues[0], nFeatures, nRows);
+    dataSet.csr   = CSRNumericTable::create(&dataSet.csrValues[0], &dataSet.colIndices[0], &dataSet.rowOffsets[0], nFeatures, nRows);
+}
+
+/* Reads the rows of a numeric table */
+vector<double> readRows(const NumericTablePtr & table)
+{
+    const size_t nTableRows = table->getNumberOfRows();
+    const size_t nCols      = table->getNumberOfColumns();
+    BlockDescriptor<double> block;
+    table->getBlockOfRows(0, nTableRows, readOnly, block);
+    vector<double> rows(block.getBlockPtr(), block.getBlockPtr() + nTableRows * nCols);
+    table->releaseBlockOfRows(block);
+    return rows;
+}
+
+/* Argument with some of the values less than the L1 penalty by the absolute value */
+NumericTablePtr createArgument(size_t nArguments)
+{
+    NumericTablePtr argument = HomogenNumericTable<double>::create(1, nArguments, NumericTable::doAllocate);
+    BlockDescriptor<double> block;
+    argument->getBlockOfRows(0, nArguments, writeOnly, block);
+    for (size_t i = 0; i < nArguments; i++)
+    {
+        block.getBlockPtr()[i] = 0.02 * (double(i % 7) - 3.0);
+    }
+    argument->releaseBlockOfRows(block);
+    return argument;
+}
+
+NumericTablePtr createBatchIndices()
+{
+    const size_t batchSize       = nRows / batchStep;
+    NumericTablePtr batchIndices = HomogenNumericTable<int>::create(batchSize, 1, NumericTable::doAllocate);
+    BlockDescriptor<int> block;
+    batchIndices->getBlockOfRows(0, 1, writeOnly, block);
+    for (size_t i = 0; i < batchSize; i++)
+    {
+        block.getBlockPtr()[i] = int(nRows - 1 - i * batchStep);
+    }
+    batchIndices->releaseBlockOfRows(block);
+    return batchIndices;
+}
+
+sum_of_functions::BatchPtr createFunction(const string & name, const NumericTablePtr & data, const DataSet & dataSet, bool interceptFlag,
+                                          float l1, float l2)
+{
+    if (name == "logistic loss")
+    {
+        services::SharedPtr<logistic_loss::Batch<double> > function = logistic_loss::Batch<double>::create(nRows);
+        function->input.set(logistic_loss::data, data);
+        function->input.set(logistic_loss::dependentVariables,
+                            HomogenNumericTable<double>::create(const_cast<double *>(&dataSet.binaryLabels[0]), 1, nRows));
+        function->parameter().interceptFlag = interceptFlag;
+        function->parameter().penaltyL1     = l1;
+        function->parameter().penaltyL2     = l2;
+        return function;
+    }
+    if (name == "cross-entropy loss")
+    {
+        services::SharedPtr<cross_entropy_loss::Batch<double> > function = cross_entropy_loss::Batch<double>::create(nClasses, nRows);
+        function->input.set(cross_entropy_loss::data, data);
+        function->input.set(cross_entropy_loss::dependentVariables,
+                            HomogenNumericTable<double>::create(const_cast<double *>(&dataSet.labels[0]), 1, nRows));
+        function->parameter().interceptFlag = interceptFlag;
+        function->parameter().penaltyL1     = l1;
+        function->parameter().penaltyL2     = l2;
+        return function;
+    }
+
+    /* The value, the gradient and the Hessian of the mean squared error do not depend on the intercept flag and the penalties */
+    services::SharedPtr<mse::Batch<double> > function(new mse::Batch<double>(nRows));
+    function->input.set(mse::data, data);
+    function->input.set(mse::dependentVariables, HomogenNumericTable<double>::create(const_cast<double *>(&dataSet.responses[0]), 1, nRows));
+    function->parameter().interceptFlag = interceptFlag;
+    return function;
+}
+
+objective_function::ResultPtr compute(const sum_of_functions::BatchPtr & function, const NumericTablePtr & argument,
+                                      const NumericTablePtr & batchIndices, DAAL_UINT64 resultsToCompute)
+{
+    function->sumOfFunctionsInput->set(sum_of_functions::argument, argument);
+    function->sumOfFunctionsParameter->batchIndices     = batchIndices;
+    function->sumOfFunctionsParameter->resultsToCompute = resultsToCompute;
+    checkStatus(function->compute());
+    return function->getResult();
+}
+
+bool checkFunction(const string & name, const DataSet & dataSet, size_t nArguments, DAAL_UINT64 resultsToCompute, bool interceptFlag, float l1,
+                   float l2, const NumericTablePtr & batchIndices)
+{
+    const NumericTablePtr argument = createArgument(nArguments);
+
+    /* The Lipschitz constant of the mean squared error is computed alone */
+    const DAAL_UINT64 resultsSets[] = { resultsToCompute & ~objective_function::lipschitzConstant,
+                                        resultsToCompute & objective_function::lipschitzConstant };
+    for (size_t iSet = 0; iSet < 2; iSet++)
+    {
+        if (!resultsSets[iSet]) continue;
+        objective_function::ResultPtr csrResult =
+            compute(createFunction(name, dataSet.csr, dataSet, interceptFlag, l1, l2), argument, batchIndices, resultsSets[iSet]);
+        objective_function::ResultPtr denseResult =
+            compute(createFunction(name, dataSet.dense, dataSet, interceptFlag, l1, l2), argument, batchIndices, resultsSets[iSet]);
+
+        for (size_t iResult = 0; iResult < nResults; iResult++)
+        {
+            if (!(resultsSets[iSet] & resultFlags[iResult])) continue;
+
+            const vector<double> csrValues   = readRows(csrResult->get(resultIds[iResult]));
+            const vector<double> denseValues = readRows(denseResult->get(resultIds[iResult]));
+            for (size_t i = 0; i < denseValues.size(); i++)
+            {
+                if (fabs(csrValues[i] - denseValues[i]) > tolerance * (1.0 + fabs(denseValues[i])))
+                {
+                    std::cout << "The " << resultNames[iResult] << " of the " << name << (interceptFlag ? " with" : " without")
+                              << " the intercept, penalties " << l1 << " and " << l2 << (batchIndices ? " for the batch" : "")
+                              << " differs for the CSR data set: " << csrValues[i] << " and " << denseValues[i] << std::endl;
+                    return false;
+                }
+            }
+        }
+    }
+    return true;
+}
+
+vector<double> trainLogisticRegression(const NumericTablePtr & data, const DataSet & dataSet)
+{
+    services::SharedPtr<optimization_solver::newton_cg::Batch<double> > solver = optimization_solver::newton_cg::Batch<double>::create();
+    solver->parameter().nIterations       = 100;
+    solver->parameter().accuracyThreshold = 1e-10;
+
+    logistic_regression::training::Batch<double> algorithm(nClasses);
+    algorithm.input.set(classifier::training::data, data);
+    algorithm.input.set(classifier::training::labels, HomogenNumericTable<double>::create(const_cast<double *>(&dataSet.labels[0]), 1, nRows));
+    algorithm.parameter().penaltyL2          = penaltyL2;
+    algorithm.parameter().optimizationSolver = solver;
+    checkStatus(algorithm.compute());
+    return readRows(algorithm.getResult()->get(classifier::training::model)->getBeta());
+}
+
+int main(int argc, char * argv[])
+{
+    DataSet dataSet;
+    generateData(dataSet);
+
+    const string names[]                 = { "logistic loss", "cross-entropy loss", "mean squared error" };
+    const size_t nArguments[]            = { nFeatures + 1, nClasses * (nFeatures + 1), nFeatures + 1 };
+    const DAAL_UINT64 resultsToCompute[] = { lossResults, lossResults,
+                                             objective_function::value | objective_function::gradient | objective_function::hessian
+                                                 | objective_function::lipschitzConstant };
+    const NumericTablePtr batchIndices[] = { NumericTablePtr(), createBatchIndices() };
+
+    for (size_t iFunction = 0; iFunction < 3; iFunction++)
+    {
+        for (size_t iBatch = 0; iBatch < 2; iBatch++)
+        {
+            for (size_t iIntercept = 0; iIntercept < 2; iIntercept++)
+            {
+                for (size_t iPenalty = 0; iPenalty < 2; iPenalty++)
+                {
+                    if (!checkFunction(names[iFunction], dataSet, nArguments[iFunction], resultsToCompute[iFunction], iIntercept == 0,
+                                       iPenalty ? penaltyL1 : 0.0f, iPenalty ? penaltyL2 : 0.0f, batchIndices[iBatch]))
+                    {
+                        return 1;
+                    }
+                }
+            }
+        }
+    }
+
+    const vector<double> csrBeta   = trainLogisticRegression(dataSet.csr, dataSet);
+    const vector<double> denseBeta = trainLogisticRegression(dataSet.dense, dataSet);
+    for (size_t i = 0; i < denseBeta.size(); i++)
+    {
+        if (fabs(csrBeta[i] - denseBeta[i]) > 1e-6 * (1.0 + fabs(denseBeta[i])))
+        {
+            std::cout << "Coefficient " << i << " of the logistic regression model trained on the CSR data set is " << csrBeta[i]
+                      << ", on the dense data set it is " << denseBeta[i] << std::endl;
+            return 1;
+        }
+    }
+
+    std::cout << "The objective functions and the logistic regression training agree for the CSR and the dense data sets" << std::endl;
+    return 0;
+}
@@ -0,0 +1,216 @@
+/* file: quantiles_dense_sketch_distr.cpp */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of the computation of quantiles with the sketch method
+!    in the batch and distributed processing modes.
+!
+!    The program generates the data of several local nodes and checks that:
+!      - the ranks of the quantiles computed in the batch processing mode
+!        differ from the quantile orders by less than the tolerance,
+!      - the partial results of the local nodes are restored from the archives
+!        without changes,
+!      - the quantiles merged on the master node from the restored partial results
+!        agree with the quantiles computed in the batch processing mode.
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-QUANTILES_DENSE_SKETCH_DISTRIBUTED"></a>
+ * \example quantiles_dense_sketch_distr.cpp
+ */
+
+#include "daal.h"
+#include "service.h"
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms;
+using namespace daal::data_management;
+
+/* Input data set parameters */
+const size_t nBlocks          = 4;
+const size_t nRowsInBlock     = 25000;
+const size_t nRows            = nBlocks * nRowsInBlock;
+const size_t nFeatures        = 3;
+const double quantileOrders[] = { 0.5, 0.95, 0.99 };
+const size_t nQuantileOrders  = sizeof(quantileOrders) / sizeof(quantileOrders[0]);
+
+/* Quantiles algorithm parameters */
+const size_t compression = 100;
+
+/* Maximal difference between the rank of a quantile and its order */
+const double rankTolerance = 1e-2;
+
+/* Reads the rows of a numeric table */
+template <typename T>
+vector<T> readRows(const NumericTablePtr & table)
+{
+    const size_t nTableRows = table->getNumberOfRows();
+    const size_t nCols      = table->getNumberOfColumns();
+    BlockDescriptor<T> block;
+    table->getBlockOfRows(0, nTableRows, readOnly, block);
+    vector<T> rows(block.getBlockPtr(), block.getBlockPtr() + nTableRows * nCols);
+    table->releaseBlockOfRows(block);
+    return rows;
+}
+
+/* The features are uniform, normal and exponential random values */
+void generateData(vector<float> & data)
+{
+    data.resize(nRows * nFeatures);
+    unsigned int seed = 2021;
+    for (size_t i = 0; i < nRows; i++)
+    {
+        double uniform[2];
+        for (size_t k = 0; k < 2; k++)
+        {
+            seed       = seed * 1103515245u + 12345u;
+            uniform[k] = (double((seed >> 8) & 0xFFFFFF) + 0.5) / 0x1000000;
+        }
+        data[i * nFeatures + 0] = float(uniform[0]);
+        data[i * nFeatures + 1] = float(sqrt(-2.0 * log(uniform[0])) * cos(6.283185307179586 * uniform[1]));
+        data[i * nFeatures + 2] = float(-log(uniform[1]));
+    }
+}
+
+/* Rank of the value among the sorted values of a feature divided by the number of values */
+double getRank(const vector<float> & sortedValues, float value)
+{
+    const size_t nLess        = lower_bound(sortedValues.begin(), sortedValues.end(), value) - sortedValues.begin();
+    const size_t nLessOrEqual = upper_bound(sortedValues.begin(), sortedValues.end(), value) - sortedValues.begin();
+    return 0.5 * (nLess + nLessOrEqual) / sortedValues.size();
+}
+
+/* Serializes the partial result into an archive and restores it */
+quantiles::PartialResultPtr serializeAndRestore(const quantiles::PartialResultPtr & partialResult)
+{
+    InputDataArchive inArch;
+    partialResult->serialize(inArch);
+
+    const size_t length = inArch.getSizeOfArchive();
+    vector<daal::byte> buffer(length);
+    inArch.copyArchiveToArray(&buffer[0], length);
+
+    OutputDataArchive outArch(&buffer[0], length);
+    quantiles::PartialResultPtr restored(new quantiles::PartialResult());
+    restored->deserialize(outArch);
+    return restored;
+}
+
+bool isRestored(const quantiles::PartialResultPtr & partialResult, const quantiles::PartialResultPtr & restored)
+{
+    return readRows<float>(restored->get(quantiles::sketchCentroids)) == readRows<float>(partialResult->get(quantiles::sketchCentroids))
+           && readRows<double>(restored->get(quantiles::sketchWeights)) == readRows<double>(partialResult->get(quantiles::sketchWeights))
+           && readRows<float>(restored->get(quantiles::partialMinimum)) == readRows<float>(partialResult->get(quantiles::partialMinimum))
+           && readRows<float>(restored->get(quantiles::partialMaximum)) == readRows<float>(partialResult->get(quantiles::partialMaximum));
+}
+
+/* Ranks of the quantiles, one row per feature */
+vector<double> getRanks(const vector<vector<float> > & sortedFeatures, const NumericTablePtr & quantilesTable)
+{
+    const vector<float> values = readRows<float>(quantilesTable);
+    vector<double> ranks(nFeatures * nQuantileOrders);
+    for (size_t j = 0; j < nFeatures; j++)
+    {
+        for (size_t k = 0; k < nQuantileOrders; k++)
+        {
+            ranks[j * nQuantileOrders + k] = getRank(sortedFeatures[j], values[j * nQuantileOrders + k]);
+        }
+    }
+    return ranks;
+}
+
+int main(int argc, char * argv[])
+{
+    vector<float> data;
+    generateData(data);
+
+    NumericTablePtr quantileOrdersTable = HomogenNumericTable<double>::create(const_cast<double *>(quantileOrders), nQuantileOrders, 1);
+
+    /* Compute the quantiles of the whole data set in the batch processing mode */
+    quantiles::Batch<float, quantiles::sketchDense> batchAlgorithm;
+    batchAlgorithm.input.set(quantiles::data, HomogenNumericTable<float>::create(&data[0], nFeatures, nRows));
+    batchAlgorithm.parameter.quantileOrders = quantileOrdersTable;
+    batchAlgorithm.parameter.compression    = compression;
+    checkStatus(batchAlgorithm.compute());
+
+    /* Compute the partial results on the local nodes and pass them to the master node through the archives */
+    quantiles::Distributed<step2Master, float, quantiles::sketchDense> masterAlgorithm;
+    masterAlgorithm.parameter.quantileOrders = quantileOrdersTable;
+    masterAlgorithm.parameter.compression    = compression;
+    for (size_t i = 0; i < nBlocks; i++)
+    {
+        quantiles::Distributed<step1Local, float, quantiles::sketchDense> localAlgorithm;
+        localAlgorithm.input.set(quantiles::data, HomogenNumericTable<float>::create(&data[i * nRowsInBlock * nFeatures], nFeatures, nRowsInBlock));
+        localAlgorithm.parameter.compression = compression;
+        checkStatus(localAlgorithm.compute());
+
+        const quantiles::PartialResultPtr partialResult = localAlgorithm.getPartialResult();
+        const quantiles::PartialResultPtr restored      = serializeAndRestore(partialResult);
+        if (!isRestored(partialResult, restored))
+        {
+            std::cout << "The partial result of node " << i << " is changed by the serialization" << std::endl;
+            return 1;
+        }
+        masterAlgorithm.input.add(quantiles::partialResults, restored);
+    }
+    checkStatus(masterAlgorithm.compute());
+    checkStatus(masterAlgorithm.finalizeCompute());
+
+    printNumericTable(batchAlgorithm.getResult()->get(quantiles::quantiles), "Quantiles computed in the batch processing mode:");
+    printNumericTable(masterAlgorithm.getResult()->get(quantiles::quantiles), "Quantiles computed in the distributed processing mode:");
+
+    /* Compare the ranks of the quantiles with the exact ranks */
+    vector<vector<float> > sortedFeatures(nFeatures, vector<float>(nRows));
+    for (size_t j = 0; j < nFeatures; j++)
+    {
+        for (size_t i = 0; i < nRows; i++)
+        {
+            sortedFeatures[j][i] = data[i * nFeatures + j];
+        }
+        sort(sortedFeatures[j].begin(), sortedFeatures[j].end());
+    }
+
+    const vector<double> batchRanks       = getRanks(sortedFeatures, batchAlgorithm.getResult()->get(quantiles::quantiles));
+    const vector<double> distributedRanks = getRanks(sortedFeatures, masterAlgorithm.getResult()->get(quantiles::quantiles));
+    for (size_t j = 0; j < nFeatures; j++)
+    {
+        for (size_t k = 0; k < nQuantileOrders; k++)
+        {
+            const double batchRank       = batchRanks[j * nQuantileOrders + k];
+            const double distributedRank = distributedRanks[j * nQuantileOrders + k];
+            if (fabs(batchRank - quantileOrders[k]) > rankTolerance)
+            {
+                std::cout << "Quantile " << quantileOrders[k] << " of feature " << j << " has rank " << batchRank << std::endl;
+                return 1;
+            }
+            if (fabs(distributedRank - batchRank) > rankTolerance)
+            {
+                std::cout << "Quantile " << quantileOrders[k] << " of feature " << j << " merged on the master node has rank " << distributedRank
+                          << ", the batch rank is " << batchRank << std::endl;
+                return 1;
+            }
+        }
+    }
+
+    std::cout << "Quantiles of " << nRows << " observations are computed with the rank error less than " << rankTolerance << std::endl;
+    return 0;
+}
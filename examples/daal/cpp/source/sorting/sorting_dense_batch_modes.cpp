@@ -0,0 +1,240 @@
+/* file: sorting_dense_batch_modes.cpp */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of the modes of the sorting algorithm in the batch processing mode.
+!
+!    The program sorts the data sets with equal values, NaN values and zeros of
+!    both signs in the ascending and descending orders and checks that:
+!      - the values are sorted, the NaN values are placed last in both orders,
+!        -0 and +0 are equal,
+!      - the equal values keep their order in the input data set,
+!      - the single precision radix sort and the double precision sort produce
+!        the same indices,
+!      - the selectTopK mode with k equal to the number of observations and
+!        the sortRows mode with one key column produce the same indices as
+!        the sortColumns mode,
+!      - the version 1.0 of the algorithm without the parameter sorts the
+!        values in the same way as the default sortColumns mode.
+!    The small data set is sorted column by column in parallel, every column
+!    of the large data set is sorted by several threads.
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-SORTING_BATCH_MODES"></a>
+ * \example sorting_dense_batch_modes.cpp
+ */
+
+#include "daal.h"
+#include "service.h"
+#include <cmath>
+#include <limits>
+#include <vector>
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms;
+using namespace daal::data_management;
+
+/* Input data set parameters */
+const size_t nFeatures   = 3;
+const size_t nSmallRows  = 1000;
+const size_t nLargeRows  = 100000;
+const size_t nNaNPeriod  = 13; /* Every 13th value of a column is NaN */
+const size_t nDistinct   = 17; /* Number of distinct values that are not NaN */
+const char * orderName[] = { "ascending", "descending" };
+
+/* Reads the rows of a numeric table */
+template <typename T>
+vector<T> readRows(const NumericTablePtr & table)
+{
+    const size_t nRows = table->getNumberOfRows();
+    const size_t nCols = table->getNumberOfColumns();
+    BlockDescriptor<T> block;
+    table->getBlockOfRows(0, nRows, readOnly, block);
+    vector<T> rows(block.getBlockPtr(), block.getBlockPtr() + nRows * nCols);
+    table->releaseBlockOfRows(block);
+    return rows;
+}
+
+/* Values (k - 8) / 2 with many ties, zeros of both signs and NaN values */
+vector<float> generateData(size_t nRows)
+{
+    vector<float> data(nRows * nFeatures);
+    unsigned int seed = 777;
+    for (size_t i = 0; i < nRows; i++)
+    {
+        for (size_t j = 0; j < nFeatures; j++)
+        {
+            seed        = seed * 1103515245u + 12345u;
+            float value = (float((seed >> 16) % nDistinct) - 8.0f) * 0.5f;
+            if (value == 0.0f && (seed & 0x100)) value = -0.0f;
+            if ((i + j) % nNaNPeriod == 0) value = numeric_limits<float>::quiet_NaN();
+            data[i * nFeatures + j] = value;
+        }
+    }
+    return data;
+}
+
+template <typename algorithmFPType>
+sorting::ResultPtr sort(const NumericTablePtr & data, sorting::SortingMode mode, sorting::SortOrder order)
+{
+    sorting::Batch<algorithmFPType> algorithm;
+    algorithm.input.set(sorting::data, data);
+    algorithm.parameter.mode             = mode;
+    algorithm.parameter.order            = order;
+    algorithm.parameter.k                = data->getNumberOfRows();
+    algorithm.parameter.resultsToCompute = sorting::computeSortedData | sorting::computeSortedIndices;
+    if (mode == sorting::sortRows)
+    {
+        algorithm.parameter.keyColumns.push_back(0);
+    }
+    checkStatus(algorithm.compute());
+    return algorithm.getResult();
+}
+
+/* Checks the sorted values and the indices of one column */
+template <typename algorithmFPType>
+bool checkColumn(const vector<float> & data, const vector<algorithmFPType> & sorted, const vector<int> & indices, size_t nRows, size_t j,
+                 sorting::SortOrder order)
+{
+    for (size_t i = 0; i < nRows; i++)
+    {
+        const float expected         = data[indices[i * nFeatures + j] * nFeatures + j];
+        const algorithmFPType actual = sorted[i * nFeatures + j];
+        if (!(actual == expected || (isnan(actual) && isnan(expected))))
+        {
+            std::cout << "Sorted value " << i << " of column " << j << " is not the value at its index" << std::endl;
+            return false;
+        }
+        if (i == 0) continue;
+
+        const algorithmFPType previous = sorted[(i - 1) * nFeatures + j];
+        const bool isEqual             = (previous == actual) || (isnan(previous) && isnan(actual));
+        if (isnan(previous) && !isnan(actual))
+        {
+            std::cout << "NaN value precedes value " << actual << " in column " << j << std::endl;
+            return false;
+        }
+        if (!isnan(actual) && !isEqual && ((order == sorting::ascending) != (previous < actual)))
+        {
+            std::cout << "Values " << previous << " and " << actual << " of column " << j << " are not in the " << orderName[order] << " order"
+                      << std::endl;
+            return false;
+        }
+        if (isEqual && indices[(i - 1) * nFeatures + j] >= indices[i * nFeatures + j])
+        {
+            std::cout << "Equal values of column " << j << " do not keep their order" << std::endl;
+            return false;
+        }
+    }
+    return true;
+}
+
+bool checkOrder(const vector<float> & data, size_t nRows, sorting::SortOrder order)
+{
+    const NumericTablePtr dataTable = HomogenNumericTable<float>::create(const_cast<float *>(&data[0]), nFeatures, nRows);
+
+    /* Single precision columns are sorted by the radix sort */
+    const sorting::ResultPtr floatResult = sort<float>(dataTable, sorting::sortColumns, order);
+    const vector<float> floatSorted      = readRows<float>(floatResult->get(sorting::sortedData));
+    const vector<int> floatIndices       = readRows<int>(floatResult->get(sorting::sortedIndices));
+
+    const sorting::ResultPtr doubleResult = sort<double>(dataTable, sorting::sortColumns, order);
+    const vector<double> doubleSorted     = readRows<double>(doubleResult->get(sorting::sortedData));
+    const vector<int> doubleIndices       = readRows<int>(doubleResult->get(sorting::sortedIndices));
+
+    for (size_t j = 0; j < nFeatures; j++)
+    {
+        if (!checkColumn<float>(data, floatSorted, floatIndices, nRows, j, order)) return false;
+        if (!checkColumn<double>(data, doubleSorted, doubleIndices, nRows, j, order)) return false;
+    }
+    if (floatIndices != doubleIndices)
+    {
+        std::cout << "Single and double precision sorts produce different indices" << std::endl;
+        return false;
+    }
+
+    /* All the observations are selected */
+    const sorting::ResultPtr topKResult = sort<float>(dataTable, sorting::selectTopK, order);
+    if (readRows<int>(topKResult->get(sorting::sortedIndices)) != floatIndices)
+    {
+        std::cout << "The selectTopK mode with k equal to the number of observations does not sort the columns" << std::endl;
+        return false;
+    }
+
+    /* The observations are sorted by the first column */
+    const vector<int> rowIndices = readRows<int>(sort<float>(dataTable, sorting::sortRows, order)->get(sorting::sortedIndices));
+    for (size_t i = 0; i < nRows; i++)
+    {
+        if (rowIndices[i] != floatIndices[i * nFeatures])
+        {
+            std::cout << "The sortRows mode with one key column does not sort the observations by the key" << std::endl;
+            return false;
+        }
+    }
+    return true;
+}
+
+/* The interface1::Batch does not set the parameter, the default one is used */
+bool checkInterface1(const vector<float> & data, size_t nRows)
+{
+    const NumericTablePtr dataTable = HomogenNumericTable<float>::create(const_cast<float *>(&data[0]), nFeatures, nRows);
+
+    sorting::interface1::Batch<float> algorithm;
+    algorithm.input.set(sorting::data, dataTable);
+    checkStatus(algorithm.compute());
+    const vector<float> sorted = readRows<float>(algorithm.getResult()->get(sorting::sortedData));
+
+    sorting::Batch<float> defaultAlgorithm;
+    defaultAlgorithm.input.set(sorting::data, dataTable);
+    checkStatus(defaultAlgorithm.compute());
+    const vector<float> expected = readRows<float>(defaultAlgorithm.getResult()->get(sorting::sortedData));
+
+    for (size_t i = 0; i < nRows * nFeatures; i++)
+    {
+        if (!(sorted[i] == expected[i] || (std::isnan(sorted[i]) && std::isnan(expected[i])))) return false;
+    }
+    return true;
+}
+
+int main(int argc, char * argv[])
+{
+    const size_t nRows[] = { nSmallRows, nLargeRows };
+    for (size_t iSize = 0; iSize < 2; iSize++)
+    {
+        const vector<float> data = generateData(nRows[iSize]);
+        for (size_t iOrder = 0; iOrder < 2; iOrder++)
+        {
+            const sorting::SortOrder order = sorting::SortOrder(iOrder);
+            if (!checkOrder(data, nRows[iSize], order))
+            {
+                std::cout << "Sorting of " << nRows[iSize] << " observations in the " << orderName[order] << " order failed" << std::endl;
+                return 1;
+            }
+        }
+        if (!checkInterface1(data, nRows[iSize]))
+        {
+            std::cout << "Sorting of " << nRows[iSize] << " observations without the parameter failed" << std::endl;
+            return 1;
+        }
+    }
+
+    std::cout << "All the sorting modes are stable and place NaN values last" << std::endl;
+    return 0;
+}
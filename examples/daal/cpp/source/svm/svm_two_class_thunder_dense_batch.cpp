@@ -82,6 +82,9 @@ void trainModel()
 
     algorithm.parameter.kernel = kernel;
 
+    /* Request the statistics of the kernel matrix cache to choose the cache size */
+    algorithm.parameter.resultsToCompute = svm::training::computeCacheStatistics;
+
     /* Pass a training data set and dependent values to the algorithm */
     algorithm.input.set(classifier::training::data, trainData);
     algorithm.input.set(classifier::training::labels, trainGroundTruth);
@@ -124,6 +127,7 @@ void testModel()
 
 void printResults()
 {
+    printNumericTable(trainingResult->get(svm::training::cacheStatistics), "Kernel matrix cache hits, misses and evictions:");
     printNumericTables<int, float>(testGroundTruth, predictionResult->get(classifier::prediction::prediction), "Ground truth\t",
                                    "Classification results", "SVM classification results (first 20 observations):", 20);
 }